@@ -0,0 +1,621 @@
+// BridgeCore.h
+// Platform-independent routing core of the ESP32 WiFi bridge
+//
+// Everything that decides where bytes go lives here:
+//   - WS command → Teensy → WS response matching
+//   - !BATCH validation and UART framing, async BATCH: result routing
+//   - UDP face-data forwarding (drop when the UART is busy)
+//   - STATE: / EVT: fan-out to all WS clients
+//   - Teensy RX line ring (SPSC, lock-free)
+//   - Latest-frame publishing and capture demand (stream/capture clients)
+//   - ROI snapshot cache (/capture crop/scale requests, see SnapshotCache.h)
+//
+// Hardware and network access goes through BridgeIO. The sketch implements
+// it on ESP-IDF/Arduino; host/bridge_host.cpp implements it on Linux with a
+// pty for the Teensy UART, loopback sockets for WiFi and a synthetic JPEG
+// source for the camera, so the same routing code can be load-tested on a PC.
+
+#ifndef BRIDGE_CORE_H
+#define BRIDGE_CORE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+
+#include "SnapshotCache.h"
+
+// ════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ════════════════════════════════════════════════════════════════
+
+// Teensy RX line ring (RX task → loop)
+#define TEENSY_LINE_MAX      1024   // Phase 1G: large QUERY responses
+#define TEENSY_RING_SLOTS    16     // Must be a power of two
+
+#define TEENSY_RESPONSE_TIMEOUT_MS 200
+
+// Batch command frames (!BATCH) — limits mirror AIBridge.h
+#define BATCH_MAX_COMMANDS          16
+#define BATCH_MAX_PAYLOAD           240
+#define BATCH_PER_CMD_ALLOWANCE_MS  1500   // smoothMoveTo-based commands block on the Teensy
+#define BATCH_REJECT_ECHO           "\"cmd\":\"BATCH#"   // Old firmware's unknown_command echo
+
+// Capture demand
+#define TARGET_FPS         15    // Default rate for a /stream client with no ?fps=
+#define IDLE_FPS           1     // Capture rate with no active consumer (0 = stop)
+#define MAX_FPS            30
+#define MAX_STREAM_CLIENTS 4
+#define CAPTURE_DEMAND_WINDOW_MS 3000   // /capture polling counts as demand this long
+#define CAPTURE_WAKE_WAIT_MS     200    // /capture out of idle waits this long for a fresh frame
+
+// ════════════════════════════════════════════════════════════════
+// PLATFORM INTERFACE
+// ════════════════════════════════════════════════════════════════
+
+class BridgeIO {
+public:
+    virtual ~BridgeIO() {}
+
+    // Time
+    virtual unsigned long nowMs() = 0;
+    virtual void sleepUs(unsigned long us) = 0;
+
+    // Teensy UART (TX; RX arrives through BridgeCore's line ring)
+    virtual void teensyWrite(const char* data, size_t len) = 0;
+    virtual void teensyFlush() = 0;
+    virtual bool lockUart(unsigned long timeoutMs) = 0;
+    virtual void unlockUart() = 0;
+
+    // WebSocket clients
+    virtual void wsSend(uint8_t client, const char* text) = 0;
+    virtual void wsBroadcast(const char* text) = 0;
+
+    // Frames — handles are opaque (camera_fb_t* on the ESP32)
+    virtual bool lockFrame(unsigned long timeoutMs) = 0;
+    virtual void unlockFrame() = 0;
+    virtual void releaseFrame(void* handle) = 0;
+    virtual uint8_t* allocFrameCopy(size_t len) = 0;
+    virtual void freeFrameCopy(uint8_t* copy) = 0;
+    virtual void wakeCapture() = 0;
+};
+
+// ════════════════════════════════════════════════════════════════
+// SHARED TYPES
+// ════════════════════════════════════════════════════════════════
+
+struct TeensyLine {
+    uint16_t len;
+    unsigned long rxMillis;
+    char text[TEENSY_LINE_MAX];
+};
+
+// Latest frame as handed to HTTP handlers
+struct FrameInfo {
+    size_t len;
+    uint32_t seq;
+    uint16_t width;
+    uint16_t height;
+};
+
+struct BridgeStats {
+    volatile unsigned long udpReceived;
+    volatile unsigned long wsMessagesIn;
+    volatile unsigned long wsMessagesOut;
+    volatile unsigned long framesSent;
+    volatile unsigned long uartDropped;        // Face packets dropped (UART busy)
+    volatile unsigned long batchesForwarded;
+    volatile unsigned long teensyLinesIn;      // Complete lines pushed into the ring
+    volatile unsigned long teensyRingDropped;  // Ring full — line discarded
+    volatile unsigned long teensyRxOverflows;  // UART FIFO/buffer/pattern queue overflow
+    volatile unsigned long teensyLinesTooLong; // Line longer than TEENSY_LINE_MAX
+    volatile unsigned long teensyOrphanLines;  // Response with no command waiting
+    volatile unsigned long snapshotHits;       // ROI /capture served from the cache
+    volatile unsigned long snapshotMisses;     // ROI /capture decoded and re-encoded
+};
+
+// ════════════════════════════════════════════════════════════════
+// BRIDGE CORE
+// ════════════════════════════════════════════════════════════════
+
+class BridgeCore {
+public:
+    BridgeStats stats;
+
+    // Runtime-adjustable capture rates (/control)
+    volatile uint8_t idleFps;
+    volatile uint8_t maxFps;
+    volatile uint8_t currentCaptureFps;
+
+    BridgeCore(BridgeIO* platform)
+        : idleFps(IDLE_FPS), maxFps(MAX_FPS), currentCaptureFps(IDLE_FPS),
+          io(platform), ringHead(0), ringTail(0),
+          latestHandle(nullptr), latestData(nullptr), latestLen(0),
+          latestWidth(0), latestHeight(0), frameSeq(0),
+          captureClientFps(0), lastCaptureRequest(0) {
+        memset((void*)&stats, 0, sizeof(stats));
+        pendingBatch.active = false;
+        pendingBatch.clientNum = 0;
+        pendingBatch.deadline = 0;
+        for (int i = 0; i < MAX_STREAM_CLIENTS; i++) streamClientFps[i] = 0;
+    }
+
+    // ============================================
+    // TEENSY RX RING — producer side (RX task only)
+    // ============================================
+
+    // Next free slot to read a line into, nullptr if the ring is full
+    TeensyLine* rxSlot() {
+        uint32_t head = ringHead.load(std::memory_order_relaxed);
+        uint32_t tail = ringTail.load(std::memory_order_acquire);
+        if (head - tail >= TEENSY_RING_SLOTS) return nullptr;
+        return &ring[head & (TEENSY_RING_SLOTS - 1)];
+    }
+
+    // Publish the slot from rxSlot() holding n raw bytes (terminator included)
+    void rxCommit(size_t n) {
+        uint32_t head = ringHead.load(std::memory_order_relaxed);
+        TeensyLine& slot = ring[head & (TEENSY_RING_SLOTS - 1)];
+
+        // Strip "\r\n"
+        while (n > 0 && (slot.text[n - 1] == '\n' || slot.text[n - 1] == '\r' || slot.text[n - 1] == ' ')) n--;
+        if (n == 0) return;  // Blank line
+        slot.text[n] = '\0';
+        slot.len = (uint16_t)n;
+        slot.rxMillis = io->nowMs();
+
+        ringHead.store(head + 1, std::memory_order_release);
+        stats.teensyLinesIn++;
+    }
+
+    // Copying variant for producers that already hold the line
+    bool pushTeensyLine(const char* data, size_t n) {
+        if (n >= TEENSY_LINE_MAX) {
+            stats.teensyLinesTooLong++;
+            return false;
+        }
+        TeensyLine* slot = rxSlot();
+        if (slot == nullptr) {
+            stats.teensyRingDropped++;
+            return false;
+        }
+        memcpy(slot->text, data, n);
+        rxCommit(n);
+        return true;
+    }
+
+    // ============================================
+    // TEENSY RX RING — consumer side (loop task only)
+    // ============================================
+
+    // Oldest complete line, or nullptr. Call releaseLine() once done with it.
+    TeensyLine* peekLine() {
+        uint32_t tail = ringTail.load(std::memory_order_relaxed);
+        uint32_t head = ringHead.load(std::memory_order_acquire);
+        if (tail == head) return nullptr;
+        return &ring[tail & (TEENSY_RING_SLOTS - 1)];
+    }
+
+    void releaseLine() {
+        uint32_t tail = ringTail.load(std::memory_order_relaxed);
+        ringTail.store(tail + 1, std::memory_order_release);
+    }
+
+    // Route unsolicited Teensy lines (STATE: broadcasts, EVT: edge events,
+    // BATCH: results). Returns true if the line was consumed and is not a
+    // command response.
+    bool routeTeensyLine(const char* line) {
+        if (strncmp(line, "STATE:", 6) == 0 || strncmp(line, "EVT:", 4) == 0) {
+            io->wsBroadcast(line);
+            return true;
+        }
+        if (strncmp(line, "BATCH:", 6) == 0) {
+            if (pendingBatch.active) {
+                pendingBatch.active = false;
+                io->wsSend(pendingBatch.clientNum, line);
+                stats.wsMessagesOut++;
+            }
+            return true;
+        }
+
+        // Firmware without !BATCH rejects the frame with unknown_command and
+        // echoes its first bytes, "cmd":"BATCH#...". Only the frame produces
+        // that echo, so it is the batch's answer wherever it lands among the
+        // replies to queued commands; relay it (as BATCH:) so the client can
+        // fall back to single commands.
+        if (line[0] == '{' && strstr(line, BATCH_REJECT_ECHO) != nullptr) {
+            if (pendingBatch.active) {
+                pendingBatch.active = false;
+                sendBatchReply(pendingBatch.clientNum, line);
+            }
+            return true;
+        }
+        return false;
+    }
+
+    // Pop complete lines queued by the RX task (e.g., STATE: broadcasts)
+    void pollTeensyLines() {
+        TeensyLine* line;
+        while ((line = peekLine()) != nullptr) {
+            // Forward STATE/EVT broadcasts and BATCH results to WebSocket clients.
+            // Anything else is a reply nobody is waiting for (command timed out).
+            if (!routeTeensyLine(line->text)) {
+                stats.teensyOrphanLines++;
+            }
+            releaseLine();
+        }
+    }
+
+    // Wait up to timeoutMs for a specific line (boot handshake)
+    bool waitForLine(const char* expected, unsigned long timeoutMs) {
+        unsigned long start = io->nowMs();
+        while (io->nowMs() - start < timeoutMs) {
+            TeensyLine* line = peekLine();
+            if (line == nullptr) {
+                io->sleepUs(10000);
+                continue;
+            }
+            bool match = (strcmp(line->text, expected) == 0);
+            releaseLine();
+            if (match) return true;
+        }
+        return false;
+    }
+
+    // ============================================
+    // TEENSY TX
+    // ============================================
+
+    // Write one line to the Teensy (same "\r\n" terminator as println)
+    void teensyWriteLine(const char* line) {
+        io->teensyWrite(line, strlen(line));
+        io->teensyWrite("\r\n", 2);
+    }
+
+    // ============================================
+    // WebSocket — Command bridge (PC ↔ Teensy)
+    // ============================================
+
+    void onWsConnected(uint8_t clientNum) {
+        io->wsSend(clientNum, "{\"ok\":true,\"msg\":\"bridge_ready\"}");
+    }
+
+    void onWsDisconnected(uint8_t clientNum) {
+        if (pendingBatch.active && pendingBatch.clientNum == clientNum) {
+            pendingBatch.active = false;  // Result has nowhere to go
+        }
+    }
+
+    void onWsText(uint8_t clientNum, const char* cmd) {
+        stats.wsMessagesIn++;
+
+        // Batch frames reply asynchronously (see routeTeensyLine)
+        if (strncmp(cmd, "!BATCH:", 7) == 0) {
+            handleBatch(clientNum, cmd + 7);
+            return;
+        }
+
+        // Phase 1E: UART mutex prevents interleaving with UDP face data
+        if (io->lockUart(300)) {
+            // Route anything already queued first, so a late reply to an
+            // earlier (timed-out) command is not taken as this one's
+            pollTeensyLines();
+
+            teensyWriteLine(cmd);
+            io->teensyFlush();
+
+            // Wait for response from Teensy (REC-4: fixed-size buffer)
+            // Lines come from the RX ring; unsolicited ones are routed
+            // on the way, the first other line is our response.
+            unsigned long waitStart = io->nowMs();
+            bool gotResponse = false;
+
+            while (io->nowMs() - waitStart < TEENSY_RESPONSE_TIMEOUT_MS) {
+                TeensyLine* line = peekLine();
+                if (line == nullptr) {
+                    io->sleepUs(100);
+                    continue;
+                }
+                if (!routeTeensyLine(line->text)) {
+                    memcpy(response, line->text, line->len + 1);
+                    gotResponse = true;
+                }
+                releaseLine();
+                if (gotResponse) break;
+            }
+
+            io->unlockUart();
+
+            if (gotResponse) {
+                io->wsSend(clientNum, response);
+            } else {
+                io->wsSend(clientNum, "{\"ok\":false,\"reason\":\"timeout\"}");
+            }
+        } else {
+            io->wsSend(clientNum, "{\"ok\":false,\"reason\":\"uart_busy\"}");
+        }
+        stats.wsMessagesOut++;
+    }
+
+    // !BATCH:c1|ms@c2|... — validate, then forward as one framed UART line:
+    //   !BATCH#count,checksum:payload   (checksum = byte sum mod 256, hex)
+    // The Teensy runs the entries (honoring delays) and replies once with
+    // BATCH:{...}. Every answer to a batch reaches the client as a BATCH:
+    // line, so it can wait for it while other commands come and go.
+    void handleBatch(uint8_t clientNum, const char* payload) {
+        if (pendingBatch.active) {
+            sendBatchReply(clientNum, "{\"ok\":false,\"reason\":\"batch_busy\"}");
+            return;
+        }
+
+        size_t len = strlen(payload);
+        if (len == 0 || len > BATCH_MAX_PAYLOAD) {
+            sendBatchReply(clientNum, "{\"ok\":false,\"reason\":\"too_long\"}");
+            return;
+        }
+
+        // Count entries and total delay (for the response deadline)
+        int count = 1;
+        unsigned long totalDelay = 0;
+        uint8_t sum = 0;
+        const char* entry = payload;
+        for (const char* p = payload; ; p++) {
+            if (*p == '|' || *p == '\0') {
+                // Entry is [entry, p) — optional "ms@" prefix
+                const char* at = (const char*)memchr(entry, '@', p - entry);
+                if (at != nullptr && at > entry) totalDelay += strtoul(entry, nullptr, 10);
+                if (*p == '\0') break;
+                count++;
+                entry = p + 1;
+            }
+            sum += (uint8_t)*p;
+        }
+
+        if (count > BATCH_MAX_COMMANDS) {
+            sendBatchReply(clientNum, "{\"ok\":false,\"reason\":\"too_many\"}");
+            return;
+        }
+
+        if (io->lockUart(300)) {
+            char frame[BATCH_MAX_PAYLOAD + 32];
+            snprintf(frame, sizeof(frame), "!BATCH#%d,%02X:%s", count, sum, payload);
+            teensyWriteLine(frame);
+            io->unlockUart();
+
+            pendingBatch.active = true;
+            pendingBatch.clientNum = clientNum;
+            pendingBatch.deadline = io->nowMs() + TEENSY_RESPONSE_TIMEOUT_MS + totalDelay
+                                    + (unsigned long)count * BATCH_PER_CMD_ALLOWANCE_MS;
+            stats.batchesForwarded++;
+        } else {
+            sendBatchReply(clientNum, "{\"ok\":false,\"reason\":\"uart_busy\"}");
+        }
+    }
+
+    // Expire a batch whose aggregated result never arrived
+    void checkBatchTimeout() {
+        if (pendingBatch.active && (long)(io->nowMs() - pendingBatch.deadline) > 0) {
+            pendingBatch.active = false;
+            sendBatchReply(pendingBatch.clientNum, "{\"ok\":false,\"reason\":\"batch_timeout\"}");
+        }
+    }
+
+    // ============================================
+    // UDP — Face data (PC → ESP32 → Teensy)
+    // ============================================
+
+    void forwardFaceData(const char* line) {
+        stats.udpReceived++;
+
+        // Phase 1E: UART mutex — if busy (command in progress), drop this frame.
+        // Next face data arrives in ~33ms — acceptable to drop one.
+        if (io->lockUart(5)) {
+            teensyWriteLine(line);
+            io->unlockUart();
+        } else {
+            stats.uartDropped++;
+        }
+    }
+
+    // ============================================
+    // FRAME PUBLISHING — capture task → HTTP handlers
+    // ============================================
+
+    // Replace the latest frame. Returns false (caller keeps ownership)
+    // if the frame lock could not be taken.
+    bool publishFrame(void* handle, const uint8_t* data, size_t len, uint16_t width, uint16_t height) {
+        if (!io->lockFrame(10)) return false;
+        void* old = latestHandle;
+        latestHandle = handle;
+        latestData = data;
+        latestLen = len;
+        latestWidth = width;
+        latestHeight = height;
+        frameSeq++;
+        io->unlockFrame();
+
+        if (old != nullptr) io->releaseFrame(old);
+        stats.framesSent++;
+        return true;
+    }
+
+    // Copy the latest frame so network I/O never holds the frame lock
+    // (WARN-1 fix). Caller frees the copy with BridgeIO::freeFrameCopy().
+    uint8_t* copyLatestFrame(FrameInfo& info, unsigned long lockTimeoutMs) {
+        uint8_t* copy = nullptr;
+        info.len = 0;
+        info.seq = 0;
+        info.width = 0;
+        info.height = 0;
+        if (!io->lockFrame(lockTimeoutMs)) return nullptr;
+        if (latestHandle != nullptr && latestLen > 0) {
+            copy = io->allocFrameCopy(latestLen);
+            if (copy != nullptr) {
+                memcpy(copy, latestData, latestLen);
+                info.len = latestLen;
+                info.seq = frameSeq;
+                info.width = latestWidth;
+                info.height = latestHeight;
+            }
+        }
+        io->unlockFrame();
+        return copy;
+    }
+
+    uint32_t frameSequence() { return frameSeq; }
+
+    // ============================================
+    // ROI SNAPSHOTS — cache of encoded crops, guarded by the frame lock
+    // ============================================
+
+    // Cached result for this request against frame seq, nullptr on a miss.
+    // Caller frees the copy with free().
+    uint8_t* lookupSnapshot(uint32_t seq, const SnapshotParams& params, size_t& len) {
+        uint8_t* jpeg = nullptr;
+        if (io->lockFrame(50)) {
+            jpeg = snapshots.lookup(seq, params, len);
+            io->unlockFrame();
+        }
+        if (jpeg != nullptr) stats.snapshotHits++;
+        else stats.snapshotMisses++;
+        return jpeg;
+    }
+
+    void storeSnapshot(uint32_t seq, const SnapshotParams& params, const uint8_t* jpeg, size_t len) {
+        if (io->lockFrame(50)) {
+            snapshots.store(seq, params, jpeg, len);
+            io->unlockFrame();
+        }
+    }
+
+    // ============================================
+    // CAPTURE DEMAND — who is watching, and how fast
+    // ============================================
+
+    // Clamp a requested rate to 1..maxFps (0 or less → fallback)
+    uint8_t clampFps(int requested, uint8_t fallback) {
+        int fps = (requested > 0) ? requested : fallback;
+        if (fps < 1) fps = 1;
+        if (fps > maxFps) fps = maxFps;
+        return (uint8_t)fps;
+    }
+
+    int registerStreamClient(uint8_t fps) {
+        for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+            if (streamClientFps[i] == 0) {
+                streamClientFps[i] = fps;
+                io->wakeCapture();  // Ramp up now
+                return i;
+            }
+        }
+        return -1;
+    }
+
+    void unregisterStreamClient(int slot) {
+        if (slot >= 0 && slot < MAX_STREAM_CLIENTS) streamClientFps[slot] = 0;
+    }
+
+    int activeStreamClients() {
+        int n = 0;
+        for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+            if (streamClientFps[i] != 0) n++;
+        }
+        return n;
+    }
+
+    // Fastest rate any active consumer asked for, 0 if nobody is watching
+    uint8_t demandedFps() {
+        uint8_t fps = 0;
+        for (int i = 0; i < MAX_STREAM_CLIENTS; i++) {
+            if (streamClientFps[i] > fps) fps = streamClientFps[i];
+        }
+        if (lastCaptureRequest != 0 && io->nowMs() - lastCaptureRequest < CAPTURE_DEMAND_WINDOW_MS
+            && captureClientFps > fps) {
+            fps = captureClientFps;
+        }
+        return fps;
+    }
+
+    // Rate the capture task should run at right now (0 = stay idle)
+    uint8_t updateCaptureFps() {
+        uint8_t demand = demandedFps();
+        uint8_t fps = (demand > 0) ? (demand < maxFps ? demand : maxFps) : idleFps;
+        currentCaptureFps = fps;
+        return fps;
+    }
+
+    // Polling /capture counts as demand. Rate comes from fpsHint (?fps=) or,
+    // failing that, from how often the endpoint is being hit. Coming out of
+    // idle, the held frame may be up to 1/idleFps old — wake the capture task
+    // and give it a moment to deliver a fresh one.
+    void noteCaptureRequest(int fpsHint) {
+        unsigned long now = io->nowMs();
+        bool wasIdle = (demandedFps() == 0);
+
+        if (fpsHint > 0) {
+            captureClientFps = clampFps(fpsHint, 1);
+        } else if (lastCaptureRequest != 0 && now - lastCaptureRequest < CAPTURE_DEMAND_WINDOW_MS) {
+            unsigned long interval = now - lastCaptureRequest;
+            if (interval < 1) interval = 1;
+            captureClientFps = clampFps((int)(1000UL / interval), 1);
+        } else {
+            captureClientFps = 1;
+        }
+        lastCaptureRequest = now;
+
+        if (wasIdle) {
+            uint32_t seq = frameSeq;
+            io->wakeCapture();
+            while (frameSeq == seq && io->nowMs() - now < CAPTURE_WAKE_WAIT_MS) io->sleepUs(5000);
+        }
+    }
+
+private:
+    BridgeIO* io;
+
+    // Teensy RX line ring — single producer (RX task), single consumer
+    // (loop task). Each index has exactly one writer, so acquire/release
+    // ordering is all the synchronization needed.
+    TeensyLine ring[TEENSY_RING_SLOTS];
+    std::atomic<uint32_t> ringHead;   // Next slot to fill (producer)
+    std::atomic<uint32_t> ringTail;   // Next slot to read (consumer)
+
+    // Command response scratch (loop task only)
+    char response[TEENSY_LINE_MAX];
+
+    // Pending batch — the aggregated BATCH: result arrives later as an
+    // unsolicited Teensy line and is routed back to the client that sent it
+    struct PendingBatch {
+        bool active;
+        uint8_t clientNum;
+        unsigned long deadline;
+    };
+    PendingBatch pendingBatch;
+
+    // Answer to a batch, prefixed like the Teensy's own results
+    void sendBatchReply(uint8_t clientNum, const char* json) {
+        char msg[TEENSY_LINE_MAX + 8];
+        snprintf(msg, sizeof(msg), "BATCH:%s", json);
+        io->wsSend(clientNum, msg);
+        stats.wsMessagesOut++;
+    }
+
+    // Latest frame (guarded by BridgeIO::lockFrame)
+    void* latestHandle;
+    const uint8_t* latestData;
+    size_t latestLen;
+    uint16_t latestWidth;
+    uint16_t latestHeight;
+    volatile uint32_t frameSeq;
+
+    SnapshotCache snapshots;
+
+    // Capture demand — written by HTTP handlers, read by the capture task
+    volatile uint8_t streamClientFps[MAX_STREAM_CLIENTS];   // 0 = free slot
+    volatile uint8_t captureClientFps;                      // Rate /capture pollers ask for
+    volatile unsigned long lastCaptureRequest;
+};
+
+#endif // BRIDGE_CORE_H
@@ -13,6 +13,20 @@
  *   - Phase 1E: UART mutex prevents interleaving of UDP face data and WS commands
  *   - Phase 1F: Dual-core architecture — HTTP/stream on core 0, WS+UDP on core 1
  *   - Phase 1G: 1024-byte Teensy RX buffer for large QUERY responses
+ *   - Batch frames: !BATCH:c1|ms@c2|... forwarded as one framed UART line,
+ *     answered with one aggregated result (no per-command round trips)
+ *   - UART RX task: ESP-IDF event queue with '\n' pattern detect fills a
+ *     lock-free SPSC line ring — no Teensy line is dropped or polled per byte
+ *   - Demand-driven capture: idle rate when nobody watches, fastest client's
+ *     requested rate otherwise; frame size / JPEG quality via /control
+ *   - Each /stream client runs in its own task, so several clients stream
+ *     at once and /capture, /control stay reachable while they do
+ *   - ROI snapshots: /capture crops and scales while decoding, re-encodes
+ *     only the requested region; repeats within a frame come from an LRU
+ *
+ * Routing logic (WS commands, batches, UDP forwarding, STATE/EVT fan-out, frame
+ * publishing) lives in BridgeCore.h; this sketch only binds it to ESP-IDF.
+ * host/ builds the same core as a Linux executable for load testing.
  *
  * Board: ESP32-S3 (Freenove ESP32-S3 WROOM CAM)
  * Camera: OV2640/OV3660
@@ -38,6 +52,10 @@
 #include "esp_task_wdt.h"
 #include "esp_system.h"          // For esp_reset_reason()
 #include "esp32-hal-psram.h"     // For ps_malloc()
+#include "driver/uart.h"         // UART event queue + pattern detect
+#include "esp_jpg_decode.h"      // Scaled JPEG decode with block callbacks (ROI)
+#include "img_converters.h"      // fmt2jpg() for ROI re-encode
+#include "BridgeCore.h"
 
 // ════════════════════════════════════════════════════════════════
 // CONFIGURATION
@@ -69,22 +87,28 @@ const char* WIFI_PASSWORD = "YOUR_WIFI_PASSWORD";
 #define TEENSY_TX_PIN 43
 #define TEENSY_RX_PIN 44
 #define TEENSY_BAUD   921600
-HardwareSerial TeensySerial(1);
+#define TEENSY_UART   UART_NUM_1
+
+// Teensy UART driver (line ring sizes are in BridgeCore.h)
+#define TEENSY_UART_RX_BUF   4096
+#define TEENSY_UART_TX_BUF   1024
+#define TEENSY_UART_QUEUE    32
 
 // Network
 #define HTTP_PORT     80
 #define WS_PORT       81
 #define UDP_PORT      8888
 
-// Timing
-#define TARGET_FPS         15
+// Timing (capture rates and batch limits are in BridgeCore.h)
 #define WDT_TIMEOUT_S      15
-#define TEENSY_RESPONSE_TIMEOUT_MS 200
 #define WIFI_RECONNECT_INTERVAL_MS 10000
 
 // MJPEG boundary
 #define MJPEG_BOUNDARY "buddyframe"
 
+// Per-client stream task (core 0, same priority as httpd)
+#define STREAM_TASK_STACK  6144
+
 // ════════════════════════════════════════════════════════════════
 // GLOBAL OBJECTS
 // ════════════════════════════════════════════════════════════════
@@ -96,23 +120,60 @@ WiFiUDP udp;
 // Phase 1E: UART mutex — prevents interleaving of UDP face data and WS commands
 SemaphoreHandle_t uartMutex;
 
-// Phase 1F: Frame mutex for shared camera frame
+// Phase 1F: Frame mutex for shared camera frame (frame itself is held by BridgeCore)
 SemaphoreHandle_t frameMutex;
-camera_fb_t* latestFrame = nullptr;
+TaskHandle_t captureTaskHandle = nullptr;
 
-// Phase 1G: Teensy RX buffer (1024 bytes for large QUERY responses)
-char teensyRxBuffer[1024];
-int teensyRxPos = 0;
+QueueHandle_t teensyUartQueue = nullptr;
 
 // UDP receive buffer
 char udpBuffer[256];
 
-// Statistics
-volatile unsigned long udpReceived = 0;
-volatile unsigned long wsMessagesIn = 0;
-volatile unsigned long wsMessagesOut = 0;
-volatile unsigned long framesSent = 0;
-volatile unsigned long uartDropped = 0;
+// ════════════════════════════════════════════════════════════════
+// BRIDGE CORE — ESP-IDF bindings
+// ════════════════════════════════════════════════════════════════
+
+class Esp32BridgeIO : public BridgeIO {
+public:
+    unsigned long nowMs() override { return millis(); }
+
+    void sleepUs(unsigned long us) override {
+        if (us >= 1000) delay(us / 1000);
+        else delayMicroseconds(us);
+    }
+
+    void teensyWrite(const char* data, size_t len) override {
+        uart_write_bytes(TEENSY_UART, data, len);
+    }
+
+    void teensyFlush() override { uart_wait_tx_done(TEENSY_UART, pdMS_TO_TICKS(20)); }
+
+    bool lockUart(unsigned long timeoutMs) override {
+        return xSemaphoreTake(uartMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+    }
+    void unlockUart() override { xSemaphoreGive(uartMutex); }
+
+    void wsSend(uint8_t client, const char* text) override { wsServer.sendTXT(client, text); }
+    void wsBroadcast(const char* text) override { wsServer.broadcastTXT(text); }
+
+    bool lockFrame(unsigned long timeoutMs) override {
+        return xSemaphoreTake(frameMutex, pdMS_TO_TICKS(timeoutMs)) == pdTRUE;
+    }
+    void unlockFrame() override { xSemaphoreGive(frameMutex); }
+
+    void releaseFrame(void* handle) override { esp_camera_fb_return((camera_fb_t*)handle); }
+
+    // Allocate from PSRAM (8MB available)
+    uint8_t* allocFrameCopy(size_t len) override { return (uint8_t*)ps_malloc(len); }
+    void freeFrameCopy(uint8_t* copy) override { free(copy); }
+
+    void wakeCapture() override {
+        if (captureTaskHandle) xTaskNotifyGive(captureTaskHandle);
+    }
+};
+
+Esp32BridgeIO bridgeIO;
+BridgeCore bridge(&bridgeIO);
 
 bool wifiConnected = false;
 
@@ -120,6 +181,89 @@ bool wifiConnected = false;
 volatile bool cameraPaused = false;
 
 
+// ════════════════════════════════════════════════════════════════
+// TEENSY UART — ESP-IDF driver, RX task and line ring
+// ════════════════════════════════════════════════════════════════
+
+bool initTeensyUart() {
+    uart_config_t cfg = {};
+    cfg.baud_rate  = TEENSY_BAUD;
+    cfg.data_bits  = UART_DATA_8_BITS;
+    cfg.parity     = UART_PARITY_DISABLE;
+    cfg.stop_bits  = UART_STOP_BITS_1;
+    cfg.flow_ctrl  = UART_HW_FLOWCTRL_DISABLE;
+    cfg.source_clk = UART_SCLK_APB;
+
+    if (uart_driver_install(TEENSY_UART, TEENSY_UART_RX_BUF, TEENSY_UART_TX_BUF,
+                            TEENSY_UART_QUEUE, &teensyUartQueue, 0) != ESP_OK) return false;
+    if (uart_param_config(TEENSY_UART, &cfg) != ESP_OK) return false;
+    if (uart_set_pin(TEENSY_UART, TEENSY_TX_PIN, TEENSY_RX_PIN,
+                     UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE) != ESP_OK) return false;
+
+    // One UART_PATTERN_DET event per '\n' — lines, not bytes
+    uart_enable_pattern_det_baud_intr(TEENSY_UART, '\n', 1, 9, 0, 0);
+    uart_pattern_queue_reset(TEENSY_UART, TEENSY_UART_QUEUE);
+    return true;
+}
+
+// Producer side: move one pattern-terminated line from the UART buffer
+// straight into the next free BridgeCore ring slot (no intermediate copy)
+void teensyRxReadLine() {
+    static char discard[128];
+
+    int pos = uart_pattern_pop_pos(TEENSY_UART);
+    if (pos < 0) {
+        // Pattern position queue overflowed — line boundaries are lost
+        bridge.stats.teensyRxOverflows++;
+        uart_flush_input(TEENSY_UART);
+        xQueueReset(teensyUartQueue);
+        return;
+    }
+
+    int remaining = pos + 1;  // Include the '\n'
+    TeensyLine* slot = bridge.rxSlot();
+    bool full = (slot == nullptr);
+    bool tooLong = remaining >= TEENSY_LINE_MAX;
+
+    if (full || tooLong) {
+        while (remaining > 0) {
+            int n = uart_read_bytes(TEENSY_UART, (uint8_t*)discard,
+                                    min(remaining, (int)sizeof(discard)), pdMS_TO_TICKS(10));
+            if (n <= 0) break;
+            remaining -= n;
+        }
+        if (full) bridge.stats.teensyRingDropped++;
+        else bridge.stats.teensyLinesTooLong++;
+        return;
+    }
+
+    int n = uart_read_bytes(TEENSY_UART, (uint8_t*)slot->text, remaining, pdMS_TO_TICKS(10));
+    if (n <= 0) return;
+    bridge.rxCommit(n);  // Strips "\r\n", stamps and publishes
+}
+
+// UART RX task — blocks on the driver event queue, never polls
+void uartRxTask(void* param) {
+    uart_event_t event;
+    while (true) {
+        if (xQueueReceive(teensyUartQueue, &event, portMAX_DELAY) != pdTRUE) continue;
+
+        switch (event.type) {
+            case UART_PATTERN_DET:
+                teensyRxReadLine();
+                break;
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                bridge.stats.teensyRxOverflows++;
+                uart_flush_input(TEENSY_UART);
+                xQueueReset(teensyUartQueue);
+                break;
+            default:
+                break;  // UART_DATA etc. — wait for the line terminator
+        }
+    }
+}
+
 // ════════════════════════════════════════════════════════════════
 // CAMERA INITIALIZATION
 // ════════════════════════════════════════════════════════════════
@@ -192,14 +336,24 @@ bool setupWiFi() {
     return true;
 }
 
+// ════════════════════════════════════════════════════════════════
+// CAPTURE DEMAND — bookkeeping is in BridgeCore
+// ════════════════════════════════════════════════════════════════
+
+// Requested rate from ?fps=, clamped to 1..maxFps
+uint8_t requestedFps(uint8_t fallback) {
+    int fps = httpServer.hasArg("fps") ? httpServer.arg("fps").toInt() : fallback;
+    return bridge.clampFps(fps, fallback);
+}
+
 // ════════════════════════════════════════════════════════════════
 // Phase 1F: CAPTURE TASK — Runs on core 0
-// Continuously captures frames and stores the latest
+// Captures at the rate consumers demand; idles at idleFps otherwise.
+// Sleeps on a task notification so a new client wakes it immediately.
 // ════════════════════════════════════════════════════════════════
 
 void captureTask(void* param) {
     esp_task_wdt_add(NULL);  // Register this task with watchdog (WARN-4)
-    unsigned long frameInterval = 1000 / TARGET_FPS;
     while (true) {
         esp_task_wdt_reset();  // Feed watchdog (WARN-4)
 
@@ -209,19 +363,121 @@ void captureTask(void* param) {
             continue;
         }
 
+        uint8_t fps = bridge.updateCaptureFps();
+
+        if (fps == 0) {
+            // Fully idle — wait for a consumer (bounded for the watchdog)
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(500));
+            continue;
+        }
+
         camera_fb_t* fb = esp_camera_fb_get();
-        if (fb) {
-            if (xSemaphoreTake(frameMutex, pdMS_TO_TICKS(10)) == pdTRUE) {
-                if (latestFrame) esp_camera_fb_return(latestFrame);
-                latestFrame = fb;
-                xSemaphoreGive(frameMutex);
-            } else {
-                esp_camera_fb_return(fb);  // Couldn't get mutex, discard
+        if (fb && !bridge.publishFrame(fb, fb->buf, fb->len, fb->width, fb->height)) {
+            esp_camera_fb_return(fb);  // Couldn't get mutex, discard
+        }
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000 / fps));
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// ROI SNAPSHOTS — crop/scale for /capture (see SnapshotCache.h)
+// The sensor only produces JPEG, so the crop is taken while decoding:
+// the decoder runs at the largest 1/2^n scale that still covers the
+// requested output and only pixels inside the box are kept. Only the
+// crop is re-encoded and sent.
+// ════════════════════════════════════════════════════════════════
+
+struct RoiDecoder {
+    const uint8_t* jpeg;
+    int cropX, cropY, cropW, cropH;   // In decoded (scaled) pixels
+    uint8_t* crop;                    // cropW * cropH * 3, BGR like jpg2rgb888()
+};
+
+size_t roiRead(void* arg, size_t index, uint8_t* buf, size_t len) {
+    RoiDecoder* d = (RoiDecoder*)arg;
+    if (buf) memcpy(buf, d->jpeg + index, len);
+    return len;
+}
+
+bool roiWrite(void* arg, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint8_t* data) {
+    if (!data) return true;  // Start / end of image
+    RoiDecoder* d = (RoiDecoder*)arg;
+
+    // Intersect this decoded block with the crop box
+    int x0 = max((int)x, d->cropX), x1 = min((int)x + (int)w, d->cropX + d->cropW);
+    int y0 = max((int)y, d->cropY), y1 = min((int)y + (int)h, d->cropY + d->cropH);
+    if (x0 >= x1 || y0 >= y1) return true;
+
+    for (int row = y0; row < y1; row++) {
+        const uint8_t* src = data + ((row - y) * w + (x0 - x)) * 3;
+        uint8_t* dst = d->crop + ((row - d->cropY) * d->cropW + (x0 - d->cropX)) * 3;
+        for (int col = x0; col < x1; col++, src += 3, dst += 3) {
+            dst[0] = src[2];
+            dst[1] = src[1];
+            dst[2] = src[0];
+        }
+    }
+    return true;
+}
+
+// Decode, crop, scale and re-encode one frame. params must be normalized.
+// Returns a JPEG to free(), or nullptr.
+uint8_t* encodeSnapshot(const uint8_t* jpeg, size_t jpegLen, const SnapshotParams& p, size_t& outLen) {
+    int scale = p.decodeScale();
+    RoiDecoder d;
+    d.jpeg = jpeg;
+    d.cropX = p.x / scale;
+    d.cropY = p.y / scale;
+    d.cropW = max(1, p.w / scale);
+    d.cropH = max(1, p.h / scale);
+    d.crop = (uint8_t*)ps_malloc((size_t)d.cropW * d.cropH * 3);
+    if (d.crop == nullptr) return nullptr;
+
+    jpg_scale_t jpgScale = (scale == 8) ? JPG_SCALE_8X : (scale == 4) ? JPG_SCALE_4X
+                         : (scale == 2) ? JPG_SCALE_2X : JPG_SCALE_NONE;
+    if (esp_jpg_decode(jpegLen, jpgScale, roiRead, roiWrite, &d) != ESP_OK) {
+        free(d.crop);
+        return nullptr;
+    }
+
+    // Nearest-neighbour down to the output size, in place (indices only shrink)
+    int outW = min(p.outW, d.cropW);
+    int outH = min(p.outH, d.cropH);
+    if (outW != d.cropW || outH != d.cropH) {
+        for (int oy = 0; oy < outH; oy++) {
+            int sy = oy * d.cropH / outH;
+            for (int ox = 0; ox < outW; ox++) {
+                int sx = ox * d.cropW / outW;
+                memmove(d.crop + (oy * outW + ox) * 3, d.crop + (sy * d.cropW + sx) * 3, 3);
             }
-            framesSent++;
         }
-        delay(frameInterval);
     }
+
+    uint8_t* out = nullptr;
+    bool ok = fmt2jpg(d.crop, (size_t)outW * outH * 3, outW, outH, PIXFORMAT_RGB888,
+                      p.quality, &out, &outLen);
+    free(d.crop);
+    if (!ok) {
+        free(out);
+        return nullptr;
+    }
+    return out;
+}
+
+// Any crop/scale/quality argument turns /capture into an ROI snapshot
+bool readSnapshotArgs(SnapshotParams& p) {
+    struct { const char* name; int* field; } args[] = {
+        {"x", &p.x}, {"y", &p.y}, {"w", &p.w}, {"h", &p.h},
+        {"out_w", &p.outW}, {"out_h", &p.outH}, {"quality", &p.quality},
+    };
+    bool any = false;
+    for (auto& a : args) {
+        if (httpServer.hasArg(a.name)) {
+            *a.field = httpServer.arg(a.name).toInt();
+            any = true;
+        }
+    }
+    return any;
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -229,98 +485,261 @@ void captureTask(void* param) {
 // ════════════════════════════════════════════════════════════════
 
 void handleHealth() {
-    char buf[256];
+    char buf[448];
     snprintf(buf, sizeof(buf),
-        "OK\nheap:%u\npsram:%u\nwifi:%d\nudp:%lu\nws_in:%lu\nws_out:%lu\nframes:%lu\nuptime:%lu",
+        "OK\nheap:%u\npsram:%u\nwifi:%d\nudp:%lu\nws_in:%lu\nws_out:%lu\nframes:%lu\nbatches:%lu\n"
+        "rx_lines:%lu\nrx_ring_drop:%lu\nrx_overflow:%lu\nrx_too_long:%lu\nrx_orphan:%lu\n"
+        "snap_hit:%lu\nsnap_miss:%lu\ncapture_fps:%u\nstream_clients:%d\nuptime:%lu",
         (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getFreePsram(),
         WiFi.status() == WL_CONNECTED ? 1 : 0,
-        udpReceived, wsMessagesIn, wsMessagesOut, framesSent, millis() / 1000);
+        bridge.stats.udpReceived, bridge.stats.wsMessagesIn, bridge.stats.wsMessagesOut,
+        bridge.stats.framesSent, bridge.stats.batchesForwarded,
+        bridge.stats.teensyLinesIn, bridge.stats.teensyRingDropped, bridge.stats.teensyRxOverflows,
+        bridge.stats.teensyLinesTooLong, bridge.stats.teensyOrphanLines,
+        bridge.stats.snapshotHits, bridge.stats.snapshotMisses,
+        (unsigned)bridge.currentCaptureFps, bridge.activeStreamClients(), millis() / 1000);
     httpServer.send(200, "text/plain", buf);
 }
 
+// /capture with crop/scale/quality arguments
+void sendSnapshot(const SnapshotParams& request) {
+    // Identical request against the frame already encoded → cached copy
+    size_t len;
+    uint8_t* jpeg = bridge.lookupSnapshot(bridge.frameSequence(), request, len);
+    const char* cacheState = "hit";
+
+    if (jpeg == nullptr) {
+        cacheState = "miss";
+        FrameInfo info;
+        uint8_t* frame = bridge.copyLatestFrame(info, 100);
+        if (frame == nullptr) {
+            httpServer.send(503, "text/plain", "No frame available");
+            return;
+        }
+
+        SnapshotParams p = request;
+        if (!p.normalize(info.width, info.height)) {
+            bridgeIO.freeFrameCopy(frame);
+            httpServer.send(400, "application/json", "{\"ok\":false,\"reason\":\"bad_roi\"}");
+            return;
+        }
+
+        esp_task_wdt_reset();
+        jpeg = encodeSnapshot(frame, info.len, p, len);
+        bridgeIO.freeFrameCopy(frame);
+        if (jpeg == nullptr) {
+            httpServer.send(500, "application/json", "{\"ok\":false,\"reason\":\"encode_failed\"}");
+            return;
+        }
+        bridge.storeSnapshot(info.seq, request, jpeg, len);
+    }
+
+    httpServer.sendHeader("Access-Control-Allow-Origin", "*");
+    httpServer.sendHeader("Cache-Control", "no-cache");
+    httpServer.sendHeader("X-Snapshot-Cache", cacheState);
+    httpServer.send_P(200, "image/jpeg", (const char*)jpeg, len);
+    free(jpeg);
+}
+
 void handleCapture() {
     esp_task_wdt_reset();
 
+    // Polling /capture counts as demand (rate from ?fps= or the polling interval)
+    bridge.noteCaptureRequest(httpServer.hasArg("fps") ? httpServer.arg("fps").toInt() : 0);
+
+    SnapshotParams roi;
+    if (readSnapshotArgs(roi)) {
+        sendSnapshot(roi);
+        return;
+    }
+
     // WARN-1 fix: Copy frame data before releasing mutex, then send from copy.
     // This prevents holding frameMutex during slow network I/O.
-    if (xSemaphoreTake(frameMutex, pdMS_TO_TICKS(100)) == pdTRUE) {
-        if (latestFrame != nullptr && latestFrame->len > 0) {
-            // Copy frame data while holding mutex (fast memcpy)
-            size_t len = latestFrame->len;
-            uint8_t* copy = (uint8_t*)ps_malloc(len);  // Allocate from PSRAM (8MB available)
-            if (copy) {
-                memcpy(copy, latestFrame->buf, len);
-                xSemaphoreGive(frameMutex);  // Release mutex BEFORE network IO
-
-                // Send from copy (slow network IO, mutex released)
-                httpServer.sendHeader("Access-Control-Allow-Origin", "*");
-                httpServer.sendHeader("Cache-Control", "no-cache");
-                httpServer.send_P(200, "image/jpeg", (const char*)copy, len);
-                free(copy);
-                return;
-            }
-        }
-        xSemaphoreGive(frameMutex);
+    FrameInfo info;
+    uint8_t* copy = bridge.copyLatestFrame(info, 100);
+    if (copy) {
+        httpServer.sendHeader("Access-Control-Allow-Origin", "*");
+        httpServer.sendHeader("Cache-Control", "no-cache");
+        httpServer.send_P(200, "image/jpeg", (const char*)copy, info.len);
+        bridgeIO.freeFrameCopy(copy);
+        return;
     }
     httpServer.send(503, "text/plain", "No frame available");
 }
 
+// WebServer runs one handler at a time, so a stream can't loop inside its
+// handler: that would hold every other request (and any second stream)
+// until it disconnects. The handler sends the headers and hands a copy of
+// the client to a task of its own; the copy keeps the socket open after
+// the handler returns.
+struct StreamClient {
+    WiFiClient client;
+    int slot;
+    uint8_t fps;
+};
+
+void streamTask(void* param) {
+    StreamClient* sc = (StreamClient*)param;
+    WiFiClient& client = sc->client;
+    esp_task_wdt_add(NULL);
+
+    uint32_t lastSentSeq = 0;
+    unsigned long frameInterval = 1000 / sc->fps;
+    unsigned long lastSendStart = 0;
+
+    while (client.connected()) {
+        esp_task_wdt_reset();
+
+        // Only send frames this client has not seen yet
+        if (bridge.frameSequence() == lastSentSeq) {
+            delay(5);
+            continue;
+        }
+
+        FrameInfo info;
+        uint8_t* copy = bridge.copyLatestFrame(info, 50);
+        if (copy) {
+            size_t len = info.len;
+            lastSentSeq = info.seq;
+            lastSendStart = millis();
+
+            // Send from copy (slow network IO, mutex released)
+            client.printf("--%s\r\n", MJPEG_BOUNDARY);
+            client.println("Content-Type: image/jpeg");
+            client.printf("Content-Length: %d\r\n", len);
+            client.println();
+            client.write(copy, len);
+            client.println();
+            bridgeIO.freeFrameCopy(copy);
+        }
+
+        // Pace to the requested rate (send time counts toward the interval)
+        unsigned long spent = millis() - lastSendStart;
+        if (spent < frameInterval) delay(frameInterval - spent);
+    }
+
+    client.stop();
+    bridge.unregisterStreamClient(sc->slot);
+    delete sc;
+    esp_task_wdt_delete(NULL);
+    vTaskDelete(NULL);
+}
+
 void handleStream() {
-    WiFiClient client = httpServer.client();
+    uint8_t fps = requestedFps(TARGET_FPS);
+    int slot = bridge.registerStreamClient(fps);
+    if (slot < 0) {
+        httpServer.send(503, "text/plain", "Too many stream clients");
+        return;
+    }
 
+    StreamClient* sc = new StreamClient{httpServer.client(), slot, fps};
+    WiFiClient& client = sc->client;
     client.println("HTTP/1.1 200 OK");
     client.printf("Content-Type: multipart/x-mixed-replace; boundary=%s\r\n", MJPEG_BOUNDARY);
     client.println("Access-Control-Allow-Origin: *");
     client.println("Cache-Control: no-cache");
     client.println();
 
-    unsigned long lastYield = millis();
+    if (xTaskCreatePinnedToCore(streamTask, "stream", STREAM_TASK_STACK, sc, 1, NULL, 0) != pdPASS) {
+        client.stop();
+        bridge.unregisterStreamClient(slot);
+        delete sc;
+    }
+}
 
-    while (client.connected()) {
-        esp_task_wdt_reset();
+// ════════════════════════════════════════════════════════════════
+// /control — runtime capture settings
+//   GET /control                         → current settings (JSON)
+//   GET /control?framesize=QVGA&quality=14&idle_fps=0&max_fps=20
+// Frame sizes are limited to VGA and below (buffers are sized at init).
+// ════════════════════════════════════════════════════════════════
 
-        if (xSemaphoreTake(frameMutex, pdMS_TO_TICKS(50)) == pdTRUE) {
-            if (latestFrame != nullptr && latestFrame->len > 0) {
-                // Copy frame data while holding mutex
-                size_t len = latestFrame->len;
-                uint8_t* copy = (uint8_t*)ps_malloc(len);
-                if (copy) {
-                    memcpy(copy, latestFrame->buf, len);
-                    xSemaphoreGive(frameMutex);
-
-                    // Send from copy (slow network IO, mutex released)
-                    client.printf("--%s\r\n", MJPEG_BOUNDARY);
-                    client.println("Content-Type: image/jpeg");
-                    client.printf("Content-Length: %d\r\n", len);
-                    client.println();
-                    client.write(copy, len);
-                    client.println();
-                    free(copy);
-                } else {
-                    xSemaphoreGive(frameMutex);
-                }
-            } else {
-                xSemaphoreGive(frameMutex);
-            }
+struct FrameSizeName {
+    const char* name;
+    framesize_t size;
+};
+
+const FrameSizeName FRAME_SIZE_NAMES[] = {
+    {"QQVGA", FRAMESIZE_QQVGA},   // 160x120
+    {"QVGA",  FRAMESIZE_QVGA},    // 320x240
+    {"CIF",   FRAMESIZE_CIF},     // 400x296
+    {"HVGA",  FRAMESIZE_HVGA},    // 480x320
+    {"VGA",   FRAMESIZE_VGA},     // 640x480
+};
+const int FRAME_SIZE_COUNT = sizeof(FRAME_SIZE_NAMES) / sizeof(FRAME_SIZE_NAMES[0]);
+
+void handleControl() {
+    sensor_t* sensor = esp_camera_sensor_get();
+    if (sensor == nullptr) {
+        httpServer.send(503, "application/json", "{\"ok\":false,\"reason\":\"no_sensor\"}");
+        return;
+    }
+
+    if (httpServer.hasArg("framesize")) {
+        String want = httpServer.arg("framesize");
+        int found = -1;
+        for (int i = 0; i < FRAME_SIZE_COUNT; i++) {
+            if (want.equalsIgnoreCase(FRAME_SIZE_NAMES[i].name)) { found = i; break; }
+        }
+        if (found < 0 || sensor->set_framesize(sensor, FRAME_SIZE_NAMES[found].size) != 0) {
+            httpServer.send(400, "application/json", "{\"ok\":false,\"reason\":\"bad_framesize\"}");
+            return;
+        }
+    }
+
+    if (httpServer.hasArg("quality")) {
+        int q = httpServer.arg("quality").toInt();
+        if (q < 4 || q > 63 || sensor->set_quality(sensor, q) != 0) {
+            httpServer.send(400, "application/json", "{\"ok\":false,\"reason\":\"bad_quality\"}");
+            return;
         }
+    }
 
-        // Yield to other HTTP handlers periodically
-        if (millis() - lastYield > 100) {
-            lastYield = millis();
-            delay(1);  // Allow httpServerTask to process other requests
+    if (httpServer.hasArg("idle_fps")) {
+        int v = httpServer.arg("idle_fps").toInt();
+        if (v < 0 || v > MAX_FPS) {
+            httpServer.send(400, "application/json", "{\"ok\":false,\"reason\":\"bad_idle_fps\"}");
+            return;
         }
+        bridge.idleFps = (uint8_t)v;
+    }
 
-        delay(1000 / TARGET_FPS);
+    if (httpServer.hasArg("max_fps")) {
+        int v = httpServer.arg("max_fps").toInt();
+        if (v < 1 || v > MAX_FPS) {
+            httpServer.send(400, "application/json", "{\"ok\":false,\"reason\":\"bad_max_fps\"}");
+            return;
+        }
+        bridge.maxFps = (uint8_t)v;
     }
+
+    bridgeIO.wakeCapture();  // Apply new rates now
+
+    const char* sizeName = "other";
+    for (int i = 0; i < FRAME_SIZE_COUNT; i++) {
+        if (sensor->status.framesize == FRAME_SIZE_NAMES[i].size) { sizeName = FRAME_SIZE_NAMES[i].name; break; }
+    }
+
+    char buf[192];
+    snprintf(buf, sizeof(buf),
+        "{\"ok\":true,\"framesize\":\"%s\",\"quality\":%d,\"idle_fps\":%u,"
+        "\"max_fps\":%u,\"capture_fps\":%u,\"stream_clients\":%d}",
+        sizeName, sensor->status.quality, (unsigned)bridge.idleFps, (unsigned)bridge.maxFps,
+        (unsigned)bridge.currentCaptureFps, bridge.activeStreamClients());
+    httpServer.sendHeader("Access-Control-Allow-Origin", "*");
+    httpServer.send(200, "application/json", buf);
 }
 
 void handleNotFound() {
     String msg = "Buddy ESP32 Bridge\n\n";
     msg += "Endpoints:\n";
     msg += "  GET /health   - Health check\n";
-    msg += "  GET /capture  - Single JPEG frame\n";
-    msg += "  GET /stream   - MJPEG stream\n";
-    msg += "  WS  :81       - WebSocket command bridge\n";
+    msg += "  GET /capture  - Single JPEG frame (?fps= polling rate hint)\n";
+    msg += "                  ROI: ?x=&y=&w=&h=&out_w=&out_h=&quality= (1-100)\n";
+    msg += "  GET /stream   - MJPEG stream (?fps= requested rate)\n";
+    msg += "  GET /control  - Capture settings (?framesize=&quality=&idle_fps=&max_fps=)\n";
+    msg += "  WS  :81       - WebSocket command bridge (!BATCH:c1|ms@c2 for lists)\n";
     msg += "  UDP :8888     - Face data receiver\n";
     httpServer.send(404, "text/plain", msg);
 }
@@ -343,71 +762,18 @@ void wsEvent(uint8_t clientNum, WStype_t type, uint8_t* payload, size_t length)
     switch (type) {
         case WStype_DISCONNECTED:
             Serial.printf("[WS] Client %u disconnected\n", clientNum);
+            bridge.onWsDisconnected(clientNum);
             break;
 
         case WStype_CONNECTED:
             Serial.printf("[WS] Client %u connected\n", clientNum);
-            wsServer.sendTXT(clientNum, "{\"ok\":true,\"msg\":\"bridge_ready\"}");
+            bridge.onWsConnected(clientNum);
             break;
 
-        case WStype_TEXT: {
-            wsMessagesIn++;
-            char* cmd = (char*)payload;
-
-            // Phase 1E: UART mutex prevents interleaving with UDP face data
-            if (xSemaphoreTake(uartMutex, pdMS_TO_TICKS(300)) == pdTRUE) {
-                // Clear UART RX buffer before sending command
-                while (TeensySerial.available()) TeensySerial.read();
-
-                TeensySerial.println(cmd);
-                TeensySerial.flush();
-
-                // Wait for response from Teensy (REC-4: fixed-size buffer)
-                unsigned long waitStart = millis();
-                char response[1024];
-                int responseLen = 0;
-                bool gotResponse = false;
-
-                while (millis() - waitStart < TEENSY_RESPONSE_TIMEOUT_MS) {
-                    while (TeensySerial.available()) {
-                        char c = TeensySerial.read();
-                        if (c == '\n') {
-                            gotResponse = true;
-                            break;
-                        }
-                        if (responseLen < (int)sizeof(response) - 1) {
-                            response[responseLen++] = c;
-                        }
-                    }
-                    if (gotResponse) break;
-                    delayMicroseconds(100);
-                }
-
-                xSemaphoreGive(uartMutex);
-
-                // Drain any stale face data that accumulated during mutex hold (REC-6)
-                // This data arrived while we were waiting for the QUERY response
-                // and is now old. Discard it so handleUDP processes fresh data next.
-                while (TeensySerial.available()) {
-                    TeensySerial.read();
-                }
-
-                if (gotResponse) {
-                    // Trim trailing \r if present
-                    while (responseLen > 0 && (response[responseLen - 1] == '\r' || response[responseLen - 1] == ' ')) {
-                        responseLen--;
-                    }
-                    response[responseLen] = '\0';
-                    wsServer.sendTXT(clientNum, response);
-                } else {
-                    wsServer.sendTXT(clientNum, "{\"ok\":false,\"reason\":\"timeout\"}");
-                }
-            } else {
-                wsServer.sendTXT(clientNum, "{\"ok\":false,\"reason\":\"uart_busy\"}");
-            }
-            wsMessagesOut++;
+        case WStype_TEXT:
+            // Blocks up to TEENSY_RESPONSE_TIMEOUT_MS for the Teensy's reply
+            bridge.onWsText(clientNum, (const char*)payload);
             break;
-        }
 
         default:
             break;
@@ -425,43 +791,9 @@ void handleUDP() {
     int len = udp.read(udpBuffer, sizeof(udpBuffer) - 1);
     if (len <= 0) return;
     udpBuffer[len] = '\0';
-    udpReceived++;
 
-    // Phase 1E: UART mutex — if busy (command in progress), drop this frame.
-    // Next face data arrives in ~33ms — acceptable to drop one.
-    if (xSemaphoreTake(uartMutex, pdMS_TO_TICKS(5)) == pdTRUE) {
-        TeensySerial.println(udpBuffer);
-        xSemaphoreGive(uartMutex);
-    } else {
-        uartDropped++;
-    }
-}
-
-// ════════════════════════════════════════════════════════════════
-// Check for unsolicited Teensy messages (STATE: broadcasts)
-// ════════════════════════════════════════════════════════════════
-
-void checkTeensyUnsolicited() {
-    // Read any unsolicited data from Teensy (e.g., STATE: broadcasts)
-    while (TeensySerial.available()) {
-        char c = TeensySerial.read();
-        if (c == '\n' || teensyRxPos >= (int)(sizeof(teensyRxBuffer) - 2)) {
-            // Phase 1G: Overflow protection
-            if (teensyRxPos >= (int)(sizeof(teensyRxBuffer) - 2)) {
-                teensyRxPos = 0;
-                continue;
-            }
-            teensyRxBuffer[teensyRxPos] = '\0';
-            teensyRxPos = 0;
-
-            // Forward STATE broadcasts to connected WebSocket clients
-            if (strncmp(teensyRxBuffer, "STATE:", 6) == 0) {
-                wsServer.broadcastTXT(teensyRxBuffer);
-            }
-        } else {
-            teensyRxBuffer[teensyRxPos++] = c;
-        }
-    }
+    // Dropped (and counted) if a command holds the UART
+    bridge.forwardFaceData(udpBuffer);
 }
 
 // ════════════════════════════════════════════════════════════════
@@ -507,7 +839,7 @@ void checkWiFi() {
 
             // Re-handshake with Teensy after reconnection
             for (int i = 0; i < 3; i++) {
-                TeensySerial.println("ESP32_READY");
+                bridge.teensyWriteLine("ESP32_READY");
                 delay(50);
             }
         } else if (reconnectAttempts >= 10) {
@@ -592,37 +924,35 @@ void setup() {
     Serial.println("[CAM] Camera initialized");
 
     // ═══ 3. UART THIRD — WiFi is stable, safe to receive data ═══
-    TeensySerial.setRxBufferSize(1024);
-    TeensySerial.begin(TEENSY_BAUD, SERIAL_8N1, TEENSY_RX_PIN, TEENSY_TX_PIN);
-    Serial.println("[UART] UART configured (921600 baud)");
+    if (!initTeensyUart()) {
+        Serial.println("[FATAL] UART driver install failed, rebooting...");
+        delay(1000);
+        ESP.restart();
+    }
+    Serial.println("[UART] UART configured (921600 baud, line-pattern RX)");
 
     // Drain any noise received while pins were floating
     delay(50);
-    while (TeensySerial.available()) TeensySerial.read();
+    uart_flush_input(TEENSY_UART);
+    uart_pattern_queue_reset(TEENSY_UART, TEENSY_UART_QUEUE);
+    xQueueReset(teensyUartQueue);
+
+    // RX task runs above capture/httpd priority so lines leave the
+    // driver buffer promptly; it only wakes on complete lines
+    xTaskCreatePinnedToCore(uartRxTask, "uart_rx", 4096, NULL, 3, NULL, 0);
 
     // ═══ 4. Handshake — tell Teensy to enable its TX pin ═══
     for (int i = 0; i < 5; i++) {
-        TeensySerial.println("ESP32_READY");
+        bridge.teensyWriteLine("ESP32_READY");
         delay(50);
     }
     Serial.println("[HANDSHAKE] Sent ESP32_READY (x5)");
 
     // Wait for Teensy acknowledgment
-    unsigned long hsStart = millis();
-    bool teensyReady = false;
-    while (millis() - hsStart < 3000) {
-        if (TeensySerial.available()) {
-            String line = TeensySerial.readStringUntil('\n');
-            line.trim();
-            if (line == "TEENSY_READY") {
-                teensyReady = true;
-                Serial.println("[HANDSHAKE] Teensy acknowledged — link active");
-                break;
-            }
-        }
-        delay(10);
-    }
-    if (!teensyReady) {
+    bool teensyReady = bridge.waitForLine("TEENSY_READY", 3000);
+    if (teensyReady) {
+        Serial.println("[HANDSHAKE] Teensy acknowledged — link active");
+    } else {
         Serial.println("[HANDSHAKE] No Teensy response (timeout) — continuing");
     }
 
@@ -634,6 +964,7 @@ void setup() {
     httpServer.on("/health", HTTP_GET, handleHealth);
     httpServer.on("/capture", HTTP_GET, handleCapture);
     httpServer.on("/stream", HTTP_GET, handleStream);
+    httpServer.on("/control", HTTP_GET, handleControl);
     httpServer.onNotFound(handleNotFound);
 
     if (wifiConnected) {
@@ -646,7 +977,7 @@ void setup() {
     esp_task_wdt_init(WDT_TIMEOUT_S, true);
     esp_task_wdt_add(NULL);
 
-    xTaskCreatePinnedToCore(captureTask, "capture", 8192, NULL, 1, NULL, 0);
+    xTaskCreatePinnedToCore(captureTask, "capture", 8192, NULL, 1, &captureTaskHandle, 0);
     xTaskCreatePinnedToCore(httpServerTask, "httpd", 8192, NULL, 1, NULL, 0);
 
     Serial.println("\n[READY] Bridge active");
@@ -673,8 +1004,11 @@ void loop() {
     // UDP face data forwarding
     handleUDP();
 
-    // Check for unsolicited Teensy messages
-    checkTeensyUnsolicited();
+    // Route Teensy lines queued by uartRxTask (no per-byte polling)
+    bridge.pollTeensyLines();
+
+    // Expire a batch whose aggregated result never arrived
+    bridge.checkBatchTimeout();
 
     // WiFi health check
     checkWiFi();
@@ -684,8 +1018,11 @@ void loop() {
     if (millis() - lastStatusLog > 60000) {
         lastStatusLog = millis();
         Serial.printf("[STATUS] UDP:%lu WS_in:%lu WS_out:%lu Frames:%lu Dropped:%lu Heap:%u\n",
-            udpReceived, wsMessagesIn, wsMessagesOut, framesSent, uartDropped,
-            (unsigned)ESP.getFreeHeap());
+            bridge.stats.udpReceived, bridge.stats.wsMessagesIn, bridge.stats.wsMessagesOut,
+            bridge.stats.framesSent, bridge.stats.uartDropped, (unsigned)ESP.getFreeHeap());
+        Serial.printf("[STATUS] RX lines:%lu ring_drop:%lu overflow:%lu too_long:%lu orphan:%lu\n",
+            bridge.stats.teensyLinesIn, bridge.stats.teensyRingDropped, bridge.stats.teensyRxOverflows,
+            bridge.stats.teensyLinesTooLong, bridge.stats.teensyOrphanLines);
     }
 
     delay(1);
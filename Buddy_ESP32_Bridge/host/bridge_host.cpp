@@ -0,0 +1,833 @@
+// bridge_host.cpp
+// Linux build of the ESP32 bridge for load testing
+//
+// Runs the sketch's BridgeCore with stand-ins for the hardware:
+//   Teensy UART  → pty (slave path printed at start; --sim spawns teensy_sim on it)
+//   WS :81       → TCP 127.0.0.1:8081, one command / response per line
+//   UDP :8888    → UDP 127.0.0.1:8888 (face data, unchanged)
+//   HTTP :80     → HTTP 127.0.0.1:8080 (/health /capture /stream /control)
+//   Camera       → synthetic JPEG (8x8 gray image padded with COM segments)
+//                  published as a 640x480 frame; ROI /capture requests go
+//                  through the real SnapshotCache, the "encode" only scales
+//                  the synthetic size by output area
+//
+// Threads mirror the ESP32 tasks: pty RX (uartRxTask), capture (captureTask),
+// one HTTP server thread answering requests one at a time like WebServer
+// (httpServerTask), one per /stream client once its headers are out
+// (streamTask) and main (loop — WS and UDP on core 1).
+//
+// Usage: ./bridge_host [--sim ./teensy_sim] [--ws-port N] [--http-port N]
+//                      [--udp-port N] [--frame-bytes N] [--baud N] [--status-s N]
+
+#include "../BridgeCore.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// ════════════════════════════════════════════════════════════════
+// CONFIGURATION
+// ════════════════════════════════════════════════════════════════
+
+#define HOST_WS_PORT        8081
+#define HOST_HTTP_PORT      8080
+#define HOST_UDP_PORT       8888
+#define HOST_FRAME_BYTES    20000    // Roughly a VGA JPEG at quality 12
+#define HOST_FRAME_W        640      // Nominal size reported for synthetic frames
+#define HOST_FRAME_H        480
+#define HOST_BAUD           921600   // Wire time charged on teensyFlush()
+#define HOST_MAX_WS_CLIENTS 8        // WebSocketsServer default
+#define MJPEG_BOUNDARY      "buddyframe"
+
+static std::atomic<bool> running(true);
+static std::atomic<size_t> frameBytes(HOST_FRAME_BYTES);
+
+static void onSignal(int) { running = false; }
+
+static bool writeAll(int fd, const void* data, size_t len) {
+    const uint8_t* p = (const uint8_t*)data;
+    while (len > 0) {
+        ssize_t n = send(fd, p, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == ENOTSOCK) n = write(fd, p, len);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN) {
+                // pty full (nobody reading) — give the reader a moment, then drop
+                pollfd pfd = {fd, POLLOUT, 0};
+                if (poll(&pfd, 1, 20) > 0) continue;
+            }
+            return false;
+        }
+        p += n;
+        len -= (size_t)n;
+    }
+    return true;
+}
+
+// ════════════════════════════════════════════════════════════════
+// SYNTHETIC CAMERA
+// ════════════════════════════════════════════════════════════════
+
+// Smallest useful baseline JPEG: one 8x8 gray block (DC = 0, EOB), single-code
+// Huffman tables. Frame number and padding go in COM segments after SOI.
+static const uint8_t JPEG_HEADER[] = {
+    0xFF, 0xDB, 0x00, 0x43, 0x00,                       // DQT, table 0, all ones
+    1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,
+    1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1, 1,1,1,1,1,1,1,1,
+    0xFF, 0xC0, 0x00, 0x0B, 0x08, 0x00, 0x08, 0x00, 0x08, // SOF0 8x8, 8-bit
+    0x01, 0x01, 0x11, 0x00,                             // 1 component, Y
+    0xFF, 0xC4, 0x00, 0x14, 0x00,                       // DHT DC0: one 1-bit code → 0
+    0x01, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0x00,
+    0xFF, 0xC4, 0x00, 0x14, 0x10,                       // DHT AC0: one 1-bit code → EOB
+    0x01, 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, 0x00,
+    0xFF, 0xDA, 0x00, 0x08, 0x01, 0x01, 0x00, 0x00, 0x3F, 0x00, // SOS
+    0x3F,                                               // "0" DC, "0" EOB, 1-padding
+    0xFF, 0xD9                                          // EOI
+};
+
+struct SyntheticFrame {
+    std::vector<uint8_t> data;
+};
+
+static void buildFrame(std::vector<uint8_t>& out, uint32_t frameNum, unsigned long ms, size_t target) {
+    out.clear();
+    out.push_back(0xFF);
+    out.push_back(0xD8);
+
+    char tag[64];
+    int tagLen = snprintf(tag, sizeof(tag), "buddy-host frame=%u ms=%lu", frameNum, ms);
+
+    // COM segments: FF FE, 2-byte length, body (each at most 65533 body bytes)
+    size_t fixed = 2 + sizeof(JPEG_HEADER);
+    size_t pad = (target > fixed + 4 + tagLen) ? target - fixed : 4 + tagLen;
+    bool first = true;
+    while (pad >= 4) {
+        size_t body = pad - 4;
+        if (body > 65533) body = 65533;
+        size_t rest = pad - (body + 4);
+        if (rest > 0 && rest < 4) body -= 4;  // Leave room for a complete last segment
+        out.push_back(0xFF);
+        out.push_back(0xFE);
+        out.push_back((uint8_t)((body + 2) >> 8));
+        out.push_back((uint8_t)((body + 2) & 0xFF));
+        size_t start = out.size();
+        out.resize(start + body, '.');
+        if (first) memcpy(&out[start], tag, (size_t)tagLen < body ? (size_t)tagLen : body);
+        first = false;
+        pad -= body + 4;
+    }
+    out.insert(out.end(), JPEG_HEADER, JPEG_HEADER + sizeof(JPEG_HEADER));
+}
+
+// ════════════════════════════════════════════════════════════════
+// HOST BINDINGS
+// ════════════════════════════════════════════════════════════════
+
+class HostBridgeIO : public BridgeIO {
+public:
+    int ptyMaster;
+    unsigned long baud;
+
+    HostBridgeIO() : ptyMaster(-1), baud(HOST_BAUD), unflushed(0), wakePending(false) {
+        for (int i = 0; i < HOST_MAX_WS_CLIENTS; i++) wsFds[i] = -1;
+    }
+
+    unsigned long nowMs() override {
+        using namespace std::chrono;
+        return (unsigned long)duration_cast<milliseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    void sleepUs(unsigned long us) override { usleep(us); }
+
+    void teensyWrite(const char* data, size_t len) override {
+        if (writeAll(ptyMaster, data, len)) unflushed += len;
+    }
+
+    // uart_wait_tx_done() equivalent: the pty has no wire, so charge 10 bits
+    // per byte written since the last flush
+    void teensyFlush() override {
+        if (baud > 0 && unflushed > 0) usleep((useconds_t)(unflushed * 10ULL * 1000000ULL / baud));
+        unflushed = 0;
+    }
+
+    bool lockUart(unsigned long timeoutMs) override {
+        return uartMutex.try_lock_for(std::chrono::milliseconds(timeoutMs));
+    }
+    void unlockUart() override { uartMutex.unlock(); }
+
+    void wsSend(uint8_t client, const char* text) override {
+        std::lock_guard<std::mutex> lock(wsMutex);
+        if (client < HOST_MAX_WS_CLIENTS && wsFds[client] >= 0) sendWsLine(wsFds[client], text);
+    }
+
+    void wsBroadcast(const char* text) override {
+        std::lock_guard<std::mutex> lock(wsMutex);
+        for (int i = 0; i < HOST_MAX_WS_CLIENTS; i++) {
+            if (wsFds[i] >= 0) sendWsLine(wsFds[i], text);
+        }
+    }
+
+    bool lockFrame(unsigned long timeoutMs) override {
+        return frameMutex.try_lock_for(std::chrono::milliseconds(timeoutMs));
+    }
+    void unlockFrame() override { frameMutex.unlock(); }
+
+    void releaseFrame(void* handle) override { delete (SyntheticFrame*)handle; }
+    uint8_t* allocFrameCopy(size_t len) override { return (uint8_t*)malloc(len); }
+    void freeFrameCopy(uint8_t* copy) override { free(copy); }
+
+    void wakeCapture() override {
+        std::lock_guard<std::mutex> lock(wakeMutex);
+        wakePending = true;
+        wakeCv.notify_one();
+    }
+
+    // ulTaskNotifyTake() equivalent
+    void waitWake(unsigned long timeoutMs) {
+        std::unique_lock<std::mutex> lock(wakeMutex);
+        wakeCv.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this] { return wakePending; });
+        wakePending = false;
+    }
+
+    // WS client table (slot index = client number)
+    int addWsClient(int fd) {
+        std::lock_guard<std::mutex> lock(wsMutex);
+        for (int i = 0; i < HOST_MAX_WS_CLIENTS; i++) {
+            if (wsFds[i] < 0) { wsFds[i] = fd; return i; }
+        }
+        return -1;
+    }
+
+    void removeWsClient(int client) {
+        std::lock_guard<std::mutex> lock(wsMutex);
+        if (wsFds[client] >= 0) close(wsFds[client]);
+        wsFds[client] = -1;
+    }
+
+private:
+    size_t unflushed;
+    std::timed_mutex uartMutex;
+    std::timed_mutex frameMutex;
+    std::mutex wakeMutex;
+    std::condition_variable wakeCv;
+    bool wakePending;
+    std::mutex wsMutex;
+    int wsFds[HOST_MAX_WS_CLIENTS];   // -1 = free
+
+    // One write per message — a separate "\n" write would sit behind Nagle
+    // waiting for the client's delayed ACK
+    static void sendWsLine(int fd, const char* text) {
+        std::string line(text);
+        line += '\n';
+        writeAll(fd, line.data(), line.size());
+    }
+};
+
+static HostBridgeIO hostIO;
+static BridgeCore bridge(&hostIO);
+
+// ════════════════════════════════════════════════════════════════
+// PTY RX THREAD — stands in for uartRxTask
+// ════════════════════════════════════════════════════════════════
+
+static void ptyRxThread() {
+    char chunk[512];
+    char line[TEENSY_LINE_MAX];
+    size_t len = 0;
+    bool discarding = false;
+
+    while (running) {
+        pollfd pfd = {hostIO.ptyMaster, POLLIN, 0};
+        if (poll(&pfd, 1, 100) <= 0) continue;
+        ssize_t n = read(hostIO.ptyMaster, chunk, sizeof(chunk));
+        if (n <= 0) {
+            if (n < 0 && errno != EAGAIN && errno != EINTR) usleep(10000);  // EIO: no Teensy side yet
+            continue;
+        }
+
+        for (ssize_t i = 0; i < n; i++) {
+            char c = chunk[i];
+            if (discarding) {
+                if (c == '\n') discarding = false;
+                continue;
+            }
+            if (len >= TEENSY_LINE_MAX - 1) {
+                bridge.stats.teensyLinesTooLong++;
+                len = 0;
+                discarding = (c != '\n');
+                continue;
+            }
+            line[len++] = c;
+            if (c == '\n') {
+                bridge.pushTeensyLine(line, len);
+                len = 0;
+            }
+        }
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// CAPTURE THREAD — stands in for captureTask
+// ════════════════════════════════════════════════════════════════
+
+static void captureThread() {
+    uint32_t frameNum = 0;
+    while (running) {
+        uint8_t fps = bridge.updateCaptureFps();
+        if (fps == 0) {
+            hostIO.waitWake(500);
+            continue;
+        }
+
+        SyntheticFrame* frame = new SyntheticFrame;
+        buildFrame(frame->data, ++frameNum, hostIO.nowMs(), frameBytes);
+        if (!bridge.publishFrame(frame, frame->data.data(), frame->data.size(), HOST_FRAME_W, HOST_FRAME_H)) {
+            delete frame;  // Couldn't get mutex, discard
+        }
+        hostIO.waitWake(1000 / fps);
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// HTTP — one request at a time (Connection: close); streams hand off
+// ════════════════════════════════════════════════════════════════
+
+static bool getArg(const std::string& query, const char* name, std::string& value) {
+    std::string key = std::string(name) + "=";
+    size_t pos = 0;
+    while (pos < query.size()) {
+        size_t end = query.find('&', pos);
+        if (end == std::string::npos) end = query.size();
+        if (query.compare(pos, key.size(), key) == 0) {
+            value = query.substr(pos + key.size(), end - pos - key.size());
+            return true;
+        }
+        pos = end + 1;
+    }
+    return false;
+}
+
+static int argInt(const std::string& query, const char* name, int fallback) {
+    std::string v;
+    return getArg(query, name, v) ? atoi(v.c_str()) : fallback;
+}
+
+// extra: additional header lines, each ending in \r\n
+static void sendResponse(int fd, int code, const char* type, const void* body, size_t len,
+                         const char* extra = "") {
+    char header[320];
+    int n = snprintf(header, sizeof(header),
+        "HTTP/1.1 %d %s\r\nContent-Type: %s\r\nContent-Length: %zu\r\n"
+        "Access-Control-Allow-Origin: *\r\nCache-Control: no-cache\r\n%sConnection: close\r\n\r\n",
+        code, code == 200 ? "OK" : code == 400 ? "Bad Request" : code == 404 ? "Not Found"
+                                 : "Service Unavailable", type, len, extra);
+    writeAll(fd, header, (size_t)n);
+    writeAll(fd, body, len);
+}
+
+static void sendText(int fd, int code, const char* type, const char* text) {
+    sendResponse(fd, code, type, text, strlen(text));
+}
+
+static void handleHealth(int fd) {
+    char buf[512];
+    snprintf(buf, sizeof(buf),
+        "OK\nudp:%lu\nws_in:%lu\nws_out:%lu\nframes:%lu\nbatches:%lu\nuart_dropped:%lu\n"
+        "rx_lines:%lu\nrx_ring_drop:%lu\nrx_overflow:%lu\nrx_too_long:%lu\nrx_orphan:%lu\n"
+        "snap_hit:%lu\nsnap_miss:%lu\ncapture_fps:%u\nstream_clients:%d",
+        bridge.stats.udpReceived, bridge.stats.wsMessagesIn, bridge.stats.wsMessagesOut,
+        bridge.stats.framesSent, bridge.stats.batchesForwarded, bridge.stats.uartDropped,
+        bridge.stats.teensyLinesIn, bridge.stats.teensyRingDropped, bridge.stats.teensyRxOverflows,
+        bridge.stats.teensyLinesTooLong, bridge.stats.teensyOrphanLines,
+        bridge.stats.snapshotHits, bridge.stats.snapshotMisses,
+        (unsigned)bridge.currentCaptureFps, bridge.activeStreamClients());
+    sendText(fd, 200, "text/plain", buf);
+}
+
+// Any crop/scale/quality argument turns /capture into an ROI snapshot
+static bool readSnapshotArgs(const std::string& query, SnapshotParams& p) {
+    struct { const char* name; int* field; } args[] = {
+        {"x", &p.x}, {"y", &p.y}, {"w", &p.w}, {"h", &p.h},
+        {"out_w", &p.outW}, {"out_h", &p.outH}, {"quality", &p.quality},
+    };
+    bool any = false;
+    std::string v;
+    for (auto& a : args) {
+        if (getArg(query, a.name, v)) {
+            *a.field = atoi(v.c_str());
+            any = true;
+        }
+    }
+    return any;
+}
+
+// Same flow as the sketch's sendSnapshot(); the synthetic "encode" sizes
+// the output by area and costs a decode-like delay per source pixel
+static void sendSnapshot(int fd, const SnapshotParams& request) {
+    size_t len;
+    uint8_t* jpeg = bridge.lookupSnapshot(bridge.frameSequence(), request, len);
+    const char* cacheState = "X-Snapshot-Cache: hit\r\n";
+
+    if (jpeg == nullptr) {
+        cacheState = "X-Snapshot-Cache: miss\r\n";
+        FrameInfo info;
+        uint8_t* frame = bridge.copyLatestFrame(info, 100);
+        if (frame == nullptr) {
+            sendText(fd, 503, "text/plain", "No frame available");
+            return;
+        }
+        hostIO.freeFrameCopy(frame);
+
+        SnapshotParams p = request;
+        if (!p.normalize(info.width, info.height)) {
+            sendText(fd, 400, "application/json", "{\"ok\":false,\"reason\":\"bad_roi\"}");
+            return;
+        }
+
+        int scale = p.decodeScale();
+        usleep((useconds_t)((long)info.width * info.height / (scale * scale) / 100));  // ~10ns/px
+
+        std::vector<uint8_t> out;
+        size_t target = (size_t)((double)frameBytes * p.outW * p.outH / ((double)info.width * info.height));
+        buildFrame(out, info.seq, hostIO.nowMs(), target);
+        len = out.size();
+        jpeg = (uint8_t*)malloc(len);
+        memcpy(jpeg, out.data(), len);
+        bridge.storeSnapshot(info.seq, request, jpeg, len);
+    }
+
+    sendResponse(fd, 200, "image/jpeg", jpeg, len, cacheState);
+    free(jpeg);
+}
+
+static void handleCapture(int fd, const std::string& query) {
+    bridge.noteCaptureRequest(argInt(query, "fps", 0));
+
+    SnapshotParams roi;
+    if (readSnapshotArgs(query, roi)) {
+        sendSnapshot(fd, roi);
+        return;
+    }
+
+    FrameInfo info;
+    uint8_t* copy = bridge.copyLatestFrame(info, 100);
+    if (copy) {
+        sendResponse(fd, 200, "image/jpeg", copy, info.len);
+        hostIO.freeFrameCopy(copy);
+        return;
+    }
+    sendText(fd, 503, "text/plain", "No frame available");
+}
+
+// Like the sketch's streamTask: runs beside the server thread
+static void streamThread(int fd, int slot, uint8_t fps) {
+    uint32_t lastSentSeq = 0;
+    unsigned long frameInterval = 1000 / fps;
+    unsigned long lastSendStart = 0;
+    bool connected = true;
+
+    while (connected && running) {
+        // Only send frames this client has not seen yet
+        if (bridge.frameSequence() == lastSentSeq) {
+            usleep(5000);
+            continue;
+        }
+
+        FrameInfo info;
+        uint8_t* copy = bridge.copyLatestFrame(info, 50);
+        if (copy) {
+            size_t len = info.len;
+            lastSentSeq = info.seq;
+            lastSendStart = hostIO.nowMs();
+
+            char part[96];
+            int pn = snprintf(part, sizeof(part),
+                "--%s\r\nContent-Type: image/jpeg\r\nContent-Length: %zu\r\n\r\n", MJPEG_BOUNDARY, len);
+            connected = writeAll(fd, part, (size_t)pn) && writeAll(fd, copy, len) && writeAll(fd, "\r\n", 2);
+            hostIO.freeFrameCopy(copy);
+        }
+
+        // Pace to the requested rate (send time counts toward the interval)
+        unsigned long spent = hostIO.nowMs() - lastSendStart;
+        if (spent < frameInterval) usleep((frameInterval - spent) * 1000);
+    }
+
+    bridge.unregisterStreamClient(slot);
+    close(fd);
+}
+
+// Headers, then the client goes to its own thread; true if fd was handed off
+static bool handleStream(int fd, const std::string& query) {
+    uint8_t fps = bridge.clampFps(argInt(query, "fps", TARGET_FPS), TARGET_FPS);
+    int slot = bridge.registerStreamClient(fps);
+    if (slot < 0) {
+        sendText(fd, 503, "text/plain", "Too many stream clients");
+        return false;
+    }
+
+    char header[160];
+    int n = snprintf(header, sizeof(header),
+        "HTTP/1.1 200 OK\r\nContent-Type: multipart/x-mixed-replace; boundary=%s\r\n"
+        "Access-Control-Allow-Origin: *\r\nCache-Control: no-cache\r\n\r\n", MJPEG_BOUNDARY);
+    if (!writeAll(fd, header, (size_t)n)) {
+        bridge.unregisterStreamClient(slot);
+        return false;
+    }
+    std::thread(streamThread, fd, slot, fps).detach();
+    return true;
+}
+
+// framesize/quality have no synthetic equivalent — frame_bytes sets the JPEG size instead
+static void handleControl(int fd, const std::string& query) {
+    std::string v;
+    if (getArg(query, "frame_bytes", v)) {
+        long bytes = atol(v.c_str());
+        if (bytes < 256 || bytes > 1000000) {
+            sendText(fd, 400, "application/json", "{\"ok\":false,\"reason\":\"bad_frame_bytes\"}");
+            return;
+        }
+        frameBytes = (size_t)bytes;
+    }
+    if (getArg(query, "idle_fps", v)) {
+        int fps = atoi(v.c_str());
+        if (fps < 0 || fps > MAX_FPS) {
+            sendText(fd, 400, "application/json", "{\"ok\":false,\"reason\":\"bad_idle_fps\"}");
+            return;
+        }
+        bridge.idleFps = (uint8_t)fps;
+    }
+    if (getArg(query, "max_fps", v)) {
+        int fps = atoi(v.c_str());
+        if (fps < 1 || fps > MAX_FPS) {
+            sendText(fd, 400, "application/json", "{\"ok\":false,\"reason\":\"bad_max_fps\"}");
+            return;
+        }
+        bridge.maxFps = (uint8_t)fps;
+    }
+
+    hostIO.wakeCapture();  // Apply new rates now
+
+    char buf[192];
+    snprintf(buf, sizeof(buf),
+        "{\"ok\":true,\"frame_bytes\":%zu,\"idle_fps\":%u,\"max_fps\":%u,"
+        "\"capture_fps\":%u,\"stream_clients\":%d}",
+        (size_t)frameBytes, (unsigned)bridge.idleFps, (unsigned)bridge.maxFps,
+        (unsigned)bridge.currentCaptureFps, bridge.activeStreamClients());
+    sendText(fd, 200, "application/json", buf);
+}
+
+// One request, on the server thread (WebServer::handleClient)
+static void handleHttpRequest(int fd) {
+    char req[2048];
+    size_t len = 0;
+    while (len < sizeof(req) - 1) {
+        ssize_t n = recv(fd, req + len, sizeof(req) - 1 - len, 0);
+        if (n <= 0) break;
+        len += (size_t)n;
+        req[len] = '\0';
+        if (strstr(req, "\r\n\r\n") != nullptr) break;
+    }
+    req[len] = '\0';
+
+    char method[8] = "", target[512] = "";
+    if (sscanf(req, "%7s %511s", method, target) == 2 && strcmp(method, "GET") == 0) {
+        std::string path(target), query;
+        size_t q = path.find('?');
+        if (q != std::string::npos) {
+            query = path.substr(q + 1);
+            path.resize(q);
+        }
+
+        if (path == "/health") handleHealth(fd);
+        else if (path == "/capture") handleCapture(fd, query);
+        else if (path == "/stream") {
+            if (handleStream(fd, query)) return;
+        }
+        else if (path == "/control") handleControl(fd, query);
+        else {
+            sendText(fd, 404, "text/plain",
+                "Buddy bridge (host build)\n\nEndpoints:\n"
+                "  GET /health   - Health check\n"
+                "  GET /capture  - Single JPEG frame (?fps= polling rate hint)\n"
+                "                  ROI: ?x=&y=&w=&h=&out_w=&out_h=&quality= (1-100)\n"
+                "  GET /stream   - MJPEG stream (?fps= requested rate)\n"
+                "  GET /control  - Capture settings (?frame_bytes=&idle_fps=&max_fps=)\n"
+                "  TCP :8081     - Command bridge, one line per message\n"
+                "  UDP :8888     - Face data receiver\n");
+        }
+    }
+    close(fd);
+}
+
+// ════════════════════════════════════════════════════════════════
+// WS STAND-IN — newline-delimited TCP, events handled on the main thread
+// ════════════════════════════════════════════════════════════════
+
+enum WsEventType { WS_CONNECTED, WS_DISCONNECTED, WS_TEXT };
+
+struct WsEvent {
+    WsEventType type;
+    uint8_t client;
+    std::string text;
+};
+
+static std::mutex wsEventMutex;
+static std::deque<WsEvent> wsEvents;
+
+static void queueWsEvent(WsEventType type, uint8_t client, const std::string& text) {
+    std::lock_guard<std::mutex> lock(wsEventMutex);
+    wsEvents.push_back(WsEvent{type, client, text});
+}
+
+static void wsReaderThread(int fd, uint8_t client) {
+    std::string pending;
+    char chunk[1024];
+    while (running) {
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0) break;
+        pending.append(chunk, (size_t)n);
+        size_t nl;
+        while ((nl = pending.find('\n')) != std::string::npos) {
+            std::string line = pending.substr(0, nl);
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+            if (!line.empty()) queueWsEvent(WS_TEXT, client, line);
+            pending.erase(0, nl + 1);
+        }
+    }
+    queueWsEvent(WS_DISCONNECTED, client, "");
+}
+
+static int listenTcp(uint16_t port) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    int one = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(fd, (sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, 16) != 0) {
+        fprintf(stderr, "[NET] Cannot listen on port %u: %s\n", port, strerror(errno));
+        exit(1);
+    }
+    return fd;
+}
+
+static int acceptWithTimeout(int listenFd) {
+    pollfd pfd = {listenFd, POLLIN, 0};
+    if (poll(&pfd, 1, 200) <= 0) return -1;
+    return accept(listenFd, nullptr, nullptr);
+}
+
+static void wsAcceptThread(int listenFd) {
+    while (running) {
+        int fd = acceptWithTimeout(listenFd);
+        if (fd < 0) continue;
+        int client = hostIO.addWsClient(fd);
+        if (client < 0) {
+            const char* busy = "{\"ok\":false,\"reason\":\"too_many_clients\"}\n";
+            writeAll(fd, busy, strlen(busy));
+            close(fd);
+            continue;
+        }
+        int one = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        queueWsEvent(WS_CONNECTED, (uint8_t)client, "");
+        std::thread(wsReaderThread, fd, (uint8_t)client).detach();
+    }
+}
+
+static void httpServerThread(int listenFd) {
+    while (running) {
+        int fd = acceptWithTimeout(listenFd);
+        if (fd < 0) continue;
+        handleHttpRequest(fd);
+    }
+}
+
+// ════════════════════════════════════════════════════════════════
+// MAIN — setup() + loop()
+// ════════════════════════════════════════════════════════════════
+
+static void printStatus() {
+    printf("[STATUS] UDP:%lu WS_in:%lu WS_out:%lu Frames:%lu Dropped:%lu Batches:%lu\n",
+        bridge.stats.udpReceived, bridge.stats.wsMessagesIn, bridge.stats.wsMessagesOut,
+        bridge.stats.framesSent, bridge.stats.uartDropped, bridge.stats.batchesForwarded);
+    printf("[STATUS] RX lines:%lu ring_drop:%lu overflow:%lu too_long:%lu orphan:%lu capture_fps:%u streams:%d\n",
+        bridge.stats.teensyLinesIn, bridge.stats.teensyRingDropped, bridge.stats.teensyRxOverflows,
+        bridge.stats.teensyLinesTooLong, bridge.stats.teensyOrphanLines,
+        (unsigned)bridge.currentCaptureFps, bridge.activeStreamClients());
+    fflush(stdout);
+}
+
+static bool openPty(std::string& slavePath, int& slaveFd) {
+    hostIO.ptyMaster = posix_openpt(O_RDWR | O_NOCTTY);
+    if (hostIO.ptyMaster < 0 || grantpt(hostIO.ptyMaster) != 0 || unlockpt(hostIO.ptyMaster) != 0) return false;
+    slavePath = ptsname(hostIO.ptyMaster);
+
+    // Hold the slave open (raw, like a UART) so the master never sees EIO
+    // and a Teensy-side process can attach and detach freely
+    slaveFd = open(slavePath.c_str(), O_RDWR | O_NOCTTY);
+    if (slaveFd < 0) return false;
+    termios tio;
+    tcgetattr(slaveFd, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(slaveFd, TCSANOW, &tio);
+
+    fcntl(hostIO.ptyMaster, F_SETFL, fcntl(hostIO.ptyMaster, F_GETFL) | O_NONBLOCK);
+    return true;
+}
+
+int main(int argc, char** argv) {
+    const char* simPath = nullptr;
+    uint16_t wsPort = HOST_WS_PORT, httpPort = HOST_HTTP_PORT, udpPort = HOST_UDP_PORT;
+    unsigned long statusMs = 10000;
+
+    for (int i = 1; i < argc; i++) {
+        const char* arg = argv[i];
+        const char* val = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (val == nullptr) {
+            fprintf(stderr, "Missing value for %s\n", arg);
+            return 2;
+        }
+        if (strcmp(arg, "--sim") == 0) simPath = val;
+        else if (strcmp(arg, "--ws-port") == 0) wsPort = (uint16_t)atoi(val);
+        else if (strcmp(arg, "--http-port") == 0) httpPort = (uint16_t)atoi(val);
+        else if (strcmp(arg, "--udp-port") == 0) udpPort = (uint16_t)atoi(val);
+        else if (strcmp(arg, "--frame-bytes") == 0) frameBytes = (size_t)atol(val);
+        else if (strcmp(arg, "--baud") == 0) hostIO.baud = strtoul(val, nullptr, 10);
+        else if (strcmp(arg, "--status-s") == 0) statusMs = strtoul(val, nullptr, 10) * 1000UL;
+        else {
+            fprintf(stderr, "Unknown option %s\n", arg);
+            return 2;
+        }
+        i++;
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("BUDDY BRIDGE — host build\n");
+
+    // ═══ 1. "UART" ═══
+    std::string slavePath;
+    int slaveFd = -1;
+    if (!openPty(slavePath, slaveFd)) {
+        fprintf(stderr, "[FATAL] pty setup failed: %s\n", strerror(errno));
+        return 1;
+    }
+    printf("[UART] Teensy pty: %s\n", slavePath.c_str());
+    std::thread(ptyRxThread).detach();
+
+    pid_t simPid = -1;
+    if (simPath != nullptr) {
+        simPid = fork();
+        if (simPid == 0) {
+            execl(simPath, simPath, slavePath.c_str(), (char*)nullptr);
+            fprintf(stderr, "[FATAL] Cannot start %s: %s\n", simPath, strerror(errno));
+            _exit(127);
+        }
+    }
+
+    // ═══ 2. Handshake ═══
+    for (int i = 0; i < 5; i++) {
+        bridge.teensyWriteLine("ESP32_READY");
+        usleep(50000);
+    }
+    bool teensyReady = bridge.waitForLine("TEENSY_READY", 3000);
+    printf("[HANDSHAKE] %s\n", teensyReady ? "Teensy acknowledged — link active"
+                                           : "No Teensy response (timeout) — continuing");
+
+    // ═══ 3. Network + capture ═══
+    int wsFd = listenTcp(wsPort);
+    int httpFd = listenTcp(httpPort);
+    int udpFd = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in udpAddr = {};
+    udpAddr.sin_family = AF_INET;
+    udpAddr.sin_port = htons(udpPort);
+    udpAddr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(udpFd, (sockaddr*)&udpAddr, sizeof(udpAddr)) != 0) {
+        fprintf(stderr, "[NET] Cannot bind UDP %u: %s\n", udpPort, strerror(errno));
+        return 1;
+    }
+
+    std::thread(captureThread).detach();
+    std::thread(wsAcceptThread, wsFd).detach();
+    std::thread(httpServerThread, httpFd).detach();
+
+    printf("[READY] Bridge active\n");
+    printf("  Stream: http://127.0.0.1:%u/stream\n", httpPort);
+    printf("  WS:     tcp://127.0.0.1:%u (line protocol)\n", wsPort);
+    printf("  UDP:    127.0.0.1:%u\n", udpPort);
+    fflush(stdout);
+
+    // ═══ loop() ═══
+    char udpBuffer[256];
+    unsigned long lastStatus = hostIO.nowMs();
+
+    while (running) {
+        // wsServer.loop()
+        std::deque<WsEvent> events;
+        {
+            std::lock_guard<std::mutex> lock(wsEventMutex);
+            events.swap(wsEvents);
+        }
+        for (WsEvent& ev : events) {
+            switch (ev.type) {
+                case WS_CONNECTED:
+                    bridge.onWsConnected(ev.client);
+                    break;
+                case WS_DISCONNECTED:
+                    bridge.onWsDisconnected(ev.client);
+                    hostIO.removeWsClient(ev.client);
+                    break;
+                case WS_TEXT:
+                    bridge.onWsText(ev.client, ev.text.c_str());
+                    break;
+            }
+        }
+
+        // handleUDP() — one packet per pass, like the sketch
+        ssize_t len = recv(udpFd, udpBuffer, sizeof(udpBuffer) - 1, MSG_DONTWAIT);
+        if (len > 0) {
+            udpBuffer[len] = '\0';
+            bridge.forwardFaceData(udpBuffer);
+        }
+
+        bridge.pollTeensyLines();
+        bridge.checkBatchTimeout();
+
+        if (statusMs > 0 && hostIO.nowMs() - lastStatus > statusMs) {
+            lastStatus = hostIO.nowMs();
+            printStatus();
+        }
+
+        usleep(1000);
+    }
+
+    printf("\n[EXIT] Final counters\n");
+    printStatus();
+
+    if (simPid > 0) {
+        kill(simPid, SIGTERM);
+        waitpid(simPid, nullptr, 0);
+    }
+    close(slaveFd);
+    return 0;
+}
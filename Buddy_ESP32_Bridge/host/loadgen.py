@@ -0,0 +1,242 @@
+#!/usr/bin/env python3
+"""
+Load generator for the host build of the ESP32 bridge (bridge_host).
+
+Runs any mix of these concurrently for --duration seconds:
+  - command clients: each sends --cmd (or a !BATCH frame with --batch)
+    back-to-back over the line-protocol WS stand-in and times the reply
+  - face sender: FACE:... packets over UDP at --face-hz with a rising seq
+  - stream clients: /stream?fps=--stream-fps readers counting MJPEG parts
+  - capture pollers: /capture?--capture-args back-to-back (e.g. an ROI
+    "x=200&y=120&w=160&h=160&out_w=96"), timed, with the bridge's
+    snapshot cache hit rate from /health
+
+Face drop rate comes from the bridge's /health counters (udp vs
+uart_dropped) before and after the run; teensy_sim's seq_gaps line shows
+what actually failed to reach the "Teensy".
+
+Usage:
+  python3 loadgen.py --commands 2 --face-hz 30 --streams 3 --duration 10
+"""
+
+import argparse
+import socket
+import threading
+import time
+
+LATENCY_PERCENTILES = (50, 95, 99)
+
+
+def read_health(host, port):
+    """GET /health and return its key:value lines as a dict of ints."""
+    with socket.create_connection((host, port), timeout=5) as s:
+        s.sendall(b"GET /health HTTP/1.1\r\nHost: bridge\r\n\r\n")
+        data = b""
+        while True:
+            chunk = s.recv(4096)
+            if not chunk:
+                break
+            data += chunk
+    body = data.split(b"\r\n\r\n", 1)[-1].decode(errors="replace")
+    result = {}
+    for line in body.splitlines():
+        key, sep, value = line.partition(":")
+        if sep and value.strip().isdigit():
+            result[key] = int(value)
+    return result
+
+
+def command_client(args, stop, results):
+    latencies = []
+    errors = {}
+    sock = socket.create_connection((args.host, args.ws_port), timeout=5)
+    reader = sock.makefile("r", encoding="utf-8", errors="replace")
+    reader.readline()  # bridge_ready
+
+    if args.batch:
+        entries = [args.cmd] * args.batch
+        message = "!BATCH:" + "|".join(entries)
+    else:
+        message = args.cmd
+
+    while not stop.is_set():
+        start = time.perf_counter()
+        sock.sendall((message + "\n").encode())
+        while True:
+            line = reader.readline()
+            if not line:
+                stop.set()
+                break
+            if line.startswith(("STATE:", "EVT:")):
+                continue
+            break
+        latencies.append((time.perf_counter() - start) * 1000.0)
+        if '"ok":true' not in line:
+            reason = line.split('"reason":"', 1)[-1].split('"', 1)[0] if "reason" in line else line.strip()
+            errors[reason] = errors.get(reason, 0) + 1
+    sock.close()
+    results.append((latencies, errors))
+
+
+def face_sender(args, stop, sent):
+    sock = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    interval = 1.0 / args.face_hz
+    seq = 0
+    next_send = time.perf_counter()
+    while not stop.is_set():
+        seq += 1
+        msg = f"FACE:160,120,{seq % 7 - 3},0,40,40,85,{seq}"
+        sock.sendto(msg.encode(), (args.host, args.udp_port))
+        next_send += interval
+        delay = next_send - time.perf_counter()
+        if delay > 0:
+            time.sleep(delay)
+    sent.append(seq)
+
+
+def stream_client(args, stop, results):
+    frames = 0
+    total_bytes = 0
+    sock = socket.create_connection((args.host, args.http_port), timeout=5)
+    sock.sendall(f"GET /stream?fps={args.stream_fps} HTTP/1.1\r\nHost: bridge\r\n\r\n".encode())
+    reader = sock.makefile("rb")
+    status = reader.readline()
+    if b"200" not in status:
+        results.append((0, 0, status.decode(errors="replace").strip()))
+        return
+    while not stop.is_set():
+        line = reader.readline()
+        if not line:
+            break
+        if line.lower().startswith(b"content-length:"):
+            length = int(line.split(b":", 1)[1])
+            reader.readline()  # blank line
+            total_bytes += len(reader.read(length))
+            frames += 1
+    sock.close()
+    results.append((frames, total_bytes, None))
+
+
+def capture_poller(args, stop, results):
+    latencies = []
+    total_bytes = 0
+    failures = 0
+    request = f"GET /capture?{args.capture_args} HTTP/1.1\r\nHost: bridge\r\n\r\n".encode()
+    while not stop.is_set():
+        start = time.perf_counter()
+        with socket.create_connection((args.host, args.http_port), timeout=5) as s:
+            s.sendall(request)
+            data = b""
+            while True:
+                chunk = s.recv(65536)
+                if not chunk:
+                    break
+                data += chunk
+        latencies.append((time.perf_counter() - start) * 1000.0)
+        if b" 200 " in data.split(b"\r\n", 1)[0]:
+            total_bytes += len(data.split(b"\r\n\r\n", 1)[-1])
+        else:
+            failures += 1
+    results.append((latencies, total_bytes, failures))
+
+
+def percentile(values, pct):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    idx = min(len(values) - 1, int(round(pct / 100.0 * (len(values) - 1))))
+    return values[idx]
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Load-test bridge_host")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--ws-port", type=int, default=8081)
+    parser.add_argument("--http-port", type=int, default=8080)
+    parser.add_argument("--udp-port", type=int, default=8888)
+    parser.add_argument("--duration", type=float, default=10.0)
+    parser.add_argument("--commands", type=int, default=1, help="concurrent command clients")
+    parser.add_argument("--cmd", default="!QUERY")
+    parser.add_argument("--batch", type=int, default=0, help="send --cmd N times per !BATCH frame")
+    parser.add_argument("--face-hz", type=float, default=30.0, help="0 disables face packets")
+    parser.add_argument("--streams", type=int, default=1, help="concurrent /stream clients")
+    parser.add_argument("--stream-fps", type=int, default=15)
+    parser.add_argument("--captures", type=int, default=0, help="concurrent /capture pollers")
+    parser.add_argument("--capture-args", default="fps=10", help="query string for /capture")
+    args = parser.parse_args()
+
+    before = read_health(args.host, args.http_port)
+    stop = threading.Event()
+    cmd_results, face_sent, stream_results, capture_results = [], [], [], []
+    threads = []
+    for _ in range(args.commands):
+        threads.append(threading.Thread(target=command_client, args=(args, stop, cmd_results)))
+    if args.face_hz > 0:
+        threads.append(threading.Thread(target=face_sender, args=(args, stop, face_sent)))
+    for _ in range(args.streams):
+        threads.append(threading.Thread(target=stream_client, args=(args, stop, stream_results)))
+    for _ in range(args.captures):
+        threads.append(threading.Thread(target=capture_poller, args=(args, stop, capture_results)))
+
+    started = time.perf_counter()
+    for t in threads:
+        t.start()
+    time.sleep(args.duration)
+    stop.set()
+    for t in threads:
+        t.join(timeout=5)
+    elapsed = time.perf_counter() - started
+    time.sleep(0.2)  # Let the bridge finish counting
+    after = read_health(args.host, args.http_port)
+
+    print(f"=== bridge load test: {elapsed:.1f}s ===")
+
+    if cmd_results:
+        latencies = [ms for lat, _ in cmd_results for ms in lat]
+        errors = {}
+        for _, errs in cmd_results:
+            for reason, count in errs.items():
+                errors[reason] = errors.get(reason, 0) + count
+        pcts = "  ".join(f"p{p}={percentile(latencies, p):.2f}ms" for p in LATENCY_PERCENTILES)
+        print(f"commands: {len(latencies)} in {elapsed:.1f}s = {len(latencies) / elapsed:.1f}/s "
+              f"({args.commands} clients{', batch x%d' % args.batch if args.batch else ''})")
+        print(f"  latency {pcts}  max={max(latencies, default=0):.2f}ms")
+        if errors:
+            print(f"  errors: {errors}")
+
+    if face_sent:
+        udp = after.get("udp", 0) - before.get("udp", 0)
+        dropped = after.get("uart_dropped", 0) - before.get("uart_dropped", 0)
+        lost_udp = face_sent[0] - udp
+        print(f"faces: sent {face_sent[0]}, bridge received {udp}, UART-busy drops {dropped} "
+              f"({100.0 * dropped / max(1, udp):.2f}%), not received {max(0, lost_udp)}")
+
+    for i, (frames, total_bytes, error) in enumerate(stream_results):
+        if error:
+            print(f"stream {i}: refused ({error})")
+        else:
+            print(f"stream {i}: {frames} frames = {frames / elapsed:.1f} fps, "
+                  f"{total_bytes / elapsed / 1024:.0f} KiB/s")
+
+    if capture_results:
+        latencies = [ms for lat, _, _ in capture_results for ms in lat]
+        total_bytes = sum(b for _, b, _ in capture_results)
+        failures = sum(f for _, _, f in capture_results)
+        hits = after.get("snap_hit", 0) - before.get("snap_hit", 0)
+        misses = after.get("snap_miss", 0) - before.get("snap_miss", 0)
+        pcts = "  ".join(f"p{p}={percentile(latencies, p):.2f}ms" for p in LATENCY_PERCENTILES)
+        print(f"captures: {len(latencies)} = {len(latencies) / elapsed:.1f}/s, "
+              f"avg {total_bytes / max(1, len(latencies)) / 1024:.1f} KiB, failed {failures}")
+        print(f"  latency {pcts}")
+        if hits or misses:
+            print(f"  snapshot cache: {hits} hits / {misses} misses "
+                  f"({100.0 * hits / max(1, hits + misses):.0f}%)")
+
+    for key in ("rx_ring_drop", "rx_too_long", "rx_orphan"):
+        delta = after.get(key, 0) - before.get(key, 0)
+        if delta:
+            print(f"bridge {key}: +{delta}")
+
+
+if __name__ == "__main__":
+    main()
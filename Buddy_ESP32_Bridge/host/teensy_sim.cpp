@@ -0,0 +1,288 @@
+// teensy_sim.cpp
+// Teensy stand-in for bridge_host — talks on the pty the bridge opened
+//
+//   ESP32_READY        → TEENSY_READY
+//   !QUERY             → ~600-byte JSON (exercises long RX lines)
+//   !<anything else>   → {"ok":true,"cmd":"..."} after --cmd-us of "work"
+//   !BATCH#n,cs:...    → frame checked like AIBridge::cmdBatch, delays honored
+//                        without blocking, one BATCH:{...} result at the end
+//                        (--no-batch 1: unknown_command with the 20-byte
+//                        echo, like firmware from before !BATCH)
+//   FACE:... / NO_FACE → counted; gaps in the trailing seq field are counted
+//                        as face packets lost somewhere between PC and Teensy
+//   STATE:{...}        → emitted unsolicited at --state-hz
+//
+// Counters print every --status-s and on SIGTERM/SIGINT.
+//
+// Usage: ./teensy_sim <pty> [--cmd-us N] [--state-hz N] [--status-s N] [--no-batch 1]
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SIM_LINE_MAX       512
+#define SIM_CMD_US         300     // Typical non-moving command on the Teensy
+#define SIM_BATCH_CMD_MS   5       // Per-entry cost inside a batch
+#define SIM_STATE_HZ       5
+
+static volatile sig_atomic_t running = 1;
+static void onSignal(int) { running = 0; }
+
+static int fd = -1;
+static bool noBatch = false;   // Answer !BATCH like old firmware
+
+struct SimStats {
+    unsigned long lines;
+    unsigned long commands;
+    unsigned long batches;
+    unsigned long batchErrors;
+    unsigned long faces;
+    unsigned long noFaces;
+    unsigned long faceSeqGaps;    // Missing seq numbers (lost before reaching us)
+    unsigned long statesSent;
+    long lastSeq;
+};
+static SimStats stats = {0, 0, 0, 0, 0, 0, 0, 0, -1};
+
+// Pending batch result — sent once its delays have elapsed
+static bool batchPending = false;
+static unsigned long batchDoneAt = 0;
+static char batchResult[160];
+
+static unsigned long nowMs() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long)ts.tv_sec * 1000UL + (unsigned long)(ts.tv_nsec / 1000000L);
+}
+
+static void sendLine(const char* line) {
+    char buf[SIM_LINE_MAX + 1024];
+    int n = snprintf(buf, sizeof(buf), "%s\r\n", line);
+    const char* p = buf;
+    while (n > 0) {
+        ssize_t w = write(fd, p, (size_t)n);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            if (errno == EAGAIN) { usleep(1000); continue; }
+            return;
+        }
+        p += w;
+        n -= (int)w;
+    }
+}
+
+static void trackSeq(const char* seqField) {
+    if (seqField == nullptr) return;
+    long seq = strtol(seqField, nullptr, 10);
+    if (stats.lastSeq >= 0 && seq > stats.lastSeq + 1) {
+        stats.faceSeqGaps += (unsigned long)(seq - stats.lastSeq - 1);
+    }
+    stats.lastSeq = seq;
+}
+
+// !BATCH#count,checksum:payload — same validation order as AIBridge::cmdBatch
+static void handleBatch(const char* args) {
+    if (batchPending) {
+        sendLine("BATCH:{\"ok\":false,\"reason\":\"batch_busy\"}");
+        stats.batchErrors++;
+        return;
+    }
+
+    int count = -1;
+    unsigned int checksum = 0;
+    const char* payload = strchr(args, ':');
+    if (*args != '#' || payload == nullptr || sscanf(args, "#%d,%x", &count, &checksum) != 2) {
+        sendLine("BATCH:{\"ok\":false,\"reason\":\"frame_error\"}");
+        stats.batchErrors++;
+        return;
+    }
+    payload++;
+
+    uint8_t sum = 0;
+    int entries = 1;
+    unsigned long delayMs = 0;
+    const char* entry = payload;
+    for (const char* p = payload; ; p++) {
+        if (*p == '|' || *p == '\0') {
+            const char* at = (const char*)memchr(entry, '@', (size_t)(p - entry));
+            if (at != nullptr && at > entry) delayMs += strtoul(entry, nullptr, 10);
+            if (*p == '\0') break;
+            entries++;
+            entry = p + 1;
+        }
+        sum += (uint8_t)*p;
+    }
+
+    if (sum != (uint8_t)checksum) {
+        sendLine("BATCH:{\"ok\":false,\"reason\":\"checksum\"}");
+        stats.batchErrors++;
+        return;
+    }
+    if (entries != count) {
+        sendLine("BATCH:{\"ok\":false,\"reason\":\"frame_error\"}");
+        stats.batchErrors++;
+        return;
+    }
+
+    char results[32];
+    int n = entries < (int)sizeof(results) - 1 ? entries : (int)sizeof(results) - 1;
+    memset(results, '1', (size_t)n);
+    results[n] = '\0';
+    snprintf(batchResult, sizeof(batchResult),
+        "BATCH:{\"ok\":true,\"n\":%d,\"failed\":0,\"results\":\"%s\"}", entries, results);
+    batchPending = true;
+    batchDoneAt = nowMs() + delayMs + (unsigned long)entries * SIM_BATCH_CMD_MS;
+    stats.batches++;
+}
+
+static void handleLine(char* line, unsigned long cmdUs) {
+    stats.lines++;
+
+    if (strcmp(line, "ESP32_READY") == 0) {
+        static bool acked = false;
+        if (!acked) sendLine("TEENSY_READY");
+        acked = true;
+        return;
+    }
+
+    if (strncmp(line, "FACE:", 5) == 0) {
+        stats.faces++;
+        trackSeq(strrchr(line, ',') ? strrchr(line, ',') + 1 : nullptr);
+        return;
+    }
+    if (strncmp(line, "NO_FACE", 7) == 0) {
+        stats.noFaces++;
+        trackSeq(strchr(line, ',') ? strchr(line, ',') + 1 : nullptr);
+        return;
+    }
+
+    if (line[0] != '!') return;  // Unknown traffic — the Teensy ignores it too
+
+    if (strncmp(line + 1, "BATCH", 5) == 0 && !noBatch) {
+        handleBatch(line + 6);
+        return;
+    }
+
+    stats.commands++;
+    usleep(cmdUs);  // Command handlers run inline on the Teensy
+
+    char reply[SIM_LINE_MAX + 768];
+    if (strncmp(line + 1, "QUERY", 5) == 0) {
+        char filler[561];
+        memset(filler, 'x', sizeof(filler) - 1);
+        filler[sizeof(filler) - 1] = '\0';
+        snprintf(reply, sizeof(reply),
+            "{\"ok\":true,\"cmd\":\"QUERY\",\"faces\":%lu,\"pad\":\"%s\"}", stats.faces, filler);
+    } else if (strncmp(line + 1, "BATCH", 5) == 0) {
+        snprintf(reply, sizeof(reply), "{\"ok\":false,\"reason\":\"unknown_command\",\"cmd\":\"%.20s\"}",
+                 line + 1);
+    } else {
+        // Command name up to ':' for the echo
+        char name[48];
+        size_t n = strcspn(line + 1, ":");
+        if (n >= sizeof(name)) n = sizeof(name) - 1;
+        memcpy(name, line + 1, n);
+        name[n] = '\0';
+        snprintf(reply, sizeof(reply), "{\"ok\":true,\"cmd\":\"%s\"}", name);
+    }
+    sendLine(reply);
+}
+
+static void printStats() {
+    printf("[SIM] lines:%lu cmds:%lu batches:%lu batch_err:%lu faces:%lu no_face:%lu seq_gaps:%lu states:%lu\n",
+        stats.lines, stats.commands, stats.batches, stats.batchErrors,
+        stats.faces, stats.noFaces, stats.faceSeqGaps, stats.statesSent);
+    fflush(stdout);
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s <pty> [--cmd-us N] [--state-hz N] [--status-s N] [--no-batch 1]\n", argv[0]);
+        return 2;
+    }
+
+    unsigned long cmdUs = SIM_CMD_US;
+    unsigned long stateHz = SIM_STATE_HZ;
+    unsigned long statusMs = 10000;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        if (strcmp(argv[i], "--cmd-us") == 0) cmdUs = strtoul(argv[i + 1], nullptr, 10);
+        else if (strcmp(argv[i], "--state-hz") == 0) stateHz = strtoul(argv[i + 1], nullptr, 10);
+        else if (strcmp(argv[i], "--status-s") == 0) statusMs = strtoul(argv[i + 1], nullptr, 10) * 1000UL;
+        else if (strcmp(argv[i], "--no-batch") == 0) noBatch = atoi(argv[i + 1]) != 0;
+        else {
+            fprintf(stderr, "Unknown option %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+
+    fd = open(argv[1], O_RDWR | O_NOCTTY);
+    if (fd < 0) {
+        fprintf(stderr, "[SIM] Cannot open %s: %s\n", argv[1], strerror(errno));
+        return 1;
+    }
+    termios tio;
+    tcgetattr(fd, &tio);
+    cfmakeraw(&tio);
+    tcsetattr(fd, TCSANOW, &tio);
+
+    printf("[SIM] Teensy simulator on %s\n", argv[1]);
+    fflush(stdout);
+
+    char line[SIM_LINE_MAX];
+    size_t len = 0;
+    unsigned long stateInterval = stateHz > 0 ? 1000 / stateHz : 0;
+    unsigned long lastState = nowMs();
+    unsigned long lastStatus = nowMs();
+
+    while (running) {
+        pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 2) > 0) {
+            char chunk[1024];
+            ssize_t n = read(fd, chunk, sizeof(chunk));
+            for (ssize_t i = 0; i < n; i++) {
+                char c = chunk[i];
+                if (c == '\r') continue;
+                if (c == '\n') {
+                    line[len] = '\0';
+                    if (len > 0) handleLine(line, cmdUs);
+                    len = 0;
+                } else if (len < sizeof(line) - 1) {
+                    line[len++] = c;
+                }
+            }
+        }
+
+        unsigned long now = nowMs();
+        if (batchPending && (long)(now - batchDoneAt) >= 0) {
+            batchPending = false;
+            sendLine(batchResult);
+        }
+        if (stateInterval > 0 && now - lastState >= stateInterval) {
+            lastState = now;
+            char state[96];
+            snprintf(state, sizeof(state), "STATE:{\"ms\":%lu,\"faces\":%lu,\"mood\":\"curious\"}",
+                     now, stats.faces);
+            sendLine(state);
+            stats.statesSent++;
+        }
+        if (statusMs > 0 && now - lastStatus >= statusMs) {
+            lastStatus = now;
+            printStats();
+        }
+    }
+
+    printStats();
+    close(fd);
+    return 0;
+}
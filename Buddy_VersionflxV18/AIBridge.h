@@ -11,7 +11,10 @@
 //   !EXPRESS:emotion     → Express an emotion (blocked during animation)
 //   !NOD:count           → Nod yes animation
 //   !SHAKE:count         → Shake no animation
-//   !STREAM:on/off       → Toggle periodic state broadcast
+//   !STREAM:on/off       → Toggle periodic state broadcast (full document every 500ms)
+//   !STREAM:delta        → Stream only fields that changed, with "seq" and periodic keyframes
+//   !SUB:t@hz,t@event    → Per-topic STATE: lines (emotion/needs/servo/tracking/consciousness/speech/queue);
+//                          @hz is periodic (1-50), @event pushes on change. !SUB:off clears
 //   !ATTENTION:dir       → Look in a direction (center/left/right/up/down)
 //   !LISTENING           → Attentive pose for wake-word detection
 //   !THINKING            → Looping pondering animation (non-blocking)
@@ -25,17 +28,207 @@
 //   !VISION:json         → Update behavior engine with PC vision observations (Phase 2)
 //   !PERFORM:type        → Speech performance arc movements (pre_speech/watching/deflated/acknowledged)
 //   !PHYSICAL:name       → Physical expression (sigh/double_take/settle/expectant/dismissive/curious_tilt)
+//   !BATCH:c1|ms@c2|...  → Ordered command list with optional relative delays (ms before entry).
+//                          One aggregated BATCH:{...} line is sent when the last entry has run.
+//                          The ESP32 bridge forwards it framed as !BATCH#count,checksum:payload
+//   !COMMANDS            → {"ok":true,"count":N,"commands":[...]} — every command name
+//   !COMMANDS:NAME       → Argument schema of one command (types, ranges, words, help)
+//
+// Unsolicited: EVT:{"evt":...} edge events (AIEvents.h) on the ESP32 link
+//
+// Names, argument schemas and help live in AI_COMMANDS (AICommands.h).
+// Lines from the serial links go through submitCommand(), which queues
+// them by the class AI_COMMANDS gives them (AICommandQueue.h): stop
+// commands run at once, LOOK/ATTENTION and VISION keep only the latest.
 
 #ifndef AI_BRIDGE_H
 #define AI_BRIDGE_H
 
 #include "BehaviorEngine.h"
 #include "ServoController.h"
+#include "MotionLut.h"
 #include "AnimationController.h"
 #include "ReflexiveControl.h"
+#include "AICommands.h"
+#include "JsonTokenizer.h"
+#include "AIEvents.h"
+#include "AICommandQueue.h"
 
 extern volatile bool esp32Linked;  // Handshake flag from main .ino — gates Serial1 writes
 
+// Batch command limits (!BATCH) — payload must fit the 256-byte UART line buffer
+#define AI_BATCH_MAX_ENTRIES  16
+#define AI_BATCH_MAX_PAYLOAD  240
+
+// Captures one command's JSON response while a batch entry executes,
+// so the batch can report a single aggregated result instead of N lines.
+class BatchResponseCapture : public Stream {
+public:
+  char buf[96];
+  int len;
+
+  BatchResponseCapture() : len(0) { buf[0] = '\0'; }
+
+  void reset() { len = 0; buf[0] = '\0'; }
+
+  size_t write(uint8_t c) override {
+    if (len < (int)sizeof(buf) - 1) {
+      buf[len++] = (char)c;
+      buf[len] = '\0';
+    }
+    return 1;
+  }
+
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  void flush() override {}
+};
+
+static_assert(sizeof(AI_EMOTION_WORDS) / sizeof(AI_EMOTION_WORDS[0]) == CONFUSED + 1,
+              "AI_EMOTION_WORDS must list every EmotionLabel in order");
+
+// !VISION:json — compact observation feed from the PC vision loop
+struct VisionUpdate {
+  int faceDetected;
+  int faceCount;
+  char expression[16];
+  float sceneNovelty;
+  int objectCount;
+  float movement;
+};
+
+static const JsonField VISION_UPDATE_FIELDS[] = {
+  JSON_INT_FIELD(VisionUpdate, faceDetected, "f"),
+  JSON_INT_FIELD(VisionUpdate, faceCount, "fc"),
+  JSON_STR_FIELD(VisionUpdate, expression, "ex"),
+  JSON_FLOAT_FIELD(VisionUpdate, sceneNovelty, "nv"),
+  JSON_INT_FIELD(VisionUpdate, objectCount, "ob"),
+  JSON_FLOAT_FIELD(VisionUpdate, movement, "mv"),
+};
+
+// !VISION json — scene context from the SceneContext pipeline
+struct VisionContext {
+  float sceneNovelty;
+  int faceCount;
+  char expression[16];
+  char changeType[24];
+  char sceneDesc[100];
+};
+
+static const JsonField VISION_CONTEXT_FIELDS[] = {
+  JSON_FLOAT_FIELD(VisionContext, sceneNovelty, "novelty"),
+  JSON_INT_FIELD(VisionContext, faceCount, "faces"),
+  JSON_STR_FIELD(VisionContext, expression, "expr"),
+  JSON_STR_FIELD(VisionContext, changeType, "change"),
+  JSON_STR_FIELD(VisionContext, sceneDesc, "desc"),
+};
+
+// ============================================
+// STATE FIELDS — shared by !QUERY and the STATE: stream
+// Table order is the JSON key order. epsilon is the smallest change a
+// delta frame reports; the comparison is against the value last sent, so
+// slow drift still goes out once it adds up.
+// ============================================
+
+enum StateFieldType : uint8_t { STATE_FLOAT, STATE_INT, STATE_BOOL, STATE_STR };
+
+struct StateFieldSpec {
+  const char* key;
+  StateFieldType type;
+  float epsilon;
+};
+
+struct StateValue {
+  float num;          // FLOAT / INT / BOOL
+  const char* str;    // STR (always a string literal)
+};
+
+enum StateFieldId : uint8_t {
+  STATE_AROUSAL, STATE_VALENCE, STATE_DOMINANCE, STATE_EMOTION, STATE_BEHAVIOR,
+  STATE_STIMULATION, STATE_SOCIAL, STATE_ENERGY, STATE_SAFETY, STATE_NOVELTY,
+  STATE_TRACKING, STATE_ANIMATING, STATE_SERVO_BASE, STATE_SERVO_NOD, STATE_SERVO_TILT,
+  STATE_EPISTEMIC, STATE_TENSION, STATE_WONDERING, STATE_SELF_AWARENESS,
+  STATE_SPEECH_URGE, STATE_SPEECH_TRIGGER, STATE_WANTS_TO_SPEAK,
+  STATE_HAS_VISION_TARGET, STATE_VISION_AGE,
+  STATE_CMD_QUEUE, STATE_CMD_COALESCED, STATE_CMD_PREEMPTED,
+  STATE_FIELD_COUNT
+};
+
+static const StateFieldSpec STATE_FIELDS[STATE_FIELD_COUNT] = {
+  { "arousal",         STATE_FLOAT, 0.02f },
+  { "valence",         STATE_FLOAT, 0.02f },
+  { "dominance",       STATE_FLOAT, 0.02f },
+  { "emotion",         STATE_STR,   0 },
+  { "behavior",        STATE_STR,   0 },
+  { "stimulation",     STATE_FLOAT, 0.02f },
+  { "social",          STATE_FLOAT, 0.02f },
+  { "energy",          STATE_FLOAT, 0.02f },
+  { "safety",          STATE_FLOAT, 0.02f },
+  { "novelty",         STATE_FLOAT, 0.02f },
+  { "tracking",        STATE_BOOL,  0 },
+  { "animating",       STATE_BOOL,  0 },
+  { "servoBase",       STATE_INT,   2 },
+  { "servoNod",        STATE_INT,   2 },
+  { "servoTilt",       STATE_INT,   2 },
+  { "epistemic",       STATE_STR,   0 },
+  { "tension",         STATE_FLOAT, 0.02f },
+  { "wondering",       STATE_BOOL,  0 },
+  { "selfAwareness",   STATE_FLOAT, 0.02f },
+  { "speechUrge",      STATE_FLOAT, 0.02f },
+  { "speechTrigger",   STATE_STR,   0 },
+  { "wantsToSpeak",    STATE_BOOL,  0 },
+  { "hasVisionTarget", STATE_BOOL,  0 },
+  { "visionAge",       STATE_INT,   5 },   // Seconds; ticks every second otherwise
+  { "cmdQueue",        STATE_INT,   1 },   // Commands waiting (AICommandQueue.h)
+  { "cmdCoalesced",    STATE_INT,   1 },
+  { "cmdPreempted",    STATE_INT,   1 },
+};
+
+#define AI_STREAM_KEYFRAME_EVERY  20      // Delta frames between full keyframes
+#define AI_STREAM_KEYFRAME_MS     10000   // Keyframe at least this often when idle
+
+// ============================================
+// !SUB TOPICS — STATE_FIELDS grouped by what changes together
+// Every field belongs to exactly one topic.
+// ============================================
+
+#define STATE_BIT(id) ((uint32_t)1 << (id))
+
+static constexpr uint32_t AI_TOPIC_FIELDS[AI_TOPIC_COUNT] = {
+  // emotion
+  STATE_BIT(STATE_AROUSAL) | STATE_BIT(STATE_VALENCE) | STATE_BIT(STATE_DOMINANCE) |
+  STATE_BIT(STATE_EMOTION) | STATE_BIT(STATE_BEHAVIOR),
+  // needs
+  STATE_BIT(STATE_STIMULATION) | STATE_BIT(STATE_SOCIAL) | STATE_BIT(STATE_ENERGY) |
+  STATE_BIT(STATE_SAFETY) | STATE_BIT(STATE_NOVELTY),
+  // servo
+  STATE_BIT(STATE_SERVO_BASE) | STATE_BIT(STATE_SERVO_NOD) | STATE_BIT(STATE_SERVO_TILT),
+  // tracking
+  STATE_BIT(STATE_TRACKING) | STATE_BIT(STATE_ANIMATING) |
+  STATE_BIT(STATE_HAS_VISION_TARGET) | STATE_BIT(STATE_VISION_AGE),
+  // consciousness
+  STATE_BIT(STATE_EPISTEMIC) | STATE_BIT(STATE_TENSION) | STATE_BIT(STATE_WONDERING) |
+  STATE_BIT(STATE_SELF_AWARENESS),
+  // speech
+  STATE_BIT(STATE_SPEECH_URGE) | STATE_BIT(STATE_SPEECH_TRIGGER) | STATE_BIT(STATE_WANTS_TO_SPEAK),
+  // queue
+  STATE_BIT(STATE_CMD_QUEUE) | STATE_BIT(STATE_CMD_COALESCED) | STATE_BIT(STATE_CMD_PREEMPTED),
+};
+
+constexpr bool aiTopicsPartitionFields() {
+  uint32_t seen = 0;
+  for (int t = 0; t < AI_TOPIC_COUNT; t++) {
+    if (seen & AI_TOPIC_FIELDS[t]) return false;
+    seen |= AI_TOPIC_FIELDS[t];
+  }
+  return seen == ((uint32_t)1 << STATE_FIELD_COUNT) - 1;
+}
+static_assert(aiTopicsPartitionFields(), "every STATE field needs exactly one !SUB topic");
+
+#define AI_SUB_MAX_HZ    50     // One frame per 20ms scheduler tick
+#define AI_SUB_EVENT     0      // periodMs value of an @event subscription
+
 // AI animation modes for non-blocking looping animations
 enum AIAnimMode {
   AI_ANIM_NONE = 0,
@@ -50,9 +243,27 @@ private:
   AnimationController* animator;
   ReflexiveControl* reflex;
 
-  bool streamingEnabled;
+  AIStreamMode streamMode;
   unsigned long lastStreamTime;
   static const unsigned long STREAM_INTERVAL = 500; // ms
+  Stream* streamTarget;                      // Stream that sent !STREAM
+  // Delta streaming: what the consumer holds, per field
+  StateValue streamSent[STATE_FIELD_COUNT];
+  uint16_t streamSeq;
+  uint8_t streamSinceKeyframe;
+  unsigned long lastKeyframeTime;
+  bool keyframePending;
+
+  // !SUB: each topic on its own period, or pushed when it changes
+  struct TopicSub {
+    bool active;
+    uint16_t periodMs;         // AI_SUB_EVENT = on change (+ keepalive)
+    unsigned long lastSent;
+    bool pending;              // Send on the next update (new subscription)
+  };
+  TopicSub subs[AI_TOPIC_COUNT];
+  Stream* subTarget;                         // Stream that sent !SUB
+  StateValue subSent[STATE_FIELD_COUNT];     // Last value sent, for @event topics
 
   // Looping animation state
   AIAnimMode aiAnimMode;
@@ -75,17 +286,51 @@ private:
   char lastSceneDescription[100];
   unsigned long lastVisionUpdateTime;
 
+  // ── Batch command state (!BATCH) ──
+  // Entries run in order; a delayed entry suspends the batch until
+  // updateBatch() finds it due. Result goes to the stream that sent it.
+  struct BatchEntry {
+    const char* cmd;          // Points into batchText
+    unsigned int delayMs;     // Delay after the previous entry completed
+  };
+  char batchText[AI_BATCH_MAX_PAYLOAD + 1];
+  BatchEntry batchEntries[AI_BATCH_MAX_ENTRIES];
+  int batchCount;
+  int batchNext;
+  bool batchActive;
+  unsigned long batchStepTime;
+  Stream* batchReplyStream;
+  char batchResults[AI_BATCH_MAX_ENTRIES + 1];   // '1' ok / '0' failed per entry
+  char batchFirstReason[24];
+  BatchResponseCapture batchCapture;
+
+  // Commands waiting for serviceCommands() (AICommandQueue.h)
+  AICommandQueue cmdQueue;
+
 public:
   AIBridge()
     : engine(nullptr), servos(nullptr), animator(nullptr), reflex(nullptr),
-      streamingEnabled(false), lastStreamTime(0),
+      streamMode(AI_STREAM_OFF), lastStreamTime(0), streamTarget(&Serial),
+      streamSeq(0), streamSinceKeyframe(0), lastKeyframeTime(0), keyframePending(true),
+      subTarget(&Serial),
       aiAnimMode(AI_ANIM_NONE), aiAnimStartTime(0), lastAiAnimStep(0),
-      responseStream(&Serial), lastVisionUpdateTime(0) {
+      responseStream(&Serial), lastVisionUpdateTime(0),
+      batchCount(0), batchNext(0), batchActive(false), batchStepTime(0),
+      batchReplyStream(&Serial) {
+    batchText[0] = '\0';
+    batchResults[0] = '\0';
+    batchFirstReason[0] = '\0';
     lastVisionTarget.hasTarget = false;
     lastVisionTarget.novelty = 0.0f;
     lastVisionTarget.description[0] = '\0';
     lastVisionTarget.timestamp = 0;
     lastSceneDescription[0] = '\0';
+    for (int t = 0; t < AI_TOPIC_COUNT; t++) {
+      subs[t].active = false;
+      subs[t].periodMs = AI_SUB_EVENT;
+      subs[t].lastSent = 0;
+      subs[t].pending = false;
+    }
   }
 
   void init(BehaviorEngine* eng, ServoController* srv,
@@ -96,125 +341,363 @@ public:
     reflex = ref;
   }
 
+  // ============================================
+  // COMMAND QUEUE
+  // Serial links hand lines to submitCommand(); the vision task runs
+  // serviceCommands() once the line ring is drained. BATCH entries call
+  // handleCommand() directly.
+  // ============================================
+
+  void submitCommand(const char* cmdLine, Stream* respondTo) {
+    AICommandArgs args;
+    const AICommandSpec* cmd = aiLookupCommand(cmdLine, args);
+    // Unknown names queue as CONTROL; the error reply comes from handleCommand()
+    AIQueueClass cls = (cmd != nullptr) ? cmd->queue : AI_Q_CONTROL;
+
+    if (cls == AI_Q_SAFETY) {
+      preemptMoving();
+      preemptBatch();
+      handleCommand(cmdLine, respondTo);
+      return;
+    }
+
+    AIQueuedCommand* older = cmdQueue.findMergeable(cls, args.sep);
+    if (older != nullptr) {
+      answerDropped(*older, "coalesced");
+      cmdQueue.coalesced++;
+      cmdQueue.remove(older);
+    }
+
+    if (cmdQueue.push(cmdLine, respondTo, cls, args.sep)) return;
+
+    AIQueuedCommand* victim = cmdQueue.findEvictable(cls);
+    if (victim != nullptr) {
+      answerDropped(*victim, "queue_full");
+      cmdQueue.rejected++;
+      cmdQueue.remove(victim);
+      cmdQueue.push(cmdLine, respondTo, cls, args.sep);
+      return;
+    }
+
+    cmdQueue.rejected++;
+    AIQueuedCommand refused;
+    refused.replyTo = respondTo;
+    refused.cls = cls;
+    answerDropped(refused, "queue_full");
+  }
+
+  // Run what is due: non-moving entries by priority, at most one
+  // MOTION/GAZE entry per pass so newer targets can merge meanwhile.
+  // Inside a smoothMoveTo() wait, while a clip plays, or while a step
+  // sequence (behavior steps, sweeps) runs, only non-moving entries run;
+  // the moving ones wait for the animation in progress.
+  void serviceCommands() {
+    unsigned long start = micros();
+    bool moved = (servos != nullptr && (servos->inMotionWait() || servos->inSequence())) ||
+                 (animator != nullptr && animator->isCurrentlyAnimating());
+    AIQueuedCommand* e;
+    while ((e = cmdQueue.next(!moved)) != nullptr) {
+      // Copy out first so the slot is free while the command runs
+      char line[AI_QUEUE_TEXT_MAX];
+      strcpy(line, e->text);
+      Stream* replyTo = e->replyTo;
+      moved |= AICommandQueue::moves(e->cls);
+      cmdQueue.remove(e);
+
+      handleCommand(line, replyTo);
+      if (micros() - start > AI_QUEUE_BUDGET_US) break;
+    }
+  }
+
+  // A SAFETY command overrides every motion still waiting
+  void preemptMoving() {
+    for (int i = 0; i < AI_QUEUE_SLOTS; i++) {
+      AIQueuedCommand& e = cmdQueue.slot(i);
+      if (!e.used || !AICommandQueue::moves(e.cls)) continue;
+      answerDropped(e, "preempted");
+      cmdQueue.preempted++;
+      cmdQueue.remove(&e);
+    }
+  }
+
+  // ...and ends a running !BATCH: entries not yet run count as failed
+  void preemptBatch() {
+    if (!batchActive) return;
+    for (int i = batchNext; i < batchCount; i++) batchResults[i] = '0';
+    batchResults[batchCount] = '\0';
+    strcpy(batchFirstReason, "preempted");
+    cmdQueue.preempted++;
+    finishBatch();
+  }
+
+  // Reply for an entry that will never run; VISION has no replies
+  void answerDropped(const AIQueuedCommand& e, const char* why) {
+    if (e.cls == AI_Q_VISION) return;
+    Stream* out = (e.replyTo != nullptr) ? e.replyTo : &Serial;
+    if (out != &Serial && !esp32Linked) return;
+    if (strcmp(why, "coalesced") == 0) {
+      // Superseded by a newer target of the same kind — not a failure
+      out->println("{\"ok\":true,\"coalesced\":true}");
+    } else {
+      out->print("{\"ok\":false,\"reason\":\"");
+      out->print(why);
+      out->println("\"}");
+    }
+  }
+
   // ============================================
   // MAIN COMMAND DISPATCHER
-  // Called from serialEvent() after '!' is consumed
+  // Runs one command line (everything after '!') immediately
   // ============================================
 
   // Overload: route responses to a specific stream (e.g. Serial1 for ESP32 bridge)
+  // Restores the previous stream afterwards: a command can run inside
+  // another one's motion wait, and the outer reply must still go home.
   void handleCommand(const char* cmdLine, Stream* respondTo) {
+    Stream* outer = responseStream;
     if (respondTo != nullptr) {
       responseStream = respondTo;
     } else {
       responseStream = &Serial;
     }
     handleCommand(cmdLine);
+    responseStream = outer;
   }
 
   void handleCommand(const char* cmdLine) {
     // cmdLine is everything after '!' up to newline
     // Responses go to responseStream (default: USB Serial, or Serial1 if routed)
 
-    // Match longer prefixes first to avoid ambiguity
-    if (strncmp(cmdLine, "STOP_THINKING", 13) == 0) {
-      cmdStopThinking();
-    }
-    else if (strncmp(cmdLine, "STOP_SPEAKING", 13) == 0) {
-      cmdStopSpeaking();
-    }
-    else if (strncmp(cmdLine, "ACKNOWLEDGE", 11) == 0) {
-      cmdAcknowledge();
-    }
-    else if (strncmp(cmdLine, "ATTENTION:", 10) == 0) {
-      cmdAttention(cmdLine + 10);
-    }
-    else if (strncmp(cmdLine, "LISTENING", 9) == 0) {
-      cmdListening();
-    }
-    else if (strncmp(cmdLine, "CELEBRATE", 9) == 0) {
-      cmdCelebrate();
-    }
-    else if (strncmp(cmdLine, "THINKING", 8) == 0) {
-      cmdThinking();
-    }
-    else if (strncmp(cmdLine, "SPEAKING", 8) == 0) {
-      cmdSpeaking();
-    }
-    else if (strncmp(cmdLine, "PRESENCE", 8) == 0) {
-      cmdPresence();
-    }
-    else if (strncmp(cmdLine, "SATISFY:", 8) == 0) {
-      cmdSatisfy(cmdLine + 8);
-    }
-    else if (strncmp(cmdLine, "EXPRESS:", 8) == 0) {
-      cmdExpress(cmdLine + 8);
-    }
-    // Phase 2: Vision feedback command — closes the autonomous observation loop
-    // Supports both !VISION:json (legacy) and !VISION json (SceneContext)
-    else if (strncmp(cmdLine, "VISION:", 7) == 0) {
-      cmdVision(cmdLine + 7);
-    }
-    else if (strncmp(cmdLine, "VISION ", 7) == 0) {
-      cmdVisionContext(cmdLine + 7);
-    }
-    else if (strncmp(cmdLine, "STREAM:", 7) == 0) {
-      cmdStream(cmdLine + 7);
-    }
-    else if (strncmp(cmdLine, "SHAKE:", 6) == 0) {
-      cmdShake(cmdLine + 6);
-    }
-    else if (strncmp(cmdLine, "QUERY", 5) == 0) {
-      cmdQuery();
-    }
-    else if (strncmp(cmdLine, "SPOKE", 5) == 0) {
-      cmdSpoke();
+    // Name ends at ':', ' ', '#' or end of line; one hash lookup finds it
+    AICommandArgs args;
+    const AICommandSpec* cmd = aiLookupCommand(cmdLine, args);
+    if (cmd == nullptr) {
+      responseStream->print("{\"ok\":false,\"reason\":\"unknown_command\",\"cmd\":\"");
+      printEscaped(cmdLine, AI_ECHO_MAX);
+      responseStream->println("\"}");
+      return;
     }
-    else if (strncmp(cmdLine, "LOOK:", 5) == 0) {
-      cmdLook(cmdLine + 5);
+
+    // Arguments are checked against the schema before any handler runs
+    switch (aiParseArgs(*cmd, args)) {
+      case AI_PARSE_OK:
+        break;
+
+      case AI_PARSE_ERROR:
+        responseStream->println("{\"ok\":false,\"reason\":\"parse_error\"}");
+        return;
+
+      case AI_PARSE_UNKNOWN_WORD: {
+        const AIWordList& list = *cmd->args[args.badArg].words;
+        responseStream->print("{\"ok\":false,\"reason\":\"");
+        responseStream->print(list.reason);
+        if (list.echoKey != nullptr) {
+          responseStream->print("\",\"");
+          responseStream->print(list.echoKey);
+          responseStream->print("\":\"");
+          printEscaped(args.bad, min(args.badLen, AI_ECHO_MAX));
+        }
+        responseStream->println("\"}");
+        return;
+      }
     }
-    else if (strncmp(cmdLine, "NOD:", 4) == 0) {
-      cmdNod(cmdLine + 4);
+
+    switch ((AICommandId)(cmd - AI_COMMAND_TABLE)) {
+      case AI_CMD_QUERY:         cmdQuery(); break;
+      case AI_CMD_LOOK:          cmdLook(args.v[0].i, args.v[1].i); break;
+      case AI_CMD_SATISFY:       cmdSatisfy((AINeed)args.v[0].i, args.v[1].f); break;
+      case AI_CMD_PRESENCE:      cmdPresence(); break;
+      case AI_CMD_EXPRESS:       cmdExpress((EmotionLabel)args.v[0].i); break;
+      case AI_CMD_NOD:           cmdNod(args.v[0].i); break;
+      case AI_CMD_SHAKE:         cmdShake(args.v[0].i); break;
+      case AI_CMD_STREAM:        cmdStream((AIStreamMode)args.v[0].i); break;
+      case AI_CMD_SUB:           cmdSub(args.rest); break;
+      case AI_CMD_ATTENTION:     cmdAttention((AIDirection)args.v[0].i); break;
+      case AI_CMD_LISTENING:     cmdListening(); break;
+      case AI_CMD_THINKING:      cmdThinking(); break;
+      case AI_CMD_STOP_THINKING: cmdStopThinking(); break;
+      case AI_CMD_SPEAKING:      cmdSpeaking(); break;
+      case AI_CMD_STOP_SPEAKING: cmdStopSpeaking(); break;
+      case AI_CMD_ACKNOWLEDGE:   cmdAcknowledge(); break;
+      case AI_CMD_CELEBRATE:     cmdCelebrate(); break;
+      case AI_CMD_IDLE:          cmdIdle(); break;
+      case AI_CMD_SPOKE:         cmdSpoke(); break;
+      case AI_CMD_PERFORM:       cmdPerform((AIPerform)args.v[0].i); break;
+      case AI_CMD_PHYSICAL:      cmdPhysical((AIPhysical)args.v[0].i); break;
+      case AI_CMD_BATCH:         cmdBatch(args.sep, args.rest); break;
+      case AI_CMD_COMMANDS:      cmdCommands(args.rest); break;
+
+      // Phase 2: Vision feedback command — closes the autonomous observation loop
+      // Supports both !VISION:json (legacy) and !VISION json (SceneContext)
+      case AI_CMD_VISION:
+        if (args.sep == ' ') cmdVisionContext(args.rest);
+        else cmdVision(args.rest);
+        break;
+
+      default:
+        break;
     }
-    else if (strncmp(cmdLine, "PERFORM:", 8) == 0) {
-      cmdPerform(cmdLine + 8);
+  }
+
+  // ============================================
+  // STREAMING UPDATE - call from loop()
+  // ============================================
+
+  // Broadcasts go to the stream that sent !STREAM — USB Serial for
+  // debugging, or Serial1 so the ESP32 bridge fans them out to WS clients.
+  void updateStreaming() {
+    if (streamMode == AI_STREAM_OFF) return;
+    unsigned long now = millis();
+    if (now - lastStreamTime < STREAM_INTERVAL) return;
+    lastStreamTime = now;
+    if (streamTarget != &Serial && !esp32Linked) return;
+
+    StateValue cur[STATE_FIELD_COUNT];
+    if (!captureState(cur)) return;
+
+    if (streamMode == AI_STREAM_FULL) {
+      char buf[768];
+      int len = formatState(buf, sizeof(buf), "STATE:{", cur, STATE_ALL_FIELDS);
+      if (len > 0) streamTarget->println(buf);
+      return;
     }
-    else if (strncmp(cmdLine, "PHYSICAL:", 9) == 0) {
-      cmdPhysical(cmdLine + 9);
+
+    // Delta: changed fields only, a keyframe with every field now and then
+    // so a consumer that missed a frame (seq gap) can rebuild its state
+    bool keyframe = keyframePending || streamSinceKeyframe >= AI_STREAM_KEYFRAME_EVERY ||
+                    now - lastKeyframeTime >= AI_STREAM_KEYFRAME_MS;
+    uint32_t fields = keyframe ? STATE_ALL_FIELDS : changedStateFields(cur, streamSent);
+    if (fields == 0) return;   // Nothing moved; seq only counts frames sent
+
+    char head[40];
+    snprintf(head, sizeof(head), keyframe ? "STATE:{\"seq\":%u,\"key\":1," : "STATE:{\"seq\":%u,",
+             (unsigned)streamSeq);
+    char buf[768];
+    int len = formatState(buf, sizeof(buf), head, cur, fields);
+    if (len <= 0) return;
+    streamTarget->println(buf);
+
+    for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+      if (fields & STATE_BIT(i)) streamSent[i] = cur[i];
+    }
+    streamSeq++;
+    if (keyframe) {
+      keyframePending = false;
+      streamSinceKeyframe = 0;
+      lastKeyframeTime = now;
+    } else {
+      streamSinceKeyframe++;
     }
-    else if (strncmp(cmdLine, "IDLE", 4) == 0) {
-      cmdIdle();
+  }
+
+  bool isStreaming() { return streamMode != AI_STREAM_OFF; }
+
+  // ============================================
+  // EVENT FLUSH - call every tick
+  // Queued edges (AIEvents.h) go out as EVT: lines on the ESP32 link;
+  // without a link they are discarded.
+  // ============================================
+
+  void flushEvents(Stream& out) {
+    AIEventRecord e;
+    for (int n = 0; n < AI_EVENT_FLUSH_MAX && aiEvents.pop(e); n++) {
+      if (!esp32Linked) continue;
+
+      char buf[160];
+      int len = snprintf(buf, sizeof(buf), "EVT:{\"evt\":\"%s\",\"ms\":%lu",
+                         AIEventQueue::eventName(e.id), (unsigned long)e.ms);
+      for (int i = 0; i < 2 && len < (int)sizeof(buf); i++) {
+        const char* k = AIEventQueue::key(e.id, i);
+        if (*k != '\0') len += snprintf(buf + len, sizeof(buf) - len, ",\"%s\":\"%s\"", k, e.text[i]);
+      }
+      const char* k = AIEventQueue::key(e.id, 2);
+      if (*k != '\0' && len < (int)sizeof(buf)) {
+        if (e.num == (float)(long)e.num) {
+          len += snprintf(buf + len, sizeof(buf) - len, ",\"%s\":%ld", k, (long)e.num);
+        } else {
+          len += snprintf(buf + len, sizeof(buf) - len, ",\"%s\":%.2f", k, e.num);
+        }
+      }
+      if (len < (int)sizeof(buf) - 1) {
+        buf[len++] = '}';
+        buf[len] = '\0';
+        out.println(buf);
+      }
     }
-    else {
-      responseStream->print("{\"ok\":false,\"reason\":\"unknown_command\",\"cmd\":\"");
-      for (int i = 0; i < 20 && cmdLine[i] != '\0'; i++) {
-        char c = cmdLine[i];
-        if (c == '"' || c == '\\') responseStream->print('\\');
-        responseStream->print(c);
+  }
+
+  // !SUB topics that are due go out together as one STATE:{...} line with
+  // every field of each due topic. @event topics are due when any of their
+  // fields moved past its epsilon, and at least every AI_STREAM_KEYFRAME_MS
+  // so the consumer can tell a quiet topic from a lost link.
+  void updateSubscriptions() {
+    if (subTarget != &Serial && !esp32Linked) return;
+    unsigned long now = millis();
+
+    bool any = false;
+    bool needChanges = false;
+    for (int t = 0; t < AI_TOPIC_COUNT; t++) {
+      if (!subs[t].active) continue;
+      any = true;
+      if (subs[t].periodMs == AI_SUB_EVENT) needChanges = true;
+    }
+    if (!any) return;
+
+    // Sampling is only worth it when something can be due
+    bool due = needChanges;
+    for (int t = 0; t < AI_TOPIC_COUNT && !due; t++) {
+      due = subs[t].active && (subs[t].pending || now - subs[t].lastSent >= subs[t].periodMs);
+    }
+    if (!due) return;
+
+    StateValue cur[STATE_FIELD_COUNT];
+    if (!captureState(cur)) return;
+    uint32_t changed = needChanges ? changedStateFields(cur, subSent) : 0;
+
+    uint32_t fields = 0;
+    for (int t = 0; t < AI_TOPIC_COUNT; t++) {
+      TopicSub& sub = subs[t];
+      if (!sub.active) continue;
+      bool send = sub.pending;
+      bool periodic = (sub.periodMs != AI_SUB_EVENT);
+      if (periodic) {
+        send = send || now - sub.lastSent >= sub.periodMs;
+      } else {
+        send = send || (changed & AI_TOPIC_FIELDS[t]) || now - sub.lastSent >= AI_STREAM_KEYFRAME_MS;
       }
-      responseStream->println("\"}");
+      if (!send) continue;
+      fields |= AI_TOPIC_FIELDS[t];
+      // Periodic topics advance by whole periods so tick jitter doesn't
+      // drag the rate down; after a stall they restart from now
+      if (periodic && !sub.pending && now - sub.lastSent < 2UL * sub.periodMs) {
+        sub.lastSent += sub.periodMs;
+      } else {
+        sub.lastSent = now;
+      }
+      sub.pending = false;
+    }
+    if (fields == 0) return;
+
+    char buf[768];
+    int len = formatState(buf, sizeof(buf), "STATE:{", cur, fields);
+    if (len <= 0) return;
+    subTarget->println(buf);
+    for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+      if (fields & STATE_BIT(i)) subSent[i] = cur[i];
     }
   }
 
   // ============================================
-  // STREAMING UPDATE - call from loop()
+  // BATCH UPDATE - call from loop()
+  // Runs delayed batch entries once they are due
   // ============================================
 
-  void updateStreaming() {
-    if (!streamingEnabled) return;
-    unsigned long now = millis();
-    if (now - lastStreamTime >= STREAM_INTERVAL) {
-      lastStreamTime = now;
-      // Stream broadcast always goes to USB Serial for debugging,
-      // regardless of where the last command came from.
-      Stream* saved = responseStream;
-      responseStream = &Serial;
-      Serial.print("STATE:");
-      sendStateJSON();
-      responseStream = saved;
-    }
+  void updateBatch() {
+    if (!batchActive) return;
+    runBatch();
   }
 
-  bool isStreaming() { return streamingEnabled; }
+  bool isBatchActive() { return batchActive; }
 
   // ============================================
   // LOOPING ANIMATION UPDATE - call from loop()
@@ -225,9 +708,8 @@ public:
     if (aiAnimMode == AI_ANIM_NONE) return;
     if (servos == nullptr) return;
 
-    // Yield to reflex tracking - don't fight for servos
-    if (reflex != nullptr && reflex->isActive()) return;
-
+    // Keeps running under reflex tracking: the loop is an expression
+    // layer, tracking blends over it (PoseCompositor.h)
     unsigned long now = millis();
 
     // 20Hz animation rate
@@ -244,7 +726,6 @@ public:
   }
 
   // True when a looping AI animation is running
-  // Used by main loop to skip behavior engine servo commands
   bool isAIAnimating() { return aiAnimMode != AI_ANIM_NONE; }
 
   // Public: called directly from parseVisionData() in .ino for zero-overhead updates
@@ -260,39 +741,13 @@ public:
 
     // Parse compact vision update from PC
     // Format: {"f":1,"fc":2,"ex":"happy","nv":0.45,"ob":3,"mv":0.2}
-    int faceDetected = 0;
-    int faceCount = 0;
-    char expression[16] = "neutral";
-    float sceneNovelty = 0.0;
-    int objectCount = 0;
-    float movement = 0.0;
-
-    const char* p;
-
-    p = strstr(jsonStr, "\"f\":");
-    if (p) faceDetected = atoi(p + 4);
-
-    p = strstr(jsonStr, "\"fc\":");
-    if (p) faceCount = atoi(p + 5);
-
-    p = strstr(jsonStr, "\"ex\":\"");
-    if (p) {
-        p += 6;
-        int i = 0;
-        while (*p && *p != '"' && i < 15) {
-            expression[i++] = *p++;
-        }
-        expression[i] = '\0';
-    }
-
-    p = strstr(jsonStr, "\"nv\":");
-    if (p) sceneNovelty = atof(p + 5);
-
-    p = strstr(jsonStr, "\"ob\":");
-    if (p) objectCount = atoi(p + 5);
-
-    p = strstr(jsonStr, "\"mv\":");
-    if (p) movement = atof(p + 5);
+    // One tokenizer pass; malformed lines are dropped (no response to send)
+    VisionUpdate v = { 0, 0, "neutral", 0.0f, 0, 0.0f };
+    JsonToken tokens[JSON_MAX_TOKENS];
+    int count = jsonTokenize(jsonStr, strlen(jsonStr), tokens, JSON_MAX_TOKENS);
+    if (count < 0) return;
+    jsonBind(jsonStr, tokens, count, VISION_UPDATE_FIELDS,
+             JSON_FIELD_COUNT(VISION_UPDATE_FIELDS), &v);
 
     // ── Feed into behavior engine ──
 
@@ -302,7 +757,7 @@ public:
     ConsciousnessLayer& consciousness = engine->getConsciousness();
 
     // 1. Scene novelty → spatial memory (enriches ultrasonic-only data)
-    if (sceneNovelty > 0.0) {
+    if (v.sceneNovelty > 0.0) {
         // Compute approximate direction from base servo angle
         int base = 90;
         if (servos != nullptr) {
@@ -318,38 +773,38 @@ public:
         else if (base > 50)  dir = 1;  // Front-right
         else                 dir = 2;  // Right
 
-        spatialMemory.injectExternalNovelty(dir, sceneNovelty);
+        spatialMemory.injectExternalNovelty(dir, v.sceneNovelty);
     }
 
     // 2. Expression → emotional resonance
-    if (faceDetected && strcmp(expression, "neutral") != 0) {
+    if (v.faceDetected && strcmp(v.expression, "neutral") != 0) {
         float valenceShift = 0.0;
         float arousalShift = 0.0;
 
-        if (strcmp(expression, "happy") == 0)          { valenceShift = 0.05;  arousalShift = 0.02; }
-        else if (strcmp(expression, "surprised") == 0)  { arousalShift = 0.08; }
-        else if (strcmp(expression, "frowning") == 0)   { valenceShift = -0.03; arousalShift = 0.02; }
-        else if (strcmp(expression, "angry") == 0)      { valenceShift = -0.05; arousalShift = 0.05; }
-        else if (strcmp(expression, "sad") == 0)        { valenceShift = -0.04; arousalShift = -0.02; }
-        else if (strcmp(expression, "raised_brows") == 0) { arousalShift = 0.03; }
+        if (strcmp(v.expression, "happy") == 0)          { valenceShift = 0.05;  arousalShift = 0.02; }
+        else if (strcmp(v.expression, "surprised") == 0)  { arousalShift = 0.08; }
+        else if (strcmp(v.expression, "frowning") == 0)   { valenceShift = -0.03; arousalShift = 0.02; }
+        else if (strcmp(v.expression, "angry") == 0)      { valenceShift = -0.05; arousalShift = 0.05; }
+        else if (strcmp(v.expression, "sad") == 0)        { valenceShift = -0.04; arousalShift = -0.02; }
+        else if (strcmp(v.expression, "raised_brows") == 0) { arousalShift = 0.03; }
 
         emotion.nudge(valenceShift, arousalShift);
     }
 
     // 3. Face count → social context
-    if (faceCount > 1) {
-        needs.satisfySocial(0.02 * faceCount);
+    if (v.faceCount > 1) {
+        needs.satisfySocial(0.02 * v.faceCount);
     }
 
     // 4. Object count + movement → stimulation
-    if (objectCount > 0 || movement > 0.3) {
-        float stimAmount = min(0.05f, movement * 0.03f + objectCount * 0.01f);
+    if (v.objectCount > 0 || v.movement > 0.3) {
+        float stimAmount = min(0.05f, v.movement * 0.03f + v.objectCount * 0.01f);
         needs.satisfyStimulation(stimAmount);
     }
 
     // 5. High novelty → consciousness event (can trigger wondering)
-    if (sceneNovelty > 0.5) {
-        consciousness.onEnvironmentChange(sceneNovelty);
+    if (v.sceneNovelty > 0.5) {
+        consciousness.onEnvironmentChange(v.sceneNovelty);
     }
 
     // No response — this is a continuous feed, not a request/response command.
@@ -362,7 +817,7 @@ public:
   // Types: pre_speech, watching, deflated, acknowledged, lean_forward
   // ============================================
 
-  void cmdPerform(const char* args) {
+  void cmdPerform(AIPerform type) {
     if (servos == nullptr) {
       responseStream->println("{\"ok\":false,\"reason\":\"not_initialized\"}");
       return;
@@ -386,36 +841,33 @@ public:
       style.speed = 0.5f;
     }
 
-    if (strcmp(args, "pre_speech") == 0) {
-      // "Inhale before speaking" — center, slight lean forward
-      style.speed = 0.6f;
-      servos->smoothMoveTo(90, 108, curTilt, style);
-    }
-    else if (strcmp(args, "watching") == 0) {
-      // Post-speech — hold attention, slight lean forward
-      style.speed = 0.4f;
-      servos->smoothMoveTo(90, 108, curTilt, style);
-    }
-    else if (strcmp(args, "deflated") == 0) {
-      // Ignored — gaze drops, small settle
-      style.speed = 0.3f;
-      servos->smoothMoveTo(curBase, constrain(curNod + 10, 80, 150), curTilt, style);
-    }
-    else if (strcmp(args, "acknowledged") == 0) {
-      // Got a response — settle back contentedly
-      style.speed = 0.4f;
-      servos->smoothMoveTo(90, 115, curTilt, style);
-    }
-    else if (strcmp(args, "lean_forward") == 0) {
-      // Expectant — lean in
-      style.speed = 0.5f;
-      servos->smoothMoveTo(90, 105, curTilt, style);
-    }
-    else {
-      responseStream->print("{\"ok\":false,\"reason\":\"unknown_perform\",\"type\":\"");
-      responseStream->print(args);
-      responseStream->println("\"}");
-      return;
+    // Single poses: the motion task carries them out, the reply goes now
+    switch (type) {
+      case AI_PERFORM_PRE_SPEECH:
+        // "Inhale before speaking" — center, slight lean forward
+        style.speed = 0.6f;
+        servos->startMove(90, 108, curTilt, style);
+        break;
+      case AI_PERFORM_WATCHING:
+        // Post-speech — hold attention, slight lean forward
+        style.speed = 0.4f;
+        servos->startMove(90, 108, curTilt, style);
+        break;
+      case AI_PERFORM_DEFLATED:
+        // Ignored — gaze drops, small settle
+        style.speed = 0.3f;
+        servos->startMove(curBase, constrain(curNod + 10, 80, 150), curTilt, style);
+        break;
+      case AI_PERFORM_ACKNOWLEDGED:
+        // Got a response — settle back contentedly
+        style.speed = 0.4f;
+        servos->startMove(90, 115, curTilt, style);
+        break;
+      case AI_PERFORM_LEAN_FORWARD:
+        // Expectant — lean in
+        style.speed = 0.5f;
+        servos->startMove(90, 105, curTilt, style);
+        break;
     }
 
     responseStream->println("{\"ok\":true}");
@@ -427,7 +879,7 @@ public:
   // Names: sigh, double_take, settle, expectant, dismissive, curious_tilt, startled
   // ============================================
 
-  void cmdPhysical(const char* args) {
+  void cmdPhysical(AIPhysical name) {
     if (servos == nullptr || engine == nullptr) {
       responseStream->println("{\"ok\":false,\"reason\":\"not_initialized\"}");
       return;
@@ -445,61 +897,61 @@ public:
 
     MovementStyleParams style = engine->getMovementStyle();
 
-    if (strcmp(args, "sigh") == 0) {
-      // Sink down slowly, hold, return
-      style.speed = 0.25f;  // Very slow
-      int nodDown = constrain(curNod + 10, 80, 150);
-      servos->smoothMoveTo(curBase, nodDown, curTilt, style);
-      // Note: Python handles the timing/return via subsequent commands
-    }
-    else if (strcmp(args, "double_take") == 0) {
-      // Quick look away then snap back
-      style.speed = 0.9f;  // Fast
-      int awayBase = (curBase > 90) ?
-                     constrain(curBase - 30, 10, 170) :
-                     constrain(curBase + 30, 10, 170);
-      servos->smoothMoveTo(awayBase, curNod, curTilt, style);
-      // Python sends follow-up LOOK to snap back
-    }
-    else if (strcmp(args, "settle") == 0) {
-      // Sink deeper into rest
-      style.speed = 0.2f;  // Very slow
-      servos->smoothMoveTo(curBase, constrain(curNod + 12, 80, 150), curTilt, style);
-    }
-    else if (strcmp(args, "expectant") == 0) {
-      // Lean forward, look at person
-      style.speed = 0.5f;
-      servos->smoothMoveTo(90, 105, curTilt, style);
-    }
-    else if (strcmp(args, "dismissive") == 0) {
-      // Slow turn away
-      style.speed = 0.2f;  // Very slow, deliberate
-      int awayBase = (curBase >= 90) ?
-                     constrain(curBase - 40, 10, 170) :
-                     constrain(curBase + 40, 10, 170);
-      servos->smoothMoveTo(awayBase, curNod, curTilt, style);
-    }
-    else if (strcmp(args, "curious_tilt") == 0) {
-      // Curious head tilt — delegate to EXPRESS:curious
-      if (animator != nullptr && !animator->isCurrentlyAnimating()) {
-        Personality& pers = engine->getPersonality();
-        Needs& needs = engine->getNeeds();
-        animator->expressEmotion(CURIOUS, pers, needs);
+    // Single poses as in cmdPerform(); the gestures go through the animator
+    switch (name) {
+      case AI_PHYSICAL_SIGH: {
+        // Sink down slowly, hold, return
+        style.speed = 0.25f;  // Very slow
+        int nodDown = constrain(curNod + 10, 80, 150);
+        servos->startMove(curBase, nodDown, curTilt, style);
+        // Note: Python handles the timing/return via subsequent commands
+        break;
       }
-    }
-    else if (strcmp(args, "startled") == 0) {
-      // Quick startle — delegate to EXPRESS:startled
-      if (animator != nullptr && !animator->isCurrentlyAnimating()) {
-        Personality& pers = engine->getPersonality();
-        Needs& needs = engine->getNeeds();
-        animator->expressEmotion(STARTLED, pers, needs);
+      case AI_PHYSICAL_DOUBLE_TAKE: {
+        // Quick look away then snap back
+        style.speed = 0.9f;  // Fast
+        int awayBase = (curBase > 90) ?
+                       constrain(curBase - 30, 10, 170) :
+                       constrain(curBase + 30, 10, 170);
+        servos->startMove(awayBase, curNod, curTilt, style);
+        // Python sends follow-up LOOK to snap back
+        break;
       }
-    }
-    else {
-      responseStream->print("{\"ok\":false,\"reason\":\"unknown_physical\",\"name\":\"");
-      responseStream->print(args);
-      responseStream->println("\"}");
-      return;
+      case AI_PHYSICAL_SETTLE:
+        // Sink deeper into rest
+        style.speed = 0.2f;  // Very slow
+        servos->startMove(curBase, constrain(curNod + 12, 80, 150), curTilt, style);
+        break;
+      case AI_PHYSICAL_EXPECTANT:
+        // Lean forward, look at person
+        style.speed = 0.5f;
+        servos->startMove(90, 105, curTilt, style);
+        break;
+      case AI_PHYSICAL_DISMISSIVE: {
+        // Slow turn away
+        style.speed = 0.2f;  // Very slow, deliberate
+        int awayBase = (curBase >= 90) ?
+                       constrain(curBase - 40, 10, 170) :
+                       constrain(curBase + 40, 10, 170);
+        servos->startMove(awayBase, curNod, curTilt, style);
+        break;
+      }
+      case AI_PHYSICAL_CURIOUS_TILT:
+        // Curious head tilt — delegate to EXPRESS:curious
+        if (animator != nullptr && !animator->isCurrentlyAnimating()) {
+          Personality& pers = engine->getPersonality();
+          Needs& needs = engine->getNeeds();
+          animator->expressEmotion(CURIOUS, pers, needs);
+        }
+        break;
+      case AI_PHYSICAL_STARTLED:
+        // Quick startle — delegate to EXPRESS:startled
+        if (animator != nullptr && !animator->isCurrentlyAnimating()) {
+          Personality& pers = engine->getPersonality();
+          Needs& needs = engine->getNeeds();
+          animator->expressEmotion(STARTLED, pers, needs);
+        }
+        break;
     }
 
     responseStream->println("{\"ok\":true}");
@@ -514,18 +966,13 @@ public:
   void cmdVisionContext(const char* jsonStr) {
     if (engine == nullptr) return;
 
-    // Parse long-key fields
-    float sceneNovelty = extractFloat(jsonStr, "novelty", 0.0f);
-    int faceCount = extractInt(jsonStr, "faces", 0);
-
-    char expression[16] = "neutral";
-    extractString(jsonStr, "expr", expression, sizeof(expression));
-
-    char changeType[24] = "none";
-    extractString(jsonStr, "change", changeType, sizeof(changeType));
-
-    char sceneDesc[100] = "";
-    extractString(jsonStr, "desc", sceneDesc, sizeof(sceneDesc));
+    // Parse long-key fields in one tokenizer pass
+    VisionContext ctx = { 0.0f, 0, "neutral", "none", "" };
+    JsonToken tokens[JSON_MAX_TOKENS];
+    int count = jsonTokenize(jsonStr, strlen(jsonStr), tokens, JSON_MAX_TOKENS);
+    if (count < 0) return;
+    jsonBind(jsonStr, tokens, count, VISION_CONTEXT_FIELDS,
+             JSON_FIELD_COUNT(VISION_CONTEXT_FIELDS), &ctx);
 
     // ─── Apply to behavior systems ───
     Needs& needs = engine->getNeeds();
@@ -533,35 +980,35 @@ public:
     ConsciousnessLayer& consciousness = engine->getConsciousness();
 
     // 1. Visual novelty → stimulation satisfaction + arousal bump
-    if (sceneNovelty > 0.3f) {
-      needs.addStimulationSatisfaction(sceneNovelty * 0.3f);
-      emotion.nudge(sceneNovelty * 0.05f, 0.0f, 0.0f);  // Arousal bump
+    if (ctx.sceneNovelty > 0.3f) {
+      needs.addStimulationSatisfaction(ctx.sceneNovelty * 0.3f);
+      emotion.nudge(ctx.sceneNovelty * 0.05f, 0.0f, 0.0f);  // Arousal bump
     }
 
     // 2. Expression → emotional mirroring
-    if (strcmp(expression, "smiling") == 0 || strcmp(expression, "happy") == 0) {
+    if (strcmp(ctx.expression, "smiling") == 0 || strcmp(ctx.expression, "happy") == 0) {
       emotion.nudge(0.02f, 0.05f, 0.0f);
-    } else if (strcmp(expression, "frowning") == 0 || strcmp(expression, "angry") == 0) {
+    } else if (strcmp(ctx.expression, "frowning") == 0 || strcmp(ctx.expression, "angry") == 0) {
       emotion.nudge(0.03f, -0.04f, -0.02f);
-    } else if (strcmp(expression, "surprised") == 0) {
+    } else if (strcmp(ctx.expression, "surprised") == 0) {
       emotion.nudge(0.05f, 0.02f, 0.0f);
-    } else if (strcmp(expression, "sad") == 0) {
+    } else if (strcmp(ctx.expression, "sad") == 0) {
       emotion.nudge(-0.01f, -0.03f, 0.0f);
     }
 
     // 3. Change events → consciousness + investigation targets
-    if (strcmp(changeType, "new_object") == 0) {
-      consciousness.onEnvironmentChange(sceneNovelty);
+    if (strcmp(ctx.changeType, "new_object") == 0) {
+      consciousness.onEnvironmentChange(ctx.sceneNovelty);
       lastVisionTarget.hasTarget = true;
-      lastVisionTarget.novelty = sceneNovelty;
-      strncpy(lastVisionTarget.description, sceneDesc, sizeof(lastVisionTarget.description) - 1);
+      lastVisionTarget.novelty = ctx.sceneNovelty;
+      strncpy(lastVisionTarget.description, ctx.sceneDesc, sizeof(lastVisionTarget.description) - 1);
       lastVisionTarget.description[sizeof(lastVisionTarget.description) - 1] = '\0';
       lastVisionTarget.timestamp = millis();
-    } else if (strcmp(changeType, "person_left") == 0) {
+    } else if (strcmp(ctx.changeType, "person_left") == 0) {
       consciousness.onEnvironmentChange(0.4f);
-    } else if (strcmp(changeType, "person_appeared") == 0) {
+    } else if (strcmp(ctx.changeType, "person_appeared") == 0) {
       consciousness.onEnvironmentChange(0.6f);
-    } else if (strcmp(changeType, "investigation_result") == 0) {
+    } else if (strcmp(ctx.changeType, "investigation_result") == 0) {
       // Investigation completed — Buddy now "understands" what it was looking at
       engine->setInvestigationDescriptionReceived(true);
       needs.addStimulationSatisfaction(0.2f);
@@ -570,7 +1017,7 @@ public:
     }
 
     // 4. Store scene description for context
-    strncpy(lastSceneDescription, sceneDesc, sizeof(lastSceneDescription) - 1);
+    strncpy(lastSceneDescription, ctx.sceneDesc, sizeof(lastSceneDescription) - 1);
     lastSceneDescription[sizeof(lastSceneDescription) - 1] = '\0';
     lastVisionUpdateTime = millis();
 
@@ -579,42 +1026,33 @@ public:
 
 private:
 
-  // ── Simple JSON field extractors (no external library) ──
-  float extractFloat(const char* json, const char* key, float defaultVal) {
-    char searchKey[32];
-    snprintf(searchKey, sizeof(searchKey), "\"%s\":", key);
-    const char* pos = strstr(json, searchKey);
-    if (!pos) return defaultVal;
-    pos += strlen(searchKey);
-    while (*pos == ' ') pos++;
-    return atof(pos);
-  }
-
-  int extractInt(const char* json, const char* key, int defaultVal) {
-    return (int)extractFloat(json, key, (float)defaultVal);
-  }
-
-  void extractString(const char* json, const char* key, char* out, int maxLen) {
-    char searchKey[32];
-    snprintf(searchKey, sizeof(searchKey), "\"%s\":\"", key);
-    const char* pos = strstr(json, searchKey);
-    if (!pos) return;
-    pos += strlen(searchKey);
-    int i = 0;
-    while (*pos && *pos != '"' && i < maxLen - 1) {
-      out[i++] = *pos++;
-    }
-    out[i] = '\0';
-  }
-
   // ============================================
   // Helper: clear any active AI animation mode
   // ============================================
 
   void stopAIAnim() {
+    if (aiAnimMode != AI_ANIM_NONE && servos != nullptr) {
+      servos->fadeLayer(LAYER_EXPRESSION);
+    }
     aiAnimMode = AI_ANIM_NONE;
   }
 
+  // Looping animations oscillate around a centre pose: glide there first
+  void startAIAnim(AIAnimMode mode, int base, int nod, int tilt) {
+    if (reflex == nullptr || !reflex->isActive()) {
+      MovementStyleParams style;
+      if (engine != nullptr) {
+        style = engine->getMovementStyle();
+      } else {
+        style.speed = 0.5f;
+      }
+      servos->startMove(base, nod, tilt, style);
+    }
+    aiAnimMode = mode;
+    aiAnimStartTime = millis();
+    lastAiAnimStep = 0;
+  }
+
   // ============================================
   // Helper: check if servos are available for AI commands
   // Returns false and prints JSON error if blocked
@@ -632,6 +1070,18 @@ private:
     return true;
   }
 
+  // ============================================
+  // Helper: print up to maxLen chars as a JSON string body
+  // ============================================
+
+  void printEscaped(const char* s, int maxLen) {
+    for (int i = 0; i < maxLen && s[i] != '\0'; i++) {
+      char c = s[i];
+      if (c == '"' || c == '\\') responseStream->print('\\');
+      responseStream->print(c);
+    }
+  }
+
   // ============================================
   // !QUERY - Return full state as JSON
   // ============================================
@@ -641,102 +1091,221 @@ private:
   }
 
   void sendStateJSON() {
-    if (engine == nullptr || servos == nullptr) {
+    StateValue cur[STATE_FIELD_COUNT];
+    if (!captureState(cur)) {
       responseStream->println("{\"ok\":false,\"reason\":\"not_initialized\"}");
       return;
     }
 
+    // Build entire JSON in buffer, then send as single write
+    char buf[768];
+    int len = formatState(buf, sizeof(buf), "{", cur, STATE_ALL_FIELDS);
+    if (len > 0) {
+      if (esp32Linked || responseStream == &Serial) {
+        responseStream->println(buf);
+      }
+    } else {
+      // Buffer overflow fallback — should never happen with 768 bytes
+      responseStream->println("{\"ok\":false,\"reason\":\"buffer_overflow\"}");
+    }
+  }
+
+  // Sample every STATE_FIELDS entry; false until init() has run
+  bool captureState(StateValue* v) {
+    if (engine == nullptr || servos == nullptr) return false;
+
     Emotion& emo = engine->getEmotion();
     Needs& needs = engine->getNeeds();
-    Behavior beh = engine->getCurrentBehavior();
+    ConsciousnessLayer& consciousness = engine->getConsciousness();
+    SpeechUrgeSystem& urge = engine->getSpeechUrge();
 
     int base, nod, tilt;
     servos->getPosition(base, nod, tilt);
 
     bool tracking = (reflex != nullptr && reflex->isActive());
     bool animating = (animator != nullptr && animator->isCurrentlyAnimating())
+                     || servos->isBusy() || servos->inSequence()
                      || (aiAnimMode != AI_ANIM_NONE);
 
-    // Consciousness state
-    ConsciousnessLayer& consciousness = engine->getConsciousness();
-
-    const char* epistemicStr = "confident";
-    switch(consciousness.getEpistemicState()) {
-        case EPIST_CONFIDENT:  epistemicStr = "confident"; break;
-        case EPIST_UNCERTAIN:  epistemicStr = "uncertain"; break;
-        case EPIST_CONFUSED:   epistemicStr = "confused"; break;
-        case EPIST_LEARNING:   epistemicStr = "learning"; break;
-        case EPIST_CONFLICTED: epistemicStr = "conflicted"; break;
-        case EPIST_WONDERING:  epistemicStr = "wondering"; break;
-    }
-
-    // Build entire JSON in buffer, then send as single write
-    // Phase B: added hasVisionTarget and visionAge fields
+    // Phase B: hasVisionTarget and visionAge fields
     unsigned long visionAge = (lastVisionUpdateTime > 0) ?
       (millis() - lastVisionUpdateTime) / 1000 : 9999;
 
-    char buf[600];
-    int len = snprintf(buf, sizeof(buf),
-      "{\"arousal\":%.2f,\"valence\":%.2f,\"dominance\":%.2f,"
-      "\"emotion\":\"%s\",\"behavior\":\"%s\","
-      "\"stimulation\":%.2f,\"social\":%.2f,\"energy\":%.2f,"
-      "\"safety\":%.2f,\"novelty\":%.2f,"
-      "\"tracking\":%s,\"animating\":%s,"
-      "\"servoBase\":%d,\"servoNod\":%d,\"servoTilt\":%d,"
-      "\"epistemic\":\"%s\",\"tension\":%.2f,"
-      "\"wondering\":%s,\"selfAwareness\":%.2f,"
-      "\"speechUrge\":%.2f,\"speechTrigger\":\"%s\","
-      "\"wantsToSpeak\":%s,"
-      "\"hasVisionTarget\":%s,\"visionAge\":%lu}",
-      emo.getArousal(), emo.getValence(), emo.getDominance(),
-      emo.getLabelString(), behaviorName(beh),
-      needs.getStimulation(), needs.getSocial(), needs.getEnergy(),
-      needs.getSafety(), needs.getNovelty(),
-      tracking ? "true" : "false",
-      animating ? "true" : "false",
-      base, nod, tilt,
-      epistemicStr, consciousness.getTension(),
-      consciousness.isWondering() ? "true" : "false",
-      consciousness.getSelfAwareness(),
-      engine->getSpeechUrge().getUrge(),
-      engine->getSpeechUrge().triggerToString(),
-      engine->getSpeechUrge().wantsToSpeak() ? "true" : "false",
-      lastVisionTarget.hasTarget ? "true" : "false",
-      visionAge
-    );
-
-    if (len > 0 && len < (int)sizeof(buf)) {
-      if (esp32Linked || responseStream == &Serial) {
-        responseStream->println(buf);
+    for (int i = 0; i < STATE_FIELD_COUNT; i++) v[i].str = nullptr;
+    v[STATE_AROUSAL].num = emo.getArousal();
+    v[STATE_VALENCE].num = emo.getValence();
+    v[STATE_DOMINANCE].num = emo.getDominance();
+    v[STATE_EMOTION].str = emo.getLabelString();
+    v[STATE_BEHAVIOR].str = behaviorName(engine->getCurrentBehavior());
+    v[STATE_STIMULATION].num = needs.getStimulation();
+    v[STATE_SOCIAL].num = needs.getSocial();
+    v[STATE_ENERGY].num = needs.getEnergy();
+    v[STATE_SAFETY].num = needs.getSafety();
+    v[STATE_NOVELTY].num = needs.getNovelty();
+    v[STATE_TRACKING].num = tracking;
+    v[STATE_ANIMATING].num = animating;
+    v[STATE_SERVO_BASE].num = base;
+    v[STATE_SERVO_NOD].num = nod;
+    v[STATE_SERVO_TILT].num = tilt;
+    v[STATE_EPISTEMIC].str = ConsciousnessLayer::epistemicName(consciousness.getEpistemicState());
+    v[STATE_TENSION].num = consciousness.getTension();
+    v[STATE_WONDERING].num = consciousness.isWondering();
+    v[STATE_SELF_AWARENESS].num = consciousness.getSelfAwareness();
+    v[STATE_SPEECH_URGE].num = urge.getUrge();
+    v[STATE_SPEECH_TRIGGER].str = urge.triggerToString();
+    v[STATE_WANTS_TO_SPEAK].num = urge.wantsToSpeak();
+    v[STATE_HAS_VISION_TARGET].num = lastVisionTarget.hasTarget;
+    v[STATE_VISION_AGE].num = (float)visionAge;
+    v[STATE_CMD_QUEUE].num = cmdQueue.depth();
+    v[STATE_CMD_COALESCED].num = (float)cmdQueue.coalesced;
+    v[STATE_CMD_PREEMPTED].num = (float)cmdQueue.preempted;
+    return true;
+  }
+
+  static const uint32_t STATE_ALL_FIELDS = ((uint32_t)1 << STATE_FIELD_COUNT) - 1;
+
+  // Fields that moved by at least their epsilon since they were last sent
+  uint32_t changedStateFields(const StateValue* cur, const StateValue* sent) {
+    uint32_t changed = 0;
+    for (int i = 0; i < STATE_FIELD_COUNT; i++) {
+      const StateFieldSpec& spec = STATE_FIELDS[i];
+      bool differs;
+      if (spec.type == STATE_STR) {
+        differs = sent[i].str == nullptr || strcmp(cur[i].str, sent[i].str) != 0;
+      } else if (spec.type == STATE_BOOL) {
+        differs = cur[i].num != sent[i].num;
+      } else {
+        differs = fabsf(cur[i].num - sent[i].num) >= spec.epsilon;
+      }
+      if (differs) changed |= STATE_BIT(i);
+    }
+    return changed;
+  }
+
+  // head + the selected fields + "}"; returns the length, or 0 if it didn't fit
+  int formatState(char* buf, int size, const char* head, const StateValue* v, uint32_t fields) {
+    int len = snprintf(buf, size, "%s", head);
+    bool first = true;
+    for (int i = 0; i < STATE_FIELD_COUNT && len < size; i++) {
+      if (!(fields & STATE_BIT(i))) continue;
+      const StateFieldSpec& spec = STATE_FIELDS[i];
+      const char* sep = first ? "" : ",";
+      first = false;
+      switch (spec.type) {
+        case STATE_FLOAT:
+          len += snprintf(buf + len, size - len, "%s\"%s\":%.2f", sep, spec.key, v[i].num);
+          break;
+        case STATE_INT:
+          len += snprintf(buf + len, size - len, "%s\"%s\":%ld", sep, spec.key, (long)v[i].num);
+          break;
+        case STATE_BOOL:
+          len += snprintf(buf + len, size - len, "%s\"%s\":%s", sep, spec.key,
+                          v[i].num != 0 ? "true" : "false");
+          break;
+        case STATE_STR:
+          len += snprintf(buf + len, size - len, "%s\"%s\":\"%s\"", sep, spec.key, v[i].str);
+          break;
       }
-    } else {
-      // Buffer overflow fallback — should never happen with 600 bytes
-      responseStream->println("{\"ok\":false,\"reason\":\"buffer_overflow\"}");
     }
+    if (len < size) len += snprintf(buf + len, size - len, "}");
+    return (len > 0 && len < size) ? len : 0;
   }
 
   // ============================================
-  // !LOOK:base,nod - Move servos safely
+  // !COMMANDS - Machine-readable command list
+  // !COMMANDS:NAME - Schema of one command, from AI_COMMAND_TABLE
+  // Kept to one command per line so replies fit the bridge's line limit
   // ============================================
 
-  void cmdLook(const char* args) {
-    stopAIAnim();
-    if (!checkServoAccess()) return;
+  void cmdCommands(const char* name) {
+    if (*name == '\0') {
+      responseStream->print("{\"ok\":true,\"count\":");
+      responseStream->print((int)AI_CMD_COUNT);
+      responseStream->print(",\"commands\":[");
+      for (int i = 0; i < AI_CMD_COUNT; i++) {
+        if (i > 0) responseStream->print(',');
+        responseStream->print('"');
+        responseStream->print(AI_COMMAND_TABLE[i].name);
+        responseStream->print('"');
+      }
+      responseStream->println("]}");
+      return;
+    }
 
-    int base, nod;
-    if (sscanf(args, "%d,%d", &base, &nod) != 2) {
-      responseStream->println("{\"ok\":false,\"reason\":\"parse_error\"}");
+    int len = strlen(name);
+    const AICommandSpec* cmd = (len <= AI_CMD_NAME_MAX) ? aiFindCommand(name, len, aiHash(name)) : nullptr;
+    if (cmd == nullptr) {
+      responseStream->print("{\"ok\":false,\"reason\":\"unknown_command\",\"cmd\":\"");
+      printEscaped(name, AI_ECHO_MAX);
+      responseStream->println("\"}");
       return;
     }
 
-    base = constrain(base, 10, 170);
-    nod = constrain(nod, 80, 150);
+    responseStream->print("{\"ok\":true,\"name\":\"");
+    responseStream->print(cmd->name);
+    responseStream->print("\",\"help\":\"");
+    responseStream->print(cmd->help);
+    responseStream->print("\",\"args\":[");
+    for (int a = 0; a < cmd->argCount; a++) {
+      const AIArgSpec& spec = cmd->args[a];
+      if (a > 0) responseStream->print(',');
+      responseStream->print("{\"name\":\"");
+      responseStream->print(spec.name);
+      responseStream->print("\",\"type\":\"");
+      switch (spec.type) {
+        case AI_ARG_INT:
+          responseStream->print("int\",\"min\":");
+          responseStream->print((int)spec.lo);
+          responseStream->print(",\"max\":");
+          responseStream->print((int)spec.hi);
+          if (spec.optional) {
+            responseStream->print(",\"default\":");
+            responseStream->print((int)spec.def);
+          }
+          break;
+        case AI_ARG_FLOAT:
+          responseStream->print("float\",\"min\":");
+          responseStream->print(spec.lo, 2);
+          responseStream->print(",\"max\":");
+          responseStream->print(spec.hi, 2);
+          if (spec.optional) {
+            responseStream->print(",\"default\":");
+            responseStream->print(spec.def, 2);
+          }
+          break;
+        case AI_ARG_WORD:
+          responseStream->print("word\",\"words\":[");
+          for (int w = 0; w < spec.words->count; w++) {
+            if (w > 0) responseStream->print(',');
+            responseStream->print('"');
+            responseStream->print(spec.words->words[w].text);
+            responseStream->print('"');
+          }
+          responseStream->print(']');
+          break;
+        case AI_ARG_TEXT:
+          responseStream->print("text\"");
+          break;
+      }
+      responseStream->print('}');
+    }
+    responseStream->println("]}");
+  }
+
+  // ============================================
+  // !LOOK:base,nod - Move servos safely
+  // ============================================
+
+  // base/nod arrive clamped to 10..170 / 80..150 by the schema
+  void cmdLook(int base, int nod) {
+    stopAIAnim();
+    if (!checkServoAccess()) return;
 
     MovementStyleParams style = engine->getMovementStyle();
 
     int curBase, curNod, curTilt;
     servos->getPosition(curBase, curNod, curTilt);
-    servos->smoothMoveTo(base, nod, curTilt, style);
+    servos->startMove(base, nod, curTilt, style);   // Motion task carries it out
 
     responseStream->println("{\"ok\":true}");
   }
@@ -745,58 +1314,32 @@ private:
   // !SATISFY:need,amount - Satisfy a homeostatic need
   // ============================================
 
-  void cmdSatisfy(const char* args) {
+  void cmdSatisfy(AINeed need, float amount) {
     if (engine == nullptr) {
       responseStream->println("{\"ok\":false,\"reason\":\"not_initialized\"}");
       return;
     }
 
-    char needName[16];
-    float amount = 0.0;
-
-    const char* comma = strchr(args, ',');
-    if (comma == nullptr) {
-      responseStream->println("{\"ok\":false,\"reason\":\"parse_error\"}");
-      return;
-    }
-
-    int nameLen = comma - args;
-    if (nameLen <= 0 || nameLen >= (int)sizeof(needName)) {
-      responseStream->println("{\"ok\":false,\"reason\":\"parse_error\"}");
-      return;
-    }
-
-    strncpy(needName, args, nameLen);
-    needName[nameLen] = '\0';
-    amount = atof(comma + 1);
-
-    if (amount < 0.0f) amount = 0.0f;
-    if (amount > 1.0f) amount = 1.0f;
-
     Needs& needs = engine->getNeeds();
     float resultValue = 0.0;
 
-    if (strcmp(needName, "social") == 0) {
-      needs.satisfySocial(amount);
-      resultValue = needs.getSocial();
-    }
-    else if (strcmp(needName, "stimulation") == 0) {
-      needs.satisfyStimulation(amount);
-      resultValue = needs.getStimulation();
-    }
-    else if (strcmp(needName, "novelty") == 0) {
-      needs.satisfyNovelty(amount);
-      resultValue = needs.getNovelty();
-    }
-    else {
-      responseStream->print("{\"ok\":false,\"reason\":\"unknown_need\",\"need\":\"");
-      responseStream->print(needName);
-      responseStream->println("\"}");
-      return;
+    switch (need) {
+      case AI_NEED_SOCIAL:
+        needs.satisfySocial(amount);
+        resultValue = needs.getSocial();
+        break;
+      case AI_NEED_STIMULATION:
+        needs.satisfyStimulation(amount);
+        resultValue = needs.getStimulation();
+        break;
+      case AI_NEED_NOVELTY:
+        needs.satisfyNovelty(amount);
+        resultValue = needs.getNovelty();
+        break;
     }
 
     responseStream->print("{\"ok\":true,\"need\":\"");
-    responseStream->print(needName);
+    responseStream->print(AI_NEED_WORDS[need].text);
     responseStream->print("\",\"value\":");
     responseStream->print(resultValue, 2);
     responseStream->println("}");
@@ -822,7 +1365,7 @@ private:
   // !EXPRESS:emotion - Express an emotion via animation
   // ============================================
 
-  void cmdExpress(const char* args) {
+  void cmdExpress(EmotionLabel label) {
     stopAIAnim();
 
     if (animator == nullptr || engine == nullptr) {
@@ -840,14 +1383,6 @@ private:
       return;
     }
 
-    EmotionLabel label;
-    if (!parseEmotionLabel(args, label)) {
-      responseStream->print("{\"ok\":false,\"reason\":\"unknown_emotion\",\"emotion\":\"");
-      responseStream->print(args);
-      responseStream->println("\"}");
-      return;
-    }
-
     Personality& pers = engine->getPersonality();
     Needs& needs = engine->getNeeds();
     animator->expressEmotion(label, pers, needs);
@@ -859,7 +1394,7 @@ private:
   // !NOD:count - Nod yes animation
   // ============================================
 
-  void cmdNod(const char* args) {
+  void cmdNod(int count) {
     stopAIAnim();
 
     if (animator == nullptr || engine == nullptr) {
@@ -877,10 +1412,6 @@ private:
       return;
     }
 
-    int count = atoi(args);
-    if (count < 1) count = 1;
-    if (count > 10) count = 10;
-
     Emotion& emo = engine->getEmotion();
     Personality& pers = engine->getPersonality();
     Needs& needs = engine->getNeeds();
@@ -893,7 +1424,7 @@ private:
   // !SHAKE:count - Shake no animation
   // ============================================
 
-  void cmdShake(const char* args) {
+  void cmdShake(int count) {
     stopAIAnim();
 
     if (animator == nullptr || engine == nullptr) {
@@ -911,10 +1442,6 @@ private:
       return;
     }
 
-    int count = atoi(args);
-    if (count < 1) count = 1;
-    if (count > 10) count = 10;
-
     Emotion& emo = engine->getEmotion();
     Personality& pers = engine->getPersonality();
     Needs& needs = engine->getNeeds();
@@ -924,51 +1451,133 @@ private:
   }
 
   // ============================================
-  // !STREAM:on/off - Toggle state streaming
+  // !STREAM:on/off/delta - Toggle state streaming
+  // delta: STATE:{"seq":n,...changed fields}, with "key":1 on keyframes
+  // (every field). Re-sending !STREAM:delta forces a keyframe.
   // ============================================
 
-  void cmdStream(const char* args) {
-    if (strcmp(args, "on") == 0) {
-      streamingEnabled = true;
-      lastStreamTime = millis();
-      responseStream->println("{\"ok\":true,\"streaming\":true}");
+  void cmdStream(AIStreamMode mode) {
+    streamMode = mode;
+    streamTarget = responseStream;
+    lastStreamTime = millis();
+    keyframePending = true;
+
+    switch (mode) {
+      case AI_STREAM_FULL:
+        responseStream->println("{\"ok\":true,\"streaming\":true,\"mode\":\"full\"}");
+        break;
+      case AI_STREAM_DELTA:
+        responseStream->print("{\"ok\":true,\"streaming\":true,\"mode\":\"delta\",\"seq\":");
+        responseStream->print(streamSeq);
+        responseStream->print(",\"keyframe_every\":");
+        responseStream->print(AI_STREAM_KEYFRAME_EVERY);
+        responseStream->println("}");
+        break;
+      default:
+        responseStream->println("{\"ok\":true,\"streaming\":false}");
+        break;
     }
-    else if (strcmp(args, "off") == 0) {
-      streamingEnabled = false;
-      responseStream->println("{\"ok\":true,\"streaming\":false}");
+  }
+
+  // ============================================
+  // !SUB:topic@rate,... - Topic subscriptions
+  // rate is a frequency in Hz (1-50, higher is clamped) or "event".
+  // Each !SUB replaces the whole set, so re-sending after a reconnect is
+  // harmless; every subscribed topic goes out once right away.
+  // ============================================
+
+  void cmdSub(const char* text) {
+    TopicSub next[AI_TOPIC_COUNT];
+    for (int t = 0; t < AI_TOPIC_COUNT; t++) {
+      next[t].active = false;
+      next[t].periodMs = AI_SUB_EVENT;
+      next[t].lastSent = 0;
+      next[t].pending = true;
+    }
+
+    if (strcasecmp(text, "off") != 0) {
+      const char* p = text;
+      while (*p != '\0') {
+        const char* end = p;
+        while (*end != '\0' && *end != ',') end++;
+        const char* at = p;
+        while (at < end && *at != '@') at++;
+
+        int topic = aiMatchWord(AI_TOPICS, p, (int)(at - p));
+        if (topic < 0) {
+          responseStream->print("{\"ok\":false,\"reason\":\"unknown_topic\",\"topic\":\"");
+          printEscaped(p, min((int)(at - p), AI_ECHO_MAX));
+          responseStream->println("\"}");
+          return;
+        }
+
+        const char* rate = (at < end) ? at + 1 : end;
+        int rateLen = (int)(end - rate);
+        uint16_t periodMs = AI_SUB_EVENT;
+        if (!(rateLen == 5 && strncasecmp(rate, "event", 5) == 0)) {
+          char* stop;
+          long hz = strtol(rate, &stop, 10);
+          if (rateLen == 0 || stop != end || hz < 1) {
+            responseStream->print("{\"ok\":false,\"reason\":\"bad_rate\",\"topic\":\"");
+            responseStream->print(AI_TOPIC_WORDS[topic].text);
+            responseStream->println("\"}");
+            return;
+          }
+          if (hz > AI_SUB_MAX_HZ) hz = AI_SUB_MAX_HZ;
+          periodMs = (uint16_t)(1000 / hz);
+        }
+        next[topic].active = true;
+        next[topic].periodMs = periodMs;
+
+        p = (*end == ',') ? end + 1 : end;
+      }
     }
-    else {
-      responseStream->println("{\"ok\":false,\"reason\":\"use_on_or_off\"}");
+
+    memcpy(subs, next, sizeof(subs));
+    subTarget = responseStream;
+    for (int i = 0; i < STATE_FIELD_COUNT; i++) subSent[i].str = nullptr;
+
+    responseStream->print("{\"ok\":true,\"topics\":{");
+    bool first = true;
+    for (int t = 0; t < AI_TOPIC_COUNT; t++) {
+      if (!subs[t].active) continue;
+      if (!first) responseStream->print(',');
+      first = false;
+      responseStream->print('"');
+      responseStream->print(AI_TOPIC_WORDS[t].text);
+      responseStream->print("\":");
+      if (subs[t].periodMs == AI_SUB_EVENT) {
+        responseStream->print("\"event\"");
+      } else {
+        responseStream->print(1000 / subs[t].periodMs);
+      }
     }
+    responseStream->println("}}");
   }
 
   // ============================================
   // !ATTENTION:direction - Look in a direction
   // ============================================
 
-  void cmdAttention(const char* args) {
+  void cmdAttention(AIDirection dir) {
     stopAIAnim();
     if (!checkServoAccess()) return;
 
     int base, nod;
 
-    if (strcasecmp(args, "center") == 0)      { base = 90;  nod = 115; }
-    else if (strcasecmp(args, "left") == 0)   { base = 140; nod = 115; }
-    else if (strcasecmp(args, "right") == 0)  { base = 40;  nod = 115; }
-    else if (strcasecmp(args, "up") == 0)     { base = 90;  nod = 90;  }
-    else if (strcasecmp(args, "down") == 0)   { base = 90;  nod = 140; }
-    else {
-      responseStream->print("{\"ok\":false,\"reason\":\"unknown_direction\",\"dir\":\"");
-      responseStream->print(args);
-      responseStream->println("\"}");
-      return;
+    switch (dir) {
+      case AI_DIR_LEFT:   base = 140; nod = 115; break;
+      case AI_DIR_RIGHT:  base = 40;  nod = 115; break;
+      case AI_DIR_UP:     base = 90;  nod = 90;  break;
+      case AI_DIR_DOWN:   base = 90;  nod = 140; break;
+      default:            base = 90;  nod = 115; break;   // center
     }
 
     MovementStyleParams style = engine->getMovementStyle();
 
     int curBase, curNod, curTilt;
     servos->getPosition(curBase, curNod, curTilt);
-    servos->smoothMoveTo(base, nod, curTilt, style);
+    servos->startMove(base, nod, curTilt, style);   // Motion task carries it out
 
     responseStream->println("{\"ok\":true}");
   }
@@ -988,7 +1597,7 @@ private:
 
     int curBase, curNod, curTilt;
     servos->getPosition(curBase, curNod, curTilt);
-    servos->smoothMoveTo(90, 105, curTilt, style);
+    servos->startMove(90, 105, curTilt, style);
 
     responseStream->println("{\"ok\":true}");
   }
@@ -1006,15 +1615,8 @@ private:
       return;
     }
 
-    // Don't start if reflex is actively tracking
-    if (reflex != nullptr && reflex->isActive()) {
-      responseStream->println("{\"ok\":false,\"reason\":\"tracking_active\"}");
-      return;
-    }
-
-    aiAnimMode = AI_ANIM_THINKING;
-    aiAnimStartTime = millis();
-    lastAiAnimStep = 0;
+    // Runs alongside reflex tracking (tracking wins on base/nod)
+    startAIAnim(AI_ANIM_THINKING, 90, 108, 90);
 
     responseStream->println("{\"ok\":true}");
   }
@@ -1041,14 +1643,7 @@ private:
       return;
     }
 
-    if (reflex != nullptr && reflex->isActive()) {
-      responseStream->println("{\"ok\":false,\"reason\":\"tracking_active\"}");
-      return;
-    }
-
-    aiAnimMode = AI_ANIM_SPEAKING;
-    aiAnimStartTime = millis();
-    lastAiAnimStep = 0;
+    startAIAnim(AI_ANIM_SPEAKING, 90, 112, 85);
 
     responseStream->println("{\"ok\":true}");
   }
@@ -1064,7 +1659,7 @@ private:
 
   // ============================================
   // !ACKNOWLEDGE - Quick subtle nod
-  // Brief blocking (~150ms) - acceptable for one-shot
+  // Non-blocking: a 120ms nod pulse on top of the current pose
   // ============================================
 
   void cmdAcknowledge() {
@@ -1078,14 +1673,8 @@ private:
       return;
     }
 
-    int base, nod, tilt;
-    servos->getPosition(base, nod, tilt);
-
     // Quick small nod: down 8 degrees, then back
-    int nodDown = constrain(nod + 8, 80, 150);
-    servos->directWrite(base, nodDown, false);
-    delay(120);
-    servos->directWrite(base, nod, false);
+    servos->nudge(AXIS_NOD, 8, 120);
 
     responseStream->println("{\"ok\":true}");
   }
@@ -1121,6 +1710,7 @@ private:
 
   void cmdIdle() {
     stopAIAnim();
+    clipPlayer.stop();
 
     if (servos != nullptr && engine != nullptr) {
       // Return to neutral position
@@ -1128,7 +1718,7 @@ private:
         MovementStyleParams style = engine->getMovementStyle();
         int curBase, curNod, curTilt;
         servos->getPosition(curBase, curNod, curTilt);
-        servos->smoothMoveTo(90, 115, curTilt, style);
+        servos->startMove(90, 115, curTilt, style);   // SAFETY path — never wait here
       }
     }
 
@@ -1150,6 +1740,106 @@ private:
     responseStream->println("{\"ok\":true,\"action\":\"spoke_acknowledged\"}");
   }
 
+  // ============================================
+  // !BATCH:c1|ms@c2|... - Ordered command list, one aggregated result
+  // Framed form from ESP32 bridge: !BATCH#count,checksum:payload
+  // (checksum = byte sum of payload mod 256, two hex digits)
+  // ============================================
+
+  void cmdBatch(char sep, const char* args) {
+    Stream* replyTo = responseStream;
+
+    if (batchActive) {
+      replyTo->println("BATCH:{\"ok\":false,\"reason\":\"batch_busy\"}");
+      return;
+    }
+
+    const char* payload;
+    int expectedCount = -1;
+
+    if (sep == '#') {
+      // Framed: validate count + checksum so a truncated UART line is rejected
+      unsigned int frameCount = 0, frameSum = 0;
+      const char* colon = strchr(args, ':');
+      if (colon == nullptr || sscanf(args, "%u,%x", &frameCount, &frameSum) != 2) {
+        replyTo->println("BATCH:{\"ok\":false,\"reason\":\"frame_error\"}");
+        return;
+      }
+      payload = colon + 1;
+      uint8_t sum = 0;
+      for (const char* p = payload; *p; p++) sum += (uint8_t)*p;
+      if (sum != (uint8_t)frameSum) {
+        replyTo->println("BATCH:{\"ok\":false,\"reason\":\"checksum\"}");
+        return;
+      }
+      expectedCount = (int)frameCount;
+    } else if (sep == ':') {
+      payload = args;
+    } else {
+      replyTo->println("BATCH:{\"ok\":false,\"reason\":\"parse_error\"}");
+      return;
+    }
+
+    if (strlen(payload) > AI_BATCH_MAX_PAYLOAD) {
+      replyTo->println("BATCH:{\"ok\":false,\"reason\":\"too_long\"}");
+      return;
+    }
+
+    strcpy(batchText, payload);
+    batchCount = 0;
+
+    // Split on '|' in place; each entry is "CMD" or "ms@CMD"
+    char* entry = batchText;
+    while (entry != nullptr) {
+      char* sep = strchr(entry, '|');
+      if (sep != nullptr) *sep = '\0';
+
+      if (batchCount >= AI_BATCH_MAX_ENTRIES) {
+        replyTo->println("BATCH:{\"ok\":false,\"reason\":\"too_many\"}");
+        return;
+      }
+
+      unsigned int delayMs = 0;
+      char* at = strchr(entry, '@');
+      if (at != nullptr && at > entry) {
+        bool numeric = true;
+        for (char* p = entry; p < at; p++) {
+          if (*p < '0' || *p > '9') { numeric = false; break; }
+        }
+        if (numeric) {
+          delayMs = (unsigned int)atol(entry);
+          entry = at + 1;
+        }
+      }
+
+      if (*entry == '\0' || strncmp(entry, "BATCH", 5) == 0) {
+        replyTo->println("BATCH:{\"ok\":false,\"reason\":\"bad_entry\"}");
+        return;
+      }
+
+      batchEntries[batchCount].cmd = entry;
+      batchEntries[batchCount].delayMs = delayMs;
+      batchCount++;
+
+      entry = (sep != nullptr) ? sep + 1 : nullptr;
+    }
+
+    if (expectedCount >= 0 && expectedCount != batchCount) {
+      replyTo->println("BATCH:{\"ok\":false,\"reason\":\"frame_error\"}");
+      return;
+    }
+
+    batchNext = 0;
+    batchReplyStream = replyTo;
+    batchResults[0] = '\0';
+    batchFirstReason[0] = '\0';
+    batchStepTime = millis();
+    batchActive = true;
+
+    // Undelayed leading entries run right away; the rest from updateBatch()
+    runBatch();
+  }
+
   private:
 
   // ============================================
@@ -1158,6 +1848,67 @@ private:
   // All math is frame-based, no blocking calls
   // ============================================
 
+  // ============================================
+  // BATCH EXECUTION
+  // ============================================
+
+  void runBatch() {
+    while (batchActive && batchNext < batchCount) {
+      BatchEntry& e = batchEntries[batchNext];
+      if (millis() - batchStepTime < e.delayMs) return;  // Not due yet
+
+      // Run the entry with its response captured instead of sent
+      Stream* saved = responseStream;
+      batchCapture.reset();
+      responseStream = &batchCapture;
+      handleCommand(e.cmd);
+      responseStream = saved;
+
+      // No response (e.g. VISION feed) counts as success
+      bool ok = (batchCapture.len == 0) || (strstr(batchCapture.buf, "\"ok\":true") != nullptr);
+      batchResults[batchNext] = ok ? '1' : '0';
+      batchResults[batchNext + 1] = '\0';
+
+      if (!ok && batchFirstReason[0] == '\0') {
+        const char* r = strstr(batchCapture.buf, "\"reason\":\"");
+        if (r != nullptr) {
+          r += 10;
+          int i = 0;
+          while (*r && *r != '"' && i < (int)sizeof(batchFirstReason) - 1) {
+            batchFirstReason[i++] = *r++;
+          }
+          batchFirstReason[i] = '\0';
+        }
+      }
+
+      batchNext++;
+      batchStepTime = millis();  // Delays are relative to completion of the previous entry
+    }
+
+    if (batchActive && batchNext >= batchCount) {
+      finishBatch();
+    }
+  }
+
+  void finishBatch() {
+    batchActive = false;
+
+    int failed = 0;
+    for (int i = 0; i < batchCount; i++) {
+      if (batchResults[i] == '0') failed++;
+    }
+
+    char buf[128];
+    snprintf(buf, sizeof(buf),
+      "BATCH:{\"ok\":%s,\"n\":%d,\"failed\":%d,\"results\":\"%s\",\"reason\":\"%s\"}",
+      failed == 0 ? "true" : "false", batchCount, failed, batchResults,
+      batchFirstReason[0] ? batchFirstReason : "none");
+
+    if (esp32Linked || batchReplyStream == &Serial) {
+      batchReplyStream->println(buf);
+    }
+  }
+
   void doThinkingStep(float t) {
     // Pondering animation: slow scanning with curious tilt
     //
@@ -1166,19 +1917,11 @@ private:
     //       centered at 108 (slightly raised = attentive)
     // Tilt: slow curious tilt       (7s period, 8 degree amplitude)
 
-    float baseOffset = sin(t * 1.0472f) * 10.0f;  // 2*PI/6
-    float nodOffset  = sin(t * 0.7854f) * 5.0f;   // 2*PI/8
-    float tiltOffset = sin(t * 0.8976f) * 8.0f;   // 2*PI/7
-
-    int targetBase = 90  + (int)baseOffset;
-    int targetNod  = 108 + (int)nodOffset;
-    int targetTilt = 90  + (int)tiltOffset;
+    float baseOffset = lutSinTurns(t / 6.0f) * 10.0f;
+    float nodOffset  = lutSinTurns(t / 8.0f) * 5.0f;
+    float tiltOffset = lutSinTurns(t / 7.0f) * 8.0f;
 
-    targetBase = constrain(targetBase, 10, 170);
-    targetNod  = constrain(targetNod, 80, 150);
-    targetTilt = constrain(targetTilt, 20, 150);
-
-    servos->directWriteFull(targetBase, targetNod, targetTilt, false);
+    servos->setLayer(LAYER_EXPRESSION, baseOffset, nodOffset, tiltOffset);
   }
 
   void doSpeakingStep(float t) {
@@ -1189,37 +1932,17 @@ private:
     //       centered at 112 (slightly forward = engaged)
     // Tilt: subtle variation        (5s period, 3 degree amplitude)
 
-    float baseOffset = sin(t * 0.6283f) * 3.0f;   // 2*PI/10
-    float nodOffset  = sin(t * 4.1888f) * 4.0f;   // 2*PI/1.5
-    float tiltOffset = sin(t * 1.2566f) * 3.0f;   // 2*PI/5
-
-    int targetBase = 90  + (int)baseOffset;
-    int targetNod  = 112 + (int)nodOffset;
-    int targetTilt = 85  + (int)tiltOffset;
-
-    targetBase = constrain(targetBase, 10, 170);
-    targetNod  = constrain(targetNod, 80, 150);
-    targetTilt = constrain(targetTilt, 20, 150);
+    float baseOffset = lutSinTurns(t / 10.0f) * 3.0f;
+    float nodOffset  = lutSinTurns(t / 1.5f) * 4.0f;
+    float tiltOffset = lutSinTurns(t / 5.0f) * 3.0f;
 
-    servos->directWriteFull(targetBase, targetNod, targetTilt, false);
+    servos->setLayer(LAYER_EXPRESSION, baseOffset, nodOffset, tiltOffset);
   }
 
   // ============================================
   // HELPERS
   // ============================================
 
-  bool parseEmotionLabel(const char* str, EmotionLabel& out) {
-    if (strcasecmp(str, "curious") == 0)   { out = CURIOUS;   return true; }
-    if (strcasecmp(str, "excited") == 0)   { out = EXCITED;   return true; }
-    if (strcasecmp(str, "content") == 0)   { out = CONTENT;   return true; }
-    if (strcasecmp(str, "anxious") == 0)   { out = ANXIOUS;   return true; }
-    if (strcasecmp(str, "neutral") == 0)   { out = NEUTRAL;   return true; }
-    if (strcasecmp(str, "startled") == 0)  { out = STARTLED;  return true; }
-    if (strcasecmp(str, "bored") == 0)     { out = BORED;     return true; }
-    if (strcasecmp(str, "confused") == 0)  { out = CONFUSED;  return true; }
-    return false;
-  }
-
   const char* behaviorName(Behavior b) {
     switch (b) {
       case IDLE:           return "IDLE";
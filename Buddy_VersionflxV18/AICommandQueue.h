@@ -0,0 +1,143 @@
+/**
+ * AICommandQueue.h - Bounded priority queue for AIBridge commands
+ *
+ * Commands used to run the moment their line was lexed, in the middle of
+ * parseVisionData(): a burst of !LOOK drove the servos through every
+ * intermediate target, and one slow animation held up every line behind
+ * it, !IDLE included.
+ *
+ * AIBridge::submitCommand() now files each line under the queue class
+ * its AI_COMMANDS entry declares (AICommands.h), and serviceCommands()
+ * runs the queue from the vision task once the line ring is drained:
+ *
+ *   SAFETY   never queued: runs on arrival, queued MOTION/GAZE entries are
+ *            answered {"ok":false,"reason":"preempted"} and dropped, and a
+ *            running !BATCH ends with the same reason
+ *   CONTROL  next pass, ahead of anything that moves
+ *   MOTION   arrival order, one MOTION/GAZE entry per pass
+ *   GAZE     latest wins: a queued LOOK/ATTENTION is answered
+ *            {"ok":true,"coalesced":true} and replaced by the newer one
+ *   VISION   latest wins per form (VISION:json / VISION json), runs last
+ *
+ * Only one moving command runs per pass, so targets that arrive while it
+ * runs are merged before the next one starts. A full queue evicts its
+ * lowest-priority entry if the newcomer outranks it, else refuses the
+ * newcomer with queue_full.
+ */
+
+#ifndef AI_COMMAND_QUEUE_H
+#define AI_COMMAND_QUEUE_H
+
+#include <Arduino.h>
+#include "AICommands.h"
+
+#define AI_QUEUE_SLOTS      8
+#define AI_QUEUE_TEXT_MAX   256    // SERIAL_LINE_MAX — one lexed line
+#define AI_QUEUE_BUDGET_US  2000   // Stop starting new entries after this
+
+struct AIQueuedCommand {
+  char text[AI_QUEUE_TEXT_MAX];   // Command line without the '!'
+  Stream* replyTo;
+  uint32_t seq;                   // Arrival order
+  AIQueueClass cls;
+  char sep;                       // Separator after the name (VISION form)
+  bool used;
+};
+
+class AICommandQueue {
+public:
+  uint32_t coalesced;   // Entries replaced by a newer one of their class
+  uint32_t preempted;   // Entries / batches dropped by a SAFETY command
+  uint32_t rejected;    // Entries refused or evicted on a full queue
+  uint8_t peak;         // Deepest the queue has been
+
+  AICommandQueue() : coalesced(0), preempted(0), rejected(0), peak(0), nextSeq(0), count(0) {
+    for (int i = 0; i < AI_QUEUE_SLOTS; i++) slots[i].used = false;
+  }
+
+  static uint8_t priority(AIQueueClass cls) {
+    switch (cls) {
+      case AI_Q_SAFETY:  return 4;
+      case AI_Q_CONTROL: return 3;
+      case AI_Q_MOTION:
+      case AI_Q_GAZE:    return 2;
+      default:           return 1;
+    }
+  }
+
+  static bool moves(AIQueueClass cls) { return cls == AI_Q_MOTION || cls == AI_Q_GAZE; }
+  static bool latestWins(AIQueueClass cls) { return cls == AI_Q_GAZE || cls == AI_Q_VISION; }
+
+  // Queued entry a new (cls, sep) command replaces, or nullptr
+  AIQueuedCommand* findMergeable(AIQueueClass cls, char sep) {
+    if (!latestWins(cls)) return nullptr;
+    for (int i = 0; i < AI_QUEUE_SLOTS; i++) {
+      AIQueuedCommand& e = slots[i];
+      if (e.used && e.cls == cls && (cls != AI_Q_VISION || e.sep == sep)) return &e;
+    }
+    return nullptr;
+  }
+
+  // Lowest-priority entry (newest among equals) that cls outranks, or nullptr
+  AIQueuedCommand* findEvictable(AIQueueClass cls) {
+    AIQueuedCommand* victim = nullptr;
+    for (int i = 0; i < AI_QUEUE_SLOTS; i++) {
+      AIQueuedCommand& e = slots[i];
+      if (!e.used || priority(e.cls) >= priority(cls)) continue;
+      if (victim == nullptr || priority(e.cls) < priority(victim->cls) ||
+          (priority(e.cls) == priority(victim->cls) && e.seq > victim->seq)) {
+        victim = &e;
+      }
+    }
+    return victim;
+  }
+
+  // Copy a command into a free slot; false if the queue is full
+  bool push(const char* text, Stream* replyTo, AIQueueClass cls, char sep) {
+    for (int i = 0; i < AI_QUEUE_SLOTS; i++) {
+      AIQueuedCommand& e = slots[i];
+      if (e.used) continue;
+      strncpy(e.text, text, AI_QUEUE_TEXT_MAX - 1);
+      e.text[AI_QUEUE_TEXT_MAX - 1] = '\0';
+      e.replyTo = replyTo;
+      e.seq = nextSeq++;
+      e.cls = cls;
+      e.sep = sep;
+      e.used = true;
+      count++;
+      if (count > peak) peak = count;
+      return true;
+    }
+    return false;
+  }
+
+  // Highest priority, oldest first; moving entries only if allowMoving
+  AIQueuedCommand* next(bool allowMoving) {
+    AIQueuedCommand* best = nullptr;
+    for (int i = 0; i < AI_QUEUE_SLOTS; i++) {
+      AIQueuedCommand& e = slots[i];
+      if (!e.used || (!allowMoving && moves(e.cls))) continue;
+      if (best == nullptr || priority(e.cls) > priority(best->cls) ||
+          (priority(e.cls) == priority(best->cls) && (int32_t)(e.seq - best->seq) < 0)) {
+        best = &e;
+      }
+    }
+    return best;
+  }
+
+  void remove(AIQueuedCommand* e) {
+    if (e == nullptr || !e->used) return;
+    e->used = false;
+    count--;
+  }
+
+  uint8_t depth() const { return count; }
+  AIQueuedCommand& slot(int i) { return slots[i]; }
+
+private:
+  AIQueuedCommand slots[AI_QUEUE_SLOTS];
+  uint32_t nextSeq;
+  uint8_t count;
+};
+
+#endif // AI_COMMAND_QUEUE_H
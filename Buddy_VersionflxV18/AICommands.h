@@ -0,0 +1,428 @@
+/**
+ * AICommands.h - Command table, perfect hash and argument schemas for AIBridge
+ *
+ * handleCommand() used to find its handler by walking ~25 strncmp calls
+ * (ordered by hand so no prefix shadowed a longer name), and each handler
+ * re-parsed its arguments with sscanf/atoi/strcasecmp ladders. Now every
+ * command is one line in AI_COMMANDS below:
+ *
+ *   X(id, queue, args, help)   name = #id, queue = AIQueueClass,
+ *                              args = AIArgSpec array or nullptr
+ *
+ * From that table the compiler builds:
+ *   - AI_CMD_<id>          enum used by the dispatch switch
+ *   - AI_COMMAND_TABLE     name, hash, argument schema, help text
+ *   - AI_CMD_INDEX         a collision-free slot map: the seed of the
+ *                          multiplicative hash is searched at compile time,
+ *                          so lookup is one FNV-1a pass over the name, one
+ *                          array read and one strcmp to confirm
+ *
+ * aiParseArgs() walks the argument text once, splitting on ',' and
+ * converting each field by its schema: INT/FLOAT are clamped to the
+ * declared range, WORD is matched case-insensitively against a word list
+ * (hash compare, then strcasecmp to confirm), TEXT takes the rest of the
+ * line unparsed. The handler gets typed values, never the raw string.
+ *
+ * The same schema is reported by !COMMANDS (names) and !COMMANDS:NAME
+ * (arguments, ranges, words, help), so the Python side reads it instead
+ * of keeping its own copy.
+ */
+
+#ifndef AI_COMMANDS_H
+#define AI_COMMANDS_H
+
+#include <Arduino.h>
+
+#define AI_CMD_SLOT_BITS  6                        // 64 slots for ~25 names
+#define AI_CMD_SLOTS      (1 << AI_CMD_SLOT_BITS)
+#define AI_CMD_MAX_ARGS   2
+#define AI_CMD_NAME_MAX   16                       // Longest name + margin
+#define AI_ECHO_MAX       20                       // Chars of bad input echoed back
+
+// ============================================================================
+// HASHING
+// ============================================================================
+
+constexpr char aiLower(char c) {
+  return (c >= 'A' && c <= 'Z') ? (char)(c + ('a' - 'A')) : c;
+}
+
+// FNV-1a; command names are case-sensitive, words are hashed lowercased
+constexpr uint32_t aiHashStep(uint32_t h, char c) {
+  return (h ^ (uint8_t)c) * 16777619u;
+}
+
+constexpr uint32_t aiHash(const char* s, uint32_t h = 2166136261u) {
+  return *s ? aiHash(s + 1, aiHashStep(h, *s)) : h;
+}
+
+constexpr uint32_t aiHashLower(const char* s, uint32_t h = 2166136261u) {
+  return *s ? aiHashLower(s + 1, aiHashStep(h, aiLower(*s))) : h;
+}
+
+constexpr uint8_t aiSlot(uint32_t hash, uint32_t seed) {
+  return (uint8_t)((hash * seed) >> (32 - AI_CMD_SLOT_BITS));
+}
+
+// ============================================================================
+// ARGUMENT SCHEMAS
+// ============================================================================
+
+enum AIArgType : uint8_t {
+  AI_ARG_INT,      // Whole number, clamped to lo..hi
+  AI_ARG_FLOAT,    // Decimal, clamped to lo..hi
+  AI_ARG_WORD,     // One of a word list; value = index into it
+  AI_ARG_TEXT      // Rest of the line, unparsed (must be last)
+};
+
+struct AIWord {
+  const char* text;
+  uint32_t hash;
+};
+
+#define AI_WORD(w) { w, aiHashLower(w) }
+
+struct AIWordList {
+  const AIWord* words;
+  uint8_t count;
+  const char* reason;     // Error reason for a word not in the list
+  const char* echoKey;    // Field echoing the bad word back (nullptr = none)
+};
+
+struct AIArgSpec {
+  const char* name;
+  AIArgType type;
+  float lo, hi;               // INT / FLOAT clamp range
+  bool optional;              // Missing field takes def instead of failing
+  float def;
+  const AIWordList* words;    // WORD only
+};
+
+#define AI_INT_ARG(name, lo, hi)           { name, AI_ARG_INT, lo, hi, false, 0, nullptr }
+#define AI_INT_ARG_OPT(name, lo, hi, def)  { name, AI_ARG_INT, lo, hi, true, def, nullptr }
+#define AI_FLOAT_ARG(name, lo, hi)         { name, AI_ARG_FLOAT, lo, hi, false, 0, nullptr }
+#define AI_WORD_ARG(name, list)            { name, AI_ARG_WORD, 0, 0, false, 0, &list }
+#define AI_TEXT_ARG(name)                  { name, AI_ARG_TEXT, 0, 0, true, 0, nullptr }
+
+// ── Word lists: order is the value the handler receives ──
+
+// !SATISFY need
+enum AINeed : uint8_t { AI_NEED_SOCIAL, AI_NEED_STIMULATION, AI_NEED_NOVELTY };
+static constexpr AIWord AI_NEED_WORDS[] = {
+  AI_WORD("social"), AI_WORD("stimulation"), AI_WORD("novelty")
+};
+
+// !EXPRESS emotion — same order as EmotionLabel
+static constexpr AIWord AI_EMOTION_WORDS[] = {
+  AI_WORD("neutral"), AI_WORD("excited"), AI_WORD("curious"), AI_WORD("content"),
+  AI_WORD("anxious"), AI_WORD("startled"), AI_WORD("bored"), AI_WORD("confused")
+};
+
+// !STREAM mode
+enum AIStreamMode : uint8_t { AI_STREAM_FULL, AI_STREAM_OFF, AI_STREAM_DELTA };
+static constexpr AIWord AI_STREAM_WORDS[] = { AI_WORD("on"), AI_WORD("off"), AI_WORD("delta") };
+
+// !SUB topics — each names a group of STATE fields (AI_TOPIC_FIELDS, AIBridge.h)
+enum AITopic : uint8_t {
+  AI_TOPIC_EMOTION, AI_TOPIC_NEEDS, AI_TOPIC_SERVO, AI_TOPIC_TRACKING,
+  AI_TOPIC_CONSCIOUSNESS, AI_TOPIC_SPEECH, AI_TOPIC_QUEUE, AI_TOPIC_COUNT
+};
+static constexpr AIWord AI_TOPIC_WORDS[] = {
+  AI_WORD("emotion"), AI_WORD("needs"), AI_WORD("servo"), AI_WORD("tracking"),
+  AI_WORD("consciousness"), AI_WORD("speech"), AI_WORD("queue")
+};
+
+// !ATTENTION direction
+enum AIDirection : uint8_t { AI_DIR_CENTER, AI_DIR_LEFT, AI_DIR_RIGHT, AI_DIR_UP, AI_DIR_DOWN };
+static constexpr AIWord AI_DIRECTION_WORDS[] = {
+  AI_WORD("center"), AI_WORD("left"), AI_WORD("right"), AI_WORD("up"), AI_WORD("down")
+};
+
+// !PERFORM type
+enum AIPerform : uint8_t {
+  AI_PERFORM_PRE_SPEECH, AI_PERFORM_WATCHING, AI_PERFORM_DEFLATED,
+  AI_PERFORM_ACKNOWLEDGED, AI_PERFORM_LEAN_FORWARD
+};
+static constexpr AIWord AI_PERFORM_WORDS[] = {
+  AI_WORD("pre_speech"), AI_WORD("watching"), AI_WORD("deflated"),
+  AI_WORD("acknowledged"), AI_WORD("lean_forward")
+};
+
+// !PHYSICAL name
+enum AIPhysical : uint8_t {
+  AI_PHYSICAL_SIGH, AI_PHYSICAL_DOUBLE_TAKE, AI_PHYSICAL_SETTLE, AI_PHYSICAL_EXPECTANT,
+  AI_PHYSICAL_DISMISSIVE, AI_PHYSICAL_CURIOUS_TILT, AI_PHYSICAL_STARTLED
+};
+static constexpr AIWord AI_PHYSICAL_WORDS[] = {
+  AI_WORD("sigh"), AI_WORD("double_take"), AI_WORD("settle"), AI_WORD("expectant"),
+  AI_WORD("dismissive"), AI_WORD("curious_tilt"), AI_WORD("startled")
+};
+
+#define AI_WORDS(arr) arr, (uint8_t)(sizeof(arr) / sizeof(arr[0]))
+
+static constexpr AIWordList AI_NEEDS      = { AI_WORDS(AI_NEED_WORDS), "unknown_need", "need" };
+static constexpr AIWordList AI_EMOTIONS   = { AI_WORDS(AI_EMOTION_WORDS), "unknown_emotion", "emotion" };
+static constexpr AIWordList AI_STREAMS    = { AI_WORDS(AI_STREAM_WORDS), "use_on_off_or_delta", nullptr };
+static constexpr AIWordList AI_TOPICS     = { AI_WORDS(AI_TOPIC_WORDS), "unknown_topic", "topic" };
+static constexpr AIWordList AI_DIRECTIONS = { AI_WORDS(AI_DIRECTION_WORDS), "unknown_direction", "dir" };
+static constexpr AIWordList AI_PERFORMS   = { AI_WORDS(AI_PERFORM_WORDS), "unknown_perform", "type" };
+static constexpr AIWordList AI_PHYSICALS  = { AI_WORDS(AI_PHYSICAL_WORDS), "unknown_physical", "name" };
+
+// ── Per-command argument lists ──
+
+static constexpr AIArgSpec AI_ARGS_LOOK[]      = { AI_INT_ARG("base", 10, 170), AI_INT_ARG("nod", 80, 150) };
+static constexpr AIArgSpec AI_ARGS_SATISFY[]   = { AI_WORD_ARG("need", AI_NEEDS), AI_FLOAT_ARG("amount", 0, 1) };
+static constexpr AIArgSpec AI_ARGS_EXPRESS[]   = { AI_WORD_ARG("emotion", AI_EMOTIONS) };
+static constexpr AIArgSpec AI_ARGS_COUNT[]     = { AI_INT_ARG_OPT("count", 1, 10, 1) };
+static constexpr AIArgSpec AI_ARGS_STREAM[]    = { AI_WORD_ARG("mode", AI_STREAMS) };
+static constexpr AIArgSpec AI_ARGS_ATTENTION[] = { AI_WORD_ARG("dir", AI_DIRECTIONS) };
+static constexpr AIArgSpec AI_ARGS_PERFORM[]   = { AI_WORD_ARG("type", AI_PERFORMS) };
+static constexpr AIArgSpec AI_ARGS_PHYSICAL[]  = { AI_WORD_ARG("name", AI_PHYSICALS) };
+static constexpr AIArgSpec AI_ARGS_VISION[]    = { AI_TEXT_ARG("json") };
+static constexpr AIArgSpec AI_ARGS_BATCH[]     = { AI_TEXT_ARG("entries") };
+static constexpr AIArgSpec AI_ARGS_COMMANDS[]  = { AI_TEXT_ARG("name") };
+static constexpr AIArgSpec AI_ARGS_SUB[]       = { AI_TEXT_ARG("topics") };
+
+// ── Command queue classes (see AICommandQueue.h) ──
+// Priority and merge rule of a command waiting for the main loop
+enum AIQueueClass : uint8_t {
+  AI_Q_SAFETY,     // Runs on arrival; queued motion is dropped
+  AI_Q_CONTROL,    // Queries and settings, ahead of motion
+  AI_Q_MOTION,     // Movement and animation, in arrival order
+  AI_Q_GAZE,       // LOOK / ATTENTION: a newer one replaces a queued one
+  AI_Q_VISION      // Observations: newer replaces queued, runs last
+};
+
+// ============================================================================
+// COMMAND TABLE — X(id, queue, args, help)
+// ============================================================================
+
+#define AI_COMMANDS(X) \
+  X(QUERY,         AI_Q_CONTROL,   nullptr,           "Full state JSON") \
+  X(LOOK,          AI_Q_GAZE,      AI_ARGS_LOOK,      "Move servos (blocked during reflex tracking)") \
+  X(SATISFY,       AI_Q_CONTROL,   AI_ARGS_SATISFY,   "Satisfy a need") \
+  X(PRESENCE,      AI_Q_CONTROL,   nullptr,           "Simulate human presence detection") \
+  X(EXPRESS,       AI_Q_MOTION,    AI_ARGS_EXPRESS,   "Express an emotion (blocked during animation)") \
+  X(NOD,           AI_Q_MOTION,    AI_ARGS_COUNT,     "Nod yes") \
+  X(SHAKE,         AI_Q_MOTION,    AI_ARGS_COUNT,     "Shake no") \
+  X(STREAM,        AI_Q_CONTROL,   AI_ARGS_STREAM,    "Periodic STATE: broadcast, full or changed fields only") \
+  X(ATTENTION,     AI_Q_GAZE,      AI_ARGS_ATTENTION, "Look in a direction") \
+  X(LISTENING,     AI_Q_MOTION,    nullptr,           "Attentive pose for wake-word detection") \
+  X(THINKING,      AI_Q_MOTION,    nullptr,           "Looping pondering animation") \
+  X(STOP_THINKING, AI_Q_SAFETY,    nullptr,           "Stop thinking animation") \
+  X(SPEAKING,      AI_Q_MOTION,    nullptr,           "Looping conversational micro-nods") \
+  X(STOP_SPEAKING, AI_Q_SAFETY,    nullptr,           "Stop speaking animation") \
+  X(ACKNOWLEDGE,   AI_Q_MOTION,    nullptr,           "Quick subtle nod") \
+  X(CELEBRATE,     AI_Q_MOTION,    nullptr,           "Happy bounce animation") \
+  X(IDLE,          AI_Q_SAFETY,    nullptr,           "Clear AI state, return to behavior system") \
+  X(SPOKE,         AI_Q_CONTROL,   nullptr,           "Acknowledge spontaneous speech") \
+  X(VISION,        AI_Q_VISION,    AI_ARGS_VISION,    "VISION:json observations, VISION json scene context; no reply") \
+  X(PERFORM,       AI_Q_MOTION,    AI_ARGS_PERFORM,   "Speech performance arc movement") \
+  X(PHYSICAL,      AI_Q_MOTION,    AI_ARGS_PHYSICAL,  "Physical expression") \
+  X(BATCH,         AI_Q_MOTION,    AI_ARGS_BATCH,     "c1|ms@c2|... ordered list, one BATCH:{...} reply") \
+  X(COMMANDS,      AI_Q_CONTROL,   AI_ARGS_COMMANDS,  "List commands, or COMMANDS:NAME for one schema") \
+  X(SUB,           AI_Q_CONTROL,   AI_ARGS_SUB,       "topic@hz or topic@event, comma-separated; replaces the set, SUB:off clears")
+
+enum AICommandId : uint8_t {
+#define AI_CMD_ENUM(id, queue, args, help) AI_CMD_##id,
+  AI_COMMANDS(AI_CMD_ENUM)
+#undef AI_CMD_ENUM
+  AI_CMD_COUNT
+};
+
+struct AICommandSpec {
+  const char* name;
+  uint32_t hash;
+  AIQueueClass queue;
+  const AIArgSpec* args;
+  uint8_t argCount;
+  const char* help;
+};
+
+template <size_t N>
+constexpr uint8_t aiArgCount(const AIArgSpec (&)[N]) { return (uint8_t)N; }
+constexpr uint8_t aiArgCount(decltype(nullptr)) { return 0; }
+
+static constexpr AICommandSpec AI_COMMAND_TABLE[AI_CMD_COUNT] = {
+#define AI_CMD_ENTRY(id, queue, args, help) { #id, aiHash(#id), queue, args, aiArgCount(args), help },
+  AI_COMMANDS(AI_CMD_ENTRY)
+#undef AI_CMD_ENTRY
+};
+
+static_assert(AI_CMD_COUNT <= AI_CMD_SLOTS / 2, "grow AI_CMD_SLOT_BITS");
+
+// ============================================================================
+// PERFECT HASH — seed found at compile time
+// ============================================================================
+
+constexpr bool aiSeedIsPerfect(uint32_t seed) {
+  bool used[AI_CMD_SLOTS] = {};
+  for (int i = 0; i < AI_CMD_COUNT; i++) {
+    uint8_t s = aiSlot(AI_COMMAND_TABLE[i].hash, seed);
+    if (used[s]) return false;
+    used[s] = true;
+  }
+  return true;
+}
+
+constexpr uint32_t aiFindSeed() {
+  for (uint32_t seed = 1; seed < 200000; seed += 2) {
+    if (aiSeedIsPerfect(seed)) return seed;
+  }
+  return 0;
+}
+
+static constexpr uint32_t AI_CMD_SEED = aiFindSeed();
+static_assert(AI_CMD_SEED != 0, "no collision-free seed: grow AI_CMD_SLOT_BITS");
+
+struct AICommandIndex {
+  uint8_t slot[AI_CMD_SLOTS];   // Table index, 0xFF = empty
+};
+
+constexpr AICommandIndex aiBuildIndex() {
+  AICommandIndex index = {};
+  for (int s = 0; s < AI_CMD_SLOTS; s++) index.slot[s] = 0xFF;
+  for (int i = 0; i < AI_CMD_COUNT; i++) {
+    index.slot[aiSlot(AI_COMMAND_TABLE[i].hash, AI_CMD_SEED)] = (uint8_t)i;
+  }
+  return index;
+}
+
+static constexpr AICommandIndex AI_CMD_INDEX = aiBuildIndex();
+
+// Exact, case-sensitive lookup of the first len chars of name; nullptr if unknown
+inline const AICommandSpec* aiFindCommand(const char* name, int len, uint32_t hash) {
+  uint8_t i = AI_CMD_INDEX.slot[aiSlot(hash, AI_CMD_SEED)];
+  if (i == 0xFF) return nullptr;
+  const AICommandSpec* cmd = &AI_COMMAND_TABLE[i];
+  if (strncmp(cmd->name, name, len) != 0 || cmd->name[len] != '\0') return nullptr;
+  return cmd;
+}
+
+// ============================================================================
+// ARGUMENT PARSER
+// ============================================================================
+
+enum AIParseResult : uint8_t {
+  AI_PARSE_OK,
+  AI_PARSE_ERROR,          // Missing, malformed or extra field
+  AI_PARSE_UNKNOWN_WORD    // WORD not in its list (bad/badLen, badArg set)
+};
+
+struct AIArgValue {
+  int i;      // INT value, or WORD index
+  float f;    // FLOAT value
+};
+
+struct AICommandArgs {
+  char sep;             // What ended the name: ':', ' ', '#' or '\0'
+  const char* rest;     // Text after the separator (TEXT args, BATCH framing)
+  AIArgValue v[AI_CMD_MAX_ARGS];
+  uint8_t badArg;       // Failing argument on AI_PARSE_UNKNOWN_WORD
+  const char* bad;
+  int badLen;
+};
+
+// Split cmdLine into name and separator; returns the command or nullptr.
+// The name is hashed while it is scanned.
+inline const AICommandSpec* aiLookupCommand(const char* cmdLine, AICommandArgs& out) {
+  uint32_t h = 2166136261u;
+  int len = 0;
+  while (cmdLine[len] != '\0' && cmdLine[len] != ':' &&
+         cmdLine[len] != ' ' && cmdLine[len] != '#') {
+    if (len >= AI_CMD_NAME_MAX) return nullptr;
+    h = aiHashStep(h, cmdLine[len]);
+    len++;
+  }
+  out.sep = cmdLine[len];
+  out.rest = cmdLine + len + (out.sep != '\0' ? 1 : 0);
+  return aiFindCommand(cmdLine, len, h);
+}
+
+// Index of the len-char word at p in list, or -1. h is aiHashLower of those chars.
+inline int aiMatchWord(const AIWordList& list, const char* p, int len, uint32_t h) {
+  for (uint8_t w = 0; w < list.count; w++) {
+    if (list.words[w].hash == h && strncasecmp(list.words[w].text, p, len) == 0 &&
+        list.words[w].text[len] == '\0') {
+      return w;
+    }
+  }
+  return -1;
+}
+
+inline int aiMatchWord(const AIWordList& list, const char* p, int len) {
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < len; i++) h = aiHashStep(h, aiLower(p[i]));
+  return aiMatchWord(list, p, len, h);
+}
+
+inline AIParseResult aiParseArgs(const AICommandSpec& cmd, AICommandArgs& out) {
+  if (cmd.argCount == 0) return AI_PARSE_OK;   // Trailing text is ignored
+
+  const char* p = out.rest;
+  bool more = (out.sep != '\0');
+
+  for (uint8_t a = 0; a < cmd.argCount; a++) {
+    const AIArgSpec& spec = cmd.args[a];
+    out.v[a].i = 0;
+    out.v[a].f = 0.0f;
+
+    if (spec.type == AI_ARG_TEXT) return AI_PARSE_OK;   // Handler reads out.rest
+
+    // Field runs to the next ',' or end of line
+    const char* end = p;
+    uint32_t h = 2166136261u;
+    if (more) {
+      while (*end != '\0' && *end != ',') {
+        h = aiHashStep(h, aiLower(*end));
+        end++;
+      }
+    }
+    bool present = more && end > p;
+
+    switch (spec.type) {
+      case AI_ARG_INT:
+      case AI_ARG_FLOAT: {
+        float value = spec.def;
+        if (present) {
+          char* stop;
+          value = (spec.type == AI_ARG_INT) ? (float)strtol(p, &stop, 10) : strtof(p, &stop);
+          while (stop < end && *stop == ' ') stop++;
+          if (stop == p || stop != end) return AI_PARSE_ERROR;
+        } else if (!spec.optional) {
+          return AI_PARSE_ERROR;
+        }
+        if (value < spec.lo) value = spec.lo;
+        if (value > spec.hi) value = spec.hi;
+        out.v[a].i = (int)value;
+        out.v[a].f = value;
+        break;
+      }
+
+      case AI_ARG_WORD: {
+        // An empty word is reported like any other unknown one
+        const AIWordList& list = *spec.words;
+        int len = present ? (int)(end - p) : 0;
+        int found = present ? aiMatchWord(list, p, len, h) : -1;
+        if (found < 0) {
+          out.badArg = a;
+          out.bad = p;
+          out.badLen = len;
+          return AI_PARSE_UNKNOWN_WORD;
+        }
+        out.v[a].i = found;
+        break;
+      }
+
+      default:
+        break;
+    }
+
+    more = (*end == ',');
+    p = more ? end + 1 : end;
+  }
+
+  return more ? AI_PARSE_ERROR : AI_PARSE_OK;   // Extra fields
+}
+
+#endif // AI_COMMANDS_H
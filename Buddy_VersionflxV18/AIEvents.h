@@ -0,0 +1,142 @@
+/**
+ * AIEvents.h - Edge-triggered notifications for the PC (EVT: lines)
+ *
+ * The PC used to find out that Buddy wants to speak, that the speech
+ * trigger changed or that the behavior switched only from its next
+ * !QUERY — up to a poll period late, and at the price of a full state
+ * document on the UART every poll.
+ *
+ * Now the module where the edge happens raises an event:
+ *
+ *   AI_EVENT(AI_EVT_BEHAVIOR, "IDLE", "EXPLORE");
+ *
+ * which appends a record to a small RAM queue — no formatting, no I/O.
+ * AIBridge::flushEvents() runs every scheduler tick and writes each record
+ * as one unsolicited line on the ESP32 link:
+ *
+ *   EVT:{"evt":"behavior","ms":123456,"from":"IDLE","to":"EXPLORE"}
+ *
+ * and the bridge fans EVT: lines out to every WebSocket client, like
+ * STATE:. While the link is down the queue is still drained, so a
+ * reconnect doesn't replay stale edges.
+ *
+ * Events are declared once in AI_EVENTS: the JSON keys of the two text
+ * arguments and of the number ("" = not sent). Text arguments are stored
+ * as pointers and must be string literals. A full queue drops the new
+ * record; the count goes out as a "dropped" event once there is room.
+ */
+
+#ifndef AI_EVENTS_H
+#define AI_EVENTS_H
+
+#include <Arduino.h>
+
+#define AI_EVENT_QUEUE_SLOTS  16   // Power of two; edges are rare (a few per minute)
+#define AI_EVENT_FLUSH_MAX    4    // Lines per flush, keeps one tick short
+
+// ============================================================================
+// EVENT TABLE — X(id, name, text0_key, text1_key, num_key)   ("" = unused)
+// ============================================================================
+
+#define AI_EVENTS(X) \
+  X(AI_EVT_SPEECH_READY,   "speech_ready",   "trigger", "",   "urge") \
+  X(AI_EVT_SPEECH_CLEARED, "speech_cleared", "trigger", "",   "urge") \
+  X(AI_EVT_SPEECH_TRIGGER, "speech_trigger", "from",    "to", "intensity") \
+  X(AI_EVT_BEHAVIOR,       "behavior",       "from",    "to", "") \
+  X(AI_EVT_EPISTEMIC,      "epistemic",      "from",    "to", "") \
+  X(AI_EVT_WONDER_START,   "wonder_start",   "type",    "",   "intensity") \
+  X(AI_EVT_WONDER_END,     "wonder_end",     "type",    "",   "seconds") \
+  X(AI_EVT_DROPPED,        "dropped",        "",        "",   "count")
+
+#define AI_EVENT_ENUM_ENTRY(id, name, k0, k1, kn) id,
+enum AIEventId : uint8_t {
+  AI_EVENTS(AI_EVENT_ENUM_ENTRY)
+  AI_EVT_COUNT
+};
+#undef AI_EVENT_ENUM_ENTRY
+
+struct AIEventRecord {
+  uint32_t ms;
+  const char* text[2];
+  float num;
+  AIEventId id;
+};
+
+// ============================================================================
+// QUEUE — main thread only (raised from scheduler tasks, not interrupts)
+// ============================================================================
+
+class AIEventQueue {
+public:
+  unsigned long raised;     // Records accepted
+  unsigned long dropped;    // Records lost to a full queue
+
+  AIEventQueue() : raised(0), dropped(0), reported(0), head(0), tail(0) {}
+
+  bool push(AIEventId id, const char* t0 = "", const char* t1 = "", float num = 0.0f) {
+    if (head - tail >= AI_EVENT_QUEUE_SLOTS) {
+      dropped++;
+      return false;
+    }
+    AIEventRecord& r = slots[head & (AI_EVENT_QUEUE_SLOTS - 1)];
+    r.ms = millis();
+    r.id = id;
+    r.text[0] = t0;
+    r.text[1] = t1;
+    r.num = num;
+    head++;
+    raised++;
+    return true;
+  }
+
+  // Next record, with a pending drop count reported first
+  bool pop(AIEventRecord& out) {
+    if (dropped != reported) {
+      out.ms = millis();
+      out.id = AI_EVT_DROPPED;
+      out.text[0] = out.text[1] = "";
+      out.num = (float)(dropped - reported);
+      reported = dropped;
+      return true;
+    }
+    if (head == tail) return false;
+    out = slots[tail & (AI_EVENT_QUEUE_SLOTS - 1)];
+    tail++;
+    return true;
+  }
+
+  bool pending() const { return head != tail || dropped != reported; }
+  uint8_t depth() const { return (uint8_t)(head - tail); }
+
+  static const char* eventName(AIEventId id) {
+    static const char* const names[] = {
+#define AI_EVENT_NAME_ENTRY(id, name, k0, k1, kn) name,
+      AI_EVENTS(AI_EVENT_NAME_ENTRY)
+#undef AI_EVENT_NAME_ENTRY
+    };
+    return id < AI_EVT_COUNT ? names[id] : "?";
+  }
+
+  // JSON key of argument 0/1 (text) or 2 (number); "" if unused
+  static const char* key(AIEventId id, int arg) {
+    static const char* const keys[][3] = {
+#define AI_EVENT_KEYS_ENTRY(id, name, k0, k1, kn) { k0, k1, kn },
+      AI_EVENTS(AI_EVENT_KEYS_ENTRY)
+#undef AI_EVENT_KEYS_ENTRY
+    };
+    return (id < AI_EVT_COUNT && arg >= 0 && arg < 3) ? keys[id][arg] : "";
+  }
+
+private:
+  AIEventRecord slots[AI_EVENT_QUEUE_SLOTS];
+  unsigned long reported;
+  uint32_t head;   // Next slot to fill
+  uint32_t tail;   // Next slot to send
+};
+
+// Firmware-wide instance, defined in the main .ino
+extern AIEventQueue aiEvents;
+
+#define AI_EVENT(...) aiEvents.push(__VA_ARGS__)
+
+#endif // AI_EVENTS_H
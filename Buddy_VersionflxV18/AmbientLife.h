@@ -1,6 +1,8 @@
 // AmbientLife.h
 // Need-driven micro-movements that make Buddy appear alive
 // NOT timer-based — driven by internal state
+// Everything here is an offset on the servo layers (PoseCompositor.h):
+// the stored pose is never edited, so nothing accumulates
 
 #ifndef AMBIENT_LIFE_H
 #define AMBIENT_LIFE_H
@@ -12,15 +14,14 @@
 
 class AmbientLife {
 private:
-    unsigned long lastBreath;
     unsigned long lastShift;
     unsigned long lastGlance;
-    float breathPhase;
 
 public:
-    AmbientLife() : lastBreath(0), lastShift(0), lastGlance(0), breathPhase(0) {}
+    AmbientLife() : lastShift(0), lastGlance(0) {}
 
-    // Called every update cycle when NOT tracking and NOT animating
+    // Called every update cycle when NOT tracking (moves and animations
+    // play through the base layer underneath)
     void update(Needs& needs, Emotion& emotion, Personality& personality,
                 ServoController& servos, unsigned long now) {
 
@@ -29,18 +30,7 @@ public:
         float breathRate = 4000 + (1.0 - emotion.getArousal()) * 3000; // 4-7s period
         float amplitude = 2.0 + emotion.getArousal() * 1.5;           // 2-3.5 degrees
 
-        unsigned long elapsed = now - lastBreath;
-        if (elapsed > 0) {
-            breathPhase += elapsed / breathRate * TWO_PI;
-            if (breathPhase > TWO_PI) breathPhase -= TWO_PI;
-        }
-        lastBreath = now;
-
-        float breathOffset = sin(breathPhase) * amplitude;
-        int currentNod = servos.getNodPos();
-        int breathNod = constrain(currentNod + (int)breathOffset, 80, 150);
-        // Apply breathing as a subtle offset — update internal state
-        servos.updateState(servos.getBasePos(), breathNod, servos.getTiltPos());
+        servos.breathingMotion(amplitude, (int)breathRate);
 
         // === WEIGHT SHIFT ===
         // Driven by stimulation need. Bored -> shift more often.
@@ -51,19 +41,15 @@ public:
         if (now - lastShift > (unsigned long)shiftInterval) {
             lastShift = now;
 
-            int shiftAmount;
+            // Each shift replaces the last one, so the head stays within
+            // a few degrees of wherever moves put it
             if (needs.getEnergy() < 0.3) {
                 // Low energy: droop slightly
-                shiftAmount = random(-2, 3);
-                int droopNod = constrain(servos.getNodPos() - 3, 80, 150);
-                servos.updateState(servos.getBasePos(), droopNod, servos.getTiltPos());
+                servos.setLayer(LAYER_AMBIENT, random(-2, 3), -3, 0);
             } else {
                 // Normal: subtle weight shift
-                shiftAmount = random(-5, 6);
+                servos.setLayer(LAYER_AMBIENT, random(-5, 6), 0, 0);
             }
-
-            int newBase = constrain(servos.getBasePos() + shiftAmount, 15, 165);
-            servos.updateState(newBase, servos.getNodPos(), servos.getTiltPos());
         }
 
         // === CURIOUS GLANCE ===
@@ -77,9 +63,7 @@ public:
             lastGlance = now;
 
             // Quick glance — adjust tilt briefly for a "noticing" effect
-            int currentTilt = servos.getTiltPos();
-            int glanceTilt = constrain(currentTilt + random(-10, 11), 20, 150);
-            servos.updateState(servos.getBasePos(), servos.getNodPos(), glanceTilt);
+            servos.nudge(AXIS_TILT, random(-10, 11), 1500);
         }
     }
 };
@@ -0,0 +1,278 @@
+/**
+ * AnimationClip.h - Keyframe clips and the player that runs them
+ *
+ * Gestures used to be hand-written sequences of blocking calls:
+ *
+ *   servos.smoothMoveTo(base, nod + 15, tilt, style); delay(150);
+ *   servos.smoothMoveTo(base, nod - 5, tilt, style);  delay(150);
+ *
+ * Now a gesture is data: a constexpr array of Keyframes (ClipLibrary.h)
+ * that ClipPlayer steps through from the motion task, one MotionEngine
+ * move per keyframe. A keyframe holds:
+ *
+ *   pose     degrees from the anchor (the pose the clip started from),
+ *            or absolute angles with KF_ABSOLUTE
+ *   spread   ± random degrees per axis, rolled when the keyframe starts
+ *   ease     MotionEase of the move, or CLIP_EASE_SNAP for a direct write
+ *   speedPct move speed as % of the clip's style (0 = 100)
+ *   hold     pause after arriving: holdMs + holdVarMs × a ClipFactor
+ *
+ * Clip-wide settings:
+ *   - KF_SIDE frames flip base/tilt by a side rolled once per play.
+ *   - scaleAxes offsets are scaled by 1 + gainPct/100 × a ClipFactor
+ *     (curiosity, persistence, ...), times ClipArgs::scale.
+ *   - Frames [loopStart, loopEnd) repeat ClipArgs::repeat times.
+ *
+ * The style still comes from the caller (MovementStyle), so emotion
+ * shapes every clip as it shaped the old moves.
+ *
+ * One clip plays at a time. play() while a clip runs queues the new one
+ * to follow (one slot); playNow() replaces. While some other module waits
+ * inside smoothMoveTo(), the player holds its place.
+ */
+
+#ifndef ANIMATION_CLIP_H
+#define ANIMATION_CLIP_H
+
+#include <Arduino.h>
+#include "ServoController.h"
+#include "Personality.h"
+
+// What a clip's gain or a keyframe's extra hold is scaled by (0..1)
+enum ClipFactor : uint8_t {
+  CLIP_FACTOR_NONE,
+  CLIP_FACTOR_CURIOSITY,     // Personality
+  CLIP_FACTOR_PERSISTENCE,   // Personality
+  CLIP_FACTOR_CAUTION,       // Personality
+  CLIP_FACTOR_HESITATION,    // Style the clip plays with
+  CLIP_FACTOR_INTENSITY,     // ClipArgs::intensity, set by the caller
+  CLIP_FACTOR_RANDOM,        // Rolled again for every keyframe
+  CLIP_FACTOR_COUNT
+};
+
+#define CLIP_EASE_SNAP  0xFF   // Keyframe ease: snapTo(), no interpolation
+
+// Keyframe flags
+#define KF_SIDE      0x01   // base/tilt offsets follow the clip's random side
+#define KF_ABSOLUTE  0x02   // pose is absolute angles, not anchor offsets
+#define KF_TARGET    0x04   // base/nod are offsets from ClipArgs::target
+
+struct Keyframe {
+  int16_t pose[MOTION_AXES];     // base, nod, tilt
+  uint8_t spread[MOTION_AXES];   // ± random degrees
+  uint8_t ease;                  // MotionEase or CLIP_EASE_SNAP
+  uint8_t flags;
+  uint16_t speedPct;             // 0 = 100
+  ClipFactor holdBy;
+  uint16_t holdMs;
+  uint16_t holdVarMs;
+};
+
+struct AnimClip {
+  const char* name;
+  const Keyframe* frames;
+  uint8_t count;
+  uint8_t loopStart;       // Frames [loopStart, loopEnd) repeat; loopEnd 0 = no loop
+  uint8_t loopEnd;
+  uint8_t scaleAxes;       // Bit per MotionAxis scaled by the gain
+  ClipFactor gainBy;
+  uint8_t gainPct;         // gain = 1 + gainPct/100 × factor
+  uint16_t speedPct;       // Whole-clip speed, % of the caller's style (0 = 100)
+};
+
+// Keyframe builders: offsets + hold, then the optional extras
+#define KF(b, n, t, hold) \
+  { { b, n, t }, { 0, 0, 0 }, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, hold, 0 }
+#define KF_EX(b, n, t, sb, sn, st, ease, flags, speed, holdBy, hold, holdVar) \
+  { { b, n, t }, { sb, sn, st }, ease, flags, speed, holdBy, hold, holdVar }
+
+#define CLIP_FRAMES(frames) frames, (uint8_t)(sizeof(frames) / sizeof(frames[0]))
+
+// Per-play inputs beyond the style
+struct ClipArgs {
+  float factor[CLIP_FACTOR_COUNT];
+  float intensity;
+  float scale;               // Extra gain on scaleAxes, set by the caller
+  uint8_t repeat;            // Loop section plays this many times (at least once)
+  bool hasAnchor;
+  int anchor[MOTION_AXES];   // Default: servo position when the clip starts
+  int target[2];             // Base/nod for KF_TARGET frames
+
+  ClipArgs() : intensity(0.0f), scale(1.0f), repeat(1), hasAnchor(false) {
+    for (int i = 0; i < CLIP_FACTOR_COUNT; i++) factor[i] = 0.0f;
+    target[0] = 90;
+    target[1] = 110;
+  }
+
+  static ClipArgs from(Personality& personality) {
+    ClipArgs a;
+    a.factor[CLIP_FACTOR_CURIOSITY] = personality.getCuriosity();
+    a.factor[CLIP_FACTOR_PERSISTENCE] = personality.getPersistence();
+    a.factor[CLIP_FACTOR_CAUTION] = personality.getCaution();
+    return a;
+  }
+
+  ClipArgs& withRepeat(uint8_t n) { repeat = n; return *this; }
+  ClipArgs& withIntensity(float v) { intensity = v; return *this; }
+  ClipArgs& withScale(float v) { scale = v; return *this; }
+  ClipArgs& withAnchor(int base, int nod, int tilt) {
+    hasAnchor = true;
+    anchor[AXIS_BASE] = base;
+    anchor[AXIS_NOD] = nod;
+    anchor[AXIS_TILT] = tilt;
+    return *this;
+  }
+  ClipArgs& withTarget(int base, int nod) {
+    target[0] = base;
+    target[1] = nod;
+    return *this;
+  }
+};
+
+// ============================================================================
+// PLAYER
+// ============================================================================
+
+class ClipPlayer {
+public:
+  ClipPlayer() : servos(nullptr), phase(CLIP_IDLE), hasNext(false) {}
+
+  // Start now, or after the clip that is playing; false if both are taken
+  bool play(const AnimClip& clip, ServoController& srv,
+            const MovementStyleParams& style, const ClipArgs& args = ClipArgs()) {
+    if (phase != CLIP_IDLE) {
+      if (hasNext) return false;
+      next.clip = &clip;
+      next.style = style;
+      next.args = args;
+      hasNext = true;
+      return true;
+    }
+    servos = &srv;
+    begin(clip, style, args);
+    return true;
+  }
+
+  // Replace whatever is playing or queued
+  void playNow(const AnimClip& clip, ServoController& srv,
+               const MovementStyleParams& style, const ClipArgs& args = ClipArgs()) {
+    stop();
+    play(clip, srv, style, args);
+  }
+
+  void stop() {
+    if (phase != CLIP_IDLE && servos != nullptr) servos->stopMotion();
+    phase = CLIP_IDLE;
+    hasNext = false;
+  }
+
+  bool isPlaying() const { return phase != CLIP_IDLE; }
+  const char* currentName() const { return phase != CLIP_IDLE ? cur.clip->name : ""; }
+
+  // Motion task, every tick: a few comparisons unless a keyframe boundary is due
+  void update() {
+    if (phase == CLIP_IDLE || servos == nullptr) return;
+    if (servos->inMotionWait()) return;   // Someone else's blocking move owns the servos
+
+    if (phase == CLIP_MOVING) {
+      if (servos->isBusy()) return;
+      const Keyframe& kf = cur.clip->frames[frame];
+      holdUntil = millis() + kf.holdMs + (unsigned long)(kf.holdVarMs * factor(kf.holdBy));
+      phase = CLIP_HOLDING;
+    }
+
+    if ((long)(millis() - holdUntil) < 0) return;
+
+    if (!advance()) {
+      phase = CLIP_IDLE;
+      if (hasNext) {
+        hasNext = false;
+        begin(*next.clip, next.style, next.args);
+      }
+      return;
+    }
+    startFrame();
+  }
+
+private:
+  enum ClipPhase : uint8_t { CLIP_IDLE, CLIP_MOVING, CLIP_HOLDING };
+
+  struct Playback {
+    const AnimClip* clip;
+    MovementStyleParams style;
+    ClipArgs args;
+  };
+
+  ServoController* servos;
+  Playback cur;
+  Playback next;
+  ClipPhase phase;
+  bool hasNext;
+  uint8_t frame;
+  uint8_t loopsLeft;
+  int8_t side;
+  float gain;
+  unsigned long holdUntil;
+
+  void begin(const AnimClip& clip, const MovementStyleParams& style, const ClipArgs& args) {
+    cur.clip = &clip;
+    cur.style = style;
+    cur.args = args;
+    cur.args.factor[CLIP_FACTOR_HESITATION] = style.hesitation;
+    cur.args.factor[CLIP_FACTOR_INTENSITY] = args.intensity;
+    if (clip.speedPct != 0) cur.style.speed *= clip.speedPct / 100.0f;
+    if (!cur.args.hasAnchor) {
+      servos->getPosition(cur.args.anchor[AXIS_BASE], cur.args.anchor[AXIS_NOD],
+                          cur.args.anchor[AXIS_TILT]);
+    }
+    side = random(0, 2) == 0 ? -1 : 1;
+    gain = (1.0f + clip.gainPct / 100.0f * factor(clip.gainBy)) * args.scale;
+    loopsLeft = (clip.loopEnd > clip.loopStart && args.repeat > 1) ? args.repeat - 1 : 0;
+    frame = 0;
+    if (clip.count > 0) startFrame();
+  }
+
+  float factor(ClipFactor f) const {
+    if (f == CLIP_FACTOR_RANDOM) return random(0, 1001) / 1000.0f;
+    return f < CLIP_FACTOR_COUNT ? cur.args.factor[f] : 0.0f;
+  }
+
+  // Step to the next keyframe, honoring the loop section
+  bool advance() {
+    frame++;
+    if (cur.clip->loopEnd > cur.clip->loopStart && frame == cur.clip->loopEnd && loopsLeft > 0) {
+      loopsLeft--;
+      frame = cur.clip->loopStart;
+    }
+    return frame < cur.clip->count;
+  }
+
+  void startFrame() {
+    const Keyframe& kf = cur.clip->frames[frame];
+    int pos[MOTION_AXES];
+    for (int a = 0; a < MOTION_AXES; a++) {
+      int offset = kf.pose[a];
+      if ((kf.flags & KF_SIDE) && a != AXIS_NOD) offset *= side;
+      if (cur.clip->scaleAxes & (1 << a)) offset = (int)(offset * gain);
+      if (kf.spread[a] > 0) offset += random(-(int)kf.spread[a], (int)kf.spread[a] + 1);
+
+      if (kf.flags & KF_ABSOLUTE) pos[a] = offset;
+      else if ((kf.flags & KF_TARGET) && a != AXIS_TILT) pos[a] = cur.args.target[a] + offset;
+      else pos[a] = cur.args.anchor[a] + offset;
+    }
+
+    if (kf.ease == CLIP_EASE_SNAP) {
+      servos->snapTo(pos[AXIS_BASE], pos[AXIS_NOD], pos[AXIS_TILT]);
+    } else {
+      MovementStyleParams style = cur.style;
+      if (kf.speedPct != 0) style.speed *= kf.speedPct / 100.0f;
+      servos->startMove(pos[AXIS_BASE], pos[AXIS_NOD], pos[AXIS_TILT], style, (MotionEase)kf.ease);
+    }
+    phase = CLIP_MOVING;
+  }
+};
+
+// Firmware-wide instance (one set of servos), defined in the main .ino
+extern ClipPlayer clipPlayer;
+
+#endif // ANIMATION_CLIP_H
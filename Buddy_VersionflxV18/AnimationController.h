@@ -11,6 +11,8 @@
 #include "Emotion.h"
 #include "Personality.h"
 #include "MovementStyle.h"
+#include "ClipLibrary.h"
+#include "Log.h"
 
 class AnimationController {
 private:
@@ -22,8 +24,10 @@ private:
   Behavior currentBehavior;
   
   unsigned long lastMicroMovement;
-  unsigned long lastBreathing;
-  bool isAnimating;
+  
+  // Behavior sequence built at run time (PoseLibrary), played as a clip
+  Keyframe behaviorFrames[5];
+  AnimClip behaviorClip;
   
 public:
   AnimationController(ServoController& servoController) 
@@ -32,10 +36,8 @@ public:
     currentPose = poseLib.getNeutralPose();
     currentBehavior = IDLE;
     lastMicroMovement = 0;
-    lastBreathing = 0;
-    isAnimating = false;
     
-    Serial.println("[ANIMATION] Controller initialized");
+    LOG_PRINTLN(ANIM, INFO, "[ANIMATION] Controller initialized");
   }
   
   // ============================================
@@ -45,18 +47,17 @@ public:
   void executeBehavior(Behavior behavior, Emotion& emotion, 
                        Personality& personality, Needs& needs) {
     
-    if (isAnimating) return;  // Don't interrupt ongoing animation
+    if (isCurrentlyAnimating()) return;  // Don't interrupt ongoing animation
     
-    isAnimating = true;
     currentBehavior = behavior;
     
-    Serial.print("\n[ANIMATION] Executing ");
-    Serial.println(behaviorToString(behavior));
+    LOG_PRINT(ANIM, DEBUG, "\n[ANIMATION] Executing ");
+    LOG_PRINTLN(ANIM, DEBUG, behaviorToString(behavior));
     
     // Generate movement style from emotion
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
     
-    if (verboseMode) {
+    if (LOG_ENABLED(ANIM, DEBUG) && verboseMode) {
       movementGen.printCompact(style);
     }
     
@@ -65,35 +66,36 @@ public:
     int seqLength = 0;
     poseLib.generateSequence(behavior, emotion, personality, sequence, seqLength, 5);
     
-    Serial.print("  Generated sequence: ");
-    Serial.print(seqLength);
-    Serial.println(" poses");
+    LOG_PRINT(ANIM, DEBUG, "  Generated sequence: ");
+    LOG_PRINT(ANIM, DEBUG, seqLength);
+    LOG_PRINTLN(ANIM, DEBUG, " poses");
+    
+    if (seqLength <= 0) return;
     
-    // Execute sequence
+    // Sequence as a clip: absolute poses, pause between them (emotion-dependent)
     for (int i = 0; i < seqLength; i++) {
-      if (verboseMode) {
-        Serial.print("    Pose ");
-        Serial.print(i + 1);
-        Serial.print("/");
-        Serial.print(seqLength);
-        Serial.print(": ");
+      if (LOG_ENABLED(ANIM, DEBUG) && verboseMode) {
+        LOG_PRINT(ANIM, DEBUG, "    Pose ");
+        LOG_PRINT(ANIM, DEBUG, i + 1);
+        LOG_PRINT(ANIM, DEBUG, "/");
+        LOG_PRINT(ANIM, DEBUG, seqLength);
+        LOG_PRINT(ANIM, DEBUG, ": ");
         sequence[i].print();
       }
       
-      servos.smoothMoveTo(sequence[i].base, sequence[i].nod, 
-                         sequence[i].tilt, style);
-      
-      // Pause between poses (emotion-dependent)
-      int pauseMs = 200 + (int)(style.hesitation * 300.0f);
-      if (i < seqLength - 1) {  // Don't pause after last pose
-        delay(pauseMs);
-      }
+      bool last = (i == seqLength - 1);  // Don't pause after last pose
+      behaviorFrames[i] = KF_EX(0, 0, 0, 0, 0, 0, MOTION_EASE_STYLE, KF_ABSOLUTE, 0,
+                                CLIP_FACTOR_HESITATION, (uint16_t)(last ? 0 : 200),
+                                (uint16_t)(last ? 0 : 300));
+      behaviorFrames[i].pose[AXIS_BASE] = sequence[i].base;
+      behaviorFrames[i].pose[AXIS_NOD] = sequence[i].nod;
+      behaviorFrames[i].pose[AXIS_TILT] = sequence[i].tilt;
     }
+    behaviorClip = { behaviorToString(behavior), behaviorFrames, (uint8_t)seqLength,
+                     0, 0, 0, CLIP_FACTOR_NONE, 0, 0 };
+    clipPlayer.play(behaviorClip, servos, style);
     
     currentPose = sequence[seqLength - 1];
-    isAnimating = false;
-    
-    Serial.println("[ANIMATION] Sequence complete\n");
   }
   
   // ============================================
@@ -105,11 +107,10 @@ public:
     
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
     
-    Serial.print("[ANIMATION] Transitioning to: ");
+    LOG_PRINT(ANIM, DEBUG, "[ANIMATION] Transitioning to: ");
     targetPose.print();
     
-    servos.smoothMoveTo(targetPose.base, targetPose.nod, 
-                       targetPose.tilt, style);
+    servos.startMove(targetPose.base, targetPose.nod, targetPose.tilt, style);
     
     currentPose = targetPose;
   }
@@ -119,31 +120,18 @@ public:
   // ============================================
   
   void curiousTilt(Emotion& emotion, Personality& personality, Needs& needs) {
-    Serial.println("[ANIMATION] Curious head tilt");
+    LOG_PRINTLN(ANIM, DEBUG, "[ANIMATION] Curious head tilt");
     
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
     
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
-    // Tilt in direction based on curiosity
-    int tiltAmount = 20 + (int)(personality.getCuriosity() * 20.0f);
-    int direction = random(0, 2) == 0 ? -1 : 1;
-    
-    // Tilt one way
-    Pose tiltPose(currentBase, currentNod + 5, currentTilt + tiltAmount * direction);
-    servos.smoothMoveTo(tiltPose.base, tiltPose.nod, tiltPose.tilt, style);
-    delay(400);
-    
-    // Return
-    Pose returnPose(currentBase, currentNod, currentTilt);
-    servos.smoothMoveTo(returnPose.base, returnPose.nod, returnPose.tilt, style);
+    // Tilt (20°, up to double with curiosity) to a random side, then return
+    clipPlayer.play(CLIP_CURIOUS_TILT, servos, style, ClipArgs::from(personality));
   }
   
   void scanningMotion(int centerAngle, float amplitude, Emotion& emotion, 
                       Personality& personality, Needs& needs) {
     
-    Serial.println("[ANIMATION] Scanning motion");
+    LOG_PRINTLN(ANIM, DEBUG, "[ANIMATION] Scanning motion");
     
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
     
@@ -152,120 +140,48 @@ public:
     
     int scanAmplitude = (int)(amplitude * style.amplitude);
     
-    // Scan left
-    Pose leftPose(centerAngle - scanAmplitude, currentNod + 5, currentTilt);
-    servos.smoothMoveTo(leftPose.base, leftPose.nod, leftPose.tilt, style);
-    delay(200);
-    
-    // Scan right
-    Pose rightPose(centerAngle + scanAmplitude, currentNod + 5, currentTilt - 5);
-    servos.smoothMoveTo(rightPose.base, rightPose.nod, rightPose.tilt, style);
-    delay(200);
-    
-    // Center
-    Pose centerPose(centerAngle, currentNod, currentTilt);
-    servos.smoothMoveTo(centerPose.base, centerPose.nod, centerPose.tilt, style);
+    // Left, right (a little raised), then back to center
+    clipPlayer.play(CLIP_SCAN, servos, style,
+                    ClipArgs().withTarget(centerAngle, currentNod).withScale(scanAmplitude / 100.0f));
   }
   
   void nodYes(int count, Emotion& emotion, Personality& personality, Needs& needs) {
-    Serial.print("[ANIMATION] Nodding ");
-    Serial.print(count);
-    Serial.println(" times");
+    LOG_PRINT(ANIM, DEBUG, "[ANIMATION] Nodding ");
+    LOG_PRINT(ANIM, DEBUG, count);
+    LOG_PRINTLN(ANIM, DEBUG, " times");
     
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
-    
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
-    int nodAmount = 15;
-    
-    for (int i = 0; i < count; i++) {
-      // Nod down
-      Pose downPose(currentBase, currentNod + nodAmount, currentTilt);
-      servos.smoothMoveTo(downPose.base, downPose.nod, downPose.tilt, style);
-      delay(150);
-      
-      // Nod up
-      Pose upPose(currentBase, currentNod - 5, currentTilt);
-      servos.smoothMoveTo(upPose.base, upPose.nod, upPose.tilt, style);
-      delay(150);
-    }
-    
-    // Return to neutral
-    Pose neutralPose(currentBase, currentNod, currentTilt);
-    servos.smoothMoveTo(neutralPose.base, neutralPose.nod, neutralPose.tilt, style);
+    clipPlayer.play(CLIP_NOD_YES, servos, style, ClipArgs().withRepeat((uint8_t)count));
   }
   
   void shakeNo(int count, Emotion& emotion, Personality& personality, Needs& needs) {
-    Serial.print("[ANIMATION] Shaking head ");
-    Serial.print(count);
-    Serial.println(" times");
+    LOG_PRINT(ANIM, DEBUG, "[ANIMATION] Shaking head ");
+    LOG_PRINT(ANIM, DEBUG, count);
+    LOG_PRINTLN(ANIM, DEBUG, " times");
     
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
-    
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
-    int shakeAmount = 20;
-    
-    for (int i = 0; i < count; i++) {
-      // Shake left
-      Pose leftPose(currentBase - shakeAmount, currentNod, currentTilt);
-      servos.smoothMoveTo(leftPose.base, leftPose.nod, leftPose.tilt, style);
-      delay(150);
-      
-      // Shake right
-      Pose rightPose(currentBase + shakeAmount, currentNod, currentTilt);
-      servos.smoothMoveTo(rightPose.base, rightPose.nod, rightPose.tilt, style);
-      delay(150);
-    }
-    
-    // Return to center
-    Pose centerPose(currentBase, currentNod, currentTilt);
-    servos.smoothMoveTo(centerPose.base, centerPose.nod, centerPose.tilt, style);
+    clipPlayer.play(CLIP_SHAKE_NO, servos, style, ClipArgs().withRepeat((uint8_t)count));
   }
   
   void playfulBounce(Emotion& emotion, Personality& personality, Needs& needs) {
-    Serial.println("[ANIMATION] Playful bounce");
+    LOG_PRINTLN(ANIM, DEBUG, "[ANIMATION] Playful bounce");
     
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
-    style.speed *= 1.3f;  // Faster for bounce
-    
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
-    for (int i = 0; i < 3; i++) {
-      // Bounce up
-      Pose upPose(currentBase + random(-10, 11), currentNod + 15, currentTilt - 10);
-      servos.smoothMoveTo(upPose.base, upPose.nod, upPose.tilt, style);
-      delay(100);
-      
-      // Bounce down
-      Pose downPose(currentBase + random(-10, 11), currentNod - 5, currentTilt + 5);
-      servos.smoothMoveTo(downPose.base, downPose.nod, downPose.tilt, style);
-      delay(100);
-    }
-    
-    // Return
-    Pose returnPose(currentBase, currentNod, currentTilt);
-    servos.smoothMoveTo(returnPose.base, returnPose.nod, returnPose.tilt, style);
+    clipPlayer.play(CLIP_PLAYFUL_BOUNCE, servos, style);  // Clip runs at 130% speed
   }
   
   void retreatMotion(Emotion& emotion, Personality& personality, Needs& needs) {
-    Serial.println("[ANIMATION] Retreat motion");
+    LOG_PRINTLN(ANIM, DEBUG, "[ANIMATION] Retreat motion");
     
     MovementStyleParams style = movementGen.generate(emotion, personality, needs);
     
-    // Quick recoil
+    // Quick recoil, then slowly peek back (still cautious)
     Pose recoilPose = poseLib.getWithdrawnPose();
-    servos.smoothMoveTo(recoilPose.base, recoilPose.nod, recoilPose.tilt, style);
-    delay(500);
-    
-    // Slowly peek back
-    style.speed *= 0.5f;  // Slower return
     Pose peekPose = poseLib.getNeutralPose();
-    peekPose.nod -= 10;  // Still cautious
-    servos.smoothMoveTo(peekPose.base, peekPose.nod, peekPose.tilt, style);
+    clipPlayer.play(CLIP_RECOIL, servos, style,
+                    ClipArgs().withAnchor(recoilPose.base, recoilPose.nod, recoilPose.tilt));
+    clipPlayer.play(CLIP_PEEK_BACK, servos, style,
+                    ClipArgs().withAnchor(peekPose.base, peekPose.nod, peekPose.tilt));
   }
   
   // ============================================
@@ -275,20 +191,9 @@ public:
   void updateMicroMovements(Behavior currentBehavior, Emotion& emotion) {
     unsigned long now = millis();
     
-    // Don't add micro-movements during active animation
-    if (isAnimating) return;
-    
-    // Breathing motion (continuous)
-    if (now - lastBreathing > 100) {
-      if (currentBehavior == IDLE || currentBehavior == REST) {
-        // Stronger breathing when idle
-        servos.breathingMotion(4.0f, 5000);
-      } else {
-        // Subtle breathing otherwise
-        servos.breathingMotion(2.0f, 4000);
-      }
-      lastBreathing = now;
-    }
+    // Breathing is AmbientLife's layer. Don't add micro-movements during
+    // active animation or a move
+    if (isCurrentlyAnimating() || servos.isBusy()) return;
     
     // Random micro-movements
     if (now - lastMicroMovement > 8000) {
@@ -316,11 +221,7 @@ public:
           case 2:
             // Small head adjustment
             if (random(100) < 50) {
-              int currentBase, currentNod, currentTilt;
-              servos.getPosition(currentBase, currentNod, currentTilt);
-              int newTilt = currentTilt + random(-3, 4);
-              newTilt = constrain(newTilt, 20, 150);
-              tiltServo.write(newTilt);
+              servos.nudge(AXIS_TILT, random(-3, 4), 2000);
             }
             break;
         }
@@ -335,8 +236,8 @@ public:
   // ============================================
   
   void expressEmotion(EmotionLabel emotion, Personality& personality, Needs& needs) {
-    Serial.print("[ANIMATION] Expressing emotion: ");
-    Serial.println(emotionLabelToString(emotion));
+    LOG_PRINT(ANIM, DEBUG, "[ANIMATION] Expressing emotion: ");
+    LOG_PRINTLN(ANIM, DEBUG, emotionLabelToString(emotion));
     
     Emotion dummyEmotion;  // Placeholder
     MovementStyleParams style = movementGen.generate(dummyEmotion, personality, needs);
@@ -351,34 +252,32 @@ public:
         
       case CURIOUS:
         expressivePose = poseLib.getCuriousTiltPose();
-        servos.smoothMoveTo(expressivePose.base, expressivePose.nod, 
-                           expressivePose.tilt, style);
+        servos.startMove(expressivePose.base, expressivePose.nod, expressivePose.tilt, style);
         break;
         
       case ANXIOUS:
         expressivePose = poseLib.getWithdrawnPose();
-        servos.smoothMoveTo(expressivePose.base, expressivePose.nod, 
-                           expressivePose.tilt, style);
+        servos.startMove(expressivePose.base, expressivePose.nod, expressivePose.tilt, style);
         break;
         
       case CONFUSED:
+        // Head shake around the confused pose
         expressivePose = poseLib.getConfusedPose();
-        servos.smoothMoveTo(expressivePose.base, expressivePose.nod, 
-                           expressivePose.tilt, style);
-        shakeNo(2, dummyEmotion, personality, needs);
+        clipPlayer.play(CLIP_SHAKE_NO, servos, style,
+                        ClipArgs().withRepeat(2).withAnchor(expressivePose.base,
+                                                            expressivePose.nod,
+                                                            expressivePose.tilt));
         break;
         
       case CONTENT:
         expressivePose = poseLib.getNeutralPose();
         expressivePose.nod -= 5;  // Relaxed
-        servos.smoothMoveTo(expressivePose.base, expressivePose.nod, 
-                           expressivePose.tilt, style);
+        servos.startMove(expressivePose.base, expressivePose.nod, expressivePose.tilt, style);
         break;
         
       default:
         expressivePose = poseLib.getNeutralPose();
-        servos.smoothMoveTo(expressivePose.base, expressivePose.nod, 
-                           expressivePose.tilt, style);
+        servos.startMove(expressivePose.base, expressivePose.nod, expressivePose.tilt, style);
         break;
     }
     
@@ -390,14 +289,15 @@ public:
   // ============================================
   
   void returnToNeutral(Emotion& emotion, Personality& personality, Needs& needs) {
-    Serial.println("[ANIMATION] Returning to neutral");
+    LOG_PRINTLN(ANIM, DEBUG, "[ANIMATION] Returning to neutral");
     
     Pose neutral = poseLib.getNeutralPose();
     transitionToPose(neutral, emotion, personality, needs);
   }
   
+  // A clip (any module's) is playing or queued
   bool isCurrentlyAnimating() {
-    return isAnimating;
+    return clipPlayer.isPlaying();
   }
   
   Pose getCurrentPose() {
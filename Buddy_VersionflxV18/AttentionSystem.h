@@ -6,6 +6,8 @@
 
 #include "SpatialMemory.h"
 #include "Personality.h"
+#include "Telemetry.h"
+#include "Log.h"
 
 class AttentionSystem {
 private:
@@ -52,15 +54,8 @@ public:
     if (maxDir != focusDirection && 
         maxSal > focusStrength + ATTENTION_SHIFT_THRESHOLD) {
       
-      Serial.print("[ATTENTION] Shift: dir ");
-      Serial.print(focusDirection);
-      Serial.print(" → ");
-      Serial.print(maxDir);
-      Serial.print(" (salience: ");
-      Serial.print(focusStrength, 2);
-      Serial.print(" → ");
-      Serial.print(maxSal, 2);
-      Serial.println(")");
+      TELEMETRY(TEL_ATTENTION_SHIFT, focusDirection, maxDir,
+                (int32_t)(focusStrength * 100), (int32_t)(maxSal * 100));
       
       focusDirection = maxDir;
       focusStrength = maxSal;
@@ -169,54 +164,50 @@ public:
     focusStrength = strength;
     focusStartTime = millis();
     
-    Serial.print("[ATTENTION] Forced to dir ");
-    Serial.print(direction);
-    Serial.print(" (strength: ");
-    Serial.print(strength, 2);
-    Serial.println(")");
+    TELEMETRY(TEL_ATTENTION_FORCE, direction, (int32_t)(strength * 100));
   }
   
   void print() {
-    Serial.println("--- ATTENTION STATE ---");
-    Serial.print("  Focus direction: ");
-    Serial.print(focusDirection);
-    Serial.print(" (strength: ");
-    Serial.print(focusStrength, 2);
-    Serial.println(")");
+    LOG_PRINTLN(ATTENTION, INFO, "--- ATTENTION STATE ---");
+    LOG_PRINT(ATTENTION, INFO, "  Focus direction: ");
+    LOG_PRINT(ATTENTION, INFO, focusDirection);
+    LOG_PRINT(ATTENTION, INFO, " (strength: ");
+    LOG_PRINT(ATTENTION, INFO, focusStrength, 2);
+    LOG_PRINTLN(ATTENTION, INFO, ")");
     
-    Serial.print("  Time focused: ");
-    Serial.print(getTimeFocused(), 1);
-    Serial.println(" seconds");
+    LOG_PRINT(ATTENTION, INFO, "  Time focused: ");
+    LOG_PRINT(ATTENTION, INFO, getTimeFocused(), 1);
+    LOG_PRINTLN(ATTENTION, INFO, " seconds");
     
-    Serial.println("\n  Salience map:");
+    LOG_PRINTLN(ATTENTION, INFO, "\n  Salience map:");
     const char* dirNames[] = {"Front", "FR", "Right", "BR", "Back", "BL", "Left", "FL"};
     for (int i = 0; i < 8; i++) {
-      Serial.print("    ");
-      Serial.print(dirNames[i]);
-      Serial.print(": ");
+      LOG_PRINT(ATTENTION, INFO, "    ");
+      LOG_PRINT(ATTENTION, INFO, dirNames[i]);
+      LOG_PRINT(ATTENTION, INFO, ": ");
       printBar(salience[i]);
-      if (i == focusDirection) Serial.print(" ← FOCUS");
-      Serial.println();
+      if (i == focusDirection) LOG_PRINT(ATTENTION, INFO, " ← FOCUS");
+      LOG_PRINTLN(ATTENTION, INFO);
     }
   }
   
   void printCompact() {
-    Serial.print("  [ATTENTION] Focus: dir ");
-    Serial.print(focusDirection);
-    Serial.print(" str:");
-    Serial.print(focusStrength, 2);
-    Serial.print(" maxSal:");
-    Serial.println(getMaxSalience(), 2);
+    LOG_PRINT(ATTENTION, INFO, "  [ATTENTION] Focus: dir ");
+    LOG_PRINT(ATTENTION, INFO, focusDirection);
+    LOG_PRINT(ATTENTION, INFO, " str:");
+    LOG_PRINT(ATTENTION, INFO, focusStrength, 2);
+    LOG_PRINT(ATTENTION, INFO, " maxSal:");
+    LOG_PRINTLN(ATTENTION, INFO, getMaxSalience(), 2);
   }
   
   void printBar(float value) {
-    Serial.print("[");
+    LOG_PRINT(ATTENTION, INFO, "[");
     int bars = (int)(value * 10);
     for (int i = 0; i < 10; i++) {
-      Serial.print(i < bars ? "█" : "░");
+      LOG_PRINT(ATTENTION, INFO, i < bars ? "█" : "░");
     }
-    Serial.print("] ");
-    Serial.print(value, 2);
+    LOG_PRINT(ATTENTION, INFO, "] ");
+    LOG_PRINT(ATTENTION, INFO, value, 2);
   }
 };
 
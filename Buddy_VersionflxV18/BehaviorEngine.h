@@ -7,9 +7,9 @@
 #define BEHAVIOR_ENGINE_H
 
 #include "LittleBots_Board_Pins.h"
-
-// Forward declarations
-int checkUltra(int theEchoPin, int theTrigPin);
+#include "RangeFilter.h"
+#include "Telemetry.h"
+#include "AIEvents.h"
 
 // ============================================
 // PERSON & RELATIONSHIP TRACKING
@@ -54,6 +54,7 @@ struct PersonRecord {
 #include "IllusionLayer.h"  // UPDATED VERSION
 #include "AnimationController.h"
 #include "ServoController.h"
+#include "MotionLut.h"
 #include "BodySchema.h"
 #include "MovementExpression.h"
 #include "EpisodicMemory.h"  // NEW
@@ -64,11 +65,7 @@ struct PersonRecord {
 #include "ConsciousnessManifest.h"
 #include "AmbientLife.h"
 #include "SpeechUrge.h"
-
-// ============================================
-// DEBUG CONFIGURATION
-// ============================================
-#define DEBUG_LEARNING false   // Set false to reduce serial output
+#include "Log.h"
 
 class BehaviorEngine {
 private:
@@ -98,14 +95,14 @@ private:
   ReflexiveControl* reflexController;  // NEW: Reflexive tracking layer
 
   unsigned long lastFastUpdate;
-  unsigned long lastMediumUpdate;
-  unsigned long lastSlowUpdate;
+  float lastDeltaTime;           // dt of the last fast update (used by updateMedium)
   unsigned long sessionStartTime;
   
   Behavior currentBehavior;
   Behavior previousBehavior;
   int currentDirection;
   float lastDistance;
+  float lastRangeConfidence;     // Confidence of the range passed to update()
   float behaviorUncertainty;
   
   int retreatLoopCounter;
@@ -127,6 +124,26 @@ private:
   static constexpr unsigned long INVESTIGATION_TIMEOUT_MS = 8000;
   static constexpr unsigned long INVESTIGATION_HOLD_MS = 3000;
 
+  // Behavior motion steps: the moves and expressions of one behavior,
+  // run one step at a time from update() once the servos are free
+  Behavior stepBehavior;
+  uint8_t behaviorStep;           // Next step to run
+  bool behaviorStepsActive;
+  bool illusionPending;           // applyIllusion() when the steps end
+  unsigned long stepHoldMs;       // Hold after the current step arrives
+  unsigned long stepHoldUntil;
+  ServoAngles stepAngles;         // Where the behavior looks first
+  int vigilantSpots[2];
+  int vigilantCount;
+
+  // Sweep/foveal point in flight: the ultrasonic is read from the first
+  // ping fired after the move arrives
+  bool scanProbeActive;
+  bool scanProbeRecord;           // False for the foveal centring move
+  bool scanProbeArrived;
+  uint32_t scanProbeArrivedMs;
+  int scanProbeDirection;
+
   // Person tracking
   static const int MAX_PEOPLE = 10;
   PersonRecord people[MAX_PEOPLE];
@@ -162,13 +179,13 @@ private:
 public:
   BehaviorEngine() {
     lastFastUpdate = 0;
-    lastMediumUpdate = 0;
-    lastSlowUpdate = 0;
+    lastDeltaTime = 0;
     sessionStartTime = millis();
     currentBehavior = IDLE;
     previousBehavior = IDLE;
     currentDirection = 0;
     lastDistance = 100.0;
+    lastRangeConfidence = 1.0;
     behaviorUncertainty = 0.0;
 
     retreatLoopCounter = 0;
@@ -183,6 +200,20 @@ public:
     investigationStartTime = 0;
     investigationDescriptionReceived = false;
 
+    // Behavior motion steps
+    stepBehavior = IDLE;
+    behaviorStep = 0;
+    behaviorStepsActive = false;
+    illusionPending = false;
+    stepHoldMs = 0;
+    stepHoldUntil = 0;
+    vigilantCount = 0;
+    scanProbeActive = false;
+    scanProbeRecord = false;
+    scanProbeArrived = false;
+    scanProbeArrivedMs = 0;
+    scanProbeDirection = 0;
+
     // Person tracking initialization
     currentPersonID = -1;
     personInteractionStart = 0;
@@ -229,9 +260,9 @@ public:
       // Only disable if not currently tracking a face
       if (!isTrackingFace && !reflexController->isActive()) {
         reflexController->disable();
-        Serial.println("[BEHAVIOR] Reflex safely disabled");
+        LOG_PRINTLN(BEHAVIOR, DEBUG, "[BEHAVIOR] Reflex safely disabled");
       } else {
-        Serial.println("[BEHAVIOR] Reflex disable blocked - active tracking");
+        LOG_PRINTLN(BEHAVIOR, DEBUG, "[BEHAVIOR] Reflex disable blocked - active tracking");
       }
     }
   }
@@ -417,7 +448,7 @@ public:
 
   void stopFaceTracking() {
     if (isTrackingFace) {
-      Serial.println("[TRACKING] Stopped");
+      LOG_PRINTLN(BEHAVIOR, INFO, "[TRACKING] Stopped");
       isTrackingFace = false;
       trackingState = TRACK_IDLE;
 
@@ -439,7 +470,7 @@ public:
         ServoAngles neutral = bodySchema.lookAt(0, 50, 20);
         MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
         style.speed = 0.3;  // Slow return
-        servoController->smoothMoveTo(neutral.base, neutral.nod, neutral.tilt, style);
+        servoController->startMove(neutral.base, neutral.nod, neutral.tilt, style);
       }
     }
   }
@@ -489,9 +520,7 @@ public:
             lockDuration = random(8000, 15000);
           }
 
-          Serial.print("[TRACKING] LOCKED ON for ");
-          Serial.print(lockDuration / 1000);
-          Serial.println(" seconds");
+          TELEMETRY(TEL_TRACK_LOCK, (int32_t)lockDuration, isRecognizedPerson ? 1 : 0);
 
           // Buddy signature: understated social greeting on lock
           if (servoController != nullptr &&
@@ -657,7 +686,8 @@ public:
     const int MIN_MOVEMENT = 2;  // degrees
 
     if (baseDelta >= MIN_MOVEMENT || nodDelta >= MIN_MOVEMENT || tiltDelta >= MIN_MOVEMENT) {
-      // During LOCKED state, use smoothMoveTo with fast speed for responsive tracking
+      // During LOCKED state, use a fast move for responsive tracking. Moves are
+      // non-blocking: each tick retargets the one in progress
       // (Direct writes cause servo spam and accumulation drift)
       if (trackingState == TRACK_LOCKED) {
         // Use smooth movement but with very fast speed
@@ -665,9 +695,9 @@ public:
         fastStyle.speed = 1.8;  // Very fast
         fastStyle.smoothness = 0.1;  // Minimal smoothing
         fastStyle.delayMs = 5;  // Minimal delay between steps
-        servoController->smoothMoveTo(targetBase, targetNod, targetTilt, fastStyle);
+        servoController->startMove(targetBase, targetNod, targetTilt, fastStyle);
       } else {
-        servoController->smoothMoveTo(targetBase, targetNod, targetTilt, style);
+        servoController->startMove(targetBase, targetNod, targetTilt, style);
       }
     }
     // else: Skip update - change too small to warrant servo movement
@@ -721,8 +751,8 @@ public:
     debugFaceTrackingMode = !debugFaceTrackingMode;
 
     if (debugFaceTrackingMode) {
-      Serial.println("\n[DEBUG] Face tracking mode ENABLED");
-      Serial.println("  Type 'x' again to exit\n");
+      LOG_PRINTLN(BEHAVIOR, INFO, "\n[DEBUG] Face tracking mode ENABLED");
+      LOG_PRINTLN(BEHAVIOR, INFO, "  Type 'x' again to exit\n");
 
       // Force tracking to be ready
       isTrackingFace = false;
@@ -733,7 +763,7 @@ public:
         servoController->snapTo(90, 110, 85);
       }
     } else {
-      Serial.println("\n[DEBUG] Face tracking mode DISABLED\n");
+      LOG_PRINTLN(BEHAVIOR, INFO, "\n[DEBUG] Face tracking mode DISABLED\n");
       // Stop tracking
       stopFaceTracking();
     }
@@ -780,29 +810,35 @@ public:
       &goalSystem  // Pass goal system
     );
 
-    #if DEBUG_LEARNING
-    Serial.print("[OUTCOME] ");
-    Serial.print(behaviorToString(currentBehavior));
-    Serial.print(": ");
-    Serial.println(outcome, 3);
+    LOG_PRINT(BEHAVIOR, DEBUG, "[OUTCOME] ");
+    LOG_PRINT(BEHAVIOR, DEBUG, behaviorToString(currentBehavior));
+    LOG_PRINT(BEHAVIOR, DEBUG, ": ");
+    LOG_PRINTLN(BEHAVIOR, DEBUG, outcome, 3);
 
     // Optional: Show detailed breakdown
     // outcomeCalc.printBreakdown(currentBehavior, needs, emotion, &goalSystem);
-    #endif
 
     return outcome;
   }
   
   void begin() {
-    Serial.println("\n[SYSTEM] Initializing behavior engine...");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n[SYSTEM] Initializing behavior engine...");
 
     learningSystem.loadFromEEPROM(personality, behaviorSelector);
     snapshotStateBeforeBehavior();
 
-    Serial.println("[SYSTEM] Behavior engine ready\n");
+    LOG_PRINTLN(BEHAVIOR, INFO, "[SYSTEM] Behavior engine ready\n");
   }
   
   void update(float sensorDistance, int baseAngle, int nodAngle) {
+    update(sensorDistance, 1.0f, baseAngle, nodAngle);
+  }
+
+  // rangeConfidence (0..1) comes from RangeFilter — distance changes
+  // below RANGE_TRUST_CONFIDENCE are treated as sensor noise, not motion
+  void update(float sensorDistance, float rangeConfidence, int baseAngle, int nodAngle) {
+    lastRangeConfidence = rangeConfidence;
+
     // DEBUG MODE: Skip all normal processing, only do face tracking
     if (debugFaceTrackingMode) {
       debugUpdate();
@@ -811,6 +847,7 @@ public:
 
     unsigned long now = millis();
     float deltaTime = (now - lastFastUpdate) / 1000.0;
+    lastDeltaTime = deltaTime;
 
     bodySchema.updateCurrentAngles(baseAngle, nodAngle, 85);
 
@@ -820,16 +857,12 @@ public:
     bool reflexIsActive = (reflexController != nullptr && reflexController->isActive());
 
     // ═══════════════════════════════════════════════════════════════════
-    // VERIFICATION: Log which path is taken (every 5 seconds)
+    // VERIFICATION: Log which path is taken (on every switch)
     // ═══════════════════════════════════════════════════════════════════
-    static unsigned long lastPathLog = 0;
-    if (now - lastPathLog > 5000) {
-      if (reflexIsActive) {
-        Serial.println("[BEHAVIOR] FAST PATH: Reflex active, minimal processing");
-      } else {
-        Serial.println("[BEHAVIOR] NORMAL PATH: Full behavior system active");
-      }
-      lastPathLog = now;
+    static int8_t lastPathFast = -1;
+    if (lastPathFast != (int8_t)reflexIsActive) {
+      TELEMETRY(TEL_BEHAVIOR_PATH, reflexIsActive ? 1 : 0);
+      lastPathFast = (int8_t)reflexIsActive;
     }
 
     // ═══════════════════════════════════════════════════════════════════
@@ -847,6 +880,9 @@ public:
       // Check face tracking timeout
       checkFaceTrackingTimeout();
 
+      // Reflex owns the servos: drop any step sequence or sweep
+      cancelMotionSequences();
+
       // Skip everything else - return early!
       return;
     }
@@ -868,41 +904,31 @@ public:
 
     attention.update(spatialMemory, personality, deltaTime);
 
-    // No guards needed - reflex already returned early if active
-    if (attention.needsPeripheralSweep()) {
-      executePeripheralSweep();
+    // Sequences in flight: read the probe that arrived, step the sweep
+    // and the behavior's moves
+    updateScanProbe();
+    scanner.update();
+    updateBehaviorSteps();
+
+    // No reflex guard needed (it returned early). A sweep/foveal point
+    // waits for free servos; the attention timer stays due until it runs
+    if (attention.needsPeripheralSweep() && executePeripheralSweep()) {
       attention.markPeripheralSweep();
     }
 
-    if (attention.needsFovealScan()) {
-      executeFovealScan();
+    if (attention.needsFovealScan() && executeFovealScan()) {
       attention.markFovealScan();
     }
 
-    if (now - lastMediumUpdate > 5000) {
-      mediumUpdate(deltaTime);
-
-      // Execute behavior on change
-      if (currentBehavior != previousBehavior && animator != nullptr) {
-        // ═══════════════════════════════════════════════════════════════
-        // VERIFICATION: Log that we're executing normal behavior
-        // ═══════════════════════════════════════════════════════════════
-        Serial.print("[BEHAVIOR] Executing normal behavior: ");
-        Serial.println(behaviorToString(currentBehavior));
-
-        executeCurrentBehavior();
-      }
-
-      lastMediumUpdate = now;
+    if (servoController != nullptr) {
+      servoController->setSequenceActive(motionSequenceActive());
     }
 
-    if (now - lastSlowUpdate > 30000) {
-      slowUpdate();
-      lastSlowUpdate = now;
-    }
+    // Medium (5s) and slow (30s) tiers run as their own scheduler tasks:
+    // updateMedium() / updateSlow()
 
     // Micro-movements and expressions (no guard needed, reflex returned early)
-    if (animator != nullptr && !animator->isCurrentlyAnimating()) {
+    if (animator != nullptr && !animator->isCurrentlyAnimating() && !motionSequenceActive()) {
       animator->updateMicroMovements(currentBehavior, emotion);
 
       if (servoController != nullptr && currentBehavior != RETREAT) {
@@ -943,16 +969,15 @@ public:
     // Buddy signature: alone thinking when nobody is around
     if (!reflexIsActive && !isTrackingFace &&
         (animator == nullptr || !animator->isCurrentlyAnimating()) &&
-        servoController != nullptr &&
+        servoController != nullptr && !servoController->isBusy() && !motionSequenceActive() &&
         currentBehavior == IDLE && !spatialMemory.likelyHumanPresent() &&
         random(100) < 8) {
       expressiveness.aloneThinking(*servoController, emotion, personality, needs);
     }
 
-    // Ambient life (need-driven, not timer-driven)
-    if (!reflexIsActive && !isTrackingFace &&
-        (animator == nullptr || !animator->isCurrentlyAnimating()) &&
-        servoController != nullptr) {
+    // Ambient life (need-driven, not timer-driven). Its offsets layer over
+    // moves and clips, so only tracking holds it back
+    if (!reflexIsActive && !isTrackingFace && servoController != nullptr) {
       ambientLife.update(needs, emotion, personality, *servoController, now);
     }
 
@@ -960,9 +985,39 @@ public:
     checkStuckState();
   }
   
+  // ═══════════════════════════════════════════════════════════════════
+  // SCHEDULED TIERS - registered in the main loop's task table
+  // Skipped while reflex tracking owns the servos (same as the fast path)
+  // ═══════════════════════════════════════════════════════════════════
+
+  // Every 5s: needs, behavior selection, consciousness, speech urge
+  void updateMedium() {
+    if (debugFaceTrackingMode) return;
+    if (reflexController != nullptr && reflexController->isActive()) return;
+
+    mediumUpdate(lastDeltaTime);
+
+    // Execute behavior on change
+    if (currentBehavior != previousBehavior && animator != nullptr) {
+      executeCurrentBehavior();   // Logs TEL_BEHAVIOR_EXEC
+    }
+  }
+
+  // Every 30s: long-term learning and goals
+  void updateSlow() {
+    if (debugFaceTrackingMode) return;
+    if (reflexController != nullptr && reflexController->isActive()) return;
+
+    slowUpdate();
+  }
+
   void fastUpdate(float distance, int baseAngle, int nodAngle, float dt) {
     currentDirection = scanner.angleToDirection(baseAngle, nodAngle);
 
+    // Untrusted range: hold the last trusted distance so noise can't
+    // register as sudden movement (Emotion spikes arousal at > 20cm)
+    if (lastRangeConfidence < RANGE_TRUST_CONFIDENCE) distance = lastDistance;
+
     float distanceChange = abs(distance - lastDistance);
     float novelty = spatialMemory.getNovelty(currentDirection);
 
@@ -1030,6 +1085,7 @@ public:
     if (currentBehavior != previousBehavior) {
       lastBehaviorChangeTime = millis();
       snapshotStateBeforeBehavior();
+      AI_EVENT(AI_EVT_BEHAVIOR, behaviorToString(previousBehavior), behaviorToString(currentBehavior));
     }
 
     // Calculate uncertainty
@@ -1150,14 +1206,13 @@ public:
   // SPATIAL SCANNING
   // ============================================
   
-  void executePeripheralSweep() {
-    if (servoController == nullptr) return;
+  // One scan point per call, started only when nothing else is moving;
+  // false leaves the attention timer due for the next tick
+  bool executePeripheralSweep() {
+    if (servoController == nullptr || !servosFree()) return false;
 
     MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
 
-    // ═══════════════════════════════════════════════════════════════
-    // PERFORMANCE: Non-blocking scan - track position and advance
-    // ═══════════════════════════════════════════════════════════════
     static int scanIndex = 0;
     SpatialPoint points[8];
     int count = 0;
@@ -1167,20 +1222,17 @@ public:
       scanIndex = 0;  // Reset to beginning
     }
 
-    // Command one scan point per call instead of all at once
+    // Move to the point; updateScanProbe() reads the range after arrival
     ServoAngles angles = bodySchema.lookAt(points[scanIndex].x, points[scanIndex].y, points[scanIndex].z);
-    servoController->smoothMoveTo(angles.base, angles.nod, angles.tilt, style);
-    // REMOVED: delay(150) - non-blocking design
-
-    float distance = checkUltra(echoPin, trigPin);
-    int direction = angles.base / 22;
-    spatialMemory.updateReading(direction, distance);
+    servoController->startMove(angles.base, angles.nod, angles.tilt, style);
+    startScanProbe(angles.base / 22, true);
 
     scanIndex++;  // Advance to next scan point for next call
+    return true;
   }
 
-  void executeFovealScan() {
-    if (servoController == nullptr) return;
+  bool executeFovealScan() {
+    if (servoController == nullptr || !servosFree()) return false;
 
     int focusDir = attention.getFocusDirection();
     float distance = spatialMemory.getAverageDistance(focusDir);
@@ -1189,24 +1241,19 @@ public:
 
     MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
 
-    // ═══════════════════════════════════════════════════════════════
-    // PERFORMANCE: Non-blocking foveal scan - track position
-    // ═══════════════════════════════════════════════════════════════
+    // One step per call: centre, then three tracking steps with a reading each
     static int fovealStep = 0;
 
     if (fovealStep == 0) {
       // First step: center on target
       ServoAngles center = bodySchema.lookAtDirection(focusDir, distance);
-      servoController->smoothMoveTo(center.base, center.nod, center.tilt, style);
-      // REMOVED: delay(300) - non-blocking design
+      servoController->startMove(center.base, center.nod, center.tilt, style);
+      startScanProbe(focusDir, false);
     } else {
       // Subsequent steps: track attention
       ServoAngles track = bodySchema.trackAttention(0.3);
-      servoController->smoothMoveTo(track.base, track.nod, track.tilt, style);
-      // REMOVED: delay(250) in loop - non-blocking design
-
-      float dist = checkUltra(echoPin, trigPin);
-      spatialMemory.updateReading(focusDir, dist);
+      servoController->startMove(track.base, track.nod, track.tilt, style);
+      startScanProbe(focusDir, true);
     }
 
     fovealStep++;
@@ -1214,6 +1261,231 @@ public:
       fovealStep = 0;  // Reset for next scan
       bodySchema.clearAttention();
     }
+    return true;
+  }
+
+  void startScanProbe(int direction, bool record) {
+    scanProbeActive = true;
+    scanProbeRecord = record;
+    scanProbeArrived = false;
+    scanProbeDirection = direction;
+  }
+
+  // Once the probe's move has arrived and a ping has gone out from the
+  // new pose, record the range for its direction
+  void updateScanProbe() {
+    if (!scanProbeActive || servoController == nullptr || servoController->isBusy()) return;
+    if (!scanProbeRecord) {
+      scanProbeActive = false;
+      return;
+    }
+    if (!scanProbeArrived) {
+      scanProbeArrived = true;
+      scanProbeArrivedMs = millis();
+      return;
+    }
+    UltrasonicReading ping;
+    if (!ultrasonic.readingFiredSince(scanProbeArrivedMs, ping)) return;   // Next ping not out yet
+    scanProbeActive = false;
+
+    if (ping.valid) spatialMemory.updateReading(scanProbeDirection, ping.cm);
+  }
+
+  // ============================================
+  // BEHAVIOR MOTION STEPS
+  // executeX() does the bookkeeping at once and hands its moves and
+  // expressions to the step machine: each step starts a move or a clip
+  // and returns; the next one runs when the servos are free and the
+  // step's hold has passed. Nothing waits inside the behavior task.
+  // ============================================
+
+  // Nothing in flight that a new sequence would cut short
+  bool servosFree() {
+    return !servoController->isBusy() && !motionSequenceActive() &&
+           (animator == nullptr || !animator->isCurrentlyAnimating());
+  }
+
+  bool motionSequenceActive() const {
+    return behaviorStepsActive || scanProbeActive || scanner.isScanning();
+  }
+
+  void beginBehaviorSteps(const ServoAngles& first) {
+    stepBehavior = currentBehavior;
+    stepAngles = first;
+    behaviorStep = 0;
+    stepHoldMs = 0;
+    stepHoldUntil = millis();
+    behaviorStepsActive = true;
+    illusionPending = false;
+    servoController->setSequenceActive(true);   // Before the next AI command pass
+  }
+
+  // Drop the steps left; investigate/social release the attention target
+  // their last step would have cleared
+  void endBehaviorSteps() {
+    if (behaviorStepsActive && (stepBehavior == INVESTIGATE || stepBehavior == SOCIAL_ENGAGE)) {
+      bodySchema.clearAttention();
+    }
+    behaviorStepsActive = false;
+    illusionPending = false;
+  }
+
+  void cancelMotionSequences() {
+    endBehaviorSteps();
+    scanProbeActive = false;
+    scanner.cancelScan();
+    if (servoController != nullptr) servoController->setSequenceActive(false);
+  }
+
+  void updateBehaviorSteps() {
+    if (!behaviorStepsActive || servoController == nullptr) return;
+    if (servoController->isBusy()) return;
+    if (animator != nullptr && animator->isCurrentlyAnimating()) return;
+
+    // Arrived: start the step's hold, then wait it out
+    unsigned long now = millis();
+    if (stepHoldMs > 0) {
+      stepHoldUntil = now + stepHoldMs;
+      stepHoldMs = 0;
+    }
+    if ((long)(now - stepHoldUntil) < 0) return;
+
+    if (runBehaviorStep(behaviorStep++)) return;
+
+    behaviorStepsActive = false;
+    if (illusionPending) {
+      illusionPending = false;
+      applyIllusion();
+    }
+  }
+
+  // Start step n of the running behavior; false once there are no more
+  bool runBehaviorStep(uint8_t n) {
+    MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
+
+    switch (stepBehavior) {
+      case EXPLORE:
+        if (n == 0) {
+          servoController->startMove(stepAngles.base, stepAngles.nod, stepAngles.tilt, style);
+        } else if (n == 1) {
+          if (expressiveness.canExpress() && random(100) < 35) {
+            expressiveness.expressCuriosity(*servoController, emotion, personality, needs);
+          }
+        } else if (n == 2) {
+          // One additional nearby exploration point
+          ServoAngles nearby = bodySchema.exploreRandomly(25.0, 70.0);
+          servoController->startMove(nearby.base, nearby.nod, nearby.tilt, style);
+        } else {
+          return false;
+        }
+        return true;
+
+      case INVESTIGATE:
+        if (n == 0) {
+          if (expressiveness.canExpress() && random(100) < 50) {
+            if (personality.getCuriosity() > 0.5 && random(100) < 40) {
+              expressiveness.curiousInspection(*servoController, stepAngles.base, stepAngles.nod,
+                                                emotion, personality, needs);
+            } else if (personality.getCuriosity() > 0.5) {
+              expressiveness.expressCuriosity(*servoController, emotion, personality, needs);
+            } else {
+              expressiveness.expressContemplation(*servoController, emotion, personality, needs);
+            }
+          }
+        } else if (n == 1) {
+          ServoAngles track = bodySchema.trackAttention(0.3);
+          servoController->startMove(track.base, track.nod, track.tilt, style);
+        } else if (n == 2) {
+          if (random(100) < 25) {
+            expressiveness.applyNaturalCorrection(*servoController);
+          }
+        } else {
+          bodySchema.clearAttention();
+          return false;
+        }
+        return true;
+
+      case SOCIAL_ENGAGE:
+        if (n == 0) {
+          servoController->startMove(stepAngles.base, stepAngles.nod, stepAngles.tilt, style);
+        } else if (n == 1) {
+          if (expressiveness.canExpress()) {
+            EmotionLabel currentEmotion = emotion.getLabel();
+
+            if (spatialMemory.likelyHumanPresent() && random(100) < 70) {
+              expressiveness.expressEmotion(currentEmotion, *servoController,
+                                          emotion, personality, needs);
+            } else if (random(100) < 40) {
+              expressiveness.expressAgreement(*servoController, emotion, personality, needs);
+            } else if (personality.getCuriosity() > 0.6) {
+              expressiveness.expressCuriosity(*servoController, emotion, personality, needs);
+            } else {
+              expressiveness.expressContemplation(*servoController, emotion, personality, needs);
+            }
+          }
+        } else if (n == 2) {
+          ServoAngles track = bodySchema.trackAttention(0.2);
+          servoController->startMove(track.base, track.nod, track.tilt, style);
+        } else if (n == 3) {
+          if (random(100) < 30) {
+            expressiveness.applyNaturalCorrection(*servoController);
+          }
+        } else {
+          bodySchema.clearAttention();
+          return false;
+        }
+        return true;
+
+      case PLAY:
+        if (animator != nullptr) {
+          if (n == 0) {
+            animator->playfulBounce(emotion, personality, needs);
+          } else if (n == 1) {
+            if (expressiveness.canExpress()) {
+              if (emotion.getArousal() > 0.6) {
+                expressiveness.expressExcitement(*servoController, emotion, personality, needs);
+              } else {
+                expressiveness.expressPlayfulness(*servoController, emotion, personality, needs);
+              }
+              stepHoldMs = 250;
+            }
+          } else {
+            return false;
+          }
+        } else {
+          // No animator: three quick random moves
+          if (n >= 3) return false;
+          ServoAngles play = bodySchema.exploreRandomly(20.0, 60.0);
+          style.speed *= 1.2;
+          servoController->startMove(play.base, play.nod, play.tilt, style);
+          stepHoldMs = 200;
+        }
+        return true;
+
+      case VIGILANT: {
+        // Per hot spot: look (hold 400), then for the first one maybe an
+        // expression (hold 200)
+        int i = n / 2;
+        if (i >= vigilantCount) return false;
+        if (n % 2 == 0) {
+          float dist = spatialMemory.getAverageDistance(vigilantSpots[i]);
+          ServoAngles angles = bodySchema.lookAtDirection(vigilantSpots[i], dist);
+          servoController->startMove(angles.base, angles.nod, angles.tilt, style);
+          stepHoldMs = 400;
+        } else if (i == 0 && expressiveness.canExpress() && random(100) < 40) {
+          if (personality.getCaution() > 0.6 || emotion.isNegative()) {
+            expressiveness.expressCaution(*servoController, emotion, personality, needs);
+          } else {
+            expressiveness.expressUncertainty(*servoController, emotion, personality, needs);
+          }
+          stepHoldMs = 200;
+        }
+        return true;
+      }
+
+      default:
+        return false;
+    }
   }
   
   // ============================================
@@ -1225,27 +1497,26 @@ public:
     // CRITICAL FIX: Don't disable reflex if actively tracking a face
     // ═══════════════════════════════════════════════════════════════════
     if (reflexController != nullptr) {
-      // Debug: Log behavior execution and reflex state
-      Serial.print("[BEHAVIOR] Executing: ");
-      Serial.print(behaviorToString(currentBehavior));
-      Serial.print(" | Reflex: ");
-      Serial.print(reflexController->isActive() ? "ACTIVE" : "inactive");
-      Serial.print(" | Face tracking: ");
-      Serial.print(isTrackingFace ? "YES" : "no");
+      bool reflexWasActive = reflexController->isActive();
+      int reflexAction;   // 0 = disabled, 1 = left on (social), 2 = protected
 
       // Only manage reflex if NOT currently tracking
-      if (!isTrackingFace && !reflexController->isActive()) {
+      if (!isTrackingFace && !reflexWasActive) {
         // Safe to disable for non-social behaviors
         if (currentBehavior != SOCIAL_ENGAGE && currentBehavior != INVESTIGATE) {
-          Serial.println(" → Disabling reflex");
           reflexController->disable();
+          reflexAction = 0;
         } else {
-          Serial.println(" → Enabling reflex (social behavior)");
+          reflexAction = 1;
         }
       } else {
         // Reflex is actively tracking - leave it alone!
-        Serial.println(" → Reflex protected (tracking active)");
+        reflexAction = 2;
       }
+
+      // Debug: Log behavior execution and reflex state
+      TELEMETRY(TEL_BEHAVIOR_EXEC, (int32_t)currentBehavior, reflexWasActive ? 1 : 0,
+                isTrackingFace ? 1 : 0, reflexAction);
     }
 
     // Recall similar past experiences
@@ -1258,6 +1529,9 @@ public:
       }
     }
 
+    // A new behavior replaces whatever the last one had left to do
+    endBehaviorSteps();
+
     switch(currentBehavior) {
       case IDLE:
         executeIdle();
@@ -1285,7 +1559,12 @@ public:
         break;
     }
     
-    applyIllusion();  // UPDATED VERSION
+    // Illusion gestures follow the behavior's own motion steps
+    if (behaviorStepsActive) {
+      illusionPending = true;
+    } else {
+      applyIllusion();
+    }
     
     float outcome = calculateBehaviorOutcome();
     recordBehaviorOutcome(currentBehavior, outcome);
@@ -1327,7 +1606,7 @@ public:
           breathNod = constrain(breathNod, 80, 150);
           style.speed = 0.15;  // Very slow
           style.smoothness = 0.8;
-          servoController->smoothMoveTo(curBase, breathNod, curTilt, style);
+          servoController->startMove(curBase, breathNod, curTilt, style);
           idlePhase = 1;
           lastIdleAction = now;
         }
@@ -1344,7 +1623,7 @@ public:
           glanceNod = constrain(glanceNod, 80, 150);
           style.speed = 0.2;
           style.smoothness = 0.7;
-          servoController->smoothMoveTo(glanceBase, glanceNod, curTilt, style);
+          servoController->startMove(glanceBase, glanceNod, curTilt, style);
           idlePhase = 2;
           lastIdleAction = now;
         }
@@ -1355,7 +1634,7 @@ public:
           ServoAngles neutral = bodySchema.lookAt(0, 50, 20);
           style.speed = 0.15;
           style.smoothness = 0.8;
-          servoController->smoothMoveTo(neutral.base, neutral.nod, neutral.tilt, style);
+          servoController->startMove(neutral.base, neutral.nod, neutral.tilt, style);
           idlePhase = 0;
           lastIdleAction = now;
         }
@@ -1373,36 +1652,10 @@ public:
       // ═══════════════════════════════════════════════════════════════
       // VERIFICATION: Log that servo command is being sent
       // ═══════════════════════════════════════════════════════════════
-      static unsigned long lastExploreLog = 0;
-      if (millis() - lastExploreLog > 5000) {
-        Serial.print("[EXPLORE] Commanding servos: Base=");
-        Serial.print(target.base);
-        Serial.print("° Nod=");
-        Serial.print(target.nod);
-        Serial.print("° Tilt=");
-        Serial.println(target.tilt);
-        lastExploreLog = millis();
-      }
-
-      MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
-      servoController->smoothMoveTo(target.base, target.nod, target.tilt, style);
-      // ═══════════════════════════════════════════════════════════════
-      // PERFORMANCE: Removed delay(300) - was blocking processor!
-      // Behavior called repeatedly by main loop, no need to wait
-      // ═══════════════════════════════════════════════════════════════
+      TELEMETRY(TEL_EXPLORE_MOVE, target.base, target.nod, target.tilt);
 
-      if (expressiveness.canExpress() && random(100) < 35) {
-        expressiveness.expressCuriosity(*servoController, emotion, personality, needs);
-        // REMOVED: delay(200) - non-blocking design
-      }
-
-      // ═══════════════════════════════════════════════════════════════
-      // PERFORMANCE: Simplified - removed loop with delays
-      // Command one additional nearby exploration point per call
-      // ═══════════════════════════════════════════════════════════════
-      ServoAngles nearby = bodySchema.exploreRandomly(25.0, 70.0);
-      servoController->smoothMoveTo(nearby.base, nearby.nod, nearby.tilt, style);
-      // REMOVED: delay(200) in loop - non-blocking design
+      // Steps: target, maybe a curiosity expression, one nearby point
+      beginBehaviorSteps(target);
     }
     
     needs.satisfyStimulation(0.15);
@@ -1422,8 +1675,8 @@ public:
       investigationDescriptionReceived = false;
 
       static unsigned long lastInvestigateLog = 0;
-      if (now - lastInvestigateLog > 3000) {
-        Serial.println("[BEHAVIOR] INVESTIGATE: Examining point of interest (holding)");
+      if (LOG_ENABLED(BEHAVIOR, DEBUG) && now - lastInvestigateLog > 3000) {
+        LOG_PRINTLN(BEHAVIOR, DEBUG, "[BEHAVIOR] INVESTIGATE: Examining point of interest (holding)");
         lastInvestigateLog = now;
       }
     }
@@ -1449,7 +1702,7 @@ public:
       if (!reflexIsHandlingMovement && servoController != nullptr) {
         MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
         style.speed = 0.2;  // Slow, deliberate
-        servoController->smoothMoveTo(angles.base, angles.nod, angles.tilt, style);
+        servoController->startMove(angles.base, angles.nod, angles.tilt, style);
       }
       needs.consumeEnergy(0.01);
       return;
@@ -1459,11 +1712,11 @@ public:
     if (!investigationDescriptionReceived && elapsed < INVESTIGATION_TIMEOUT_MS) {
       // Subtle "examining" motion — tiny shifts to show active observation
       if (!reflexIsHandlingMovement && servoController != nullptr) {
-        float tinyNod = sin((float)elapsed / 1000.0f * 0.5f) * 2.0f;
+        float tinyNod = lutSinPeriod(elapsed, 12566) * 2.0f;   // 4π s
         int examNod = constrain(angles.nod + (int)tinyNod, 80, 150);
         MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
         style.speed = 0.1;
-        servoController->smoothMoveTo(angles.base, examNod, angles.tilt, style);
+        servoController->startMove(angles.base, examNod, angles.tilt, style);
       }
       needs.consumeEnergy(0.01);
       return;
@@ -1472,30 +1725,15 @@ public:
     // Phase 3: Investigation complete (description received or timeout)
     isInvestigating = false;
 
-    // Full investigation behavior (expression etc.) if not reflex-controlled
+    // Full investigation behavior (expression etc.) if not reflex-controlled.
+    // Steps: maybe an expression, track the target, maybe a correction;
+    // the last step clears the attention target
     if (!reflexIsHandlingMovement && animator != nullptr && servoController != nullptr) {
-      MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
-
-      if (expressiveness.canExpress() && random(100) < 50) {
-        if (personality.getCuriosity() > 0.5 && random(100) < 40) {
-          expressiveness.curiousInspection(*servoController, angles.base, angles.nod,
-                                            emotion, personality, needs);
-        } else if (personality.getCuriosity() > 0.5) {
-          expressiveness.expressCuriosity(*servoController, emotion, personality, needs);
-        } else {
-          expressiveness.expressContemplation(*servoController, emotion, personality, needs);
-        }
-      }
-
-      ServoAngles track = bodySchema.trackAttention(0.3);
-      servoController->smoothMoveTo(track.base, track.nod, track.tilt, style);
-
-      if (random(100) < 25) {
-        expressiveness.applyNaturalCorrection(*servoController);
-      }
+      beginBehaviorSteps(angles);
+    } else {
+      bodySchema.clearAttention();
     }
 
-    bodySchema.clearAttention();
     needs.satisfyNovelty(0.2);
     needs.satisfyStimulation(0.15);  // Boosted: understanding = rewarding
     needs.consumeEnergy(0.03);
@@ -1506,8 +1744,8 @@ public:
     // VERIFICATION: Confirm behavior is executing
     // ═══════════════════════════════════════════════════════════
     static unsigned long lastSocialLog = 0;
-    if (millis() - lastSocialLog > 3000) {  // Log every 3 seconds max
-      Serial.println("[BEHAVIOR] SOCIAL_ENGAGE: Interacting with human");
+    if (LOG_ENABLED(BEHAVIOR, DEBUG) && millis() - lastSocialLog > 3000) {  // Log every 3 seconds max
+      LOG_PRINTLN(BEHAVIOR, DEBUG, "[BEHAVIOR] SOCIAL_ENGAGE: Interacting with human");
       lastSocialLog = millis();
     }
 
@@ -1526,47 +1764,15 @@ public:
     bool reflexIsHandlingMovement = (reflexController != nullptr &&
                                      reflexController->isActive());
 
+    // Only move servos if reflex is NOT active. Steps: look, express,
+    // track the target, maybe a correction; the last clears the target
     if (!reflexIsHandlingMovement && animator != nullptr && servoController != nullptr) {
-      // Only move servos if reflex is NOT active
-      MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
-
-      servoController->smoothMoveTo(angles.base, angles.nod, angles.tilt, style);
-      // REMOVED: delay(500) - non-blocking design
-
-      if (expressiveness.canExpress()) {
-        EmotionLabel currentEmotion = emotion.getLabel();
-
-        if (spatialMemory.likelyHumanPresent() && random(100) < 70) {
-          expressiveness.expressEmotion(currentEmotion, *servoController,
-                                      emotion, personality, needs);
-        } else if (random(100) < 40) {
-          expressiveness.expressAgreement(*servoController, emotion, personality, needs);
-        } else {
-          if (personality.getCuriosity() > 0.6) {
-            expressiveness.expressCuriosity(*servoController, emotion, personality, needs);
-          } else {
-            expressiveness.expressContemplation(*servoController, emotion, personality, needs);
-          }
-        }
-
-        // REMOVED: delay(300) - non-blocking design
-      }
-
-      // ═══════════════════════════════════════════════════════════════
-      // PERFORMANCE: Simplified - removed loop with delays
-      // Command one attention tracking update per call
-      // ═══════════════════════════════════════════════════════════════
-      ServoAngles track = bodySchema.trackAttention(0.2);
-      servoController->smoothMoveTo(track.base, track.nod, track.tilt, style);
-      // REMOVED: delay(400) in loop - non-blocking design
-
-      if (random(100) < 30) {
-        expressiveness.applyNaturalCorrection(*servoController);
-      }
+      beginBehaviorSteps(angles);
+    } else {
+      // Reflex is active - let it handle ALL servo movements
+      bodySchema.clearAttention();
     }
-    // else: Reflex is active - let it handle ALL servo movements
 
-    bodySchema.clearAttention();
     needs.satisfySocial(0.2);
     needs.consumeEnergy(0.02);
   }
@@ -1577,7 +1783,7 @@ public:
     } else if (servoController != nullptr) {
       ServoAngles retreat = bodySchema.lookAt(0, 30, 15);
       MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
-      servoController->smoothMoveTo(retreat.base, retreat.nod, retreat.tilt, style);
+      servoController->startMove(retreat.base, retreat.nod, retreat.tilt, style);
     }
 
     // REMOVED: delay(800) - non-blocking design
@@ -1590,7 +1796,7 @@ public:
     if (animator != nullptr && servoController != nullptr) {
       MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
       style.speed *= 0.6;
-      servoController->smoothMoveTo(rest.base, rest.nod, rest.tilt, style);
+      servoController->startMove(rest.base, rest.nod, rest.tilt, style);
     }
 
     needs.consumeEnergy(-0.1);
@@ -1601,32 +1807,15 @@ public:
     // VERIFICATION: Confirm behavior is executing
     // ═══════════════════════════════════════════════════════════
     static unsigned long lastPlayLog = 0;
-    if (millis() - lastPlayLog > 3000) {  // Log every 3 seconds max
-      Serial.println("[BEHAVIOR] PLAY: Playful bouncing and movement");
+    if (LOG_ENABLED(BEHAVIOR, DEBUG) && millis() - lastPlayLog > 3000) {  // Log every 3 seconds max
+      LOG_PRINTLN(BEHAVIOR, DEBUG, "[BEHAVIOR] PLAY: Playful bouncing and movement");
       lastPlayLog = millis();
     }
 
-    if (animator != nullptr) {
-      animator->playfulBounce(emotion, personality, needs);
-      
-      if (expressiveness.canExpress() && servoController != nullptr) {
-        if (emotion.getArousal() > 0.6) {
-          expressiveness.expressExcitement(*servoController, emotion, personality, needs);
-        } else {
-          expressiveness.expressPlayfulness(*servoController, emotion, personality, needs);
-        }
-        delay(250);
-      }
-    } else {
-      for (int i = 0; i < 3; i++) {
-        ServoAngles play = bodySchema.exploreRandomly(20.0, 60.0);
-        if (servoController != nullptr) {
-          MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
-          style.speed *= 1.2;
-          servoController->smoothMoveTo(play.base, play.nod, play.tilt, style);
-          delay(200);
-        }
-      }
+    // Steps: bounce, then an excitement/playfulness expression (without
+    // an animator: three quick random moves)
+    if (servoController != nullptr) {
+      beginBehaviorSteps(ServoAngles());
     }
     
     needs.consumeEnergy(0.06);
@@ -1634,27 +1823,11 @@ public:
   
   void executeVigilant() {
     
-    int hotSpots[2];
-    int hotCount = attention.countHighSalienceDirections(hotSpots, 0.5);
+    vigilantCount = attention.countHighSalienceDirections(vigilantSpots, 0.5);
     
-    if (hotCount > 0 && servoController != nullptr) {
-      MovementStyleParams style = movementGenerator.generate(emotion, personality, needs);
-      
-      for (int i = 0; i < hotCount; i++) {
-        float dist = spatialMemory.getAverageDistance(hotSpots[i]);
-        ServoAngles angles = bodySchema.lookAtDirection(hotSpots[i], dist);
-        servoController->smoothMoveTo(angles.base, angles.nod, angles.tilt, style);
-        delay(400);
-        
-        if (i == 0 && expressiveness.canExpress() && random(100) < 40) {
-          if (personality.getCaution() > 0.6 || emotion.isNegative()) {
-            expressiveness.expressCaution(*servoController, emotion, personality, needs);
-          } else {
-            expressiveness.expressUncertainty(*servoController, emotion, personality, needs);
-          }
-          delay(200);
-        }
-      }
+    // Steps: look at each hot spot in turn, maybe an expression at the first
+    if (vigilantCount > 0 && servoController != nullptr) {
+      beginBehaviorSteps(ServoAngles());
     }
     
     needs.consumeEnergy(0.03);
@@ -1759,100 +1932,100 @@ public:
   }
   
   void printFullDiagnostics() {
-    Serial.println("\n╔═══════════════════════════════════════╗");
-    Serial.println("║    CONSCIOUSNESS SYSTEM DIAGNOSTICS    ║");
-    Serial.println("╚═══════════════════════════════════════╝");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n╔═══════════════════════════════════════╗");
+    LOG_PRINTLN(BEHAVIOR, INFO, "║    CONSCIOUSNESS SYSTEM DIAGNOSTICS    ║");
+    LOG_PRINTLN(BEHAVIOR, INFO, "╚═══════════════════════════════════════╝");
     
     unsigned long sessionTime = (millis() - sessionStartTime) / 1000;
-    Serial.print("Session uptime: ");
-    Serial.print(sessionTime);
-    Serial.println(" seconds");
+    LOG_PRINT(BEHAVIOR, INFO, "Session uptime: ");
+    LOG_PRINT(BEHAVIOR, INFO, sessionTime);
+    LOG_PRINTLN(BEHAVIOR, INFO, " seconds");
     
-    Serial.println("\n=== BODY SCHEMA ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== BODY SCHEMA ===");
     bodySchema.print();
     
-    Serial.println("\n=== ATTENTION ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== ATTENTION ===");
     attention.print();
     
-    Serial.println("\n=== EPISODIC MEMORY ===");  // NEW
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== EPISODIC MEMORY ===");  // NEW
     episodicMemory.print();
     
-    Serial.println("\n=== GOAL FORMATION ===");   // NEW
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== GOAL FORMATION ===");   // NEW
     goalSystem.print();
     
-    Serial.println("\n=== NEEDS ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== NEEDS ===");
     needs.print();
     
-    Serial.println("\n=== PERSONALITY ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== PERSONALITY ===");
     personality.print();
     
-    Serial.println("\n=== EMOTION ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== EMOTION ===");
     emotion.print();
     
-    Serial.println("\n=== SPATIAL MEMORY ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== SPATIAL MEMORY ===");
     spatialMemory.print();
     
-    Serial.println("\n=== CURRENT BEHAVIOR ===");
-    Serial.print("Active: ");
-    Serial.println(behaviorToString(currentBehavior));
-    Serial.print("Consecutive count: ");
-    Serial.println(behaviorSelector.getConsecutiveCount(currentBehavior));
-    Serial.print("Uncertainty: ");
-    Serial.println(behaviorUncertainty, 2);
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== CURRENT BEHAVIOR ===");
+    LOG_PRINT(BEHAVIOR, INFO, "Active: ");
+    LOG_PRINTLN(BEHAVIOR, INFO, behaviorToString(currentBehavior));
+    LOG_PRINT(BEHAVIOR, INFO, "Consecutive count: ");
+    LOG_PRINTLN(BEHAVIOR, INFO, behaviorSelector.getConsecutiveCount(currentBehavior));
+    LOG_PRINT(BEHAVIOR, INFO, "Uncertainty: ");
+    LOG_PRINTLN(BEHAVIOR, INFO, behaviorUncertainty, 2);
     
-    Serial.println("\n=== BEHAVIOR STATISTICS ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== BEHAVIOR STATISTICS ===");
     behaviorSelector.printWeights();
 
     // PACKAGE 4: Behavioral variety diagnostics
-    Serial.println("\n=== BEHAVIORAL VARIETY ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== BEHAVIORAL VARIETY ===");
     for (int i = 0; i < 8; i++) {
       Behavior b = (Behavior)i;
       int count = behaviorSelector.getExecutionCount(b);
       unsigned long timeSince = behaviorSelector.getTimeSinceExecution(b);
 
       if (count > 0) {
-        Serial.print("  ");
-        Serial.print(behaviorToString(b));
-        Serial.print(": ");
-        Serial.print(count);
-        Serial.print(" times, last ");
-        Serial.print(timeSince / 1000);
-        Serial.println("s ago");
+        LOG_PRINT(BEHAVIOR, INFO, "  ");
+        LOG_PRINT(BEHAVIOR, INFO, behaviorToString(b));
+        LOG_PRINT(BEHAVIOR, INFO, ": ");
+        LOG_PRINT(BEHAVIOR, INFO, count);
+        LOG_PRINT(BEHAVIOR, INFO, " times, last ");
+        LOG_PRINT(BEHAVIOR, INFO, timeSince / 1000);
+        LOG_PRINTLN(BEHAVIOR, INFO, "s ago");
       }
     }
 
     // NEW: Person tracking diagnostics
-    Serial.println("\n=== KNOWN PEOPLE ===");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n=== KNOWN PEOPLE ===");
     int peopleCount = 0;
     for (int i = 0; i < MAX_PEOPLE; i++) {
       if (people[i].isValid) {
         peopleCount++;
-        Serial.print("  ID ");
-        Serial.print(people[i].id);
-        Serial.print(": ");
-        Serial.print(familiarityName(people[i].familiarity));
-        Serial.print(" (");
-        Serial.print(people[i].interactionCount);
-        Serial.print(" encounters, ");
-        Serial.print(people[i].totalTimeSpent / 1000);
-        Serial.println("s total)");
+        LOG_PRINT(BEHAVIOR, INFO, "  ID ");
+        LOG_PRINT(BEHAVIOR, INFO, people[i].id);
+        LOG_PRINT(BEHAVIOR, INFO, ": ");
+        LOG_PRINT(BEHAVIOR, INFO, familiarityName(people[i].familiarity));
+        LOG_PRINT(BEHAVIOR, INFO, " (");
+        LOG_PRINT(BEHAVIOR, INFO, people[i].interactionCount);
+        LOG_PRINT(BEHAVIOR, INFO, " encounters, ");
+        LOG_PRINT(BEHAVIOR, INFO, people[i].totalTimeSpent / 1000);
+        LOG_PRINTLN(BEHAVIOR, INFO, "s total)");
       }
     }
     if (peopleCount == 0) {
-      Serial.println("  No people registered yet");
+      LOG_PRINTLN(BEHAVIOR, INFO, "  No people registered yet");
     }
 
     if (animator != nullptr) {
-      Serial.println("\n=== ANIMATION STATUS ===");
-      Serial.print("Currently animating: ");
-      Serial.println(animator->isCurrentlyAnimating() ? "YES" : "NO");
-      Serial.print("Current pose: ");
+      LOG_PRINTLN(BEHAVIOR, INFO, "\n=== ANIMATION STATUS ===");
+      LOG_PRINT(BEHAVIOR, INFO, "Currently animating: ");
+      LOG_PRINTLN(BEHAVIOR, INFO, animator->isCurrentlyAnimating() ? "YES" : "NO");
+      LOG_PRINT(BEHAVIOR, INFO, "Current pose: ");
       animator->getCurrentPose().print();
     }
 
     consciousness.printDiagnostics();
 
-    Serial.println("\n═══════════════════════════════════════\n");
+    LOG_PRINTLN(BEHAVIOR, INFO, "\n═══════════════════════════════════════\n");
   }
 
   // Getter for consciousness layer (used by AIBridge)
@@ -8,6 +8,7 @@
 #include "Personality.h"
 #include "Emotion.h"
 #include "SpatialMemory.h"
+#include "Log.h"
 
 // Forward declaration for memory integration
 class EpisodicMemory;
@@ -87,12 +88,12 @@ public:
       stuckCounter++;
       
       if (stuckCounter > 2) {
-        Serial.println("[STUCK DETECTION] System is stuck in loop!");
-        Serial.print("  Behavior: ");
-        Serial.print(behaviorToString(lastBehavior));
-        Serial.print(" for ");
-        Serial.print(timeSinceChange / 1000);
-        Serial.println(" seconds");
+        LOG_PRINTLN(SELECTION, WARN, "[STUCK DETECTION] System is stuck in loop!");
+        LOG_PRINT(SELECTION, WARN, "  Behavior: ");
+        LOG_PRINT(SELECTION, WARN, behaviorToString(lastBehavior));
+        LOG_PRINT(SELECTION, WARN, " for ");
+        LOG_PRINT(SELECTION, WARN, timeSinceChange / 1000);
+        LOG_PRINTLN(SELECTION, WARN, " seconds");
         return true;
       }
     } else {
@@ -145,17 +146,15 @@ public:
         behaviorNoveltyBonus[idx] = noveltyBonus;
         scores[i].finalScore += noveltyBonus;
 
-        #if DEBUG_LEARNING
-        if (noveltyBonus > 0.05) {
-          Serial.print("  [VARIETY] ");
-          Serial.print(behaviorToString(b));
-          Serial.print(" +");
-          Serial.print(noveltyBonus, 2);
-          Serial.print(" (");
-          Serial.print(minutesSince, 1);
-          Serial.println(" min since used)");
+        if (LOG_ENABLED(SELECTION, DEBUG) && noveltyBonus > 0.05) {
+          LOG_PRINT(SELECTION, DEBUG, "  [VARIETY] ");
+          LOG_PRINT(SELECTION, DEBUG, behaviorToString(b));
+          LOG_PRINT(SELECTION, DEBUG, " +");
+          LOG_PRINT(SELECTION, DEBUG, noveltyBonus, 2);
+          LOG_PRINT(SELECTION, DEBUG, " (");
+          LOG_PRINT(SELECTION, DEBUG, minutesSince, 1);
+          LOG_PRINTLN(SELECTION, DEBUG, " min since used)");
         }
-        #endif
       }
     }
 
@@ -174,10 +173,10 @@ public:
       score.finalScore *= penalty;
       
       if (consecutive > 3) {
-        Serial.print("[REPETITION] ");
-        Serial.print(behaviorToString(score.type));
-        Serial.print(" penalty: ");
-        Serial.println(penalty, 2);
+        LOG_PRINT(SELECTION, DEBUG, "[REPETITION] ");
+        LOG_PRINT(SELECTION, DEBUG, behaviorToString(score.type));
+        LOG_PRINT(SELECTION, DEBUG, " penalty: ");
+        LOG_PRINTLN(SELECTION, DEBUG, penalty, 2);
       }
     }
   }
@@ -271,7 +270,7 @@ public:
     int retreatCount = consecutiveExecutions[RETREAT];
     if (retreatCount > 2) {
       score.urgency *= 0.5;  // Urgency drops after multiple retreats
-      Serial.println("[RETREAT] Diminishing urgency due to repetition");
+      LOG_PRINTLN(SELECTION, DEBUG, "[RETREAT] Diminishing urgency due to repetition");
     }
     
     score.expectedPayoff = 0.4;
@@ -292,7 +291,7 @@ public:
     // BOOST rest if stuck in negative loop
     if (consecutiveExecutions[RETREAT] > 3 || consecutiveExecutions[VIGILANT] > 3) {
       score.urgency += 0.4;
-      Serial.println("[REST] Boosted to break defensive loop");
+      LOG_PRINTLN(SELECTION, DEBUG, "[REST] Boosted to break defensive loop");
     }
     
     score.expectedPayoff = 0.5;
@@ -378,15 +377,15 @@ public:
         float originalScore = scores[i].finalScore;
         scores[i].finalScore *= memoryWeight;
         
-        Serial.print("[MEMORY] ");
-        Serial.print(behaviorToString(b));
-        Serial.print(": ");
-        Serial.print(originalScore, 2);
-        Serial.print(" → ");
-        Serial.print(scores[i].finalScore, 2);
-        Serial.print(" (avg outcome: ");
-        Serial.print(avgOutcome, 2);
-        Serial.println(")");
+        LOG_PRINT(SELECTION, DEBUG, "[MEMORY] ");
+        LOG_PRINT(SELECTION, DEBUG, behaviorToString(b));
+        LOG_PRINT(SELECTION, DEBUG, ": ");
+        LOG_PRINT(SELECTION, DEBUG, originalScore, 2);
+        LOG_PRINT(SELECTION, DEBUG, " → ");
+        LOG_PRINT(SELECTION, DEBUG, scores[i].finalScore, 2);
+        LOG_PRINT(SELECTION, DEBUG, " (avg outcome: ");
+        LOG_PRINT(SELECTION, DEBUG, avgOutcome, 2);
+        LOG_PRINTLN(SELECTION, DEBUG, ")");
       }
     }
     
@@ -498,7 +497,7 @@ public:
 
       float secondScore = scores[secondBest].finalScore;
       if (secondScore > currentScore + SWITCH_THRESHOLD) {
-        Serial.println("  [RANDOM] Selecting 2nd-best for variety");
+        LOG_PRINTLN(SELECTION, DEBUG, "  [RANDOM] Selecting 2nd-best for variety");
         behaviorDwellStart = now;
         updateBehaviorTracking(scores[secondBest].type);
         return scores[secondBest].type;
@@ -534,7 +533,7 @@ public:
   // ============================================
   
   Behavior forceAlternativeBehavior(BehaviorScore scores[], int numBehaviors) {
-    Serial.println("[FORCE] Breaking stuck loop with alternative behavior");
+    LOG_PRINTLN(SELECTION, WARN, "[FORCE] Breaking stuck loop with alternative behavior");
     
     // Find behavior that hasn't been used recently
     int bestAlternative = -1;
@@ -600,22 +599,22 @@ public:
   // ============================================
   
   void printWeights() {
-    Serial.println("--- BEHAVIOR WEIGHTS ---");
+    LOG_PRINTLN(SELECTION, INFO, "--- BEHAVIOR WEIGHTS ---");
     const char* names[] = {"IDLE", "EXPLORE", "INVESTIGATE", "SOCIAL", 
                            "RETREAT", "REST", "PLAY", "VIGILANT"};
     
     for (int i = 0; i < 8; i++) {
-      Serial.print("  ");
-      Serial.print(names[i]);
-      Serial.print(": ");
-      Serial.print(behaviorWeights[i], 2);
-      Serial.print(" (success: ");
-      Serial.print(successHistory[i], 2);
-      Serial.print(", count: ");
-      Serial.print(executionCounts[i]);
-      Serial.print(", consecutive: ");
-      Serial.print(consecutiveExecutions[i]);
-      Serial.println(")");
+      LOG_PRINT(SELECTION, INFO, "  ");
+      LOG_PRINT(SELECTION, INFO, names[i]);
+      LOG_PRINT(SELECTION, INFO, ": ");
+      LOG_PRINT(SELECTION, INFO, behaviorWeights[i], 2);
+      LOG_PRINT(SELECTION, INFO, " (success: ");
+      LOG_PRINT(SELECTION, INFO, successHistory[i], 2);
+      LOG_PRINT(SELECTION, INFO, ", count: ");
+      LOG_PRINT(SELECTION, INFO, executionCounts[i]);
+      LOG_PRINT(SELECTION, INFO, ", consecutive: ");
+      LOG_PRINT(SELECTION, INFO, consecutiveExecutions[i]);
+      LOG_PRINTLN(SELECTION, INFO, ")");
     }
   }
   
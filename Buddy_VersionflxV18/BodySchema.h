@@ -6,6 +6,8 @@
 #define BODY_SCHEMA_H
 
 #include <Arduino.h>
+#include "Log.h"
+#include "JointTrajectory.h"
 
 // Physical robot dimensions (adjust to match your actual robot)
 struct RobotGeometry {
@@ -42,16 +44,25 @@ struct SpatialPoint {
   }
   
   void print() {
-    Serial.print("(");
-    Serial.print(x, 1);
-    Serial.print(", ");
-    Serial.print(y, 1);
-    Serial.print(", ");
-    Serial.print(z, 1);
-    Serial.print(")");
+    LOG_PRINT(BODY, INFO, "(");
+    LOG_PRINT(BODY, INFO, x, 1);
+    LOG_PRINT(BODY, INFO, ", ");
+    LOG_PRINT(BODY, INFO, y, 1);
+    LOG_PRINT(BODY, INFO, ", ");
+    LOG_PRINT(BODY, INFO, z, 1);
+    LOG_PRINT(BODY, INFO, ")");
   }
 };
 
+// Joint limits: mechanical range plus the speed and acceleration a move
+// may ask for (JointTrajectory.h). Base, nod, tilt — MotionAxis order.
+// The nod joint carries the arm, so it gets the gentlest limits
+constexpr JointLimits BODY_JOINT_LIMITS[3] = {
+  { 10.0f, 170.0f, 360.0f, 4000.0f },   // Base
+  { 80.0f, 150.0f, 300.0f, 3000.0f },   // Nod
+  { 20.0f, 150.0f, 360.0f, 4000.0f },   // Tilt
+};
+
 // Servo angles
 struct ServoAngles {
   int base;   // 10-170°
@@ -62,19 +73,19 @@ struct ServoAngles {
   ServoAngles(int b, int n, int t) : base(b), nod(n), tilt(t) {}
   
   void clamp() {
-    base = constrain(base, 10, 170);
-    nod = constrain(nod, 80, 150);
-    tilt = constrain(tilt, 20, 150);
+    base = constrain(base, (int)BODY_JOINT_LIMITS[0].minDeg, (int)BODY_JOINT_LIMITS[0].maxDeg);
+    nod = constrain(nod, (int)BODY_JOINT_LIMITS[1].minDeg, (int)BODY_JOINT_LIMITS[1].maxDeg);
+    tilt = constrain(tilt, (int)BODY_JOINT_LIMITS[2].minDeg, (int)BODY_JOINT_LIMITS[2].maxDeg);
   }
   
   void print() {
-    Serial.print("Base:");
-    Serial.print(base);
-    Serial.print("° Nod:");
-    Serial.print(nod);
-    Serial.print("° Tilt:");
-    Serial.print(tilt);
-    Serial.print("°");
+    LOG_PRINT(BODY, INFO, "Base:");
+    LOG_PRINT(BODY, INFO, base);
+    LOG_PRINT(BODY, INFO, "° Nod:");
+    LOG_PRINT(BODY, INFO, nod);
+    LOG_PRINT(BODY, INFO, "° Tilt:");
+    LOG_PRINT(BODY, INFO, tilt);
+    LOG_PRINT(BODY, INFO, "°");
   }
 };
 
@@ -235,11 +246,11 @@ public:
     attentionStrength = strength;
     lastAttentionShift = millis();
     
-    Serial.print("[ATTENTION] New target: ");
+    LOG_PRINT(BODY, DEBUG, "[ATTENTION] New target: ");
     target.print();
-    Serial.print(" (strength: ");
-    Serial.print(strength, 2);
-    Serial.println(")");
+    LOG_PRINT(BODY, DEBUG, " (strength: ");
+    LOG_PRINT(BODY, DEBUG, strength, 2);
+    LOG_PRINTLN(BODY, DEBUG, ")");
   }
   
   void setAttentionDirection(int direction, float distance, float strength = 1.0) {
@@ -322,11 +333,11 @@ public:
     float y = distance * cos(angle);
     float z = height;
     
-    Serial.print("[EXPLORE] Random target: ");
-    Serial.print(distance, 0);
-    Serial.print("cm at ");
-    Serial.print(angle * RAD_TO_DEG, 0);
-    Serial.println("°");
+    LOG_PRINT(BODY, DEBUG, "[EXPLORE] Random target: ");
+    LOG_PRINT(BODY, DEBUG, distance, 0);
+    LOG_PRINT(BODY, DEBUG, "cm at ");
+    LOG_PRINT(BODY, DEBUG, angle * RAD_TO_DEG, 0);
+    LOG_PRINTLN(BODY, DEBUG, "°");
     
     return lookAt(x, y, z);
   }
@@ -378,54 +389,54 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- BODY SCHEMA ---");
+    LOG_PRINTLN(BODY, INFO, "--- BODY SCHEMA ---");
     
-    Serial.print("  Current angles: ");
+    LOG_PRINT(BODY, INFO, "  Current angles: ");
     currentAngles.print();
-    Serial.println();
+    LOG_PRINTLN(BODY, INFO);
     
     SpatialPoint lookPoint = getCurrentLookPoint();
-    Serial.print("  Looking at: ");
+    LOG_PRINT(BODY, INFO, "  Looking at: ");
     lookPoint.print();
-    Serial.println();
+    LOG_PRINTLN(BODY, INFO);
     
-    Serial.print("  Distance: ");
-    Serial.print(lookPoint.distance(), 1);
-    Serial.println(" cm");
+    LOG_PRINT(BODY, INFO, "  Distance: ");
+    LOG_PRINT(BODY, INFO, lookPoint.distance(), 1);
+    LOG_PRINTLN(BODY, INFO, " cm");
     
     if (attentionStrength > 0.1) {
-      Serial.print("  Attention target: ");
+      LOG_PRINT(BODY, INFO, "  Attention target: ");
       attentionTarget.print();
-      Serial.print(" (strength: ");
-      Serial.print(attentionStrength, 2);
-      Serial.println(")");
+      LOG_PRINT(BODY, INFO, " (strength: ");
+      LOG_PRINT(BODY, INFO, attentionStrength, 2);
+      LOG_PRINTLN(BODY, INFO, ")");
     }
     
-    Serial.print("  Target reachable: ");
-    Serial.println(isReachable ? "YES" : "NO");
+    LOG_PRINT(BODY, INFO, "  Target reachable: ");
+    LOG_PRINTLN(BODY, INFO, isReachable ? "YES" : "NO");
   }
   
   void printCompact() {
-    Serial.print("  [BODY] Looking ");
+    LOG_PRINT(BODY, INFO, "  [BODY] Looking ");
     getCurrentLookPoint().print();
-    Serial.print(" @ ");
-    Serial.print(getCurrentLookPoint().distance(), 0);
-    Serial.print("cm");
+    LOG_PRINT(BODY, INFO, " @ ");
+    LOG_PRINT(BODY, INFO, getCurrentLookPoint().distance(), 0);
+    LOG_PRINT(BODY, INFO, "cm");
     
     if (attentionStrength > 0.3) {
-      Serial.print(" | ATT:");
-      Serial.print(attentionStrength, 1);
+      LOG_PRINT(BODY, INFO, " | ATT:");
+      LOG_PRINT(BODY, INFO, attentionStrength, 1);
     }
-    Serial.println();
+    LOG_PRINTLN(BODY, INFO);
   }
   
   void testKinematics() {
-    Serial.println("\n╔═══════════════════════════════════╗");
-    Serial.println("║  BODY SCHEMA KINEMATICS TEST      ║");
-    Serial.println("╚═══════════════════════════════════╝\n");
+    LOG_PRINTLN(BODY, INFO, "\n╔═══════════════════════════════════╗");
+    LOG_PRINTLN(BODY, INFO, "║  BODY SCHEMA KINEMATICS TEST      ║");
+    LOG_PRINTLN(BODY, INFO, "╚═══════════════════════════════════╝\n");
     
     // Test forward kinematics
-    Serial.println("=== FORWARD KINEMATICS TEST ===");
+    LOG_PRINTLN(BODY, INFO, "=== FORWARD KINEMATICS TEST ===");
     ServoAngles testAngles[] = {
       ServoAngles(90, 110, 85),   // Center
       ServoAngles(45, 110, 85),   // Left
@@ -437,17 +448,17 @@ public:
     const char* labels[] = {"Center", "Left", "Right", "Down", "Up"};
     
     for (int i = 0; i < 5; i++) {
-      Serial.print(labels[i]);
-      Serial.print(": ");
+      LOG_PRINT(BODY, INFO, labels[i]);
+      LOG_PRINT(BODY, INFO, ": ");
       testAngles[i].print();
-      Serial.print(" → ");
+      LOG_PRINT(BODY, INFO, " → ");
       SpatialPoint p = forwardKinematics(testAngles[i]);
       p.print();
-      Serial.println();
+      LOG_PRINTLN(BODY, INFO);
     }
     
     // Test inverse kinematics
-    Serial.println("\n=== INVERSE KINEMATICS TEST ===");
+    LOG_PRINTLN(BODY, INFO, "\n=== INVERSE KINEMATICS TEST ===");
     SpatialPoint testPoints[] = {
       SpatialPoint(0, 50, 20),     // Forward
       SpatialPoint(-30, 40, 18),   // Front-left
@@ -459,29 +470,29 @@ public:
     const char* pointLabels[] = {"Forward", "Front-Left", "Front-Right", "Close-Low", "Far-High"};
     
     for (int i = 0; i < 5; i++) {
-      Serial.print(pointLabels[i]);
-      Serial.print(": ");
+      LOG_PRINT(BODY, INFO, pointLabels[i]);
+      LOG_PRINT(BODY, INFO, ": ");
       testPoints[i].print();
-      Serial.print(" → ");
+      LOG_PRINT(BODY, INFO, " → ");
       
       bool reachable;
       ServoAngles angles = inverseKinematics(testPoints[i], reachable);
       angles.print();
-      Serial.print(reachable ? " ✓" : " ⚠");
-      Serial.println();
+      LOG_PRINT(BODY, INFO, reachable ? " ✓" : " ⚠");
+      LOG_PRINTLN(BODY, INFO);
     }
     
     // Test round-trip accuracy
-    Serial.println("\n=== ROUND-TRIP ACCURACY TEST ===");
+    LOG_PRINTLN(BODY, INFO, "\n=== ROUND-TRIP ACCURACY TEST ===");
     for (int i = 0; i < 3; i++) {
-      Serial.print("Target: ");
+      LOG_PRINT(BODY, INFO, "Target: ");
       testPoints[i].print();
       
       bool reachable;
       ServoAngles angles = inverseKinematics(testPoints[i], reachable);
       SpatialPoint result = forwardKinematics(angles);
       
-      Serial.print(" → Result: ");
+      LOG_PRINT(BODY, INFO, " → Result: ");
       result.print();
       
       float error = sqrt(
@@ -490,12 +501,12 @@ public:
         pow(testPoints[i].z - result.z, 2)
       );
       
-      Serial.print(" | Error: ");
-      Serial.print(error, 2);
-      Serial.println(" cm");
+      LOG_PRINT(BODY, INFO, " | Error: ");
+      LOG_PRINT(BODY, INFO, error, 2);
+      LOG_PRINTLN(BODY, INFO, " cm");
     }
     
-    Serial.println("\n✓ Kinematics test complete\n");
+    LOG_PRINTLN(BODY, INFO, "\n✓ Kinematics test complete\n");
   }
 };
 
@@ -44,6 +44,13 @@
 #include "BehaviorEngine.h"
 #include "ReflexiveControl.h"  // NEW: Reflexive tracking layer
 #include "AIBridge.h"          // AI serial command integration
+#include "SerialLineLexer.h"   // Non-blocking ESP32 UART line lexer
+#include "TaskScheduler.h"     // Periodic task table driving loop()
+#include "UltrasonicRanger.h"  // Interrupt-driven ultrasonic ranging
+#include "RangeFilter.h"       // Median + alpha-beta range pipeline
+#include "Telemetry.h"         // Binary event ring drained over USB
+#include "AIEvents.h"          // Edge events pushed to the PC as EVT: lines
+#include "ToneSequencer.h"     // Non-blocking buzzer phrases
 
 // ============================================
 // VISION DATA STRUCTURES (PACKAGE 3)
@@ -84,6 +91,11 @@ FaceData currentFace;
 unsigned long esp32LastMessage = 0;
 unsigned long esp32MessageCount = 0;
 unsigned long esp32ParseErrors = 0;
+unsigned long esp32BudgetYields = 0;   // parseVisionData() stopped with lines still queued
+const unsigned long VISION_PARSE_BUDGET_US = 1000;  // Per-loop dispatch budget
+
+SerialLineLexer esp32Lexer;
+TimedLineRing esp32Lines;
 const unsigned long ESP32_TIMEOUT = 5000;  // 5 seconds without messages = warning
 
 // ════════════════════════════════════════════════════════════════
@@ -133,6 +145,7 @@ Servo nodServo;
 Servo tiltServo;
 
 ServoController servoController;
+ClipPlayer clipPlayer;              // Keyframe clips (ClipLibrary.h), stepped by motionTask
 AnimationController animator(servoController);
 BehaviorEngine behaviorEngine;
 ReflexiveControl reflexController;  // NEW: Reflexive tracking layer
@@ -162,10 +175,28 @@ struct headPos {
 // CPU can handle this easily: 9µs loop time << 20ms interval
 // CPU usage: 9µs/20ms = 0.045% = plenty of headroom
 // ═══════════════════════════════════════════════════════════════
-unsigned long lastUpdate = 0;
-unsigned long lastDiagnostics = 0;
+// All periodic work is registered in registerTasks() below; these are
+// the periods it uses.
 const unsigned long UPDATE_INTERVAL = 20;       // 20ms = 50Hz (5x smoother!)
 const unsigned long DIAGNOSTICS_INTERVAL = 300000; // 5 minutes
+const unsigned long SAVE_INTERVAL = 1800000;       // 30 minutes (EEPROM wear)
+const unsigned long PROFILE_INTERVAL = 2000;       // Performance profile records
+const unsigned long TELEMETRY_DRAIN_INTERVAL = 20; // Ring → USB
+
+TaskScheduler scheduler;
+void registerTasks();            // Task table, defined after the task functions
+void motionWaitHook();           // Runs urgent tasks while smoothMoveTo() waits
+UltrasonicRanger ultrasonic;     // Pings in the background from setup() on
+RangeFilter rangeFilter;         // Filtered range fed to the behavior engine
+Telemetry telemetry;             // TELEMETRY() records, drained by telemetryOutTask
+AIEventQueue aiEvents;           // AI_EVENT() edges, flushed as EVT: lines by aiEventTask
+ToneSequencer toneSequencer(buzzerPin);  // droidSpeak.h phrases, stepped by soundTask
+
+// Ping schedule: full rate normally, slower while reflex tracking (the
+// behavior fast path only needs a rough range then)
+unsigned long rangePingMs = ULTRA_PING_INTERVAL_MS;          // Normal
+unsigned long rangePingTrackingMs = 4 * ULTRA_PING_INTERVAL_MS;  // Reflex active
+const unsigned long RANGE_DIAG_INTERVAL = 10000;   // Min ms between sensor warnings
 
 // ═══════════════════════════════════════════════════════════════
 // FRESH DATA TRACKING: Critical for preventing stale data movement
@@ -263,56 +294,99 @@ void handleFaceDetection() {
 }
 
 // ============================================
-// VISION DATA PARSER (PACKAGE 3) - Buffer-draining version
-// Reads ALL buffered messages and only processes the latest
+// ESP32 RX PUMP
+// Lexes Serial1 into the timestamped line ring. Runs from yield() via
+// serialEvent1() (between loop passes and inside every delay()), so lines
+// are stamped close to their arrival. When the ring is full the bytes stay
+// in the Serial1 buffer — nothing is dropped here.
+// ============================================
+void pumpEsp32Serial() {
+  while (!esp32Lines.full()) {
+    LineKind kind = esp32Lexer.poll(ESP32_SERIAL);
+    if (kind == LINE_NONE) break;
+    esp32Lines.push(esp32Lexer, kind);
+  }
+}
+
+void serialEvent1() {
+  // The boot handshake reads Serial1 itself (and calls delay()) until linked
+  if (esp32Linked) pumpEsp32Serial();
+}
+
+// ============================================
+// VISION DATA PARSER (PACKAGE 3) - Non-blocking lexer version
+// Dispatches queued lines until the ring is empty or the time budget
+// runs out; only the latest FACE/NO_FACE is processed.
+// Partial lines stay in esp32Lexer until the rest arrives.
 // ============================================
 void parseVisionData() {
-  if (!ESP32_SERIAL.available()) return;
+  pumpEsp32Serial();
+  if (esp32Lines.empty()) return;
 
-  static char buffer[256];  // Increased from 128 for VISION payloads (Phase 2)
-  static char latestFace[128];
+  static char latestFace[SERIAL_LINE_MAX];
+  unsigned long latestFaceUs = 0;
   bool gotFace = false;
   bool gotNoFace = false;
+  unsigned long parseStart = micros();
 
-  // Drain buffer — read all available, keep latest
-  while (ESP32_SERIAL.available()) {
-    int len = ESP32_SERIAL.readBytesUntil('\n', buffer, sizeof(buffer) - 1);
-    if (len == 0) continue;
-    buffer[len] = '\0';
+  const TimedLine* queued;
+  while ((queued = esp32Lines.peek()) != nullptr) {
+    const char* line = queued->text;
 
     esp32LastMessage = millis();
     esp32MessageCount++;
 
-    if (strncmp(buffer, "FACE:", 5) == 0) {
-      memcpy(latestFace, buffer, len + 1);
-      gotFace = true;
-      gotNoFace = false;  // FACE after NO_FACE overrides
-    }
-    else if (strncmp(buffer, "NO_FACE", 7) == 0) {
-      gotNoFace = true;
-      gotFace = false;  // NO_FACE after FACE overrides
-    }
-    // ── Phase 2: Vision feedback from PC (fire-and-forget, no response) ──
-    else if (strncmp(buffer, "!VISION:", 8) == 0) {
-      aiBridge.cmdVision(buffer + 8);
-    }
-    // ── Phase 1A: AI Bridge commands arriving via ESP32 WiFi↔UART bridge ──
-    else if (buffer[0] == '!') {
-      // Commands from PC via WiFi→ESP32→UART arrive with ! prefix
-      // Route responses back to ESP32_SERIAL so they reach the PC
-      aiBridge.handleCommand(buffer + 1, &ESP32_SERIAL);
-    }
-    else if (strncmp(buffer, "ESP32_READY", 11) == 0) {
-      // ESP32 reboot detection — re-handshake
-      esp32Linked = true;
-      Serial1.println("TEENSY_READY");
-      delay(10);
-      Serial1.println("TEENSY_READY");
-      Serial.println("[LINK] ESP32 rebooted — re-linked");
+    switch (queued->kind) {
+      case LINE_FACE:
+        memcpy(latestFace, line, queued->len + 1);
+        latestFaceUs = queued->arrivalUs;
+        gotFace = true;
+        gotNoFace = false;  // FACE after NO_FACE overrides
+        break;
+
+      case LINE_NO_FACE:
+        gotNoFace = true;
+        gotFace = false;  // NO_FACE after FACE overrides
+        break;
+
+      // ── Phase 2: Vision feedback from PC (fire-and-forget, no response) ──
+      // Queued latest-wins: only the newest observation is applied
+      case LINE_VISION:
+        aiBridge.submitCommand(line + 1, &ESP32_SERIAL);
+        break;
+
+      // ── Phase 1A: AI Bridge commands arriving via ESP32 WiFi↔UART bridge ──
+      case LINE_COMMAND:
+        // Commands from PC via WiFi→ESP32→UART arrive with ! prefix
+        // Route responses back to ESP32_SERIAL so they reach the PC.
+        // Queued by class; visionTask() runs them once the ring is drained
+        aiBridge.submitCommand(line + 1, &ESP32_SERIAL);
+        break;
+
+      case LINE_ESP32_READY:
+        // ESP32 reboot detection — re-handshake
+        esp32Linked = true;
+        Serial1.println("TEENSY_READY");
+        delay(10);
+        Serial1.println("TEENSY_READY");
+        Serial.println("[LINK] ESP32 rebooted — re-linked");
+        break;
+
+      case LINE_READY:
+        Serial.println("[VISION] ESP32-S3 connected");
+        break;
+
+      default:
+        break;
     }
-    else if (strncmp(buffer, "READY", 5) == 0) {
-      Serial.println("[VISION] ESP32-S3 connected");
+    esp32Lines.release();
+
+    // Leave the rest for the next loop — commands can run long
+    if (micros() - parseStart > VISION_PARSE_BUDGET_US) {
+      if (!esp32Lines.empty() || ESP32_SERIAL.available()) esp32BudgetYields++;
+      break;
     }
+    pumpEsp32Serial();
   }
 
   // Process final state
@@ -357,7 +431,7 @@ void parseVisionData() {
   currentFace.detected = true;
   currentFace.lastSeen = millis();
 
-  reflexController.updateFaceData(x, y, w, currentFace.distance);
+  reflexController.updateFaceData(x, y, w, currentFace.distance, latestFaceUs);
   reflexController.updateConfidence(conf);
 
   freshFaceDataReceived = true;
@@ -368,35 +442,26 @@ void parseVisionData() {
 
 // ============================================
 // ULTRASONIC SENSOR FUNCTION
+// Non-blocking: returns the latest ping from the interrupt-driven
+// ranger (at most ~one ping interval old). No echo / no ping yet comes
+// back with valid == false — callers skip it rather than store a range.
+// The pins are fixed in ultrasonic.begin().
 // ============================================
-int checkUltra(int theEchoPin, int theTrigPin) {
-  long duration, distance;
-  
-  digitalWrite(theTrigPin, LOW);
-  delayMicroseconds(2);
-  
-  digitalWrite(theTrigPin, HIGH);
-  delayMicroseconds(10);
-  
-  digitalWrite(theTrigPin, LOW);
-  duration = pulseIn(theEchoPin, HIGH, 30000);
-  
-  distance = duration / 58.2;
-  
-  if (distance == 0 || distance > 400) {
-    distance = 400;
-  }
-  
-  return distance;
+UltrasonicReading checkUltra(int theEchoPin, int theTrigPin) {
+  (void)theEchoPin;
+  (void)theTrigPin;
+
+  return ultrasonic.latest();
 }
 
 // ============================================
 // LEGACY MOVETO FUNCTION (for compatibility)
+// Starts the move and returns; the motion task carries it out
 // ============================================
 void moveTo(struct headPos faceMotion) {
   MovementStyleParams style = behaviorEngine.getMovementStyle();
   
-  servoController.smoothMoveTo(
+  servoController.startMove(
     faceMotion.baseServoAngle,
     faceMotion.nodServoAngle,
     faceMotion.tiltServoAngle,
@@ -419,11 +484,12 @@ void setup() {
   
   // NEW: Initialize ESP32-S3 communication
   Serial.println("[ESP32] Initializing vision communication...");
-  // Increase Serial1 RX buffer from default 64 bytes to 512.
+  // Increase Serial1 RX buffer from default 64 bytes to 4 KB.
   // At 921600 baud, 64 bytes fills in <0.7ms. During the 30ms
   // ultrasonic pulseIn() block, incoming face data would overflow.
-  // (CRITICAL-2 from hardware audit)
-  static uint8_t serial1RxBuf[512];
+  // (CRITICAL-2 from hardware audit) 4 KB covers ~44ms of a saturated
+  // link, plus the lexed lines waiting in esp32Lines.
+  static uint8_t serial1RxBuf[4096];
   ESP32_SERIAL.addMemoryForRead(serial1RxBuf, sizeof(serial1RxBuf));
   ESP32_SERIAL.begin(ESP32_BAUD);
 
@@ -469,8 +535,7 @@ void setup() {
   // Checkpoint 1
   Serial.println("[1/8] Configuring pins...");
   Serial.flush();
-  pinMode(trigPin, OUTPUT);
-  pinMode(echoPin, INPUT);
+  ultrasonic.begin(trigPin, echoPin);  // Starts background pinging
   pinMode(buzzerPin, OUTPUT);
   Serial.println("  ✓ Pins configured");
   delay(100);
@@ -501,6 +566,7 @@ void setup() {
   Serial.println("[4/8] Initializing servo controller...");
   Serial.flush();
   servoController.initialize(90, 105, 90);
+  servoController.setWaitHook(motionWaitHook);
   Serial.println("  ✓ Servo controller ready");
   delay(100);
   
@@ -547,10 +613,16 @@ void setup() {
   Serial.flush();
 
   Serial.println("[BOOT] Handshake complete — UART link active");
+
+  TELEMETRY(TEL_BOOT);
+  registerTasks();
+  scheduler.start();
 }
 
 // ============================================
 // STARTUP ANIMATION (SPATIAL)
+// Runs from setup() before the scheduler starts, so the blocking
+// smoothMoveTo() / delay() sequence holds up nothing
 // ============================================
 void startupAnimation() {
   BodySchema& bodySchema = behaviorEngine.getBodySchema();
@@ -596,364 +668,346 @@ void startupAnimation() {
 }
 
 // ============================================
-// MAIN LOOP
+// SCHEDULED TASKS
+// ============================================
+// Everything loop() used to gate with millis() comparisons runs from
+// the task table in registerTasks(). Priorities decide who goes first
+// when several are due; low-priority work yields when it would delay
+// the vision → reflex path (see TaskScheduler.h).
 // ============================================
-void loop() {
-  unsigned long now = millis();
 
-  // Update at fixed interval (50Hz) - MATCHES TEENSY EXACTLY
-  if (now - lastUpdate >= UPDATE_INTERVAL) {
-    // ═══════════════════════════════════════════════════════════════
-    // CRITICAL: Update timestamp FIRST (matches Teensy architecture)
-    // This prevents timing drift from variable work duration
-    // ═══════════════════════════════════════════════════════════════
-    lastUpdate = now;  // ← UPDATE FIRST, like Teensy!
+// Vision intake (CRITICAL) — lines were already lexed and timestamped
+// by serialEvent1(); this dispatches them, then runs the AI commands
+// they queued (AICommandQueue.h)
+void visionTask() {
+  parseVisionData();
+  aiBridge.serviceCommands();
+}
 
-    // ═══════════════════════════════════════════════════════════════
-    // Parse ESP32 data at 50Hz (inside timing check)
-    // This matches Teensy's effective rate and prevents runaway
-    // ═══════════════════════════════════════════════════════════════
-    parseVisionData();
+// Servo motion (HIGH) — step the playing clip to its next keyframe when
+// one is due, then advance the trajectory started by startMove() or
+// smoothMoveTo(); the engine works out the due step from the clock.
+// updateMotion() composes the pose layers and is the one servo write
+void motionTask() {
+  clipPlayer.update();
+  servoController.updateMotion();
+}
 
+// smoothMoveTo() waits here between steps: vision intake, reflex and
+// the motion task itself keep running (the task that waits is skipped)
+void motionWaitHook() {
+  scheduler.runUrgent();
+}
+
+// Reflex tracking (HIGH) — servo output from fresh face data
+void reflexTask() {
+  unsigned long now = millis();
+
+  // ========================================================================
+  // CRITICAL FIX: ONLY move servos on FRESH face data
+  // ========================================================================
+  // ESP32 sends updates at ~8-10Hz (100-120ms)
+  // Reflex runs at 50Hz (20ms)
+  // Must NOT respond to same face position multiple times!
+  //
+  // Problem: Without this check, reflex calculates 5-6 times per ESP32 update,
+  //          building up momentum and overshooting before realizing face moved
+  // Solution: Only calculate/move when we have NEW data
+  // ========================================================================
+
+  if (reflexController.isActive() && currentFace.detected && freshFaceDataReceived) {
     // ═══════════════════════════════════════════════════════════════
-    // PERFORMANCE PROFILING: Measure each section
+    // FRESH DATA CONFIRMED - safe to calculate and move
     // ═══════════════════════════════════════════════════════════════
-    unsigned long loopStart = micros();
-
-    // Measure behavior system or tracking mode
-    unsigned long behaviorStart = micros();
-    unsigned long behaviorTime = 0;
-    unsigned long ultrasonicTime = 0;
 
-    // Check if in face tracking only mode
-    if (faceTrackingMode) {
-      // TRACKING MODE: Only perform face tracking, skip behavior system
+    // Clear the flag immediately to prevent re-processing same data
+    freshFaceDataReceived = false;
+
+    // Get current servo positions
+    int currentBase = servoController.getBasePos();
+    int currentNod = servoController.getNodPos();
+
+    // Calculate reflex adjustments using ReflexiveControl layer
+    // Float targets: the servo output stage resolves ~0.1°
+    float targetBase, targetNod;
+    if (reflexController.calculate(currentBase, currentNod, targetBase, targetNod)) {
+      // ════════════════════════════════════════════════════════════
+      // ENHANCED FIX: Clamp to limits with smart disable
+      // ════════════════════════════════════════════════════════════
+      bool wasLimited = false;
+      float originalBase = targetBase;
+      float originalNod = targetNod;
+
+      // Clamp to safe ranges (soft limits)
+      targetBase = constrain(targetBase, 10.0f, 170.0f);
+      targetNod = constrain(targetNod, 80.0f, 150.0f);
+
+      // Track if we had to clamp
+      if (targetBase != originalBase || targetNod != originalNod) {
+        wasLimited = true;
+        TELEMETRY(TEL_REFLEX_LIMIT, (int32_t)originalBase, (int32_t)targetBase,
+                  (int32_t)originalNod, (int32_t)targetNod);
+      }
 
-      // NEW: Check reflex timeout (disables reflex if no face data)
-      reflexController.checkTimeout();
+      // ALWAYS send command (clamped if necessary) - maintains tracking at limits
+      servoController.directWrite(targetBase, targetNod, false);
+
+      // ════════════════════════════════════════════════════════════
+      // SMART DISABLE: Only disable if stuck at limit for extended period
+      // ════════════════════════════════════════════════════════════
+      static int limitCounter = 0;
+      static unsigned long firstLimitTime = 0;
+      static int lastLimitedBase = 0;
+      static int lastLimitedNod = 0;
+
+      if (wasLimited) {
+        // First time hitting limit, or hit different limit
+        if (limitCounter == 0 || (fabs(targetBase - lastLimitedBase) > 5 || fabs(targetNod - lastLimitedNod) > 5)) {
+          firstLimitTime = now;
+          limitCounter = 1;
+          lastLimitedBase = (int)targetBase;
+          lastLimitedNod = (int)targetNod;
+        } else {
+          // Same limit position - increment counter
+          limitCounter++;
+        }
 
-    } else {
-      // NORMAL MODE: Full behavior system
-
-      // ═══════════════════════════════════════════════════════════════
-      // OPTIMIZATION: Skip ultrasonic during active reflex tracking
-      // ═══════════════════════════════════════════════════════════════
-      static float lastDistance = 100.0;
-      float distance = lastDistance;  // Use cached value by default
-
-      if (!reflexController.isActive()) {
-        // Only read ultrasonic when NOT tracking (MAJOR PERFORMANCE GAIN)
-        unsigned long ultraStart = micros();
-        distance = checkUltra(echoPin, trigPin);
-        ultrasonicTime = micros() - ultraStart;
-        lastDistance = distance;  // Cache for next iteration
+        // Check if stuck at limit for 3+ seconds AND not making progress
+        // (150 updates at 20ms = 3 seconds)
+        if (limitCounter > 150 && (now - firstLimitTime > 3000)) {
+          TELEMETRY(TEL_REFLEX_STUCK, (int32_t)targetBase, (int32_t)targetNod);
+          reflexController.disable();
+          limitCounter = 0;
+          firstLimitTime = 0;
+        }
       } else {
-        // Use cached distance while tracking (saves 30-60ms per loop!)
-        ultrasonicTime = 0;
+        // Not at limit - reset counter (target has moved away from limits)
+        if (limitCounter > 0) {
+          limitCounter = 0;
+          firstLimitTime = 0;
+        }
       }
+    }
+  }
 
-      // Get current servo positions
-      int baseAngle = servoController.getBasePos();
-      int nodAngle = servoController.getNodPos();
+  // Check if face data is stale (timeout after 2 seconds)
+  if (currentFace.detected && (now - currentFace.lastSeen > 2000)) {
+    currentFace.detected = false;
+  }
 
-      // Skip behavior engine during AI looping animations to prevent
-      // smoothMoveTo blocking the loop and fighting with directWrite
-      if (!aiBridge.isAIAnimating()) {
-        // Update behavior engine (this drives everything)
-        behaviorEngine.update(distance, baseAngle, nodAngle);
-      }
-      behaviorTime = micros() - behaviorStart;
+  // ═══════════════════════════════════════════════════════════════
+  // REFLEX ON-OFF SWITCH VERIFICATION: Track mode transitions
+  // ═══════════════════════════════════════════════════════════════
+  static bool lastReflexState = false;
+  bool currentReflexState = reflexController.isActive();
 
-      // NEW: Check reflex timeout (disables reflex if no face data)
-      reflexController.checkTimeout();
-    }
+  // Log state changes (active=1: behavior system blocked, reflex owns servos)
+  if (currentReflexState != lastReflexState) {
+    TELEMETRY(TEL_REFLEX_MODE, currentReflexState ? 1 : 0,
+              behaviorEngine.getIsTrackingFace() ? 1 : 0, (int32_t)behaviorEngine.getCurrentBehavior());
+  }
+  lastReflexState = currentReflexState;
+}
 
-    // ========================================================================
-    // CRITICAL FIX: ONLY move servos on FRESH face data
-    // ========================================================================
-    // ESP32 sends updates at ~8-10Hz (100-120ms)
-    // Reflex runs at 50Hz (20ms)
-    // Must NOT respond to same face position multiple times!
-    //
-    // Problem: Without this check, reflex calculates 5-6 times per ESP32 update,
-    //          building up momentum and overshooting before realizing face moved
-    // Solution: Only calculate/move when we have NEW data
-    // ========================================================================
-
-    // Measure reflex calculation
-    unsigned long reflexStart = micros();
-    unsigned long reflexTime = 0;
-
-    if (reflexController.isActive() && currentFace.detected && freshFaceDataReceived) {
-      // ═══════════════════════════════════════════════════════════════
-      // FRESH DATA CONFIRMED - safe to calculate and move
-      // ═══════════════════════════════════════════════════════════════
-
-      // Clear the flag immediately to prevent re-processing same data
-      freshFaceDataReceived = false;
-
-      // Get current servo positions
-      int currentBase = servoController.getBasePos();
-      int currentNod = servoController.getNodPos();
-
-      // Calculate reflex adjustments using ReflexiveControl layer
-      int targetBase, targetNod;
-      if (reflexController.calculate(currentBase, currentNod, targetBase, targetNod)) {
-        reflexTime = micros() - reflexStart;
-        // ════════════════════════════════════════════════════════════
-        // ENHANCED FIX: Clamp to limits with smart disable
-        // ════════════════════════════════════════════════════════════
-        bool wasLimited = false;
-        int originalBase = targetBase;
-        int originalNod = targetNod;
-
-        // Clamp to safe ranges (soft limits)
-        targetBase = constrain(targetBase, 10, 170);
-        targetNod = constrain(targetNod, 80, 150);
-
-        // Track if we had to clamp
-        if (targetBase != originalBase || targetNod != originalNod) {
-          wasLimited = true;
-          static unsigned long lastLimitWarning = 0;
-          // Throttle warning messages to every 2 seconds
-          if (now - lastLimitWarning > 2000) {
-            Serial.print("[LIMIT] Clamped: Base ");
-            Serial.print(originalBase);
-            Serial.print("° → ");
-            Serial.print(targetBase);
-            Serial.print("°, Nod ");
-            Serial.print(originalNod);
-            Serial.print("° → ");
-            Serial.print(targetNod);
-            Serial.println("°");
-            lastLimitWarning = now;
-          }
-        }
+// Reflex timeout (HIGH, 500ms) — disables reflex if face data stops
+void reflexTimeoutTask() {
+  reflexController.checkTimeout();
+}
 
-        // ALWAYS send command (clamped if necessary) - maintains tracking at limits
-        servoController.directWrite(targetBase, targetNod, false);
-
-        // ════════════════════════════════════════════════════════════
-        // SMART DISABLE: Only disable if stuck at limit for extended period
-        // ════════════════════════════════════════════════════════════
-        static int limitCounter = 0;
-        static unsigned long firstLimitTime = 0;
-        static int lastLimitedBase = 0;
-        static int lastLimitedNod = 0;
-
-        if (wasLimited) {
-          // First time hitting limit, or hit different limit
-          if (limitCounter == 0 || (abs(targetBase - lastLimitedBase) > 5 || abs(targetNod - lastLimitedNod) > 5)) {
-            firstLimitTime = now;
-            limitCounter = 1;
-            lastLimitedBase = targetBase;
-            lastLimitedNod = targetNod;
-          } else {
-            // Same limit position - increment counter
-            limitCounter++;
-          }
+// Range pipeline (NORMAL) — feeds new pings through the filter, applies
+// the ping schedule and reports sensor trouble at most every 10s
+void rangeTask() {
+  rangeFilter.update(ultrasonic.latest());
 
-          // Check if stuck at limit for 3+ seconds AND not making progress
-          // (150 updates at 20ms = 3 seconds)
-          if (limitCounter > 150 && (now - firstLimitTime > 3000)) {
-            Serial.println("[LIMIT] Stuck at servo limit for 3s - disabling reflex");
-            Serial.print("  Final position: Base=");
-            Serial.print(targetBase);
-            Serial.print("° Nod=");
-            Serial.print(targetNod);
-            Serial.println("°");
-            reflexController.disable();
-            limitCounter = 0;
-            firstLimitTime = 0;
-          }
-        } else {
-          // Not at limit - reset counter (target has moved away from limits)
-          if (limitCounter > 0) {
-            limitCounter = 0;
-            firstLimitTime = 0;
-          }
-        }
-      }
-    }
+  ultrasonic.setPingInterval(reflexController.isActive() ? rangePingTrackingMs : rangePingMs);
 
-    // Check if face data is stale (timeout after 2 seconds)
-    if (currentFace.detected && (now - currentFace.lastSeen > 2000)) {
-      currentFace.detected = false;
-    }
+  static unsigned long lastDiag = 0;
+  static unsigned long lastMisses = 0;
+  static unsigned long lastRejected = 0;
+  unsigned long now = millis();
+  if (now - lastDiag < RANGE_DIAG_INTERVAL) return;
 
-    // ═══════════════════════════════════════════════════════════════
-    // PERFORMANCE REPORTING: Print timing summary every 2 seconds
-    // ═══════════════════════════════════════════════════════════════
-    unsigned long loopTime = micros() - loopStart;
-
-    static unsigned long lastTimingPrint = 0;
-    static unsigned long maxLoopTime = 0;
-    static unsigned long minLoopTime = 999999;
-    static unsigned long sumLoopTime = 0;
-    static int loopCount = 0;
-
-    // Track min/max/average
-    if (loopTime > maxLoopTime) maxLoopTime = loopTime;
-    if (loopTime < minLoopTime) minLoopTime = loopTime;
-    sumLoopTime += loopTime;
-    loopCount++;
-
-    if (debugPrintEnabled && now - lastTimingPrint > 2000) {
-      unsigned long avgLoopTime = (loopCount > 0) ? (sumLoopTime / loopCount) : 0;
-
-      Serial.println("\n╔════════════════════════════════════════════════════╗");
-      Serial.println("║         PERFORMANCE PROFILE                        ║");
-      Serial.println("╚════════════════════════════════════════════════════╝");
-
-      Serial.print("  Total loop time: ");
-      Serial.print(loopTime);
-      Serial.print(" µs (avg: ");
-      Serial.print(avgLoopTime);
-      Serial.print(" µs, min: ");
-      Serial.print(minLoopTime);
-      Serial.print(" µs, max: ");
-      Serial.print(maxLoopTime);
-      Serial.println(" µs)");
-
-      // NOTE: Vision parse now runs every loop iteration (outside timing)
-      // This matches Teensy architecture for continuous serial parsing
-
-      if (ultrasonicTime > 0) {
-        Serial.print("  - Ultrasonic: ");
-        Serial.print(ultrasonicTime);
-        Serial.print(" µs (");
-        Serial.print((ultrasonicTime * 100) / loopTime);
-        Serial.println("%) ← BLOCKING!");
-      }
+  unsigned long newMisses = rangeFilter.misses - lastMisses;
+  unsigned long newRejected = rangeFilter.rejected - lastRejected;
+  if (newMisses > 0 || newRejected > 0) {
+    TELEMETRY(TEL_RANGE_WARN, (int32_t)newMisses, (int32_t)newRejected,
+              (int32_t)((now - lastDiag) / 1000));
+  }
+  lastDiag = now;
+  lastMisses = rangeFilter.misses;
+  lastRejected = rangeFilter.rejected;
+}
 
-      if (behaviorTime > 0) {
-        Serial.print("  - Behavior system: ");
-        Serial.print(behaviorTime);
-        Serial.print(" µs (");
-        Serial.print((behaviorTime * 100) / loopTime);
-        Serial.println("%)");
-      }
+// Behavior fast tier (NORMAL) — emotion/attention/ambient
+void behaviorTask() {
+  // Face tracking only mode: skip behavior system
+  if (faceTrackingMode) return;
 
-      if (reflexTime > 0) {
-        Serial.print("  - Reflex calc: ");
-        Serial.print(reflexTime);
-        Serial.print(" µs (");
-        Serial.print((reflexTime * 100) / loopTime);
-        Serial.println("%)");
-      }
+  // Filtered range; low confidence makes the engine hold its last value
+  RangeEstimate range = rangeFilter.estimate();
 
-      Serial.print("  Loop frequency: ");
-      if (avgLoopTime > 0) {
-        Serial.print(1000000.0 / avgLoopTime);
-      } else {
-        Serial.print("N/A");
-      }
-      Serial.println(" Hz");
+  // Get current servo positions
+  int baseAngle = servoController.getBasePos();
+  int nodAngle = servoController.getNodPos();
 
-      Serial.println("════════════════════════════════════════════════════\n");
+  // Update behavior engine (this drives everything). AI looping
+  // animations are an expression layer over its moves, so both run
+  behaviorEngine.update(range.cm, range.confidence, baseAngle, nodAngle);
+}
 
-      // ═══════════════════════════════════════════════════════════════
-      // REFLEX MODE STATUS - Verify normal behaviors execute when OFF
-      // ═══════════════════════════════════════════════════════════════
-      Serial.println("╔════════════════════════════════════════════════════╗");
-      Serial.println("║         REFLEX MODE STATUS                         ║");
-      Serial.println("╚════════════════════════════════════════════════════╝");
+// Behavior medium tier (NORMAL, 5s) — needs, selection, consciousness
+void behaviorMediumTask() {
+  if (faceTrackingMode) return;
+  behaviorEngine.updateMedium();
+}
 
-      bool reflexActive = reflexController.isActive();
-      bool faceTracking = behaviorEngine.getIsTrackingFace();
+// Behavior slow tier (LOW, 30s) — learning, goals
+void behaviorSlowTask() {
+  if (faceTrackingMode) return;
+  behaviorEngine.updateSlow();
+}
 
-      Serial.print("  Reflex active: ");
-      if (reflexActive) {
-        Serial.println("YES - tracking mode");
-        Serial.println("  → Behavior system should be BLOCKED");
-        Serial.println("  → ONLY reflex controls servos");
-      } else {
-        Serial.println("NO - normal mode");
-        Serial.println("  → Behavior system should be ACTIVE");
-        Serial.println("  → Full consciousness running");
-      }
+// Buzzer (HIGH) — start the next note of the playing phrase when it is
+// due; HIGH so phrases keep their rhythm while smoothMoveTo() waits
+void soundTask() {
+  toneSequencer.update(millis());
+}
 
-      Serial.print("\n  Face tracking: ");
-      Serial.println(faceTracking ? "YES" : "NO");
+// AI Bridge (HIGH): looping animations (THINKING/SPEAKING) step at 20Hz
+// internally; HIGH so the expression layer keeps moving during move waits
+void aiAnimationTask() {
+  aiBridge.updateLoopingAnimation();
+}
 
-      Serial.print("  Current behavior: ");
-      Serial.println(behaviorEngine.getCurrentBehavior());
+// AI Bridge: run delayed entries of an active !BATCH command list
+void aiBatchTask() {
+  aiBridge.updateBatch();
+}
 
-      if (!reflexActive) {
-        Serial.println("\n  ℹ EXPECT: Behavior should change every 5-10s");
-        Serial.println("  ℹ EXPECT: Regular servo movements visible");
-      }
+// AI Bridge: speech-urge / behavior / consciousness edges → EVT: lines,
+// every tick so the PC hears about them within ~20ms. HIGH, like ai_anim,
+// so it also runs inside runUrgent() during a motion wait; a flush is at
+// most AI_EVENT_FLUSH_MAX short lines
+void aiEventTask() {
+  aiBridge.flushEvents(ESP32_SERIAL);
+}
 
-      Serial.println("════════════════════════════════════════════════════\n");
+// AI Bridge: !STREAM state (every 500ms internally) and !SUB topics
+// (own rate per topic, up to one frame per tick)
+void aiStreamTask() {
+  aiBridge.updateStreaming();
+  aiBridge.updateSubscriptions();
+}
 
-      // Reset statistics
-      lastTimingPrint = now;
-      maxLoopTime = 0;
-      minLoopTime = 999999;
-      sumLoopTime = 0;
-      loopCount = 0;
+// Performance profile (LOW, 2s) — one record per task plus link, range
+// and reflex state; telemetryOutTask formats or frames them
+void telemetryTask() {
+  uint64_t busyUs = 0;
+  for (int i = 0; i < scheduler.taskCount(); i++) {
+    const ScheduledTask& t = scheduler.task(i);
+    busyUs += t.totalUs;
+    TELEMETRY(TEL_TASK_STATS, Telemetry::fourCC(t.name), (int32_t)t.runs,
+              t.runs > 0 ? (int32_t)(t.totalUs / t.runs) : 0, (int32_t)t.wcetUs);
+    if (t.overruns > 0 || t.deferrals > 0 || t.missed > 0) {
+      TELEMETRY(TEL_TASK_FAULTS, Telemetry::fourCC(t.name), (int32_t)t.overruns,
+                (int32_t)t.deferrals, (int32_t)t.missed);
     }
+  }
 
-    // ═══════════════════════════════════════════════════════════════
-    // REFLEX ON-OFF SWITCH VERIFICATION: Track mode transitions
-    // ═══════════════════════════════════════════════════════════════
-    static bool lastReflexState = false;
-    bool currentReflexState = reflexController.isActive();
-
-    // Log state changes
-    if (debugPrintEnabled && currentReflexState != lastReflexState) {
-      Serial.println("\n╔═══════════════════════════════════════╗");
-      if (currentReflexState) {
-        Serial.println("║  REFLEX MODE: ON (TRACKING)           ║");
-        Serial.println("║  → Behavior system BLOCKED            ║");
-        Serial.println("║  → ONLY reflex controls servos        ║");
-      } else {
-        Serial.println("║  REFLEX MODE: OFF (NORMAL)            ║");
-        Serial.println("║  → Behavior system ACTIVE             ║");
-        Serial.println("║  → Full consciousness running         ║");
-      }
-      Serial.println("╚═══════════════════════════════════════╝\n");
-    }
-    lastReflexState = currentReflexState;
+  // CPU share of the window spent inside tasks (tenths of a percent)
+  TELEMETRY(TEL_TASK_LOAD, (int32_t)(busyUs * 1000 / (PROFILE_INTERVAL * 1000)),
+            (int32_t)PROFILE_INTERVAL);
 
-    // NOTE: lastUpdate already set at START of timing block (line 520)
-    // This matches Teensy architecture and prevents drift
-  }
+  TELEMETRY(TEL_LINK_STATS, (int32_t)esp32Lexer.lines, (int32_t)esp32Lexer.overflows,
+            (int32_t)esp32Lexer.malformed, (int32_t)esp32ParseErrors);
+  TELEMETRY(TEL_LINK_QUEUE, (int32_t)esp32BudgetYields, (int32_t)esp32Lines.highWater,
+            SERIAL_LINE_SLOTS);
 
-  // Periodic diagnostics (every 5 minutes)
-  if (now - lastDiagnostics >= DIAGNOSTICS_INTERVAL) {
-    behaviorEngine.printFullDiagnostics();
-    lastDiagnostics = now;
-  }
-  
-  // Save state periodically (every 30 minutes to reduce EEPROM wear)
-  static unsigned long lastSave = 0;
-  if (now - lastSave > 1800000) {  // 30 minutes = 1800000ms
-    behaviorEngine.saveState();
-    lastSave = now;
+  UltrasonicReading ping = ultrasonic.latest();
+  TELEMETRY(TEL_ULTRA_STATS, (int32_t)ultrasonic.pings, (int32_t)ultrasonic.echoes,
+            (int32_t)ultrasonic.timeouts, (int32_t)ping.ageMs());
+
+  RangeEstimate est = rangeFilter.estimate();
+  TELEMETRY(TEL_RANGE, (int32_t)(est.cm * 10), (int32_t)(est.velocity * 10),
+            (int32_t)(est.confidence * 100), est.flags);
+
+  // REFLEX MODE STATUS - with active=0 behavior should change every 5-10s
+  TELEMETRY(TEL_REFLEX_MODE, reflexController.isActive() ? 1 : 0,
+            behaviorEngine.getIsTrackingFace() ? 1 : 0, (int32_t)behaviorEngine.getCurrentBehavior());
+
+  // Per-window statistics (WCET, overruns...) start over
+  scheduler.resetStats();
+}
+
+// Telemetry output (LOW, 20ms) — the only place records become bytes.
+// With debug output off the ring is still emptied, just not written.
+void telemetryOutTask() {
+  if (debugPrintEnabled) {
+    telemetry.drain(Serial);
+  } else {
+    TelemetryMode mode = telemetry.mode();
+    telemetry.setMode(TELEM_OFF);
+    telemetry.drain(Serial);
+    telemetry.setMode(mode);
   }
+}
 
-  // AI Bridge: Update looping animations (THINKING/SPEAKING) at 20Hz
-  aiBridge.updateLoopingAnimation();
+// Periodic diagnostics (LOW, every 5 minutes)
+void diagnosticsTask() {
+  behaviorEngine.printFullDiagnostics();
+}
 
-  // AI Bridge: Send streaming state if enabled (every 500ms)
-  aiBridge.updateStreaming();
+// Save state (LOW, every 30 minutes to reduce EEPROM wear)
+void saveStateTask() {
+  behaviorEngine.saveState();
+}
+
+// ============================================
+// TASK TABLE
+// ============================================
+// name, function, period ms, phase ms, priority, budget µs
+// (names must differ in their first four characters — telemetry packs
+// them as a _4cc)
+//
+// vision and reflex share phase 0 so fresh face data reaches the servos
+// in the same pass; behavior is offset so it runs in the gap after them.
+// Diagnostics and save start one period in, like the old timers did.
+// ============================================
+void registerTasks() {
+  scheduler.addTask("vision",    visionTask,         UPDATE_INTERVAL, 0,  TASK_CRITICAL, VISION_PARSE_BUDGET_US);
+  scheduler.addTask("reflex",    reflexTask,         UPDATE_INTERVAL, 0,  TASK_HIGH,     500);
+  scheduler.addTask("watchdog",  reflexTimeoutTask,  500,             5,  TASK_HIGH,     100);
+  scheduler.addTask("motion",    motionTask,         5,               0,  TASK_HIGH,     200);
+  scheduler.addTask("sound",     soundTask,          5,               2,  TASK_HIGH,     50);
+  scheduler.addTask("range",     rangeTask,          UPDATE_INTERVAL, 1,  TASK_NORMAL,   200);
+  scheduler.addTask("behavior",  behaviorTask,       UPDATE_INTERVAL, 2,  TASK_NORMAL,   5000);
+  scheduler.addTask("needs_5s",  behaviorMediumTask, 5000,            7,  TASK_NORMAL,   5000);
+  scheduler.addTask("learn_30s", behaviorSlowTask,   30000,           9,  TASK_LOW,      5000);
+  scheduler.addTask("ai_anim",   aiAnimationTask,    10,              1,  TASK_HIGH,     500);
+  scheduler.addTask("ai_batch",  aiBatchTask,        5,               3,  TASK_NORMAL,   2000);
+  scheduler.addTask("ai_stream", aiStreamTask,       UPDATE_INTERVAL, 4,  TASK_LOW,      2000);
+  scheduler.addTask("ai_event",  aiEventTask,        UPDATE_INTERVAL, 3,  TASK_HIGH,     1000);
+  scheduler.addTask("profile",   telemetryTask,      PROFILE_INTERVAL, PROFILE_INTERVAL, TASK_LOW, 500);
+  scheduler.addTask("drain",     telemetryOutTask,   TELEMETRY_DRAIN_INTERVAL, 6, TASK_LOW, 2000);
+  scheduler.addTask("diag",      diagnosticsTask,    DIAGNOSTICS_INTERVAL, DIAGNOSTICS_INTERVAL, TASK_LOW, 50000);
+  scheduler.addTask("save",      saveStateTask,      SAVE_INTERVAL,   SAVE_INTERVAL, TASK_LOW, 50000);
+}
+
+// ============================================
+// MAIN LOOP
+// ============================================
+void loop() {
+  scheduler.runDue();
 
   // ═══════════════════════════════════════════════════════════════
-  // LOOP RATE LIMITING: Match Teensy's natural throttling
+  // IDLE: Sleep until the next task is due
   // ═══════════════════════════════════════════════════════════════
-  // Teensy: Serial blocking provides natural ~few hundred Hz throttling
-  // Buddy: Use delay(5) to match that behavior
-  //
-  // delay(5) = ~200Hz loop rate:
-  //   - Still 4x faster than 50Hz update rate (plenty of margin)
-  //   - Matches Teensy's natural throttling behavior
-  //   - Prevents runaway behavior
-  //   - Stable and controlled like Teensy
-  //
-  // This exactly matches Teensy's stability characteristics
+  // delay() keeps calling yield() → serialEvent1(), so ESP32 lines
+  // are still lexed and timestamped while the loop is idle.
+  // Capped at 5ms, the old fixed loop delay.
   // ═══════════════════════════════════════════════════════════════
-  delay(5);  // 5ms = ~200Hz loop rate (matches Teensy's natural rate)
+  unsigned long idleUs = scheduler.usUntilNextDue();
+  if (idleUs >= 1000) delay(min(idleUs / 1000, 5UL));
 }
 
 // ============================================
@@ -982,8 +1036,8 @@ void serialEvent() {
           BodySchema& bodySchema = behaviorEngine.getBodySchema();
           ServoAngles neutral = bodySchema.lookAt(0, 50, 20);
           MovementStyleParams style = behaviorEngine.getMovementStyle();
-          servoController.smoothMoveTo(neutral.base, neutral.nod, neutral.tilt, style);
-          Serial.println("Returned to spatial neutral");
+          servoController.startMove(neutral.base, neutral.nod, neutral.tilt, style);
+          Serial.println("Returning to spatial neutral");
         }
         break;
         
@@ -1005,6 +1059,12 @@ void serialEvent() {
           
           MovementStyleParams style = behaviorEngine.getMovementStyle();
           
+          // Played as a clip of absolute poses, 1s hold each; the
+          // frames live in RAM, so stop any clip before rewriting them
+          static Keyframe testFrames[4];
+          static const AnimClip testClip = { "spatial_test", testFrames, 4, 0, 0, 0, CLIP_FACTOR_NONE, 0, 0 };
+          clipPlayer.stop();
+          
           for (int i = 0; i < 4; i++) {
             Serial.print("  Target ");
             Serial.print(i+1);
@@ -1017,11 +1077,13 @@ void serialEvent() {
             Serial.println(")");
             
             ServoAngles angles = bodySchema.lookAt(points[i][0], points[i][1], points[i][2]);
-            servoController.smoothMoveTo(angles.base, angles.nod, angles.tilt, style);
-            delay(1000);
+            testFrames[i] = Keyframe KF_EX((int16_t)angles.base, (int16_t)angles.nod, (int16_t)angles.tilt,
+                                           0, 0, 0, MOTION_EASE_STYLE, KF_ABSOLUTE, 0,
+                                           CLIP_FACTOR_NONE, 1000, 0);
           }
           
-          Serial.println("✓ Spatial test complete");
+          clipPlayer.play(testClip, servoController, style);
+          Serial.println("✓ Spatial test started");
         }
         break;
         
@@ -1139,6 +1201,17 @@ void serialEvent() {
         Serial.println(debugPrintEnabled ? "ON" : "OFF");
         break;
 
+      case 'b':  // Telemetry output: text → binary → off
+      case 'B':
+        {
+          TelemetryMode next = (TelemetryMode)((telemetry.mode() + 1) % 3);
+          Serial.print("Telemetry output: ");
+          Serial.println(next == TELEM_TEXT ? "TEXT" : next == TELEM_BINARY ? "BINARY" : "OFF");
+          Serial.flush();
+          telemetry.setMode(next);
+        }
+        break;
+
       case 'h':
       case 'H':
         printHelp();
@@ -1156,7 +1229,7 @@ void serialEvent() {
             if (c == '\n' || c == '\r') {
               if (aiCmdPos > 0) {
                 aiCmdBuf[aiCmdPos] = '\0';
-                aiBridge.handleCommand(aiCmdBuf);
+                aiBridge.submitCommand(aiCmdBuf, &Serial);
                 aiCmdPos = 0;
               }
               break;
@@ -1342,6 +1415,8 @@ void printHelp() {
   Serial.println("  r/R - Show tracking diagnostics");
   Serial.println("        (Face position, reflex state)");
   Serial.println("  g/G - Toggle debug serial output");
+  Serial.println("  b/B - Cycle telemetry output");
+  Serial.println("        (text / binary for telemetry_decode.py / off)");
   Serial.println("");
   Serial.println("STATE:");
   Serial.println("  s/S - Save state to EEPROM now");
@@ -1380,6 +1455,8 @@ void printHelp() {
   Serial.println("  !CELEBRATE        - Happy bounce");
   Serial.println("  !IDLE             - Return to normal");
   Serial.println("  !STREAM:on/off    - Toggle streaming");
+  Serial.println("  !SUB:servo@50,... - Topic streams (hz or event)");
+  Serial.println("  !BATCH:c1|ms@c2   - Command list, one result");
   Serial.println("════════════════════════════════════\n");
 }
 
@@ -1393,7 +1470,7 @@ void emergencyStop() {
   nodServo.detach();
   tiltServo.detach();
   
-  noTone(buzzerPin);
+  toneSequencer.stop();
   
   behaviorEngine.saveState();
   
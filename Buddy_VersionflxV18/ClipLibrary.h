@@ -0,0 +1,369 @@
+/**
+ * ClipLibrary.h - Buddy's gestures as keyframe clips
+ *
+ * Every multi-step gesture of AnimationController, MovementExpression and
+ * ConsciousnessManifest lives here as data for ClipPlayer (AnimationClip.h).
+ * Offsets are degrees from where the clip starts unless a frame says
+ * otherwise. Holds are in ms. To add a gesture, add an array and a clip,
+ * then play it:
+ *
+ *   clipPlayer.play(CLIP_NOD_YES, servos, style, ClipArgs().withRepeat(3));
+ *
+ * Single-pose expressions (one move, no hold) stay as startMove() calls in
+ * their modules.
+ */
+
+#ifndef CLIP_LIBRARY_H
+#define CLIP_LIBRARY_H
+
+#include "AnimationClip.h"
+
+#define CLIP_NO_GAIN  0, CLIP_FACTOR_NONE, 0
+
+// ============================================================================
+// ANIMATION CONTROLLER
+// ============================================================================
+
+// Down/up loop (ClipArgs::repeat = count), then back
+static constexpr Keyframe FRAMES_NOD_YES[] = {
+  KF(0, 15, 0, 150),
+  KF(0, -5, 0, 150),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_NOD_YES = { "nod_yes", CLIP_FRAMES(FRAMES_NOD_YES), 0, 2, CLIP_NO_GAIN, 0 };
+
+// Left/right loop, then back
+static constexpr Keyframe FRAMES_SHAKE_NO[] = {
+  KF(-20, 0, 0, 150),
+  KF(20, 0, 0, 150),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_SHAKE_NO = { "shake_no", CLIP_FRAMES(FRAMES_SHAKE_NO), 0, 2, CLIP_NO_GAIN, 0 };
+
+// Three up/down hops with a random sideways kick
+static constexpr Keyframe FRAMES_PLAYFUL_BOUNCE[] = {
+  KF_EX(0, 15, -10, 10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, -5, 5,   10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, 15, -10, 10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, -5, 5,   10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, 15, -10, 10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, -5, 5,   10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_PLAYFUL_BOUNCE = { "playful_bounce", CLIP_FRAMES(FRAMES_PLAYFUL_BOUNCE), 0, 0, CLIP_NO_GAIN, 130 };
+
+// Tilt to a random side, further the more curious, then back
+static constexpr Keyframe FRAMES_CURIOUS_TILT[] = {
+  KF_EX(0, 5, 20, 0, 0, 0, MOTION_EASE_STYLE, KF_SIDE, 0, CLIP_FACTOR_NONE, 400, 0),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_CURIOUS_TILT = {
+  "curious_tilt", CLIP_FRAMES(FRAMES_CURIOUS_TILT), 0, 0,
+  1 << AXIS_TILT, CLIP_FACTOR_CURIOSITY, 100, 0
+};
+
+// Played anchored at the withdrawn pose: hold there...
+static constexpr Keyframe FRAMES_RECOIL[] = {
+  KF(0, 0, 0, 500)
+};
+static constexpr AnimClip CLIP_RECOIL = { "recoil", CLIP_FRAMES(FRAMES_RECOIL), 0, 0, CLIP_NO_GAIN, 0 };
+
+// ...then anchored at neutral: peek back slowly, still a little low
+static constexpr Keyframe FRAMES_PEEK_BACK[] = {
+  KF(0, -10, 0, 0)
+};
+static constexpr AnimClip CLIP_PEEK_BACK = { "peek_back", CLIP_FRAMES(FRAMES_PEEK_BACK), 0, 0, CLIP_NO_GAIN, 50 };
+
+// Look left, right, back to center around ClipArgs::target (center, nod);
+// base swings ±100 × ClipArgs::scale, so scale = amplitude / 100
+static constexpr Keyframe FRAMES_SCAN[] = {
+  KF_EX(-100, 5, 0, 0, 0, 0, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_NONE, 200, 0),
+  KF_EX(100, 5, -5, 0, 0, 0, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_NONE, 200, 0),
+  KF_EX(0, 0, 0,    0, 0, 0, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr AnimClip CLIP_SCAN = { "scan", CLIP_FRAMES(FRAMES_SCAN), 0, 0, 1 << AXIS_BASE, CLIP_FACTOR_NONE, 0, 0 };
+
+// ============================================================================
+// MOVEMENT EXPRESSION
+// ============================================================================
+
+// Windup before a move: snap to the anchor (set to the windup pose), hold
+static constexpr Keyframe FRAMES_WINDUP[] = {
+  KF_EX(0, 0, 0, 0, 0, 5, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 100, 0)
+};
+static constexpr AnimClip CLIP_WINDUP = { "windup", CLIP_FRAMES(FRAMES_WINDUP), 0, 0, CLIP_NO_GAIN, 0 };
+
+// ── Agreement: one variant per choice ──
+static constexpr Keyframe FRAMES_CONFIDENT_NOD[] = {
+  KF(0, 20, 0, 180),
+  KF(0, -3, 0, 0)
+};
+static constexpr Keyframe FRAMES_UNDERSTANDING_TILT[] = {
+  KF_EX(0, 5, 25, 0, 0, 0, MOTION_EASE_STYLE, KF_SIDE, 0, CLIP_FACTOR_NONE, 400, 0),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_LEAN_IN[] = {
+  KF(0, 15, -10, 300),
+  KF(0, 5, 0, 0)
+};
+static constexpr Keyframe FRAMES_SUBTLE_ACK[] = {
+  KF_EX(0, 3, -5, 5, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 200, 0)
+};
+static constexpr AnimClip CLIPS_AGREEMENT[] = {
+  { "confident_nod", CLIP_FRAMES(FRAMES_CONFIDENT_NOD), 0, 0, CLIP_NO_GAIN, 0 },
+  { "understanding_tilt", CLIP_FRAMES(FRAMES_UNDERSTANDING_TILT), 0, 0, CLIP_NO_GAIN, 0 },
+  { "lean_in", CLIP_FRAMES(FRAMES_LEAN_IN), 0, 0, CLIP_NO_GAIN, 0 },
+  { "subtle_ack", CLIP_FRAMES(FRAMES_SUBTLE_ACK), 0, 0, CLIP_NO_GAIN, 0 }
+};
+
+// ── Excitement: two quick hops, settle a little raised ──
+static constexpr Keyframe FRAMES_EXCITEMENT[] = {
+  KF_EX(0, 15, -10, 10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, -5, 5,   10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, 15, -10, 10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF_EX(0, -5, 5,   10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 100, 0),
+  KF(0, 5, 0, 0)
+};
+static constexpr AnimClip CLIP_EXCITEMENT = { "excitement", CLIP_FRAMES(FRAMES_EXCITEMENT), 0, 0, CLIP_NO_GAIN, 140 };
+
+// ── Affection ──
+static constexpr Keyframe FRAMES_GENTLE_SWAY[] = {
+  KF(-8, 3, 10, 300),
+  KF(8, 3, -10, 300),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_WARM_TILT[] = {
+  KF_EX(0, 8, 20, 0, 0, 0, MOTION_EASE_STYLE, KF_SIDE, 0, CLIP_FACTOR_NONE, 500, 0),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_SETTLE_NEAR[] = {
+  KF(0, 10, -5, 400)
+};
+static constexpr AnimClip CLIPS_AFFECTION[] = {
+  { "gentle_sway", CLIP_FRAMES(FRAMES_GENTLE_SWAY), 0, 0, CLIP_NO_GAIN, 0 },
+  { "warm_tilt", CLIP_FRAMES(FRAMES_WARM_TILT), 0, 0, CLIP_NO_GAIN, 0 },
+  { "settle_near", CLIP_FRAMES(FRAMES_SETTLE_NEAR), 0, 0, CLIP_NO_GAIN, 0 }
+};
+
+// ── Quirks: snapped, not eased (index = MovementExpression::quirkType) ──
+static constexpr Keyframe FRAMES_QUIRK_THINKER[] = {
+  KF_EX(0, 15, 20, 0, 0, 0, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 600, 0),
+  KF_EX(0, 0, 0,   0, 0, 0, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr Keyframe FRAMES_QUIRK_WATCHER[] = {
+  KF_EX(30, 10, -10, 0, 0, 0, CLIP_EASE_SNAP, KF_SIDE, 0, CLIP_FACTOR_NONE, 500, 0),
+  KF_EX(0, 0, 0,     0, 0, 0, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr Keyframe FRAMES_QUIRK_WOBBLER[] = {
+  KF_EX(0, 0, 0, 5, 0, 8, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 200, 0),
+  KF_EX(0, 0, 0, 5, 0, 8, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 200, 0),
+  KF_EX(0, 0, 0, 5, 0, 8, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 200, 0)
+};
+static constexpr Keyframe FRAMES_QUIRK_STARGAZER[] = {
+  KF_EX(0, 25, 0, 0, 0, 0, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 700, 0),
+  KF_EX(0, 0, 0,  0, 0, 0, CLIP_EASE_SNAP, 0, 0, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr AnimClip CLIPS_QUIRK[] = {
+  { "quirk_thinker", CLIP_FRAMES(FRAMES_QUIRK_THINKER), 0, 0, CLIP_NO_GAIN, 0 },
+  { "quirk_watcher", CLIP_FRAMES(FRAMES_QUIRK_WATCHER), 0, 0, CLIP_NO_GAIN, 0 },
+  { "quirk_wobbler", CLIP_FRAMES(FRAMES_QUIRK_WOBBLER), 0, 0, CLIP_NO_GAIN, 0 },
+  { "quirk_stargazer", CLIP_FRAMES(FRAMES_QUIRK_STARGAZER), 0, 0, CLIP_NO_GAIN, 0 }
+};
+
+// ── Playfulness: three random poses, then back ──
+static constexpr Keyframe FRAMES_PLAYFULNESS[] = {
+  KF_EX(0, 0, 0, 20, 10, 15, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 150, 0),
+  KF_EX(0, 0, 0, 20, 10, 15, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 150, 0),
+  KF_EX(0, 0, 0, 20, 10, 15, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 150, 0),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_PLAYFULNESS = { "playfulness", CLIP_FRAMES(FRAMES_PLAYFULNESS), 0, 0, CLIP_NO_GAIN, 120 };
+
+// ── Caution: slow look left, right, back ──
+static constexpr Keyframe FRAMES_CAUTION[] = {
+  KF(-15, 0, 0, 300),
+  KF(15, 0, 0, 300),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_CAUTION = { "caution", CLIP_FRAMES(FRAMES_CAUTION), 0, 0, CLIP_NO_GAIN, 60 };
+
+// ── Uncertainty: four small jerky adjustments, uneven pauses ──
+static constexpr Keyframe FRAMES_UNCERTAINTY[] = {
+  KF_EX(0, 0, 0, 0, 3, 5, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_RANDOM, 150, 150),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_UNCERTAINTY = { "uncertainty", CLIP_FRAMES(FRAMES_UNCERTAINTY), 0, 1, CLIP_NO_GAIN, 0 };
+
+// ── Curious inspection: pause, tilt, orient to ClipArgs::target, hold ──
+static constexpr Keyframe FRAMES_CURIOUS_INSPECTION[] = {
+  KF_EX(0, 0, 0,  0, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_CAUTION, 150, 200),
+  KF_EX(0, 5, 18, 0, 0, 0, MOTION_EASE_STYLE, KF_SIDE, 60, CLIP_FACTOR_NONE, 200, 0),
+  KF_EX(0, 0, 8,  0, 0, 0, MOTION_EASE_STYLE, KF_SIDE | KF_TARGET, 90, CLIP_FACTOR_PERSISTENCE, 700, 600)
+};
+static constexpr AnimClip CLIP_CURIOUS_INSPECTION = {
+  "curious_inspection", CLIP_FRAMES(FRAMES_CURIOUS_INSPECTION), 0, 0, CLIP_NO_GAIN, 0
+};
+
+// ── Social greeting: orient to the face, small nod, hold, maybe tilt ──
+static constexpr Keyframe FRAMES_SOCIAL_GREETING[] = {
+  KF_EX(0, 0, 0,  0, 0, 0, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_NONE, 150, 0),
+  KF_EX(0, 8, 0,  0, 0, 0, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_NONE, 120, 0),
+  KF_EX(0, 0, 0,  0, 0, 0, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_PERSISTENCE, 300, 400),
+  KF_EX(0, 0, 12, 0, 0, 0, MOTION_EASE_STYLE, KF_TARGET | KF_SIDE, 70, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr AnimClip CLIP_SOCIAL_GREETING = {
+  "social_greeting", FRAMES_SOCIAL_GREETING, 3, 0, 0, CLIP_NO_GAIN, 130
+};
+static constexpr AnimClip CLIP_SOCIAL_GREETING_TILT = {
+  "social_greeting_tilt", CLIP_FRAMES(FRAMES_SOCIAL_GREETING), 0, 0, CLIP_NO_GAIN, 130
+};
+
+// ── Alone thinking: one variant per choice ──
+static constexpr Keyframe FRAMES_SLOW_SCAN[] = {
+  KF_EX(25, 0, 0, 0, 0, 0, MOTION_EASE_STYLE, KF_SIDE, 0, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr Keyframe FRAMES_TILT_AT_NOTHING[] = {
+  KF_EX(0, 3, 15, 0, 0, 0, MOTION_EASE_STYLE, KF_SIDE, 0, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr Keyframe FRAMES_LONG_STARE[] = {
+  KF_EX(0, 0, 0, 30, 5, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_PERSISTENCE, 500, 800)
+};
+static constexpr Keyframe FRAMES_THOUGHT_INTERRUPT[] = {
+  KF(0, 0, 0, 300),
+  KF_EX(0, 0, 0, 8, 4, 6, MOTION_EASE_STYLE, 0, 300, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr AnimClip CLIPS_ALONE_THINKING[] = {
+  { "slow_scan", CLIP_FRAMES(FRAMES_SLOW_SCAN), 0, 0, CLIP_NO_GAIN, 50 },
+  { "tilt_at_nothing", CLIP_FRAMES(FRAMES_TILT_AT_NOTHING), 0, 0, CLIP_NO_GAIN, 50 },
+  { "long_stare", CLIP_FRAMES(FRAMES_LONG_STARE), 0, 0, CLIP_NO_GAIN, 50 },
+  { "thought_interrupt", CLIP_FRAMES(FRAMES_THOUGHT_INTERRUPT), 0, 0, CLIP_NO_GAIN, 50 }
+};
+
+// ============================================================================
+// CONSCIOUSNESS MANIFEST
+// ============================================================================
+
+// ── Conflict: false start toward the suppressed drive, pause, correct back ──
+// The pause grows with ClipArgs::intensity (tension level)
+#define CONFLICT_FRAMES(b, n, sb) { \
+  KF_EX(b, n, 0, sb, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_INTENSITY, 100, 300), \
+  KF_EX(0, 0, 0, 0, 0, 0, MOTION_EASE_STYLE, 0, 71, CLIP_FACTOR_NONE, 0, 0) }
+
+static constexpr Keyframe FRAMES_CONFLICT_EXPLORE[] = CONFLICT_FRAMES(0, 0, 15);
+static constexpr Keyframe FRAMES_CONFLICT_RETREAT[] = CONFLICT_FRAMES(0, -8, 0);
+static constexpr Keyframe FRAMES_CONFLICT_SOCIAL[]  = CONFLICT_FRAMES(0, 5, 0);
+static constexpr Keyframe FRAMES_CONFLICT_PLAY[]    = CONFLICT_FRAMES(0, 5, 10);
+static constexpr Keyframe FRAMES_CONFLICT_OTHER[]   = CONFLICT_FRAMES(0, 0, 0);
+#undef CONFLICT_FRAMES
+
+static constexpr AnimClip CLIP_CONFLICT_EXPLORE = { "conflict_explore", CLIP_FRAMES(FRAMES_CONFLICT_EXPLORE), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_CONFLICT_RETREAT = { "conflict_retreat", CLIP_FRAMES(FRAMES_CONFLICT_RETREAT), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_CONFLICT_SOCIAL  = { "conflict_social", CLIP_FRAMES(FRAMES_CONFLICT_SOCIAL), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_CONFLICT_PLAY    = { "conflict_play", CLIP_FRAMES(FRAMES_CONFLICT_PLAY), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_CONFLICT_OTHER   = { "conflict", CLIP_FRAMES(FRAMES_CONFLICT_OTHER), 0, 0, CLIP_NO_GAIN, 0 };
+
+// ── Meta-awareness: small upward jerk, then a slower "hmm" tilt ──
+static constexpr Keyframe FRAMES_META_CATCH[] = {
+  KF(0, 6, 0, 200),
+  KF_EX(0, 0, 0, 0, 0, 8, MOTION_EASE_STYLE, 0, 56, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr AnimClip CLIP_META_CATCH = { "meta_catch", CLIP_FRAMES(FRAMES_META_CATCH), 0, 0, CLIP_NO_GAIN, 0 };
+
+// ── Counterfactual: glance at what might have been, then relief or regret ──
+static constexpr Keyframe FRAMES_CF_RELIEF[] = {
+  KF(0, 0, 0, 300),
+  KF(0, 3, 0, 200),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_CF_REGRET[] = {
+  KF_EX(0, 0, 0, 10, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 300, 0),
+  KF(0, -3, 0, 300),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_CF_RELIEF = { "cf_relief", CLIP_FRAMES(FRAMES_CF_RELIEF), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_CF_REGRET = { "cf_regret", CLIP_FRAMES(FRAMES_CF_REGRET), 0, 0, CLIP_NO_GAIN, 0 };
+
+// ============================================================================
+// ILLUSION LAYER
+// ============================================================================
+
+// ── Deliberation: three small tilts, each held longer with ClipArgs::intensity
+// (uncertainty), then back ──
+static constexpr Keyframe FRAMES_DELIBERATE[] = {
+  KF_EX(0, 0, 0, 0, 0, 8, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_INTENSITY, 100, 500),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_DELIBERATE = { "deliberate", CLIP_FRAMES(FRAMES_DELIBERATE), 0, 1, CLIP_NO_GAIN, 0 };
+
+// ── Micro-expressions: emotional leakage, a quick pose and (mostly) back ──
+static constexpr Keyframe FRAMES_MICRO_CURIOUS[] = {
+  KF(0, 0, -12, 180),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_MICRO_EXCITED[] = {
+  KF(0, 8, 0, 120),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_MICRO_ANXIOUS[] = {
+  KF(0, -5, 0, 80),
+  KF(0, -5, 3, 80),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_MICRO_STARTLED[] = {
+  KF(0, -15, 0, 100),
+  KF(0, -5, 0, 200),
+  KF(0, 0, 0, 0)
+};
+static constexpr Keyframe FRAMES_MICRO_CONTENT[] = {
+  KF(0, -3, 0, 300)
+};
+static constexpr Keyframe FRAMES_MICRO_BORED[] = {
+  KF_EX(0, -10, 0, 0, 0, 0, MOTION_EASE_STYLE, 0, 50, CLIP_FACTOR_NONE, 400, 0)
+};
+static constexpr Keyframe FRAMES_MICRO_CONFUSED[] = {
+  KF(-5, 0, 0, 150),
+  KF(5, 0, 0, 150),
+  KF(0, 0, 0, 0)
+};
+static constexpr AnimClip CLIP_MICRO_CURIOUS  = { "micro_curious", CLIP_FRAMES(FRAMES_MICRO_CURIOUS), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_MICRO_EXCITED  = { "micro_excited", CLIP_FRAMES(FRAMES_MICRO_EXCITED), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_MICRO_ANXIOUS  = { "micro_anxious", CLIP_FRAMES(FRAMES_MICRO_ANXIOUS), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_MICRO_STARTLED = { "micro_startled", CLIP_FRAMES(FRAMES_MICRO_STARTLED), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_MICRO_CONTENT  = { "micro_content", CLIP_FRAMES(FRAMES_MICRO_CONTENT), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_MICRO_BORED    = { "micro_bored", CLIP_FRAMES(FRAMES_MICRO_BORED), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_MICRO_CONFUSED = { "micro_confused", CLIP_FRAMES(FRAMES_MICRO_CONFUSED), 0, 0, CLIP_NO_GAIN, 0 };
+
+// ── False start toward the rejected behavior, then a slower correction ──
+#define FALSE_START_FRAMES(b, n, t, sb, hold) { \
+  KF_EX(b, n, t, sb, 0, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, hold, 0), \
+  KF_EX(0, 0, 0, 0, 0, 0, MOTION_EASE_STYLE, 0, 80, CLIP_FACTOR_NONE, 200, 0) }
+
+static constexpr Keyframe FRAMES_FALSE_START_RETREAT[]     = FALSE_START_FRAMES(0, -8, 10, 20, 250);
+static constexpr Keyframe FRAMES_FALSE_START_INVESTIGATE[] = FALSE_START_FRAMES(0, 10, -8, 0, 250);
+static constexpr Keyframe FRAMES_FALSE_START_EXPLORE[]     = FALSE_START_FRAMES(0, 0, 0, 30, 250);
+static constexpr Keyframe FRAMES_FALSE_START_SOCIAL[]      = FALSE_START_FRAMES(0, 5, 0, 0, 200);
+#undef FALSE_START_FRAMES
+
+static constexpr AnimClip CLIP_FALSE_START_RETREAT     = { "false_start_retreat", CLIP_FRAMES(FRAMES_FALSE_START_RETREAT), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_FALSE_START_INVESTIGATE = { "false_start_investigate", CLIP_FRAMES(FRAMES_FALSE_START_INVESTIGATE), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_FALSE_START_EXPLORE     = { "false_start_explore", CLIP_FRAMES(FRAMES_FALSE_START_EXPLORE), 0, 0, CLIP_NO_GAIN, 0 };
+static constexpr AnimClip CLIP_FALSE_START_SOCIAL      = { "false_start_social", CLIP_FRAMES(FRAMES_FALSE_START_SOCIAL), 0, 0, CLIP_NO_GAIN, 0 };
+
+// ── Attentional dwell: four searching looks around ClipArgs::target, then
+// settle on it ──
+static constexpr Keyframe FRAMES_DWELL[] = {
+  KF_EX(0, 0, 0, 5, 10, 15, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_RANDOM, 300, 400),
+  KF_EX(0, 0, 0, 0, 0, 0, MOTION_EASE_STYLE, KF_TARGET, 0, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr AnimClip CLIP_DWELL = { "dwell", CLIP_FRAMES(FRAMES_DWELL), 0, 1, CLIP_NO_GAIN, 0 };
+
+// ── Self-correction: small "oops" overshoot, slower correction back ──
+static constexpr Keyframe FRAMES_SELF_CORRECTION[] = {
+  KF_EX(0, 0, 0, 8, 5, 0, MOTION_EASE_STYLE, 0, 0, CLIP_FACTOR_NONE, 200, 0),
+  KF_EX(0, 0, 0, 0, 0, 0, MOTION_EASE_STYLE, 0, 80, CLIP_FACTOR_NONE, 0, 0)
+};
+static constexpr AnimClip CLIP_SELF_CORRECTION = { "self_correction", CLIP_FRAMES(FRAMES_SELF_CORRECTION), 0, 0, CLIP_NO_GAIN, 0 };
+
+#undef CLIP_NO_GAIN
+
+#endif // CLIP_LIBRARY_H
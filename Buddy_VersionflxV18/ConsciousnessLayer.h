@@ -18,6 +18,8 @@
 #include "Needs.h"
 #include "SpatialMemory.h"
 #include "Learning.h"
+#include "Log.h"
+#include "AIEvents.h"
 
 // ============================================
 // EPISTEMIC STATES — What do I know?
@@ -191,6 +193,7 @@ public:
     // ========================================================================
 
     void updateEpistemicState(SpatialMemory& memory, Emotion& emotion) {
+        EpistemicState before = epistemicState;
         float novelty = memory.getTotalNovelty();
         float dynamism = memory.getAverageDynamism();
         float emotionalClarity = abs(emotion.getValence());
@@ -219,6 +222,10 @@ public:
             epistemicState = EPIST_CONFIDENT;
             subjectiveConfidence = 0.8;
         }
+
+        if (epistemicState != before) {
+            AI_EVENT(AI_EVT_EPISTEMIC, epistemicName(before), epistemicName(epistemicState));
+        }
     }
 
     // ========================================================================
@@ -334,6 +341,7 @@ public:
             if (duration > 45.0 || needs.getImbalance() > 0.5) {
                 wondering.isWondering = false;
                 wondering.intensity = 0.0;
+                AI_EVENT(AI_EVT_WONDER_END, wonderingName(wondering.type), "", duration);
             }
             return;
         }
@@ -353,6 +361,7 @@ public:
             wondering.lastWondering = millis();
             wondering.intensity = 0.6;
             wondering.type = (WonderingType)random(0, 5);
+            AI_EVENT(AI_EVT_WONDER_START, wonderingName(wondering.type), "", wondering.intensity);
         }
     }
 
@@ -465,6 +474,7 @@ public:
                 wondering.lastWondering = millis();
                 wondering.intensity = 0.5;
                 wondering.type = WONDER_EXTERNAL;
+                AI_EVENT(AI_EVT_WONDER_START, wonderingName(wondering.type), "", wondering.intensity);
             }
         }
 
@@ -512,6 +522,30 @@ public:
     float getSelfAwareness() const { return meta.selfAwareness; }
 
     EpistemicState getEpistemicState() const { return epistemicState; }
+
+    static const char* epistemicName(EpistemicState s) {
+        switch (s) {
+            case EPIST_CONFIDENT:  return "confident";
+            case EPIST_UNCERTAIN:  return "uncertain";
+            case EPIST_CONFUSED:   return "confused";
+            case EPIST_LEARNING:   return "learning";
+            case EPIST_CONFLICTED: return "conflicted";
+            case EPIST_WONDERING:  return "wondering";
+        }
+        return "confident";
+    }
+
+    static const char* wonderingName(WonderingType t) {
+        switch (t) {
+            case WONDER_SELF:     return "self";
+            case WONDER_PLACE:    return "place";
+            case WONDER_PURPOSE:  return "purpose";
+            case WONDER_FUTURE:   return "future";
+            case WONDER_PAST:     return "past";
+            case WONDER_EXTERNAL: return "external";
+        }
+        return "self";
+    }
     float getSubjectiveConfidence() const { return subjectiveConfidence; }
 
     const SelfNarrative& getNarrative() const { return narrative; }
@@ -522,50 +556,50 @@ public:
     // ========================================================================
 
     void printDiagnostics() {
-        Serial.println("\n=== CONSCIOUSNESS STATE ===");
+        LOG_PRINTLN(CONSCIOUS, INFO, "\n=== CONSCIOUSNESS STATE ===");
 
-        Serial.print("  Epistemic: ");
+        LOG_PRINT(CONSCIOUS, INFO, "  Epistemic: ");
         switch(epistemicState) {
-            case EPIST_CONFIDENT:  Serial.println("CONFIDENT"); break;
-            case EPIST_UNCERTAIN:  Serial.println("UNCERTAIN"); break;
-            case EPIST_CONFUSED:   Serial.println("CONFUSED"); break;
-            case EPIST_LEARNING:   Serial.println("LEARNING"); break;
-            case EPIST_CONFLICTED: Serial.println("CONFLICTED"); break;
-            case EPIST_WONDERING:  Serial.println("WONDERING"); break;
+            case EPIST_CONFIDENT:  LOG_PRINTLN(CONSCIOUS, INFO, "CONFIDENT"); break;
+            case EPIST_UNCERTAIN:  LOG_PRINTLN(CONSCIOUS, INFO, "UNCERTAIN"); break;
+            case EPIST_CONFUSED:   LOG_PRINTLN(CONSCIOUS, INFO, "CONFUSED"); break;
+            case EPIST_LEARNING:   LOG_PRINTLN(CONSCIOUS, INFO, "LEARNING"); break;
+            case EPIST_CONFLICTED: LOG_PRINTLN(CONSCIOUS, INFO, "CONFLICTED"); break;
+            case EPIST_WONDERING:  LOG_PRINTLN(CONSCIOUS, INFO, "WONDERING"); break;
         }
 
-        Serial.print("  Confidence: "); Serial.println(subjectiveConfidence, 2);
-        Serial.print("  Self-awareness: "); Serial.println(meta.selfAwareness, 2);
+        LOG_PRINT(CONSCIOUS, INFO, "  Confidence: "); LOG_PRINTLN(CONSCIOUS, INFO, subjectiveConfidence, 2);
+        LOG_PRINT(CONSCIOUS, INFO, "  Self-awareness: "); LOG_PRINTLN(CONSCIOUS, INFO, meta.selfAwareness, 2);
 
         if (conflict.inConflict()) {
-            Serial.print("  CONFLICT: tension=");
-            Serial.print(conflict.tensionLevel, 2);
-            Serial.print(" for ");
-            Serial.print(conflict.duration(), 1);
-            Serial.println("s");
+            LOG_PRINT(CONSCIOUS, INFO, "  CONFLICT: tension=");
+            LOG_PRINT(CONSCIOUS, INFO, conflict.tensionLevel, 2);
+            LOG_PRINT(CONSCIOUS, INFO, " for ");
+            LOG_PRINT(CONSCIOUS, INFO, conflict.duration(), 1);
+            LOG_PRINTLN(CONSCIOUS, INFO, "s");
         }
 
         if (wondering.isWondering) {
-            Serial.print("  WONDERING: ");
+            LOG_PRINT(CONSCIOUS, INFO, "  WONDERING: ");
             switch(wondering.type) {
-                case WONDER_SELF: Serial.println("Who am I?"); break;
-                case WONDER_PLACE: Serial.println("What is this place?"); break;
-                case WONDER_PURPOSE: Serial.println("Why do I do this?"); break;
-                case WONDER_FUTURE: Serial.println("What happens next?"); break;
-                case WONDER_PAST: Serial.println("What was that about?"); break;
-                case WONDER_EXTERNAL: Serial.println("What just changed?"); break;
+                case WONDER_SELF: LOG_PRINTLN(CONSCIOUS, INFO, "Who am I?"); break;
+                case WONDER_PLACE: LOG_PRINTLN(CONSCIOUS, INFO, "What is this place?"); break;
+                case WONDER_PURPOSE: LOG_PRINTLN(CONSCIOUS, INFO, "Why do I do this?"); break;
+                case WONDER_FUTURE: LOG_PRINTLN(CONSCIOUS, INFO, "What happens next?"); break;
+                case WONDER_PAST: LOG_PRINTLN(CONSCIOUS, INFO, "What was that about?"); break;
+                case WONDER_EXTERNAL: LOG_PRINTLN(CONSCIOUS, INFO, "What just changed?"); break;
             }
         }
 
         if (counterfactual.active) {
-            Serial.println("  Imagining alternatives...");
+            LOG_PRINTLN(CONSCIOUS, INFO, "  Imagining alternatives...");
             if (counterfactual.regret > 0.1) {
-                Serial.print("  Regret: "); Serial.println(counterfactual.regret, 2);
+                LOG_PRINT(CONSCIOUS, INFO, "  Regret: "); LOG_PRINTLN(CONSCIOUS, INFO, counterfactual.regret, 2);
             }
         }
 
-        Serial.print("  Mood trend: ");
-        Serial.println(narrative.recentMoodTrend > 0.05 ? "improving" :
+        LOG_PRINT(CONSCIOUS, INFO, "  Mood trend: ");
+        LOG_PRINTLN(CONSCIOUS, INFO, narrative.recentMoodTrend > 0.05 ? "improving" :
                        narrative.recentMoodTrend < -0.05 ? "declining" : "stable");
     }
 };
@@ -7,11 +7,14 @@
 
 #include "ConsciousnessLayer.h"
 #include "ServoController.h"
+#include "MotionLut.h"
+#include "ClipLibrary.h"
 #include "BodySchema.h"
 #include "Emotion.h"
 #include "Personality.h"
 #include "Needs.h"
 #include "LittleBots_Board_Pins.h"
+#include "droidSpeak.h"
 
 class ConsciousnessManifest {
 public:
@@ -40,34 +43,34 @@ public:
         switch(type) {
             case WONDER_SELF:
                 // Look down slightly, then slowly tilt head — introspective
-                servos.smoothMoveTo(base, constrain(nod - 8, 80, 150),
-                                     constrain(tilt - 10, 20, 150), style);
+                servos.startMove(base, constrain(nod - 8, 80, 150),
+                                 constrain(tilt - 10, 20, 150), style);
                 break;
 
             case WONDER_PLACE:
                 // Slow panoramic gaze — taking in surroundings
                 {
-                    int slowGaze = base + (int)(sin(millis() / 3000.0) * 20);
-                    servos.smoothMoveTo(constrain(slowGaze, 15, 165), nod, tilt, style);
+                    int slowGaze = base + (int)(lutSinPeriod(millis(), 18850) * 20);
+                    servos.startMove(constrain(slowGaze, 15, 165), nod, tilt, style);
                 }
                 break;
 
             case WONDER_PURPOSE:
                 // Small head tilt, slight pause — philosophical
-                servos.smoothMoveTo(base, nod,
-                                     constrain(tilt + (int)(sin(millis() / 2000.0) * 8), 20, 150),
-                                     style);
+                servos.startMove(base, nod,
+                                 constrain(tilt + (int)(lutSinPeriod(millis(), 12566) * 8), 20, 150),
+                                 style);
                 break;
 
             case WONDER_FUTURE:
                 // Gaze slightly upward — looking toward the future
-                servos.smoothMoveTo(base, constrain(nod + 5, 80, 150), tilt, style);
+                servos.startMove(base, constrain(nod + 5, 80, 150), tilt, style);
                 break;
 
             case WONDER_PAST:
                 // Gaze down-left — remembering
-                servos.smoothMoveTo(constrain(base - 15, 15, 165),
-                                     constrain(nod - 5, 80, 150), tilt, style);
+                servos.startMove(constrain(base - 15, 15, 165),
+                                 constrain(nod - 5, 80, 150), tilt, style);
                 break;
         }
     }
@@ -82,11 +85,9 @@ public:
 
         if (!conflict.inConflict()) return;
 
-        int base, nod, tilt;
-        servos.getPosition(base, nod, tilt);
-
+        // Quick false start (0.7), then a slower correction back (0.5)
         MovementStyleParams style;
-        style.speed = 0.4;
+        style.speed = 0.7;
         style.smoothness = 0.5;
         style.hesitation = conflict.tensionLevel * 0.5;
         style.delayMs = 15;
@@ -94,31 +95,17 @@ public:
         style.directness = 0.3;
         style.rangeScale = 60;
 
-        // Brief movement toward suppressed drive, then correction
-        int falseStartBase = base;
-        int falseStartNod = nod;
-
+        // Brief movement toward suppressed drive, a pause (visible decision
+        // moment, longer with tension), then correction
+        const AnimClip* clip;
         switch(conflict.suppressedDrive) {
-            case EXPLORE: falseStartBase += random(-15, 16); break;
-            case RETREAT: falseStartNod -= 8; break;
-            case SOCIAL_ENGAGE: falseStartNod += 5; break;
-            case PLAY: falseStartBase += random(-10, 11); falseStartNod += 5; break;
-            default: break;
+            case EXPLORE: clip = &CLIP_CONFLICT_EXPLORE; break;
+            case RETREAT: clip = &CLIP_CONFLICT_RETREAT; break;
+            case SOCIAL_ENGAGE: clip = &CLIP_CONFLICT_SOCIAL; break;
+            case PLAY: clip = &CLIP_CONFLICT_PLAY; break;
+            default: clip = &CLIP_CONFLICT_OTHER; break;
         }
-
-        falseStartBase = constrain(falseStartBase, 15, 165);
-        falseStartNod = constrain(falseStartNod, 80, 150);
-
-        // Quick false start
-        style.speed = 0.7;
-        servos.smoothMoveTo(falseStartBase, falseStartNod, tilt, style);
-
-        // Pause (visible decision moment)
-        delay(100 + (int)(conflict.tensionLevel * 300));
-
-        // Correct back
-        style.speed = 0.5;
-        servos.smoothMoveTo(base, nod, tilt, style);
+        clipPlayer.play(*clip, servos, style, ClipArgs().withIntensity(conflict.tensionLevel));
     }
 
     // ========================================================================
@@ -128,10 +115,8 @@ public:
     void manifestMetaCatch(ServoController& servos, Emotion& emotion,
                            Personality& personality, Needs& needs) {
 
-        int base, nod, tilt;
-        servos.getPosition(base, nod, tilt);
-
-        // Quick "snap back" — small upward jerk
+        // Quick "snap back" — small upward jerk, then a slower
+        // "hmm, what was I doing?" head tilt
         MovementStyleParams quickStyle;
         quickStyle.speed = 0.9;
         quickStyle.smoothness = 0.3;
@@ -141,20 +126,10 @@ public:
         quickStyle.directness = 0.8;
         quickStyle.rangeScale = 40;
 
-        int alertNod = constrain(nod + 6, 80, 150);
-        servos.smoothMoveTo(base, alertNod, tilt, quickStyle);
-
-        delay(200);
+        clipPlayer.play(CLIP_META_CATCH, servos, quickStyle);
 
-        // Subtle head tilt — "hmm, what was I doing?"
-        int thinkTilt = constrain(tilt + random(-8, 9), 20, 150);
-        quickStyle.speed = 0.5;
-        servos.smoothMoveTo(base, nod, thinkTilt, quickStyle);
-
-        // Brief sound
-        tone(buzzerPin, 600); delay(40);
-        tone(buzzerPin, 800); delay(60);
-        noTone(buzzerPin);
+        // Brief sound (plays as the jerk starts)
+        toneSequencer.play(PHRASE_META_CATCH);
     }
 
     // ========================================================================
@@ -166,9 +141,6 @@ public:
 
         if (!cf.active) return;
 
-        int base, nod, tilt;
-        servos.getPosition(base, nod, tilt);
-
         MovementStyleParams style;
         style.speed = 0.3;
         style.smoothness = 0.8;
@@ -178,25 +150,13 @@ public:
         style.directness = 0.4;
         style.rangeScale = 40;
 
-        // Subtle look toward "what might have been"
-        int glanceOffset = (cf.regret > 0.2) ? random(-10, 11) : 0;
-        int glanceBase = constrain(base + glanceOffset, 15, 165);
-        servos.smoothMoveTo(glanceBase, nod, tilt, style);
-
-        delay(300);
-
-        // Return with either a small nod (relief) or slight droop (regret)
+        // Look toward "what might have been" (a sideways glance if regretted),
+        // then a small nod (relief) or slight droop (regret) and back
         if (cf.relief > 0.2) {
-            int nodRelief = constrain(nod + 3, 80, 150);
-            servos.smoothMoveTo(base, nodRelief, tilt, style);
-            delay(200);
+            clipPlayer.play(CLIP_CF_RELIEF, servos, style);
         } else if (cf.regret > 0.2) {
-            int nodRegret = constrain(nod - 3, 80, 150);
-            servos.smoothMoveTo(base, nodRegret, tilt, style);
-            delay(300);
+            clipPlayer.play(CLIP_CF_REGRET, servos, style);
         }
-
-        servos.smoothMoveTo(base, nod, tilt, style);
     }
 
     // ========================================================================
@@ -219,7 +179,7 @@ public:
                 break;
 
             case EPIST_UNCERTAIN:
-                tilt = constrain(tilt + (int)(sin(millis() / 800.0) * 4), 20, 150);
+                tilt = constrain(tilt + (int)(lutSinPeriod(millis(), 5027) * 4), 20, 150);
                 break;
 
             default:
@@ -234,7 +194,7 @@ public:
         gentle.amplitude = 0.3;
         gentle.directness = 0.5;
         gentle.rangeScale = 40;
-        servos.smoothMoveTo(base, nod, tilt, gentle);
+        servos.startMove(base, nod, tilt, gentle);
     }
 };
 
@@ -6,6 +6,7 @@
 
 #include "Needs.h"
 #include "Personality.h"
+#include "Log.h"
 
 enum EmotionLabel {
   NEUTRAL,
@@ -250,78 +251,78 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- EMOTION ---");
-    Serial.print("  Label: ");
-    Serial.println(getLabelString());
+    LOG_PRINTLN(EMOTION, INFO, "--- EMOTION ---");
+    LOG_PRINT(EMOTION, INFO, "  Label: ");
+    LOG_PRINTLN(EMOTION, INFO, getLabelString());
     
-    Serial.print("  Arousal:   ");
+    LOG_PRINT(EMOTION, INFO, "  Arousal:   ");
     printBar(arousal);
-    Serial.println();
+    LOG_PRINTLN(EMOTION, INFO);
     
-    Serial.print("  Valence:   ");
+    LOG_PRINT(EMOTION, INFO, "  Valence:   ");
     printBarSigned(valence);
-    Serial.println();
+    LOG_PRINTLN(EMOTION, INFO);
     
-    Serial.print("  Dominance: ");
+    LOG_PRINT(EMOTION, INFO, "  Dominance: ");
     printBar(dominance);
-    Serial.println();
+    LOG_PRINTLN(EMOTION, INFO);
     
-    Serial.print("  Intensity: ");
+    LOG_PRINT(EMOTION, INFO, "  Intensity: ");
     printBar(intensity);
-    Serial.println();
+    LOG_PRINTLN(EMOTION, INFO);
     
-    Serial.print("  Mood baseline: valence=");
-    Serial.print(baselineValence, 2);
-    Serial.print(", arousal=");
-    Serial.println(baselineArousal, 2);
+    LOG_PRINT(EMOTION, INFO, "  Mood baseline: valence=");
+    LOG_PRINT(EMOTION, INFO, baselineValence, 2);
+    LOG_PRINT(EMOTION, INFO, ", arousal=");
+    LOG_PRINTLN(EMOTION, INFO, baselineArousal, 2);
   }
   
   void printCompact() {
-    Serial.print("  [EMOTION] ");
-    Serial.print(getLabelString());
-    Serial.print(" (A:");
-    Serial.print(arousal, 2);
-    Serial.print(" V:");
-    Serial.print(valence, 2);
-    Serial.print(" D:");
-    Serial.print(dominance, 2);
-    Serial.print(" I:");
-    Serial.print(intensity, 2);
-    Serial.println(")");
+    LOG_PRINT(EMOTION, INFO, "  [EMOTION] ");
+    LOG_PRINT(EMOTION, INFO, getLabelString());
+    LOG_PRINT(EMOTION, INFO, " (A:");
+    LOG_PRINT(EMOTION, INFO, arousal, 2);
+    LOG_PRINT(EMOTION, INFO, " V:");
+    LOG_PRINT(EMOTION, INFO, valence, 2);
+    LOG_PRINT(EMOTION, INFO, " D:");
+    LOG_PRINT(EMOTION, INFO, dominance, 2);
+    LOG_PRINT(EMOTION, INFO, " I:");
+    LOG_PRINT(EMOTION, INFO, intensity, 2);
+    LOG_PRINTLN(EMOTION, INFO, ")");
   }
   
   void printBar(float value) {
-    Serial.print("[");
+    LOG_PRINT(EMOTION, INFO, "[");
     int bars = (int)(value * 10);
     for (int i = 0; i < 10; i++) {
       if (i < bars) {
-        Serial.print("█");
+        LOG_PRINT(EMOTION, INFO, "█");
       } else {
-        Serial.print("░");
+        LOG_PRINT(EMOTION, INFO, "░");
       }
     }
-    Serial.print("] ");
-    Serial.print(value, 2);
+    LOG_PRINT(EMOTION, INFO, "] ");
+    LOG_PRINT(EMOTION, INFO, value, 2);
   }
   
   void printBarSigned(float value) {
     // For valence (-1 to 1)
-    Serial.print("[");
+    LOG_PRINT(EMOTION, INFO, "[");
     int center = 5;
     int pos = (int)((value + 1.0) * 5);  // Map -1,1 to 0,10
     
     for (int i = 0; i < 10; i++) {
       if (i == center) {
-        Serial.print("|");
+        LOG_PRINT(EMOTION, INFO, "|");
       } else if ((value > 0 && i > center && i <= pos) ||
                  (value < 0 && i < center && i >= pos)) {
-        Serial.print("█");
+        LOG_PRINT(EMOTION, INFO, "█");
       } else {
-        Serial.print("░");
+        LOG_PRINT(EMOTION, INFO, "░");
       }
     }
-    Serial.print("] ");
-    Serial.print(value, 2);
+    LOG_PRINT(EMOTION, INFO, "] ");
+    LOG_PRINT(EMOTION, INFO, value, 2);
   }
 };
 
@@ -7,6 +7,7 @@
 
 #include "Emotion.h"
 #include "BehaviorSelection.h"
+#include "Log.h"
 
 struct Episode {
   // Context
@@ -89,9 +90,9 @@ public:
     }
     
     if (ep.salience > 0.7) {
-      Serial.print("[EPISODIC] Memorable experience recorded (salience: ");
-      Serial.print(ep.salience, 2);
-      Serial.println(")");
+      LOG_PRINT(MEMORY, INFO, "[EPISODIC] Memorable experience recorded (salience: ");
+      LOG_PRINT(MEMORY, INFO, ep.salience, 2);
+      LOG_PRINTLN(MEMORY, INFO, ")");
     }
   }
   
@@ -170,9 +171,9 @@ public:
       lastRecalledIndex = bestMatch;
       lastRecallTime = millis();
       
-      Serial.print("[EPISODIC] Recalled similar experience (similarity: ");
-      Serial.print(bestSimilarity, 2);
-      Serial.println(")");
+      LOG_PRINT(MEMORY, DEBUG, "[EPISODIC] Recalled similar experience (similarity: ");
+      LOG_PRINT(MEMORY, DEBUG, bestSimilarity, 2);
+      LOG_PRINTLN(MEMORY, DEBUG, ")");
       
       return bestMatch;
     }
@@ -202,11 +203,11 @@ public:
       recalled = episodes[bestIndex];
       episodes[bestIndex].recallCount++;
       
-      Serial.print("[EPISODIC] Recalled best ");
-      Serial.print(behaviorToString(behavior));
-      Serial.print(" experience (outcome: ");
-      Serial.print(bestOutcome, 2);
-      Serial.println(")");
+      LOG_PRINT(MEMORY, DEBUG, "[EPISODIC] Recalled best ");
+      LOG_PRINT(MEMORY, DEBUG, behaviorToString(behavior));
+      LOG_PRINT(MEMORY, DEBUG, " experience (outcome: ");
+      LOG_PRINT(MEMORY, DEBUG, bestOutcome, 2);
+      LOG_PRINTLN(MEMORY, DEBUG, ")");
       
       return bestIndex;
     }
@@ -232,11 +233,11 @@ public:
       recalled = episodes[worstIndex];
       episodes[worstIndex].recallCount++;
       
-      Serial.print("[EPISODIC] Recalled worst ");
-      Serial.print(behaviorToString(behavior));
-      Serial.print(" experience (outcome: ");
-      Serial.print(worstOutcome, 2);
-      Serial.println(")");
+      LOG_PRINT(MEMORY, DEBUG, "[EPISODIC] Recalled worst ");
+      LOG_PRINT(MEMORY, DEBUG, behaviorToString(behavior));
+      LOG_PRINT(MEMORY, DEBUG, " experience (outcome: ");
+      LOG_PRINT(MEMORY, DEBUG, worstOutcome, 2);
+      LOG_PRINTLN(MEMORY, DEBUG, ")");
       
       return worstIndex;
     }
@@ -265,11 +266,11 @@ public:
       recalled = episodes[mostIntenseIndex];
       episodes[mostIntenseIndex].recallCount++;
       
-      Serial.print("[EPISODIC] Recalled intense ");
-      Serial.print(emotionToString(recalled.emotion));
-      Serial.print(" memory (salience: ");
-      Serial.print(highestSalience, 2);
-      Serial.println(")");
+      LOG_PRINT(MEMORY, DEBUG, "[EPISODIC] Recalled intense ");
+      LOG_PRINT(MEMORY, DEBUG, emotionToString(recalled.emotion));
+      LOG_PRINT(MEMORY, DEBUG, " memory (salience: ");
+      LOG_PRINT(MEMORY, DEBUG, highestSalience, 2);
+      LOG_PRINTLN(MEMORY, DEBUG, ")");
       
       return mostIntenseIndex;
     }
@@ -359,18 +360,18 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- EPISODIC MEMORY ---");
-    Serial.print("  Episodes stored: ");
-    Serial.print(episodeCount);
-    Serial.print(" / ");
-    Serial.println(MAX_EPISODES);
+    LOG_PRINTLN(MEMORY, INFO, "--- EPISODIC MEMORY ---");
+    LOG_PRINT(MEMORY, INFO, "  Episodes stored: ");
+    LOG_PRINT(MEMORY, INFO, episodeCount);
+    LOG_PRINT(MEMORY, INFO, " / ");
+    LOG_PRINTLN(MEMORY, INFO, MAX_EPISODES);
     
     if (episodeCount == 0) {
-      Serial.println("  No experiences recorded yet");
+      LOG_PRINTLN(MEMORY, INFO, "  No experiences recorded yet");
       return;
     }
     
-    Serial.println("\n  Recent memorable experiences:");
+    LOG_PRINTLN(MEMORY, INFO, "\n  Recent memorable experiences:");
     
     // Show 5 most salient
     for (int shown = 0; shown < 5 && shown < episodeCount; shown++) {
@@ -393,37 +394,37 @@ public:
         Episode& ep = episodes[mostSalient];
         unsigned long age = (millis() - ep.timestamp) / 1000;
         
-        Serial.print("    [");
-        Serial.print(age);
-        Serial.print("s ago] ");
-        Serial.print(behaviorToString(ep.behavior));
-        Serial.print(" → ");
-        Serial.print(emotionToString(ep.emotion));
-        Serial.print(" (outcome:");
-        Serial.print(ep.outcome, 1);
-        Serial.print(" sal:");
-        Serial.print(ep.salience, 2);
-        Serial.println(")");
+        LOG_PRINT(MEMORY, INFO, "    [");
+        LOG_PRINT(MEMORY, INFO, age);
+        LOG_PRINT(MEMORY, INFO, "s ago] ");
+        LOG_PRINT(MEMORY, INFO, behaviorToString(ep.behavior));
+        LOG_PRINT(MEMORY, INFO, " → ");
+        LOG_PRINT(MEMORY, INFO, emotionToString(ep.emotion));
+        LOG_PRINT(MEMORY, INFO, " (outcome:");
+        LOG_PRINT(MEMORY, INFO, ep.outcome, 1);
+        LOG_PRINT(MEMORY, INFO, " sal:");
+        LOG_PRINT(MEMORY, INFO, ep.salience, 2);
+        LOG_PRINTLN(MEMORY, INFO, ")");
       }
     }
     
-    Serial.print("\n  Social episodes: ");
-    Serial.println(countSocialEpisodes());
+    LOG_PRINT(MEMORY, INFO, "\n  Social episodes: ");
+    LOG_PRINTLN(MEMORY, INFO, countSocialEpisodes());
     
-    Serial.print("  Last recall: ");
+    LOG_PRINT(MEMORY, INFO, "  Last recall: ");
     if (lastRecalledIndex >= 0) {
-      Serial.print((millis() - lastRecallTime) / 1000);
-      Serial.println("s ago");
+      LOG_PRINT(MEMORY, INFO, (millis() - lastRecallTime) / 1000);
+      LOG_PRINTLN(MEMORY, INFO, "s ago");
     } else {
-      Serial.println("never");
+      LOG_PRINTLN(MEMORY, INFO, "never");
     }
   }
   
   void printCompact() {
-    Serial.print("  [MEMORY] Episodes:");
-    Serial.print(episodeCount);
-    Serial.print(" Social:");
-    Serial.println(countSocialEpisodes());
+    LOG_PRINT(MEMORY, INFO, "  [MEMORY] Episodes:");
+    LOG_PRINT(MEMORY, INFO, episodeCount);
+    LOG_PRINT(MEMORY, INFO, " Social:");
+    LOG_PRINTLN(MEMORY, INFO, countSocialEpisodes());
   }
   
   const char* behaviorToString(Behavior b) {
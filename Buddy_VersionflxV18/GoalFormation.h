@@ -8,6 +8,7 @@
 #include "BehaviorSelection.h"
 #include "Emotion.h"
 #include "Personality.h"
+#include "Log.h"
 
 // Forward declaration for memory integration
 class EpisodicMemory;
@@ -132,7 +133,7 @@ public:
       previousGoal = currentGoal;
       previousGoal.wasAbandoned = true;
       
-      Serial.println("[GOAL] Abandoning previous goal for new intention");
+      LOG_PRINTLN(GOALS, INFO, "[GOAL] Abandoning previous goal for new intention");
     }
     
     currentGoal = Goal();  // Reset
@@ -148,37 +149,37 @@ public:
       case GOAL_INVESTIGATE_THOROUGHLY:
         currentGoal.stepsRequired = 3;
         currentGoal.urgency = 0.7;
-        Serial.println("[GOAL FORMED] Investigate thoroughly");
+        LOG_PRINTLN(GOALS, INFO, "[GOAL FORMED] Investigate thoroughly");
         break;
         
       case GOAL_SEEK_SOCIAL:
         currentGoal.stepsRequired = 4;
         currentGoal.urgency = 0.8;
-        Serial.println("[GOAL FORMED] Seek social interaction");
+        LOG_PRINTLN(GOALS, INFO, "[GOAL FORMED] Seek social interaction");
         break;
         
       case GOAL_EXPLORE_AREA:
         currentGoal.stepsRequired = 5;
         currentGoal.urgency = 0.6;
-        Serial.println("[GOAL FORMED] Explore area");
+        LOG_PRINTLN(GOALS, INFO, "[GOAL FORMED] Explore area");
         break;
         
       case GOAL_UNDERSTAND_PATTERN:
         currentGoal.stepsRequired = 6;
         currentGoal.urgency = 0.7;
-        Serial.println("[GOAL FORMED] Understand pattern");
+        LOG_PRINTLN(GOALS, INFO, "[GOAL FORMED] Understand pattern");
         break;
         
       case GOAL_EXPERIMENT:
         currentGoal.stepsRequired = 3;
         currentGoal.urgency = 0.5;
-        Serial.println("[GOAL FORMED] Experiment");
+        LOG_PRINTLN(GOALS, INFO, "[GOAL FORMED] Experiment");
         break;
         
       case GOAL_REST_FULLY:
         currentGoal.stepsRequired = 2;
         currentGoal.urgency = 0.9;
-        Serial.println("[GOAL FORMED] Rest fully");
+        LOG_PRINTLN(GOALS, INFO, "[GOAL FORMED] Rest fully");
         break;
         
       default:
@@ -195,12 +196,12 @@ public:
     lastGoalFormation = millis();
     consecutiveFailures = 0;
     
-    Serial.print("  Target: dir ");
-    Serial.print(direction);
-    Serial.print(", dist ");
-    Serial.print(distance, 0);
-    Serial.print("cm, steps ");
-    Serial.println(currentGoal.stepsRequired);
+    LOG_PRINT(GOALS, INFO, "  Target: dir ");
+    LOG_PRINT(GOALS, INFO, direction);
+    LOG_PRINT(GOALS, INFO, ", dist ");
+    LOG_PRINT(GOALS, INFO, distance, 0);
+    LOG_PRINT(GOALS, INFO, "cm, steps ");
+    LOG_PRINTLN(GOALS, INFO, currentGoal.stepsRequired);
   }
   
   // ============================================
@@ -217,7 +218,7 @@ public:
     // Check if pursuing goal for too long
     unsigned long goalAge = millis() - currentGoal.startTime;
     if (goalAge > 60000) {  // 1 minute max
-      Serial.println("[GOAL] Timeout - abandoning goal");
+      LOG_PRINTLN(GOALS, INFO, "[GOAL] Timeout - abandoning goal");
       abandonGoal();
       return originalChoice;
     }
@@ -258,7 +259,7 @@ public:
     
     // With low persistence, might abandon goal
     if (personality.getPersistence() < 0.4 && random(100) < 30) {
-      Serial.println("[GOAL] Low persistence - considering abandonment");
+      LOG_PRINTLN(GOALS, INFO, "[GOAL] Low persistence - considering abandonment");
       return originalChoice;  // Don't force it
     }
     
@@ -307,13 +308,13 @@ public:
         currentGoal.stepsCompleted++;
         currentGoal.progress = (float)currentGoal.stepsCompleted / currentGoal.stepsRequired;
         
-        Serial.print("[GOAL PROGRESS] Step ");
-        Serial.print(currentGoal.stepsCompleted);
-        Serial.print("/");
-        Serial.print(currentGoal.stepsRequired);
-        Serial.print(" (");
-        Serial.print(currentGoal.progress * 100, 0);
-        Serial.println("%)");
+        LOG_PRINT(GOALS, DEBUG, "[GOAL PROGRESS] Step ");
+        LOG_PRINT(GOALS, DEBUG, currentGoal.stepsCompleted);
+        LOG_PRINT(GOALS, DEBUG, "/");
+        LOG_PRINT(GOALS, DEBUG, currentGoal.stepsRequired);
+        LOG_PRINT(GOALS, DEBUG, " (");
+        LOG_PRINT(GOALS, DEBUG, currentGoal.progress * 100, 0);
+        LOG_PRINTLN(GOALS, DEBUG, "%)");
         
         consecutiveFailures = 0;
         
@@ -324,12 +325,12 @@ public:
       } else {
         // Poor outcome
         consecutiveFailures++;
-        Serial.print("[GOAL] Poor outcome (failures: ");
-        Serial.print(consecutiveFailures);
-        Serial.println(")");
+        LOG_PRINT(GOALS, DEBUG, "[GOAL] Poor outcome (failures: ");
+        LOG_PRINT(GOALS, DEBUG, consecutiveFailures);
+        LOG_PRINTLN(GOALS, DEBUG, ")");
         
         if (consecutiveFailures >= 3) {
-          Serial.println("[GOAL] Too many failures - abandoning");
+          LOG_PRINTLN(GOALS, DEBUG, "[GOAL] Too many failures - abandoning");
           abandonGoal();
         }
       }
@@ -343,15 +344,15 @@ public:
     
     unsigned long duration = (millis() - currentGoal.startTime) / 1000;
     
-    Serial.println("\n[GOAL COMPLETE] ✓");
-    Serial.print("  Type: ");
-    Serial.println(goalTypeToString(currentGoal.type));
-    Serial.print("  Duration: ");
-    Serial.print(duration);
-    Serial.println(" seconds");
-    Serial.print("  Steps: ");
-    Serial.print(currentGoal.stepsCompleted);
-    Serial.println("\n");
+    LOG_PRINTLN(GOALS, INFO, "\n[GOAL COMPLETE] ✓");
+    LOG_PRINT(GOALS, INFO, "  Type: ");
+    LOG_PRINTLN(GOALS, INFO, goalTypeToString(currentGoal.type));
+    LOG_PRINT(GOALS, INFO, "  Duration: ");
+    LOG_PRINT(GOALS, INFO, duration);
+    LOG_PRINTLN(GOALS, INFO, " seconds");
+    LOG_PRINT(GOALS, INFO, "  Steps: ");
+    LOG_PRINT(GOALS, INFO, currentGoal.stepsCompleted);
+    LOG_PRINTLN(GOALS, INFO, "\n");
     
     // PACKAGE 2: Record as memorable episode
     if (episodicMemory != nullptr) {
@@ -367,7 +368,7 @@ public:
         1.0     // Excellent outcome (goal completed!)
       );
       
-      Serial.println("[MEMORY] Goal achievement recorded as memorable episode");
+      LOG_PRINTLN(GOALS, INFO, "[MEMORY] Goal achievement recorded as memorable episode");
     }
   }
   
@@ -375,7 +376,7 @@ public:
     currentGoal.wasAbandoned = true;
     currentGoal.isActive = false;
     
-    Serial.println("[GOAL] Abandoned (new priorities emerged)");
+    LOG_PRINTLN(GOALS, INFO, "[GOAL] Abandoned (new priorities emerged)");
     
     // PACKAGE 2: Record as low-salience negative episode
     if (episodicMemory != nullptr) {
@@ -390,7 +391,7 @@ public:
         0.3     // Poor outcome (abandoned)
       );
       
-      Serial.println("[MEMORY] Goal abandonment recorded");
+      LOG_PRINTLN(GOALS, INFO, "[MEMORY] Goal abandonment recorded");
     }
     
     // Reset failure counter
@@ -406,7 +407,7 @@ public:
     
     // High urgency can interrupt
     if (urgency > currentGoal.urgency + 0.3) {
-      Serial.println("[GOAL] Interrupted by urgent need");
+      LOG_PRINTLN(GOALS, INFO, "[GOAL] Interrupted by urgent need");
       return true;
     }
     
@@ -436,42 +437,42 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- GOAL FORMATION ---");
+    LOG_PRINTLN(GOALS, INFO, "--- GOAL FORMATION ---");
     
     if (currentGoal.isActive) {
-      Serial.println("  ACTIVE GOAL:");
-      Serial.print("    Type: ");
-      Serial.println(goalTypeToString(currentGoal.type));
-      Serial.print("    Progress: ");
-      Serial.print(currentGoal.progress * 100, 0);
-      Serial.print("% (");
-      Serial.print(currentGoal.stepsCompleted);
-      Serial.print("/");
-      Serial.print(currentGoal.stepsRequired);
-      Serial.println(")");
-      Serial.print("    Urgency: ");
-      Serial.println(currentGoal.urgency, 2);
-      Serial.print("    Age: ");
-      Serial.print((millis() - currentGoal.startTime) / 1000);
-      Serial.println(" seconds");
+      LOG_PRINTLN(GOALS, INFO, "  ACTIVE GOAL:");
+      LOG_PRINT(GOALS, INFO, "    Type: ");
+      LOG_PRINTLN(GOALS, INFO, goalTypeToString(currentGoal.type));
+      LOG_PRINT(GOALS, INFO, "    Progress: ");
+      LOG_PRINT(GOALS, INFO, currentGoal.progress * 100, 0);
+      LOG_PRINT(GOALS, INFO, "% (");
+      LOG_PRINT(GOALS, INFO, currentGoal.stepsCompleted);
+      LOG_PRINT(GOALS, INFO, "/");
+      LOG_PRINT(GOALS, INFO, currentGoal.stepsRequired);
+      LOG_PRINTLN(GOALS, INFO, ")");
+      LOG_PRINT(GOALS, INFO, "    Urgency: ");
+      LOG_PRINTLN(GOALS, INFO, currentGoal.urgency, 2);
+      LOG_PRINT(GOALS, INFO, "    Age: ");
+      LOG_PRINT(GOALS, INFO, (millis() - currentGoal.startTime) / 1000);
+      LOG_PRINTLN(GOALS, INFO, " seconds");
     } else {
-      Serial.println("  No active goal");
+      LOG_PRINTLN(GOALS, INFO, "  No active goal");
     }
     
     if (previousGoal.wasAbandoned) {
-      Serial.println("\n  Previous goal: ABANDONED");
-      Serial.print("    Was: ");
-      Serial.println(goalTypeToString(previousGoal.type));
+      LOG_PRINTLN(GOALS, INFO, "\n  Previous goal: ABANDONED");
+      LOG_PRINT(GOALS, INFO, "    Was: ");
+      LOG_PRINTLN(GOALS, INFO, goalTypeToString(previousGoal.type));
     }
   }
   
   void printCompact() {
     if (currentGoal.isActive) {
-      Serial.print("  [GOAL] ");
-      Serial.print(goalTypeToString(currentGoal.type));
-      Serial.print(" (");
-      Serial.print(currentGoal.progress * 100, 0);
-      Serial.println("%)");
+      LOG_PRINT(GOALS, INFO, "  [GOAL] ");
+      LOG_PRINT(GOALS, INFO, goalTypeToString(currentGoal.type));
+      LOG_PRINT(GOALS, INFO, " (");
+      LOG_PRINT(GOALS, INFO, currentGoal.progress * 100, 0);
+      LOG_PRINTLN(GOALS, INFO, "%)");
     }
   }
   
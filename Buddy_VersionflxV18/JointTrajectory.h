@@ -0,0 +1,213 @@
+/**
+ * JointTrajectory.h - Velocity/acceleration-limited joint profiles
+ *
+ * Motion limits used to live in three unrelated places: the reflex's
+ * MAX_VELOCITY_PER_FRAME, smoothMoveTo's step counts and the fixed step
+ * list in GentleTrajectory. None of them bounded acceleration, so a
+ * retarget or a snap asked the servo for an instant change of velocity —
+ * that is where the overshoot and the current spikes came from.
+ *
+ * JointProfile drives one joint within its JointLimits (BodySchema.h):
+ *
+ *   PROFILE_MIN_JERK   quintic from the current position, velocity and
+ *                      acceleration to rest at the target. The duration is
+ *                      the caller's, stretched until the peaks fit:
+ *                        peak v = 1.875 d/T    peak a = 5.774 d/T²
+ *   PROFILE_TRAPEZOID  online: accelerate at aMax toward a cruise speed,
+ *                      brake at aMax to stop on the target. Cruise speed
+ *                      is chosen so a rest-to-rest move takes the
+ *                      caller's duration (never more than vMax).
+ *
+ * moveTo() while a profile is running starts the new one from the state
+ * the joint is in at that moment, so re-targeting mid-motion keeps
+ * velocity (and for min-jerk, acceleration) continuous.
+ *
+ * Time is millis(); the profile does no I/O. MotionEngine (moves and
+ * clips), PoseCompositor (the tracking override) and the reflex's
+ * GentleTrajectory each own the profiles they drive.
+ */
+
+#ifndef JOINT_TRAJECTORY_H
+#define JOINT_TRAJECTORY_H
+
+#include <Arduino.h>
+
+struct JointLimits {
+  float minDeg;
+  float maxDeg;
+  float vMax;      // deg/s
+  float aMax;      // deg/s²
+};
+
+enum JointProfileType : uint8_t { PROFILE_MIN_JERK, PROFILE_TRAPEZOID };
+
+class JointProfile {
+public:
+  JointProfile()
+    : type(PROFILE_MIN_JERK), moving(false), pos(0.0f), vel(0.0f), acc(0.0f),
+      target(0.0f), vCap(0.0f), startedAt(0), lastAt(0), T(0.0f) {
+    limits.minDeg = 0.0f;
+    limits.maxDeg = 180.0f;
+    limits.vMax = 360.0f;
+    limits.aMax = 3000.0f;
+  }
+
+  void setLimits(const JointLimits& l) { limits = l; }
+
+  // At rest at pos (drops any profile in progress)
+  void reset(float p, unsigned long now) {
+    pos = constrain(p, limits.minDeg, limits.maxDeg);
+    target = pos;
+    vel = 0.0f;
+    acc = 0.0f;
+    moving = false;
+    lastAt = now;
+  }
+
+  // New target; minMs is the shortest the move may take (0 = as fast as
+  // the limits allow). Continues from the joint's state at now
+  void moveTo(float goal, JointProfileType profile, unsigned long minMs, unsigned long now) {
+    sample(now);
+    goal = constrain(goal, limits.minDeg, limits.maxDeg);
+    float d = goal - pos;
+    float dist = fabs(d);
+
+    type = profile;
+    target = goal;
+    startedAt = now;
+    lastAt = now;
+
+    if (dist < 0.01f && fabs(vel) < 0.5f) {
+      pos = goal;
+      vel = 0.0f;
+      acc = 0.0f;
+      moving = false;
+      return;
+    }
+    moving = true;
+
+    float minSec = minMs / 1000.0f;
+    if (type == PROFILE_MIN_JERK) {
+      // Time to fit the peaks, plus time to cancel velocity pointing away
+      float t = max(1.875f * dist / limits.vMax, sqrtf(5.774f * dist / limits.aMax));
+      if (vel * d < 0.0f) t += fabs(vel) / limits.aMax;
+      T = max(t, minSec);
+      p0 = pos;
+      v0 = vel;
+      a0 = acc;
+
+      // From a moving start the closed-form peaks no longer hold: stretch
+      // until the sampled peaks fit (rest-to-rest fits first time)
+      for (int i = 0; i < 4; i++) {
+        solve(d);
+        float over = peakRatio();
+        if (over <= 1.02f) break;
+        T *= (over > 1.5f) ? sqrtf(over) : over;
+      }
+    } else {
+      // Cruise speed for a rest-to-rest trapezoid lasting minSec:
+      // T = d/v + v/a  →  v = (aT − √(a²T² − 4ad)) / 2
+      float a = limits.aMax;
+      float disc = a * a * minSec * minSec - 4.0f * a * dist;
+      vCap = (minSec > 0.0f && disc > 0.0f) ? (a * minSec - sqrtf(disc)) / 2.0f : limits.vMax;
+      vCap = constrain(vCap, 1.0f, limits.vMax);
+    }
+  }
+
+  // Advance to now and return the position
+  float sample(unsigned long now) {
+    if (!moving) {
+      lastAt = now;
+      return pos;
+    }
+
+    if (type == PROFILE_MIN_JERK) {
+      float t = (now - startedAt) / 1000.0f;
+      if (t >= T) {
+        pos = target;
+        vel = 0.0f;
+        acc = 0.0f;
+        moving = false;
+      } else {
+        float t2 = t * t;
+        pos = p0 + v0 * t + 0.5f * a0 * t2 + (c3 + (c4 + c5 * t) * t) * t2 * t;
+        vel = v0 + a0 * t + (3.0f * c3 + (4.0f * c4 + 5.0f * c5 * t) * t) * t2;
+        acc = a0 + (6.0f * c3 + (12.0f * c4 + 20.0f * c5 * t) * t) * t;
+      }
+    } else {
+      // Integrate in slices of at most 5 ms so a late call stays stable
+      unsigned long elapsed = now - lastAt;
+      while (elapsed > 0 && moving) {
+        unsigned long slice = min(elapsed, 5UL);
+        trapezoidStep(slice / 1000.0f);
+        elapsed -= slice;
+      }
+    }
+    lastAt = now;
+    return pos;
+  }
+
+  bool isMoving() const { return moving; }
+  float position() const { return pos; }
+  float velocity() const { return vel; }
+  float getTarget() const { return target; }
+
+private:
+  JointLimits limits;
+  JointProfileType type;
+  bool moving;
+  float pos, vel, acc;
+  float target;
+  float vCap;                  // Trapezoid cruise speed
+  unsigned long startedAt;
+  unsigned long lastAt;
+  float T;                     // Min-jerk duration (s)
+  float p0, v0, a0;            // Min-jerk start state
+  float c3, c4, c5;            // Min-jerk coefficients
+
+  void solve(float d) {
+    float T2 = T * T;
+    float T3 = T2 * T;
+    c3 = (20.0f * d - 12.0f * v0 * T - 3.0f * a0 * T2) / (2.0f * T3);
+    c4 = (-30.0f * d + 16.0f * v0 * T + 3.0f * a0 * T2) / (2.0f * T3 * T);
+    c5 = (12.0f * d - 6.0f * v0 * T - a0 * T2) / (2.0f * T3 * T2);
+  }
+
+  // Largest of peak |v|/vMax and peak |a|/aMax over the segment (after
+  // the start, whose state is given)
+  float peakRatio() const {
+    float worst = 0.0f;
+    for (int i = 1; i <= 16; i++) {
+      float t = T * i / 16.0f;
+      float t2 = t * t;
+      float v = v0 + a0 * t + (3.0f * c3 + (4.0f * c4 + 5.0f * c5 * t) * t) * t2;
+      float a = a0 + (6.0f * c3 + (12.0f * c4 + 20.0f * c5 * t) * t) * t;
+      worst = max(worst, max(fabs(v) / limits.vMax, fabs(a) / limits.aMax));
+    }
+    return worst;
+  }
+
+  void trapezoidStep(float dt) {
+    float d = target - pos;
+    float aStep = limits.aMax * dt;
+
+    // Close enough and slow enough to stop within one step
+    if (fabs(d) < 0.05f && fabs(vel) <= aStep) {
+      pos = target;
+      vel = 0.0f;
+      acc = 0.0f;
+      moving = false;
+      return;
+    }
+
+    // Fastest speed that can still brake to a stop on the target
+    float vStop = sqrtf(2.0f * limits.aMax * fabs(d));
+    float vWant = (d > 0.0f ? 1.0f : -1.0f) * min(vCap, vStop);
+    float dv = constrain(vWant - vel, -aStep, aStep);
+    acc = dv / dt;
+    vel += dv;
+    pos += vel * dt;
+  }
+};
+
+#endif // JOINT_TRAJECTORY_H
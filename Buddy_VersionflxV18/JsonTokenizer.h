@@ -0,0 +1,284 @@
+/**
+ * JsonTokenizer.h - Fixed-capacity, non-allocating JSON tokenizer
+ *
+ * The vision handlers used to pull each key out with its own strstr over
+ * the whole payload — a 10-key message was scanned ten times, and a key
+ * name that also appeared inside a string value (a scene description
+ * quoting "novelty", say) could be matched in the wrong place.
+ *
+ * jsonTokenize() makes one pass over the text and fills a caller-supplied
+ * token array (jsmn-style): each token records its type, its span in the
+ * original text and its parent, nothing is copied or allocated. Object
+ * members are key tokens whose parent is the object; a key's value is the
+ * next token.
+ *
+ * jsonBind() then walks the top-level keys once and stores the values of
+ * the keys named in a static schema straight into a struct:
+ *
+ *   struct Update { int faces; char expr[16]; };
+ *   static const JsonField UPDATE_FIELDS[] = {
+ *     JSON_INT_FIELD(Update, faces, "faces"),
+ *     JSON_STR_FIELD(Update, expr, "expr"),
+ *   };
+ *   uint32_t found = jsonBind(js, tokens, n, UPDATE_FIELDS,
+ *                             JSON_FIELD_COUNT(UPDATE_FIELDS), &update);
+ *
+ * Keys match exactly; unknown keys and nested values are skipped; a field
+ * whose key is missing or whose value has the wrong type keeps the value
+ * already in the struct, so defaults are set before binding. The returned
+ * bitmask has bit i set for every field i that was stored.
+ *
+ * No Arduino dependency: host/json_fuzz.cpp builds this file on Linux for
+ * fuzzing and benchmarking.
+ */
+
+#ifndef JSON_TOKENIZER_H
+#define JSON_TOKENIZER_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define JSON_MAX_TOKENS 64   // !VISION context with 3 objects uses 40 (640 B of stack)
+
+enum JsonType : uint8_t {
+  JSON_UNDEFINED,
+  JSON_OBJECT,
+  JSON_ARRAY,
+  JSON_STRING,      // Span excludes the quotes, escapes left in place
+  JSON_PRIMITIVE    // Number, true, false, null
+};
+
+enum JsonError : int8_t {
+  JSON_ERROR_NOMEM   = -1,   // More tokens than the array holds
+  JSON_ERROR_INVALID = -2,   // Malformed text
+  JSON_ERROR_PARTIAL = -3    // Text ended inside a value
+};
+
+struct JsonToken {
+  JsonType type;
+  int16_t start;     // Offset of first char
+  int16_t end;       // Offset one past the last char (-1 while open)
+  int16_t size;      // Members of an object / elements of an array, 1 for a key
+  int16_t parent;    // Index of enclosing token, -1 for the root
+};
+
+// ============================================================================
+// TOKENIZER
+// ============================================================================
+
+// Count a new token as a child of super; a key takes exactly one value
+inline bool jsonAddValue(JsonToken* tokens, int super) {
+  if (super == -1) return true;
+  if (tokens[super].type == JSON_STRING && tokens[super].size != 0) return false;
+  tokens[super].size++;
+  return true;
+}
+
+// Returns the number of tokens used, or a JsonError.
+// Input is limited to 32767 chars so spans fit the int16 fields.
+inline int jsonTokenize(const char* js, int len, JsonToken* tokens, int maxTokens) {
+  if (len > 32767) return JSON_ERROR_NOMEM;
+
+  int next = 0;        // Next free token
+  int super = -1;      // Container or key the next value belongs to
+
+  for (int pos = 0; pos < len && js[pos] != '\0'; pos++) {
+    char c = js[pos];
+
+    switch (c) {
+      case '{':
+      case '[': {
+        if (next >= maxTokens) return JSON_ERROR_NOMEM;
+        // Objects and arrays can't be keys
+        if (super != -1 && tokens[super].type == JSON_OBJECT) return JSON_ERROR_INVALID;
+        if (!jsonAddValue(tokens, super)) return JSON_ERROR_INVALID;
+        JsonToken& t = tokens[next];
+        t.type = (c == '{') ? JSON_OBJECT : JSON_ARRAY;
+        t.start = pos;
+        t.end = -1;
+        t.size = 0;
+        t.parent = super;
+        super = next++;
+        break;
+      }
+
+      case '}':
+      case ']': {
+        JsonType type = (c == '}') ? JSON_OBJECT : JSON_ARRAY;
+        if (next < 1) return JSON_ERROR_INVALID;
+        if (super != -1 && tokens[super].type == JSON_STRING) {
+          if (tokens[super].size == 0) return JSON_ERROR_INVALID;   // Key without a value
+          super = tokens[super].parent;
+        }
+        // Innermost token still open must be the matching container
+        int i = next - 1;
+        while (i != -1 && !(tokens[i].start != -1 && tokens[i].end == -1)) {
+          i = tokens[i].parent;
+        }
+        if (i == -1 || tokens[i].type != type) return JSON_ERROR_INVALID;
+        tokens[i].end = pos + 1;
+        super = tokens[i].parent;
+        break;
+      }
+
+      case '"': {
+        int start = pos + 1;
+        for (pos = start; pos < len && js[pos] != '\0' && js[pos] != '"'; pos++) {
+          if (js[pos] == '\\') {
+            pos++;
+            if (pos >= len || js[pos] == '\0') return JSON_ERROR_PARTIAL;
+          }
+        }
+        if (pos >= len || js[pos] != '"') return JSON_ERROR_PARTIAL;
+        if (next >= maxTokens) return JSON_ERROR_NOMEM;
+        if (!jsonAddValue(tokens, super)) return JSON_ERROR_INVALID;
+        JsonToken& t = tokens[next++];
+        t.type = JSON_STRING;
+        t.start = start;
+        t.end = pos;
+        t.size = 0;
+        t.parent = super;
+        break;
+      }
+
+      case ':':
+        // Only the string just read directly inside the open object is a key
+        if (next < 1 || super == -1 || tokens[super].type != JSON_OBJECT ||
+            tokens[next - 1].type != JSON_STRING || tokens[next - 1].parent != super) {
+          return JSON_ERROR_INVALID;
+        }
+        super = next - 1;
+        break;
+
+      case ',':
+        // Back from the key to its object
+        if (super != -1 && tokens[super].type == JSON_STRING) {
+          if (tokens[super].size == 0) return JSON_ERROR_INVALID;   // Key without a value
+          super = tokens[super].parent;
+        }
+        break;
+
+      case ' ':
+      case '\t':
+      case '\r':
+      case '\n':
+        break;
+
+      default: {
+        if (!(c == '-' || (c >= '0' && c <= '9') || c == 't' || c == 'f' || c == 'n')) {
+          return JSON_ERROR_INVALID;
+        }
+        // Primitives are values, never keys
+        if (super != -1 && tokens[super].type == JSON_OBJECT) return JSON_ERROR_INVALID;
+        int start = pos;
+        while (pos < len && js[pos] != '\0' && js[pos] != ',' && js[pos] != ']' &&
+               js[pos] != '}' && js[pos] != ' ' && js[pos] != '\t' &&
+               js[pos] != '\r' && js[pos] != '\n' && js[pos] != ':') {
+          if ((uint8_t)js[pos] < 32 || js[pos] == '"') return JSON_ERROR_INVALID;
+          pos++;
+        }
+        if (next >= maxTokens) return JSON_ERROR_NOMEM;
+        if (!jsonAddValue(tokens, super)) return JSON_ERROR_INVALID;
+        JsonToken& t = tokens[next++];
+        t.type = JSON_PRIMITIVE;
+        t.start = start;
+        t.end = pos;
+        t.size = 0;
+        t.parent = super;
+        pos--;   // Delimiter is handled by the next iteration
+        break;
+      }
+    }
+  }
+
+  for (int i = 0; i < next; i++) {
+    if (tokens[i].end == -1) return JSON_ERROR_PARTIAL;
+  }
+  return next;
+}
+
+// ============================================================================
+// SCHEMA BINDING
+// ============================================================================
+
+enum JsonFieldType : uint8_t {
+  JSON_FIELD_INT,      // int; accepts numbers, true (1), false (0)
+  JSON_FIELD_FLOAT,    // float
+  JSON_FIELD_STR       // char[size], truncated, escapes decoded
+};
+
+struct JsonField {
+  const char* key;
+  JsonFieldType type;
+  uint16_t offset;     // offsetof() into the destination struct
+  uint16_t size;       // JSON_FIELD_STR: buffer size including the NUL
+};
+
+#define JSON_INT_FIELD(S, member, key)    { key, JSON_FIELD_INT, (uint16_t)offsetof(S, member), 0 }
+#define JSON_FLOAT_FIELD(S, member, key)  { key, JSON_FIELD_FLOAT, (uint16_t)offsetof(S, member), 0 }
+#define JSON_STR_FIELD(S, member, key)    \
+  { key, JSON_FIELD_STR, (uint16_t)offsetof(S, member), (uint16_t)sizeof(((S*)nullptr)->member) }
+#define JSON_FIELD_COUNT(fields)          (uint8_t)(sizeof(fields) / sizeof(fields[0]))
+
+inline bool jsonTokenEquals(const char* js, const JsonToken& t, const char* s) {
+  int n = t.end - t.start;
+  return strncmp(js + t.start, s, n) == 0 && s[n] == '\0';
+}
+
+// Copy a string token into out (size includes the NUL), decoding simple escapes
+inline void jsonCopyString(const char* js, const JsonToken& t, char* out, int size) {
+  int o = 0;
+  for (int i = t.start; i < t.end && o < size - 1; i++) {
+    char c = js[i];
+    if (c == '\\' && i + 1 < t.end) {
+      c = js[++i];
+      if (c == 'n') c = '\n';
+      else if (c == 't') c = '\t';
+      else if (c == 'r') c = '\r';
+      else if (c == 'u') { c = '?'; i += 4; }   // No unicode on this side
+    }
+    out[o++] = c;
+  }
+  out[o] = '\0';
+}
+
+inline uint32_t jsonBind(const char* js, const JsonToken* tokens, int count,
+                         const JsonField* fields, uint8_t fieldCount, void* out) {
+  uint32_t found = 0;
+  if (count < 1 || tokens[0].type != JSON_OBJECT) return 0;
+
+  for (int i = 1; i + 1 < count; i++) {
+    // Keys are the root object's direct children; their value follows
+    if (tokens[i].parent != 0 || tokens[i].size != 1) continue;
+    const JsonToken& value = tokens[i + 1];
+
+    for (uint8_t f = 0; f < fieldCount && f < 32; f++) {
+      const JsonField& field = fields[f];
+      if (!jsonTokenEquals(js, tokens[i], field.key)) continue;
+
+      uint8_t* dst = (uint8_t*)out + field.offset;
+      if (field.type == JSON_FIELD_STR) {
+        if (value.type != JSON_STRING) break;
+        jsonCopyString(js, value, (char*)dst, field.size);
+      } else {
+        if (value.type != JSON_PRIMITIVE) break;
+        const char* v = js + value.start;
+        if (*v == 'n') break;   // null keeps the default
+        if (field.type == JSON_FIELD_INT) {
+          int n = (*v == 't') ? 1 : (*v == 'f') ? 0 : (int)strtol(v, nullptr, 10);
+          memcpy(dst, &n, sizeof(n));
+        } else {
+          float x = (*v == 't') ? 1.0f : (*v == 'f') ? 0.0f : strtof(v, nullptr);
+          memcpy(dst, &x, sizeof(x));
+        }
+      }
+      found |= (uint32_t)1 << f;
+      break;
+    }
+  }
+  return found;
+}
+
+#endif // JSON_TOKENIZER_H
@@ -8,6 +8,7 @@
 #include <EEPROM.h>
 #include "Personality.h"
 #include "BehaviorSelection.h"
+#include "Log.h"
 
 // EEPROM memory map (Teensy 4.0 has 1080 bytes)
 #define EEPROM_MAGIC 0xBEEF
@@ -117,9 +118,9 @@ public:
         mediumWeights[i] = constrain(mediumWeights[i], -0.3, 0.3);
       }
       
-      Serial.print("[LEARNING] Consolidated weights (quality: ");
-      Serial.print(sessionQuality, 2);
-      Serial.println(")");
+      LOG_PRINT(LEARNING, INFO, "[LEARNING] Consolidated weights (quality: ");
+      LOG_PRINT(LEARNING, INFO, sessionQuality, 2);
+      LOG_PRINTLN(LEARNING, INFO, ")");
     }
   }
   
@@ -190,12 +191,12 @@ public:
     // Write to EEPROM
     EEPROM.put(EEPROM_START_ADDR, data);
     
-    Serial.println("[EEPROM] State saved");
-    Serial.print("  Sessions: ");
-    Serial.println(data.totalSessions);
-    Serial.print("  Uptime: ");
-    Serial.print(data.totalUptime);
-    Serial.println(" seconds");
+    LOG_PRINTLN(LEARNING, INFO, "[EEPROM] State saved");
+    LOG_PRINT(LEARNING, INFO, "  Sessions: ");
+    LOG_PRINTLN(LEARNING, INFO, data.totalSessions);
+    LOG_PRINT(LEARNING, INFO, "  Uptime: ");
+    LOG_PRINT(LEARNING, INFO, data.totalUptime);
+    LOG_PRINTLN(LEARNING, INFO, " seconds");
   }
   
   void loadFromEEPROM(Personality& personality, BehaviorSelection& behaviorSelector) {
@@ -204,17 +205,17 @@ public:
     
     // Validate
     if (data.magic != EEPROM_MAGIC) {
-      Serial.println("[EEPROM] No valid data found, using defaults");
+      LOG_PRINTLN(LEARNING, WARN, "[EEPROM] No valid data found, using defaults");
       return;
     }
     
     uint16_t calculatedChecksum = calculateChecksum((uint8_t*)&data, sizeof(PersistentData) - 2);
     if (data.checksum != calculatedChecksum) {
-      Serial.println("[EEPROM] Checksum mismatch, data may be corrupted");
+      LOG_PRINTLN(LEARNING, ERROR, "[EEPROM] Checksum mismatch, data may be corrupted");
       return;
     }
     
-    Serial.println("[EEPROM] Loading saved state...");
+    LOG_PRINTLN(LEARNING, INFO, "[EEPROM] Loading saved state...");
     
     // Restore personality
     personality.setCuriosity(data.curiosity);
@@ -233,19 +234,19 @@ public:
     // Restore statistics
     sessionCount = data.totalSessions + 1;  // Increment
     
-    Serial.println("[EEPROM] State restored");
-    Serial.print("  Previous sessions: ");
-    Serial.println(data.totalSessions);
-    Serial.print("  Total uptime: ");
-    Serial.print(data.totalUptime);
-    Serial.println(" seconds");
+    LOG_PRINTLN(LEARNING, INFO, "[EEPROM] State restored");
+    LOG_PRINT(LEARNING, INFO, "  Previous sessions: ");
+    LOG_PRINTLN(LEARNING, INFO, data.totalSessions);
+    LOG_PRINT(LEARNING, INFO, "  Total uptime: ");
+    LOG_PRINT(LEARNING, INFO, data.totalUptime);
+    LOG_PRINTLN(LEARNING, INFO, " seconds");
   }
   
   void clearEEPROM() {
     PersistentData data;
     data.magic = 0;  // Invalidate
     EEPROM.put(EEPROM_START_ADDR, data);
-    Serial.println("[EEPROM] Memory cleared");
+    LOG_PRINTLN(LEARNING, INFO, "[EEPROM] Memory cleared");
   }
   
   // ============================================
@@ -283,48 +284,48 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- LEARNING STATE ---");
-    Serial.print("  Session: ");
-    Serial.println(sessionCount);
-    Serial.print("  Session uptime: ");
-    Serial.print((millis() - sessionStart) / 1000);
-    Serial.println(" seconds");
+    LOG_PRINTLN(LEARNING, INFO, "--- LEARNING STATE ---");
+    LOG_PRINT(LEARNING, INFO, "  Session: ");
+    LOG_PRINTLN(LEARNING, INFO, sessionCount);
+    LOG_PRINT(LEARNING, INFO, "  Session uptime: ");
+    LOG_PRINT(LEARNING, INFO, (millis() - sessionStart) / 1000);
+    LOG_PRINTLN(LEARNING, INFO, " seconds");
     
-    Serial.println("\n  Fast Weights (session-only):");
+    LOG_PRINTLN(LEARNING, INFO, "\n  Fast Weights (session-only):");
     for (int i = 0; i < 8; i++) {
       if (abs(fastWeights[i]) > 0.01) {
-        Serial.print("    Behavior ");
-        Serial.print(i);
-        Serial.print(": ");
-        Serial.println(fastWeights[i], 3);
+        LOG_PRINT(LEARNING, INFO, "    Behavior ");
+        LOG_PRINT(LEARNING, INFO, i);
+        LOG_PRINT(LEARNING, INFO, ": ");
+        LOG_PRINTLN(LEARNING, INFO, fastWeights[i], 3);
       }
     }
     
-    Serial.println("\n  Medium Weights (accumulated):");
+    LOG_PRINTLN(LEARNING, INFO, "\n  Medium Weights (accumulated):");
     for (int i = 0; i < 8; i++) {
       if (abs(mediumWeights[i]) > 0.01) {
-        Serial.print("    Behavior ");
-        Serial.print(i);
-        Serial.print(": ");
-        Serial.println(mediumWeights[i], 3);
+        LOG_PRINT(LEARNING, INFO, "    Behavior ");
+        LOG_PRINT(LEARNING, INFO, i);
+        LOG_PRINT(LEARNING, INFO, ": ");
+        LOG_PRINTLN(LEARNING, INFO, mediumWeights[i], 3);
       }
     }
     
-    Serial.print("\n  Recent outcome average: ");
-    Serial.println(getAverageRecentOutcome(), 2);
+    LOG_PRINT(LEARNING, INFO, "\n  Recent outcome average: ");
+    LOG_PRINTLN(LEARNING, INFO, getAverageRecentOutcome(), 2);
     
     // NEW: Show learning effectiveness
-    Serial.print("  Learning rates: fast=");
-    Serial.print(fastDecayRate, 2);
-    Serial.print(", medium=");
-    Serial.println(mediumLearningRate, 3);
+    LOG_PRINT(LEARNING, INFO, "  Learning rates: fast=");
+    LOG_PRINT(LEARNING, INFO, fastDecayRate, 2);
+    LOG_PRINT(LEARNING, INFO, ", medium=");
+    LOG_PRINTLN(LEARNING, INFO, mediumLearningRate, 3);
     
-    Serial.print("  Total outcomes recorded: ");
+    LOG_PRINT(LEARNING, INFO, "  Total outcomes recorded: ");
     int recordedCount = 0;
     for (int i = 0; i < 10; i++) {
       if (recentOutcomes[i].timestamp > 0) recordedCount++;
     }
-    Serial.println(recordedCount);
+    LOG_PRINTLN(LEARNING, INFO, recordedCount);
   }
 };
 
@@ -0,0 +1,138 @@
+/**
+ * Log.h - Compile-time log levels per module
+ *
+ * Debug output used to be switched at runtime (verboseMode, logOutput,
+ * DEBUG_LEARNING, throttled static timers), so every message's string
+ * literal and branch stayed in flash and on the hot path even when
+ * nothing was printed.
+ *
+ * Each module now has a level fixed at compile time:
+ *
+ *   LOG_PRINT(REFLEX, DEBUG, "Err: ");
+ *   LOG_PRINTLN(REFLEX, DEBUG, error, 1);
+ *
+ * expands to  if (LOG_LEVEL_REFLEX >= LOG_LEVEL_DEBUG) Serial.print(...)
+ * — a constant condition, so a disabled statement is removed entirely,
+ * arguments are never evaluated and its literals never reach flash.
+ * LOG_ENABLED(module, level) guards whole blocks (loops, throttle timers).
+ *
+ * Levels:
+ *   ERROR  something is broken (EEPROM corrupt, sensor dead)
+ *   WARN   degraded but running (stuck loops, sensor timeouts)
+ *   INFO   state changes worth seeing + on-demand diagnostic dumps
+ *   DEBUG  per-decision chatter (scores, expressions, animation steps)
+ *   TRACE  per-control-period output (every servo write)
+ *
+ * Override before including anything, e.g. at the top of the .ino:
+ *   #define LOG_LEVEL LOG_LEVEL_WARN          // everything
+ *   #define LOG_LEVEL_SELECTION LOG_LEVEL_DEBUG   // one module
+ *
+ * Runtime switches (verboseMode, logOutput, 'g') still work, but only
+ * for statements the compile-time level kept.
+ *
+ * host/: `make size` builds the sketch at every level, `make looptime`
+ * prints the per-task run times at one (LOG_LEVEL=WARN make looptime).
+ */
+
+#ifndef LOG_H
+#define LOG_H
+
+#include <Arduino.h>
+
+#define LOG_LEVEL_OFF    0
+#define LOG_LEVEL_ERROR  1
+#define LOG_LEVEL_WARN   2
+#define LOG_LEVEL_INFO   3
+#define LOG_LEVEL_DEBUG  4
+#define LOG_LEVEL_TRACE  5
+
+#ifndef LOG_OUTPUT
+#define LOG_OUTPUT Serial
+#endif
+
+// Default for every module not set explicitly
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// ============================================================================
+// MODULE LEVELS
+// ============================================================================
+
+#ifndef LOG_LEVEL_ANIM
+#define LOG_LEVEL_ANIM LOG_LEVEL          // AnimationController, PoseLibrary
+#endif
+#ifndef LOG_LEVEL_ATTENTION
+#define LOG_LEVEL_ATTENTION LOG_LEVEL     // AttentionSystem
+#endif
+#ifndef LOG_LEVEL_BEHAVIOR
+#define LOG_LEVEL_BEHAVIOR LOG_LEVEL      // BehaviorEngine
+#endif
+#ifndef LOG_LEVEL_BODY
+#define LOG_LEVEL_BODY LOG_LEVEL          // BodySchema
+#endif
+#ifndef LOG_LEVEL_CONSCIOUS
+#define LOG_LEVEL_CONSCIOUS LOG_LEVEL     // ConsciousnessLayer
+#endif
+#ifndef LOG_LEVEL_EMOTION
+#define LOG_LEVEL_EMOTION LOG_LEVEL       // Emotion
+#endif
+#ifndef LOG_LEVEL_EXPRESSION
+#define LOG_LEVEL_EXPRESSION LOG_LEVEL    // MovementExpression
+#endif
+#ifndef LOG_LEVEL_GOALS
+#define LOG_LEVEL_GOALS LOG_LEVEL         // GoalFormation
+#endif
+#ifndef LOG_LEVEL_ILLUSION
+#define LOG_LEVEL_ILLUSION LOG_LEVEL      // IllusionLayer
+#endif
+#ifndef LOG_LEVEL_LEARNING
+#define LOG_LEVEL_LEARNING LOG_LEVEL      // Learning, OutcomeCalculator, EEPROM
+#endif
+#ifndef LOG_LEVEL_MEMORY
+#define LOG_LEVEL_MEMORY LOG_LEVEL        // EpisodicMemory
+#endif
+#ifndef LOG_LEVEL_MOVEMENT
+#define LOG_LEVEL_MOVEMENT LOG_LEVEL      // MovementStyle
+#endif
+#ifndef LOG_LEVEL_NEEDS
+#define LOG_LEVEL_NEEDS LOG_LEVEL         // Needs
+#endif
+#ifndef LOG_LEVEL_PERSONALITY
+#define LOG_LEVEL_PERSONALITY LOG_LEVEL   // Personality
+#endif
+#ifndef LOG_LEVEL_RANGE
+#define LOG_LEVEL_RANGE LOG_LEVEL         // Ultrasonic helpers
+#endif
+#ifndef LOG_LEVEL_REFLEX
+#define LOG_LEVEL_REFLEX LOG_LEVEL        // ReflexiveControl
+#endif
+#ifndef LOG_LEVEL_SCAN
+#define LOG_LEVEL_SCAN LOG_LEVEL          // ScanningSystem
+#endif
+#ifndef LOG_LEVEL_SELECTION
+#define LOG_LEVEL_SELECTION LOG_LEVEL     // BehaviorSelection
+#endif
+#ifndef LOG_LEVEL_SERVO
+#define LOG_LEVEL_SERVO LOG_LEVEL         // ServoController
+#endif
+#ifndef LOG_LEVEL_SOUND
+#define LOG_LEVEL_SOUND LOG_LEVEL         // droidSpeak
+#endif
+#ifndef LOG_LEVEL_SPATIAL
+#define LOG_LEVEL_SPATIAL LOG_LEVEL       // SpatialMemory
+#endif
+
+// ============================================================================
+// MACROS
+// ============================================================================
+
+#define LOG_ENABLED(module, level) (LOG_LEVEL_##module >= LOG_LEVEL_##level)
+
+#define LOG_PRINT(module, level, ...) \
+  do { if (LOG_ENABLED(module, level)) LOG_OUTPUT.print(__VA_ARGS__); } while (0)
+
+#define LOG_PRINTLN(module, level, ...) \
+  do { if (LOG_ENABLED(module, level)) LOG_OUTPUT.println(__VA_ARGS__); } while (0)
+
+#endif // LOG_H
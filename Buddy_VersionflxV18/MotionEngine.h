@@ -0,0 +1,189 @@
+/**
+ * MotionEngine.h - Time-stepped servo trajectories
+ *
+ * ServoController::smoothMoveTo used to run its whole interpolation in a
+ * for loop: up to 40 steps with delay(style.delayMs) between them, plus
+ * random hesitation pauses. For as long as two seconds nothing else ran:
+ * no vision intake, no reflex tracking, no command replies.
+ *
+ * MotionEngine holds the move that is in progress instead. Each axis is a
+ * JointProfile (JointTrajectory.h) within its BodySchema limits, so no
+ * move asks a servo for more speed or acceleration than the joint allows:
+ *
+ *   duration    steps × stepMs from MovementStyleParams, as before;
+ *               stretched if the distance would break vMax/aMax
+ *   profile     min-jerk for smooth styles and SMOOTH/CUBIC, trapezoid
+ *               for mechanical styles and LINEAR
+ *   retarget    a move started while one runs continues from the
+ *               joints' current velocity — no jolt
+ *
+ * The step schedule stays for the style's character: at each step
+ * boundary the move may hesitate (the profile's clock stops for
+ * hesitation × 150 ms) or jitter (± jitterMax on that step's output).
+ *
+ * The engine does no I/O. ServoController::startMove() fills in a
+ * MotionTrajectory, and ServoController::updateMotion() writes what
+ * update() returns.
+ */
+
+#ifndef MOTION_ENGINE_H
+#define MOTION_ENGINE_H
+
+#include <Arduino.h>
+#include "BodySchema.h"
+#include "JointTrajectory.h"
+
+enum MotionAxis : uint8_t { AXIS_BASE, AXIS_NOD, AXIS_TILT, MOTION_AXES };
+
+#define MOTION_ALL_AXES  0x07
+
+// Profile of one move; STYLE picks it from the style's smoothness
+enum MotionEase : uint8_t { MOTION_EASE_STYLE, MOTION_EASE_LINEAR, MOTION_EASE_SMOOTH, MOTION_EASE_CUBIC };
+
+// Mechanical safe range per axis (BodySchema joint limits)
+constexpr int MOTION_AXIS_MIN[MOTION_AXES] = {
+  (int)BODY_JOINT_LIMITS[AXIS_BASE].minDeg, (int)BODY_JOINT_LIMITS[AXIS_NOD].minDeg,
+  (int)BODY_JOINT_LIMITS[AXIS_TILT].minDeg
+};
+constexpr int MOTION_AXIS_MAX[MOTION_AXES] = {
+  (int)BODY_JOINT_LIMITS[AXIS_BASE].maxDeg, (int)BODY_JOINT_LIMITS[AXIS_NOD].maxDeg,
+  (int)BODY_JOINT_LIMITS[AXIS_TILT].maxDeg
+};
+
+struct MotionTrajectory {
+  int start[MOTION_AXES];
+  int target[MOTION_AXES];
+  uint8_t axisMask;      // Bit per MotionAxis this move drives
+  uint8_t steps;         // Steps of the style's schedule
+  uint8_t stepMs;        // Time per step
+  uint8_t jitterChance;  // % of steps that get jitter (0 = none)
+  uint8_t jitterMax;     // ± degrees
+  MotionEase ease;
+  float smoothness;      // Picks the profile for MOTION_EASE_STYLE
+  float hesitation;      // > 0.3: steps may pause for hesitation * 150 ms
+};
+
+// Smooth styles get minimum jerk; direct, mechanical ones a trapezoid
+inline JointProfileType motionProfileFor(MotionEase ease, float smoothness) {
+  if (ease == MOTION_EASE_LINEAR) return PROFILE_TRAPEZOID;
+  if (ease == MOTION_EASE_SMOOTH || ease == MOTION_EASE_CUBIC) return PROFILE_MIN_JERK;
+  return smoothness > 0.5f ? PROFILE_MIN_JERK : PROFILE_TRAPEZOID;
+}
+
+// ============================================================================
+// ENGINE
+// ============================================================================
+
+class MotionEngine {
+public:
+  MotionEngine() : busy(false), nextStepAt(0), shiftMs(0), pauseStart(0), pauseMs(0) {
+    for (int a = 0; a < MOTION_AXES; a++) {
+      joint[a].setLimits(BODY_JOINT_LIMITS[a]);
+      jitterOffset[a] = 0;
+    }
+  }
+
+  void start(const MotionTrajectory& trajectory, unsigned long now) {
+    endPause(now);
+    unsigned long t = profileClock(now);
+
+    traj = trajectory;
+    if (traj.steps < 1) traj.steps = 1;
+    unsigned long minMs = (unsigned long)traj.steps * traj.stepMs;
+    JointProfileType type = motionProfileFor(traj.ease, traj.smoothness);
+
+    for (int a = 0; a < MOTION_AXES; a++) {
+      jitterOffset[a] = 0;
+      if (!(traj.axisMask & (1 << a))) continue;
+      // A move that interrupts a move carries its velocity on
+      if (!busy || !joint[a].isMoving()) joint[a].reset(traj.start[a], t);
+      joint[a].moveTo(traj.target[a], type, minMs, t);
+    }
+    nextStepAt = now + traj.stepMs;
+    busy = true;
+  }
+
+  // Drop the move where it is (the last written position stands)
+  void cancel() { busy = false; }
+
+  bool isBusy() const { return busy; }
+  uint8_t axisMask() const { return traj.axisMask; }
+  int target(MotionAxis axis) const { return traj.target[axis]; }
+
+  // Positions for now; false if no move is running.
+  // The move ends exactly on the target.
+  bool update(unsigned long now, int out[MOTION_AXES]) {
+    if (!busy) return false;
+
+    // Step boundaries roll hesitation and jitter, like the old loop did;
+    // steps that fell behind are merged into one roll
+    if ((long)(now - nextStepAt) >= 0) {
+      while ((long)(now - nextStepAt) >= 0) nextStepAt += traj.stepMs;
+
+      bool jitter = traj.jitterChance > 0 && random(100) < traj.jitterChance;
+      for (int a = 0; a < MOTION_AXES; a++) {
+        jitterOffset[a] = jitter ? random(-(int)traj.jitterMax, (int)traj.jitterMax + 1) : 0;
+      }
+
+      if (pauseMs == 0 && traj.hesitation > 0.3f &&
+          random(100) < (long)(traj.hesitation * 20.0f)) {
+        pauseStart = now;
+        pauseMs = (unsigned long)(traj.hesitation * 150.0f);
+        nextStepAt = now + pauseMs + traj.stepMs;
+      }
+    }
+
+    unsigned long t = profileClock(now);
+    bool moving = false;
+    for (int a = 0; a < MOTION_AXES; a++) {
+      if (!(traj.axisMask & (1 << a))) {
+        out[a] = traj.start[a];
+        continue;
+      }
+      int pos = (int)lroundf(joint[a].sample(t));
+      if (joint[a].isMoving()) {
+        moving = true;
+        pos += jitterOffset[a];
+      }
+      out[a] = constrain(pos, MOTION_AXIS_MIN[a], MOTION_AXIS_MAX[a]);
+    }
+
+    if (!moving) {
+      for (int a = 0; a < MOTION_AXES; a++) {
+        out[a] = constrain(traj.target[a], MOTION_AXIS_MIN[a], MOTION_AXIS_MAX[a]);
+      }
+      busy = false;
+    }
+    return true;
+  }
+
+private:
+  MotionTrajectory traj;
+  JointProfile joint[MOTION_AXES];
+  int8_t jitterOffset[MOTION_AXES];   // This step's jitter
+  bool busy;
+  unsigned long nextStepAt;   // millis() of the next step boundary
+  unsigned long shiftMs;      // Hesitation time taken out of the profiles' clock
+  unsigned long pauseStart;   // Hesitation in progress (pauseMs 0 = none)
+  unsigned long pauseMs;
+
+  // The profiles' clock: millis() less the hesitations, frozen during one
+  unsigned long profileClock(unsigned long now) {
+    if (pauseMs > 0) {
+      if ((long)(now - (pauseStart + pauseMs)) < 0) return pauseStart - shiftMs;
+      shiftMs += pauseMs;
+      pauseMs = 0;
+    }
+    return now - shiftMs;
+  }
+
+  // A new move does not inherit the old one's hesitation
+  void endPause(unsigned long now) {
+    if (pauseMs == 0) return;
+    unsigned long held = now - pauseStart;
+    shiftMs += min(held, pauseMs);
+    pauseMs = 0;
+  }
+};
+
+#endif // MOTION_ENGINE_H
@@ -0,0 +1,109 @@
+/**
+ * MotionLut.h - Compile-time sine and easing tables for animation math
+ *
+ * Breathing, the AI THINKING/SPEAKING loops, the wondering gazes and the
+ * layer fades each evaluated sin() (double on this toolchain, since the
+ * arguments were doubles) every tick. libm's cost depends on the argument
+ * — range reduction grows with it, and millis()-based arguments only grow.
+ *
+ * These tables are built by the compiler (constexpr Taylor series, no
+ * libm at run time) and read with linear interpolation: one floor, two
+ * loads and a multiply-add, the same for every call.
+ *
+ *   lutSinTurns(turns)        sin(2π × turns), any real phase
+ *   lutSin(rad) / lutCos(rad) the usual argument in radians
+ *   lutSinPeriod(ms, period)  sin of a clock: the phase is taken with an
+ *                             integer modulo, so it stays exact however
+ *                             long the robot has been running
+ *   lutEase(u)                minimum-jerk ease 10u³ − 15u⁴ + 6u⁵, u in 0..1
+ *
+ * Error with MOTION_LUT_SIZE 256 (host/motion_lut.cpp checks it against
+ * libm): sine ≤ 7.6e-5, ease ≤ 1.2e-5 — far below one servo microsecond.
+ */
+
+#ifndef MOTION_LUT_H
+#define MOTION_LUT_H
+
+#include <math.h>
+#include <stdint.h>
+
+#define MOTION_LUT_SIZE  256   // Segments per table (one guard entry on top)
+
+struct MotionLut {
+  float v[MOTION_LUT_SIZE + 1];
+};
+
+// ============================================================================
+// TABLE GENERATION (compile time)
+// ============================================================================
+
+constexpr double MOTION_LUT_PI = 3.14159265358979323846;
+
+// Taylor series on [-π/2, π/2] after folding; 13 terms reach double precision
+constexpr double motionLutSin(double x) {
+  while (x > MOTION_LUT_PI) x -= 2.0 * MOTION_LUT_PI;
+  while (x < -MOTION_LUT_PI) x += 2.0 * MOTION_LUT_PI;
+  if (x > MOTION_LUT_PI / 2.0) x = MOTION_LUT_PI - x;
+  if (x < -MOTION_LUT_PI / 2.0) x = -MOTION_LUT_PI - x;
+
+  double term = x;
+  double sum = x;
+  for (int n = 1; n <= 13; n++) {
+    term *= -x * x / ((2.0 * n) * (2.0 * n + 1.0));
+    sum += term;
+  }
+  return sum;
+}
+
+constexpr double motionLutMinJerk(double u) {
+  return u * u * u * (10.0 + u * (-15.0 + 6.0 * u));
+}
+
+constexpr MotionLut makeSineLut() {
+  MotionLut t = {};
+  for (int i = 0; i <= MOTION_LUT_SIZE; i++) {
+    t.v[i] = (float)motionLutSin(2.0 * MOTION_LUT_PI * i / MOTION_LUT_SIZE);
+  }
+  return t;
+}
+
+constexpr MotionLut makeMinJerkLut() {
+  MotionLut t = {};
+  for (int i = 0; i <= MOTION_LUT_SIZE; i++) {
+    t.v[i] = (float)motionLutMinJerk((double)i / MOTION_LUT_SIZE);
+  }
+  return t;
+}
+
+constexpr MotionLut SINE_LUT = makeSineLut();
+constexpr MotionLut EASE_MINJERK_LUT = makeMinJerkLut();
+
+// ============================================================================
+// LOOKUP
+// ============================================================================
+
+// Table value at u × MOTION_LUT_SIZE, u in [0, 1]
+inline float motionLutRead(const MotionLut& lut, float u) {
+  float x = u * MOTION_LUT_SIZE;
+  int i = (int)x;
+  if (i >= MOTION_LUT_SIZE) return lut.v[MOTION_LUT_SIZE];
+  if (i < 0) return lut.v[0];
+  return lut.v[i] + (lut.v[i + 1] - lut.v[i]) * (x - i);
+}
+
+inline float lutSinTurns(float turns) {
+  return motionLutRead(SINE_LUT, turns - floorf(turns));
+}
+
+inline float lutSin(float rad) { return lutSinTurns(rad * (float)(0.5 / MOTION_LUT_PI)); }
+inline float lutCos(float rad) { return lutSinTurns(rad * (float)(0.5 / MOTION_LUT_PI) + 0.25f); }
+
+inline float lutSinPeriod(unsigned long ms, unsigned long periodMs) {
+  return motionLutRead(SINE_LUT, (float)(ms % periodMs) / (float)periodMs);
+}
+
+inline float lutEase(float u) {
+  return motionLutRead(EASE_MINJERK_LUT, u);
+}
+
+#endif // MOTION_LUT_H
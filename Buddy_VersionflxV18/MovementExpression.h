@@ -10,6 +10,8 @@
 #include "Needs.h"
 #include "ServoController.h"
 #include "MovementStyle.h"
+#include "ClipLibrary.h"
+#include "Log.h"
 
 enum ExpressionType {
   EXPRESS_AGREEMENT,      // Varied agreement (not just nodding!)
@@ -55,9 +57,6 @@ public:
     
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
     
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
     // Choose varied agreement based on emotion and personality
     int choice = random(0, 4);
     
@@ -67,55 +66,10 @@ public:
     }
     recordExpression(EXPRESS_AGREEMENT);
     
-    Serial.print("[EXPRESSION] Agreement ");
-    
-    switch(choice) {
-      case 0: {
-        // Single confident nod (RARE - only 25% of time)
-        Serial.println("→ Confident nod");
-        Pose down(currentBase, currentNod + 20, currentTilt);
-        servos.smoothMoveTo(down.base, down.nod, down.tilt, style);
-        delay(180);
-        
-        Pose up(currentBase, currentNod - 3, currentTilt);
-        servos.smoothMoveTo(up.base, up.nod, up.tilt, style);
-        break;
-      }
-      
-      case 1: {
-        // Side tilt (head cocked, understanding)
-        Serial.println("→ Understanding tilt");
-        int tiltDir = random(0, 2) == 0 ? -1 : 1;
-        Pose tilt(currentBase, currentNod + 5, currentTilt + 25 * tiltDir);
-        servos.smoothMoveTo(tilt.base, tilt.nod, tilt.tilt, style);
-        delay(400);
-        
-        Pose back(currentBase, currentNod, currentTilt);
-        servos.smoothMoveTo(back.base, back.nod, back.tilt, style);
-        break;
-      }
-      
-      case 2: {
-        // Lean in (engaged)
-        Serial.println("→ Leaning in");
-        Pose lean(currentBase, currentNod + 15, currentTilt - 10);
-        servos.smoothMoveTo(lean.base, lean.nod, lean.tilt, style);
-        delay(300);
-        
-        Pose back(currentBase, currentNod + 5, currentTilt);
-        servos.smoothMoveTo(back.base, back.nod, back.tilt, style);
-        break;
-      }
-      
-      case 3: {
-        // Subtle body language (minimal movement, confident)
-        Serial.println("→ Subtle acknowledgment");
-        Pose subtle(currentBase + random(-5, 6), currentNod + 3, currentTilt - 5);
-        servos.smoothMoveTo(subtle.base, subtle.nod, subtle.tilt, style);
-        delay(200);
-        break;
-      }
-    }
+    // 0 confident nod (rare), 1 understanding tilt, 2 lean in, 3 subtle acknowledgment
+    LOG_PRINT(EXPRESSION, DEBUG, "[EXPRESSION] Agreement → ");
+    LOG_PRINTLN(EXPRESSION, DEBUG, CLIPS_AGREEMENT[choice].name);
+    clipPlayer.play(CLIPS_AGREEMENT[choice], servos, style);
   }
   
   // ============================================
@@ -138,33 +92,33 @@ public:
     // Command one curiosity pose and return immediately
     // ═══════════════════════════════════════════════════════════════
     int choice = random(0, 3);
-    Serial.print("[EXPRESSION] Curiosity ");
+    LOG_PRINT(EXPRESSION, DEBUG, "[EXPRESSION] Curiosity ");
 
     switch(choice) {
       case 0: {
         // Inquisitive tilt + lean
-        Serial.println("→ Inquisitive lean");
+        LOG_PRINTLN(EXPRESSION, DEBUG, "→ Inquisitive lean");
         int tiltDir = random(0, 2) == 0 ? -1 : 1;
         Pose inquiry(currentBase, currentNod + 12, currentTilt + 30 * tiltDir);
-        servos.smoothMoveTo(inquiry.base, inquiry.nod, inquiry.tilt, style);
+        servos.startMove(inquiry.base, inquiry.nod, inquiry.tilt, style);
         // REMOVED: delay(600) and return movement - non-blocking design
         break;
       }
 
       case 1: {
         // Slight turn + study
-        Serial.println("→ Study turn");
+        LOG_PRINTLN(EXPRESSION, DEBUG, "→ Study turn");
         Pose turn(currentBase + random(-20, 20), currentNod + 10, currentTilt - 15);
-        servos.smoothMoveTo(turn.base, turn.nod, turn.tilt, style);
+        servos.startMove(turn.base, turn.nod, turn.tilt, style);
         // REMOVED: delay(500), adjust movement, delay(300), and return - non-blocking
         break;
       }
 
       case 2: {
         // Peek and inspect
-        Serial.println("→ Peek behavior");
+        LOG_PRINTLN(EXPRESSION, DEBUG, "→ Peek behavior");
         Pose peek(currentBase + random(-15, 15), currentNod + 18, currentTilt - 20);
-        servos.smoothMoveTo(peek.base, peek.nod, peek.tilt, style);
+        servos.startMove(peek.base, peek.nod, peek.tilt, style);
         // REMOVED: delay(400) and return movement - non-blocking design
         break;
       }
@@ -179,29 +133,14 @@ public:
                          Personality& personality, Needs& needs) {
     
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
-    style.speed *= 1.4;  // Faster for excitement
-    
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
     
     if (wasRecentlyUsed(EXPRESS_EXCITEMENT)) return;
     recordExpression(EXPRESS_EXCITEMENT);
     
-    Serial.println("[EXPRESSION] Excitement → Bouncy movement");
-    
-    // Quick bouncy sequence
-    for (int i = 0; i < 2; i++) {
-      Pose up(currentBase + random(-10, 10), currentNod + 15, currentTilt - 10);
-      servos.smoothMoveTo(up.base, up.nod, up.tilt, style);
-      delay(100);
-      
-      Pose down(currentBase + random(-10, 10), currentNod - 5, currentTilt + 5);
-      servos.smoothMoveTo(down.base, down.nod, down.tilt, style);
-      delay(100);
-    }
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[EXPRESSION] Excitement → Bouncy movement");
     
-    Pose settle(currentBase, currentNod + 5, currentTilt);
-    servos.smoothMoveTo(settle.base, settle.nod, settle.tilt, style);
+    // Quick bouncy sequence (clip runs at 140% speed)
+    clipPlayer.play(CLIP_EXCITEMENT, servos, style);
   }
   
   // ============================================
@@ -224,24 +163,24 @@ public:
     // PERFORMANCE: Simplified non-blocking expression
     // ═══════════════════════════════════════════════════════════════
     int choice = random(0, 2);
-    Serial.print("[EXPRESSION] Contemplation ");
+    LOG_PRINT(EXPRESSION, DEBUG, "[EXPRESSION] Contemplation ");
 
     switch(choice) {
       case 0: {
         // Slow turn away
-        Serial.println("→ Thoughtful turn");
+        LOG_PRINTLN(EXPRESSION, DEBUG, "→ Thoughtful turn");
         int turnDir = random(0, 2) == 0 ? -1 : 1;
         Pose away(currentBase + 25 * turnDir, currentNod + 5, currentTilt + 10 * turnDir);
-        servos.smoothMoveTo(away.base, away.nod, away.tilt, style);
+        servos.startMove(away.base, away.nod, away.tilt, style);
         // REMOVED: delay(700) and return movement - non-blocking design
         break;
       }
 
       case 1: {
         // Lower gaze
-        Serial.println("→ Pensive gaze");
+        LOG_PRINTLN(EXPRESSION, DEBUG, "→ Pensive gaze");
         Pose down(currentBase, currentNod - 8, currentTilt + 5);
-        servos.smoothMoveTo(down.base, down.nod, down.tilt, style);
+        servos.startMove(down.base, down.nod, down.tilt, style);
         // REMOVED: delay(800) and lift movement - non-blocking design
         break;
       }
@@ -257,54 +196,14 @@ public:
     
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
     
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
     if (wasRecentlyUsed(EXPRESS_AFFECTION)) return;
     recordExpression(EXPRESS_AFFECTION);
     
+    // 0 gentle sway, 1 warm tilt, 2 settle near
     int choice = random(0, 3);
-    Serial.print("[EXPRESSION] Affection ");
-    
-    switch(choice) {
-      case 0: {
-        // Gentle sway
-        Serial.println("→ Gentle sway");
-        Pose left(currentBase - 8, currentNod + 3, currentTilt + 10);
-        servos.smoothMoveTo(left.base, left.nod, left.tilt, style);
-        delay(300);
-        
-        Pose right(currentBase + 8, currentNod + 3, currentTilt - 10);
-        servos.smoothMoveTo(right.base, right.nod, right.tilt, style);
-        delay(300);
-        
-        Pose center(currentBase, currentNod, currentTilt);
-        servos.smoothMoveTo(center.base, center.nod, center.tilt, style);
-        break;
-      }
-      
-      case 1: {
-        // Soft tilt toward
-        Serial.println("→ Warm tilt");
-        int tiltDir = random(0, 2) == 0 ? -1 : 1;
-        Pose tilt(currentBase, currentNod + 8, currentTilt + 20 * tiltDir);
-        servos.smoothMoveTo(tilt.base, tilt.nod, tilt.tilt, style);
-        delay(500);
-        
-        Pose back(currentBase, currentNod, currentTilt);
-        servos.smoothMoveTo(back.base, back.nod, back.tilt, style);
-        break;
-      }
-      
-      case 2: {
-        // Settle closer
-        Serial.println("→ Settle near");
-        Pose close(currentBase, currentNod + 10, currentTilt - 5);
-        servos.smoothMoveTo(close.base, close.nod, close.tilt, style);
-        delay(400);
-        break;
-      }
-    }
+    LOG_PRINT(EXPRESSION, DEBUG, "[EXPRESSION] Affection → ");
+    LOG_PRINTLN(EXPRESSION, DEBUG, CLIPS_AFFECTION[choice].name);
+    clipPlayer.play(CLIPS_AFFECTION[choice], servos, style);
   }
   
   // ============================================
@@ -320,59 +219,14 @@ public:
     
     lastQuirk = now;
     
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
-    Serial.print("[QUIRK] Personality signature #");
-    Serial.println(quirkType);
+    LOG_PRINT(EXPRESSION, DEBUG, "[QUIRK] Personality signature #");
+    LOG_PRINTLN(EXPRESSION, DEBUG, quirkType);
     
-    // Each Buddy develops a preferred quirk
-    switch(quirkType) {
-      case 0: {
-        // "The Thinker" - touches "chin" (nods down, tilts)
-        Pose think(currentBase, currentNod + 15, currentTilt + 20);
-        servos.snapTo(think.base, think.nod, think.tilt);
-        delay(600);
-        
-        Pose up(currentBase, currentNod, currentTilt);
-        servos.snapTo(up.base, up.nod, up.tilt);
-        break;
-      }
-      
-      case 1: {
-        // "The Watcher" - quick turn and hold
-        int dir = random(0, 2) == 0 ? -1 : 1;
-        Pose watch(currentBase + 30 * dir, currentNod + 10, currentTilt - 10 * dir);
-        servos.snapTo(watch.base, watch.nod, watch.tilt);
-        delay(500);
-        
-        Pose back(currentBase, currentNod, currentTilt);
-        servos.snapTo(back.base, back.nod, back.tilt);
-        break;
-      }
-      
-      case 2: {
-        // "The Wobbler" - subtle side-to-side
-        for (int i = 0; i < 3; i++) {
-          Pose wobble(currentBase + random(-5, 6), currentNod, 
-                      currentTilt + random(-8, 8));
-          servos.snapTo(wobble.base, wobble.nod, wobble.tilt);
-          delay(200);
-        }
-        break;
-      }
-      
-      case 3: {
-        // "The Stargazer" - looks up periodically
-        Pose up(currentBase, currentNod + 25, currentTilt);
-        servos.snapTo(up.base, up.nod, up.tilt);
-        delay(700);
-        
-        Pose down(currentBase, currentNod, currentTilt);
-        servos.snapTo(down.base, down.nod, down.tilt);
-        break;
-      }
-    }
+    // Each Buddy develops a preferred quirk: 0 thinker (chin touch),
+    // 1 watcher (turn and hold), 2 wobbler (side-to-side), 3 stargazer.
+    // Quirk frames are snapped, so the style only has to exist.
+    MovementStyleParams style = {};
+    clipPlayer.play(CLIPS_QUIRK[quirkType], servos, style);
   }
   
   // ============================================
@@ -392,12 +246,14 @@ public:
     Pose windup(
       currentBase + baseDir * 8,
       currentNod + nodDir * 5,
-      currentTilt + random(-5, 5)
+      currentTilt
     );
     
-    Serial.println("[ANTICIPATION] Subtle windup");
-    servos.snapTo(windup.base, windup.nod, windup.tilt);
-    delay(100);
+    // Snap there (tilt ±5) and hold 100 ms; a clip played next follows it
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[ANTICIPATION] Subtle windup");
+    MovementStyleParams style = {};
+    clipPlayer.play(CLIP_WINDUP, servos, style,
+                    ClipArgs().withAnchor(windup.base, windup.nod, windup.tilt));
   }
   
   // ============================================
@@ -420,7 +276,7 @@ public:
       currentTilt + random(-5, 6)
     );
 
-    Serial.println("[CORRECTION] Natural settle");
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[CORRECTION] Natural settle");
     servos.snapTo(overshoot.base, overshoot.nod, overshoot.tilt);
     // REMOVED: delay(80) and settle snap - non-blocking design
   }
@@ -480,34 +336,14 @@ public:
     
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
     style.amplitude *= 1.3;  // Bigger movements
-    style.speed *= 1.2;      // Faster
-    
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
     
     if (wasRecentlyUsed(EXPRESS_PLAYFULNESS)) return;
     recordExpression(EXPRESS_PLAYFULNESS);
     
-    Serial.println("[EXPRESSION] Playfulness → Bouncy animation");
-    
-    // Bouncy, animated movement
-    for (int i = 0; i < 3; i++) {
-      int newBase = currentBase + random(-20, 21);
-      int newNod = currentNod + random(-10, 11);
-      int newTilt = currentTilt + random(-15, 16);
-      
-      newBase = constrain(newBase, 10, 170);
-      newNod = constrain(newNod, 80, 150);
-      newTilt = constrain(newTilt, 20, 150);
-      
-      Pose playPose(newBase, newNod, newTilt);
-      servos.smoothMoveTo(playPose.base, playPose.nod, playPose.tilt, style);
-      delay(150);
-    }
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[EXPRESSION] Playfulness → Bouncy animation");
     
-    // Return to original
-    Pose back(currentBase, currentNod, currentTilt);
-    servos.smoothMoveTo(back.base, back.nod, back.tilt, style);
+    // Bouncy, animated movement (clip runs at 120% speed)
+    clipPlayer.play(CLIP_PLAYFULNESS, servos, style);
   }
   
   // ============================================
@@ -518,31 +354,15 @@ public:
                      Personality& personality, Needs& needs) {
     
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
-    style.speed *= 0.6;       // Slower
     style.hesitation += 0.3;  // More hesitant
     
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
     if (wasRecentlyUsed(EXPRESS_CAUTION)) return;
     recordExpression(EXPRESS_CAUTION);
     
-    Serial.println("[EXPRESSION] Caution → Careful scanning");
-    
-    // Slow, careful scanning
-    int leftBase = constrain(currentBase - 15, 10, 170);
-    Pose left(leftBase, currentNod, currentTilt);
-    servos.smoothMoveTo(left.base, left.nod, left.tilt, style);
-    delay(300);
-    
-    int rightBase = constrain(currentBase + 15, 10, 170);
-    Pose right(rightBase, currentNod, currentTilt);
-    servos.smoothMoveTo(right.base, right.nod, right.tilt, style);
-    delay(300);
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[EXPRESSION] Caution → Careful scanning");
     
-    // Return to center
-    Pose center(currentBase, currentNod, currentTilt);
-    servos.smoothMoveTo(center.base, center.nod, center.tilt, style);
+    // Slow, careful scanning (clip runs at 60% speed)
+    clipPlayer.play(CLIP_CAUTION, servos, style);
   }
   
   // ============================================
@@ -555,30 +375,13 @@ public:
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
     style.smoothness *= 0.5;  // Jerkier
     
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-    
     if (wasRecentlyUsed(EXPRESS_UNCERTAINTY)) return;
     recordExpression(EXPRESS_UNCERTAINTY);
     
-    Serial.println("[EXPRESSION] Uncertainty → Hesitant movements");
-    
-    // Small hesitant movements
-    for (int i = 0; i < 4; i++) {
-      int newTilt = currentTilt + random(-5, 6);
-      int newNod = currentNod + random(-3, 4);
-      
-      newTilt = constrain(newTilt, 20, 150);
-      newNod = constrain(newNod, 80, 150);
-      
-      Pose uncertain(currentBase, newNod, newTilt);
-      servos.smoothMoveTo(uncertain.base, uncertain.nod, uncertain.tilt, style);
-      delay(random(150, 300));
-    }
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[EXPRESSION] Uncertainty → Hesitant movements");
     
-    // Return
-    Pose back(currentBase, currentNod, currentTilt);
-    servos.smoothMoveTo(back.base, back.nod, back.tilt, style);
+    // Four small hesitant movements, then back
+    clipPlayer.play(CLIP_UNCERTAINTY, servos, style, ClipArgs().withRepeat(4));
   }
   
   // ============================================
@@ -593,31 +396,12 @@ public:
 
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
 
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-
-    Serial.println("[EXPRESSION] Curious inspection → pause-tilt-orient-hold");
-
-    // Step 1: Pause briefly (moderate caution — considers before acting)
-    // No movement command, just a short delay to read as hesitation
-    delay(150 + (int)(personality.getCaution() * 200));
-
-    // Step 2: Tilt head (the "considering" gesture)
-    int tiltDir = random(0, 2) == 0 ? -1 : 1;
-    Pose consider(currentBase, currentNod + 5, currentTilt + 18 * tiltDir);
-    style.speed *= 0.6;
-    servos.smoothMoveTo(consider.base, consider.nod, consider.tilt, style);
-    delay(200);
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[EXPRESSION] Curious inspection → pause-tilt-orient-hold");
 
-    // Step 3: Orient toward the stimulus (high curiosity drives approach)
-    style.speed *= 1.5;
-    Pose orient(targetBase, targetNod, currentTilt + 8 * tiltDir);
-    servos.smoothMoveTo(orient.base, orient.nod, orient.tilt, style);
-    delay(300);
-
-    // Step 4: Hold the look (high persistence keeps focus)
-    // Just stay — the hold duration scales with persistence
-    delay(400 + (int)(personality.getPersistence() * 600));
+    // Pause (longer with caution), slow considering tilt, orient toward the
+    // stimulus, then hold the look (longer with persistence)
+    clipPlayer.play(CLIP_CURIOUS_INSPECTION, servos, style,
+                    ClipArgs::from(personality).withTarget(targetBase, targetNod));
 
     recordExpression(EXPRESS_CURIOSITY);
   }
@@ -629,34 +413,13 @@ public:
 
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
 
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
-
-    Serial.println("[EXPRESSION] Social greeting → orient-nod-hold-tilt");
+    LOG_PRINTLN(EXPRESSION, DEBUG, "[EXPRESSION] Social greeting → orient-nod-hold-tilt");
 
-    // Step 1: Quick orient toward the face (noticed immediately)
-    style.speed *= 1.3;
-    Pose orient(faceBase, faceNod, currentTilt);
-    servos.smoothMoveTo(orient.base, orient.nod, orient.tilt, style);
-    delay(150);
-
-    // Step 2: Slight nod (acknowledgment, not excitement)
-    Pose nod(faceBase, faceNod + 8, currentTilt);
-    servos.smoothMoveTo(nod.base, nod.nod, nod.tilt, style);
-    delay(120);
-    Pose nodBack(faceBase, faceNod, currentTilt);
-    servos.smoothMoveTo(nodBack.base, nodBack.nod, nodBack.tilt, style);
-
-    // Step 3: Hold eye contact (attentive, not overeager)
-    delay(300 + (int)(personality.getPersistence() * 400));
-
-    // Step 4: Maybe a small tilt (curious "let me look at you" angle)
-    if (random(100) < 60) {
-      int tiltDir = random(0, 2) == 0 ? -1 : 1;
-      Pose tilt(faceBase, faceNod, currentTilt + 12 * tiltDir);
-      style.speed *= 0.7;
-      servos.smoothMoveTo(tilt.base, tilt.nod, tilt.tilt, style);
-    }
+    // Quick orient toward the face, slight nod, hold eye contact, and
+    // 60% of the time a small curious tilt
+    const AnimClip& clip = random(100) < 60 ? CLIP_SOCIAL_GREETING_TILT : CLIP_SOCIAL_GREETING;
+    clipPlayer.play(clip, servos, style,
+                    ClipArgs::from(personality).withTarget(faceBase, faceNod));
 
     recordExpression(EXPRESS_AFFECTION);
   }
@@ -667,54 +430,13 @@ public:
                      Personality& personality, Needs& needs) {
 
     MovementStyleParams style = styleGen.generate(emotion, personality, needs);
-    style.speed *= 0.5;  // Slow, observational
-
-    int currentBase, currentNod, currentTilt;
-    servos.getPosition(currentBase, currentNod, currentTilt);
 
+    // Slow, observational clips: 0 slow scan, 1 tilt at nothing,
+    // 2 long stare (held by persistence), 3 stillness then a sudden jolt
     int choice = random(0, 4);
-    Serial.print("[EXPRESSION] Alone thinking → ");
-
-    switch(choice) {
-      case 0: {
-        // Slow scanning (not restless — observational)
-        Serial.println("slow scan");
-        int scanDir = random(0, 2) == 0 ? -1 : 1;
-        Pose scan(currentBase + 25 * scanDir, currentNod, currentTilt);
-        servos.smoothMoveTo(scan.base, scan.nod, scan.tilt, style);
-        break;
-      }
-      case 1: {
-        // Occasional head tilt at nothing (having a thought)
-        Serial.println("tilt at nothing");
-        int tiltDir = random(0, 2) == 0 ? -1 : 1;
-        Pose tilt(currentBase, currentNod + 3, currentTilt + 15 * tiltDir);
-        servos.smoothMoveTo(tilt.base, tilt.nod, tilt.tilt, style);
-        break;
-      }
-      case 2: {
-        // Long pause in one direction (staring at something, judging it)
-        Serial.println("long stare");
-        int stareDir = random(-30, 31);
-        Pose stare(currentBase + stareDir, currentNod + random(-5, 6), currentTilt);
-        servos.smoothMoveTo(stare.base, stare.nod, stare.tilt, style);
-        // Hold — the persistence trait determines how long
-        delay(500 + (int)(personality.getPersistence() * 800));
-        break;
-      }
-      case 3: {
-        // Sudden small movement (thought interrupted itself)
-        Serial.println("thought interrupt");
-        // First, be still for a moment
-        delay(300);
-        // Then a quick small movement as if a thought struck
-        style.speed *= 3.0;
-        Pose jolt(currentBase + random(-8, 9), currentNod + random(-4, 5),
-                  currentTilt + random(-6, 7));
-        servos.smoothMoveTo(jolt.base, jolt.nod, jolt.tilt, style);
-        break;
-      }
-    }
+    LOG_PRINT(EXPRESSION, DEBUG, "[EXPRESSION] Alone thinking → ");
+    LOG_PRINTLN(EXPRESSION, DEBUG, CLIPS_ALONE_THINKING[choice].name);
+    clipPlayer.play(CLIPS_ALONE_THINKING[choice], servos, style, ClipArgs::from(personality));
 
     recordExpression(EXPRESS_CONTEMPLATION);
   }
@@ -7,6 +7,7 @@
 #include "Emotion.h"
 #include "Personality.h"
 #include "Needs.h"
+#include "Log.h"
 
 struct MovementStyleParams {
   float speed;         // 0.0=very slow, 1.0=fast
@@ -183,56 +184,56 @@ public:
   // ============================================
   
   void print(MovementStyleParams& style) {
-    Serial.println("--- MOVEMENT STYLE ---");
-    Serial.print("  Speed:       ");
+    LOG_PRINTLN(MOVEMENT, INFO, "--- MOVEMENT STYLE ---");
+    LOG_PRINT(MOVEMENT, INFO, "  Speed:       ");
     printBar(style.speed);
-    Serial.print(" (delay: ");
-    Serial.print(style.delayMs);
-    Serial.println("ms)");
+    LOG_PRINT(MOVEMENT, INFO, " (delay: ");
+    LOG_PRINT(MOVEMENT, INFO, style.delayMs);
+    LOG_PRINTLN(MOVEMENT, INFO, "ms)");
     
-    Serial.print("  Amplitude:   ");
+    LOG_PRINT(MOVEMENT, INFO, "  Amplitude:   ");
     printBar(style.amplitude);
-    Serial.print(" (range: ");
-    Serial.print(style.rangeScale);
-    Serial.println("%)");
+    LOG_PRINT(MOVEMENT, INFO, " (range: ");
+    LOG_PRINT(MOVEMENT, INFO, style.rangeScale);
+    LOG_PRINTLN(MOVEMENT, INFO, "%)");
     
-    Serial.print("  Smoothness:  ");
+    LOG_PRINT(MOVEMENT, INFO, "  Smoothness:  ");
     printBar(style.smoothness);
-    Serial.println();
+    LOG_PRINTLN(MOVEMENT, INFO);
     
-    Serial.print("  Directness:  ");
+    LOG_PRINT(MOVEMENT, INFO, "  Directness:  ");
     printBar(style.directness);
-    Serial.println();
+    LOG_PRINTLN(MOVEMENT, INFO);
     
-    Serial.print("  Hesitation:  ");
+    LOG_PRINT(MOVEMENT, INFO, "  Hesitation:  ");
     printBar(style.hesitation);
-    Serial.println();
+    LOG_PRINTLN(MOVEMENT, INFO);
   }
   
   void printCompact(MovementStyleParams& style) {
-    Serial.print("  [STYLE] Spd:");
-    Serial.print(style.speed, 1);
-    Serial.print(" Amp:");
-    Serial.print(style.amplitude, 1);
-    Serial.print(" Smooth:");
-    Serial.print(style.smoothness, 1);
-    Serial.print(" Delay:");
-    Serial.print(style.delayMs);
-    Serial.println("ms");
+    LOG_PRINT(MOVEMENT, INFO, "  [STYLE] Spd:");
+    LOG_PRINT(MOVEMENT, INFO, style.speed, 1);
+    LOG_PRINT(MOVEMENT, INFO, " Amp:");
+    LOG_PRINT(MOVEMENT, INFO, style.amplitude, 1);
+    LOG_PRINT(MOVEMENT, INFO, " Smooth:");
+    LOG_PRINT(MOVEMENT, INFO, style.smoothness, 1);
+    LOG_PRINT(MOVEMENT, INFO, " Delay:");
+    LOG_PRINT(MOVEMENT, INFO, style.delayMs);
+    LOG_PRINTLN(MOVEMENT, INFO, "ms");
   }
   
   void printBar(float value) {
-    Serial.print("[");
+    LOG_PRINT(MOVEMENT, INFO, "[");
     int bars = (int)(value * 10);
     for (int i = 0; i < 10; i++) {
       if (i < bars) {
-        Serial.print("█");
+        LOG_PRINT(MOVEMENT, INFO, "█");
       } else {
-        Serial.print("░");
+        LOG_PRINT(MOVEMENT, INFO, "░");
       }
     }
-    Serial.print("] ");
-    Serial.print(value, 2);
+    LOG_PRINT(MOVEMENT, INFO, "] ");
+    LOG_PRINT(MOVEMENT, INFO, value, 2);
   }
 };
 
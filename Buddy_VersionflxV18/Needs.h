@@ -6,6 +6,7 @@
 
 #include "Personality.h"
 #include "SpatialMemory.h"
+#include "Log.h"
 
 class Needs {
 private:
@@ -102,9 +103,9 @@ public:
       // Decrease safety (but less than before)
       safety -= 0.05 * lastThreatMagnitude;  // Was 0.1, now 0.05 max
       
-      Serial.print("[SAFETY] Threat detected: ");
-      Serial.print(maxChange);
-      Serial.println(" cm change");
+      LOG_PRINT(NEEDS, DEBUG, "[SAFETY] Threat detected: ");
+      LOG_PRINT(NEEDS, DEBUG, maxChange);
+      LOG_PRINTLN(NEEDS, DEBUG, " cm change");
     } else {
       consecutiveCalmCycles++;
     }
@@ -136,7 +137,7 @@ public:
     // FORCE FLOOR: Never go completely to zero
     if (safety < 0.15) {
       safety = 0.15;  // Minimum safety level
-      Serial.println("[SAFETY] Floor enforced at 0.15");
+      LOG_PRINTLN(NEEDS, DEBUG, "[SAFETY] Floor enforced at 0.15");
     }
     
     applyInteractions();
@@ -222,7 +223,7 @@ public:
     lastThreatTime = millis() - 10000;  // Act like threat was 10s ago
     clampNeeds();
     
-    Serial.println("[SAFETY] Successful retreat - safety restored");
+    LOG_PRINTLN(NEEDS, INFO, "[SAFETY] Successful retreat - safety restored");
   }
   
   // NEW: Force exploration when stuck
@@ -231,7 +232,7 @@ public:
     novelty = 0.7;      // High novelty seeking
     safety = 0.5;       // Reset safety to moderate
     
-    Serial.println("[NEEDS] Exploration drive forced - breaking stuck state");
+    LOG_PRINTLN(NEEDS, INFO, "[NEEDS] Exploration drive forced - breaking stuck state");
   }
   
   // ============================================
@@ -284,72 +285,72 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- NEEDS ---");
-    Serial.print("  Stimulation: ");
+    LOG_PRINTLN(NEEDS, INFO, "--- NEEDS ---");
+    LOG_PRINT(NEEDS, INFO, "  Stimulation: ");
     printBar(stimulation);
-    Serial.print(" (pressure: ");
-    Serial.print(getStimulationPressure(), 2);
-    Serial.println(")");
+    LOG_PRINT(NEEDS, INFO, " (pressure: ");
+    LOG_PRINT(NEEDS, INFO, getStimulationPressure(), 2);
+    LOG_PRINTLN(NEEDS, INFO, ")");
     
-    Serial.print("  Social:      ");
+    LOG_PRINT(NEEDS, INFO, "  Social:      ");
     printBar(social);
-    Serial.print(" (pressure: ");
-    Serial.print(getSocialPressure(), 2);
-    Serial.println(")");
+    LOG_PRINT(NEEDS, INFO, " (pressure: ");
+    LOG_PRINT(NEEDS, INFO, getSocialPressure(), 2);
+    LOG_PRINTLN(NEEDS, INFO, ")");
     
-    Serial.print("  Energy:      ");
+    LOG_PRINT(NEEDS, INFO, "  Energy:      ");
     printBar(energy);
-    Serial.print(" (pressure: ");
-    Serial.print(getEnergyPressure(), 2);
-    Serial.println(")");
+    LOG_PRINT(NEEDS, INFO, " (pressure: ");
+    LOG_PRINT(NEEDS, INFO, getEnergyPressure(), 2);
+    LOG_PRINTLN(NEEDS, INFO, ")");
     
-    Serial.print("  Safety:      ");
+    LOG_PRINT(NEEDS, INFO, "  Safety:      ");
     printBar(safety);
-    Serial.print(" (pressure: ");
-    Serial.print(getSafetyPressure(), 2);
-    Serial.print(" calm: ");
-    Serial.print(consecutiveCalmCycles);
-    Serial.println(")");
+    LOG_PRINT(NEEDS, INFO, " (pressure: ");
+    LOG_PRINT(NEEDS, INFO, getSafetyPressure(), 2);
+    LOG_PRINT(NEEDS, INFO, " calm: ");
+    LOG_PRINT(NEEDS, INFO, consecutiveCalmCycles);
+    LOG_PRINTLN(NEEDS, INFO, ")");
     
-    Serial.print("  Novelty:     ");
+    LOG_PRINT(NEEDS, INFO, "  Novelty:     ");
     printBar(novelty);
-    Serial.println();
+    LOG_PRINTLN(NEEDS, INFO);
     
-    Serial.print("  Expression:  ");
+    LOG_PRINT(NEEDS, INFO, "  Expression:  ");
     printBar(expression);
-    Serial.println();
+    LOG_PRINTLN(NEEDS, INFO);
     
-    Serial.print("  Overall imbalance: ");
-    Serial.println(getImbalance(), 2);
+    LOG_PRINT(NEEDS, INFO, "  Overall imbalance: ");
+    LOG_PRINTLN(NEEDS, INFO, getImbalance(), 2);
   }
   
   void printCompact() {
-    Serial.print("  [NEEDS] S:");
-    Serial.print(stimulation, 1);
-    Serial.print(" So:");
-    Serial.print(social, 1);
-    Serial.print(" E:");
-    Serial.print(energy, 1);
-    Serial.print(" Sa:");
-    Serial.print(safety, 1);
-    Serial.print(" N:");
-    Serial.print(novelty, 1);
-    Serial.print(" calm:");
-    Serial.println(consecutiveCalmCycles);
+    LOG_PRINT(NEEDS, INFO, "  [NEEDS] S:");
+    LOG_PRINT(NEEDS, INFO, stimulation, 1);
+    LOG_PRINT(NEEDS, INFO, " So:");
+    LOG_PRINT(NEEDS, INFO, social, 1);
+    LOG_PRINT(NEEDS, INFO, " E:");
+    LOG_PRINT(NEEDS, INFO, energy, 1);
+    LOG_PRINT(NEEDS, INFO, " Sa:");
+    LOG_PRINT(NEEDS, INFO, safety, 1);
+    LOG_PRINT(NEEDS, INFO, " N:");
+    LOG_PRINT(NEEDS, INFO, novelty, 1);
+    LOG_PRINT(NEEDS, INFO, " calm:");
+    LOG_PRINTLN(NEEDS, INFO, consecutiveCalmCycles);
   }
   
   void printBar(float value) {
-    Serial.print("[");
+    LOG_PRINT(NEEDS, INFO, "[");
     int bars = (int)(value * 10);
     for (int i = 0; i < 10; i++) {
       if (i < bars) {
-        Serial.print("█");
+        LOG_PRINT(NEEDS, INFO, "█");
       } else {
-        Serial.print("░");
+        LOG_PRINT(NEEDS, INFO, "░");
       }
     }
-    Serial.print("] ");
-    Serial.print(value, 2);
+    LOG_PRINT(NEEDS, INFO, "] ");
+    LOG_PRINT(NEEDS, INFO, value, 2);
   }
 };
 
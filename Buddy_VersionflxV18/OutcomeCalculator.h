@@ -9,6 +9,7 @@
 #include "Emotion.h"
 #include "GoalFormation.h"
 #include "BehaviorSelection.h"
+#include "Log.h"
 
 class OutcomeCalculator {
 private:
@@ -225,45 +226,45 @@ public:
   void printBreakdown(Behavior behavior, Needs& needsAfter,
                      Emotion& emotionAfter, GoalFormation* goalSystem) {
 
-    Serial.println("\n[OUTCOME BREAKDOWN]");
+    LOG_PRINTLN(LEARNING, INFO, "\n[OUTCOME BREAKDOWN]");
 
     float needImp = calculateNeedImprovement(behavior, needsAfter);
-    Serial.print("  Need improvement: ");
-    Serial.print(needImp, 3);
-    Serial.print(" × ");
-    Serial.print(WEIGHT_NEEDS, 2);
-    Serial.print(" = ");
-    Serial.println(needImp * WEIGHT_NEEDS, 3);
+    LOG_PRINT(LEARNING, INFO, "  Need improvement: ");
+    LOG_PRINT(LEARNING, INFO, needImp, 3);
+    LOG_PRINT(LEARNING, INFO, " × ");
+    LOG_PRINT(LEARNING, INFO, WEIGHT_NEEDS, 2);
+    LOG_PRINT(LEARNING, INFO, " = ");
+    LOG_PRINTLN(LEARNING, INFO, needImp * WEIGHT_NEEDS, 3);
 
     float emotionImp = calculateEmotionalImprovement(emotionAfter);
-    Serial.print("  Emotion improvement: ");
-    Serial.print(emotionImp, 3);
-    Serial.print(" × ");
-    Serial.print(WEIGHT_EMOTION, 2);
-    Serial.print(" = ");
-    Serial.println(emotionImp * WEIGHT_EMOTION, 3);
+    LOG_PRINT(LEARNING, INFO, "  Emotion improvement: ");
+    LOG_PRINT(LEARNING, INFO, emotionImp, 3);
+    LOG_PRINT(LEARNING, INFO, " × ");
+    LOG_PRINT(LEARNING, INFO, WEIGHT_EMOTION, 2);
+    LOG_PRINT(LEARNING, INFO, " = ");
+    LOG_PRINTLN(LEARNING, INFO, emotionImp * WEIGHT_EMOTION, 3);
 
     if (goalSystem && goalSystem->hasActiveGoal()) {
       float goalAlign = calculateGoalAlignment(behavior, goalSystem);
-      Serial.print("  Goal alignment: ");
-      Serial.print(goalAlign, 3);
-      Serial.print(" × ");
-      Serial.print(WEIGHT_GOAL, 2);
-      Serial.print(" = ");
-      Serial.println(goalAlign * WEIGHT_GOAL, 3);
+      LOG_PRINT(LEARNING, INFO, "  Goal alignment: ");
+      LOG_PRINT(LEARNING, INFO, goalAlign, 3);
+      LOG_PRINT(LEARNING, INFO, " × ");
+      LOG_PRINT(LEARNING, INFO, WEIGHT_GOAL, 2);
+      LOG_PRINT(LEARNING, INFO, " = ");
+      LOG_PRINTLN(LEARNING, INFO, goalAlign * WEIGHT_GOAL, 3);
     }
 
     float safetyMaint = calculateSafetyMaintenance(behavior, needsAfter);
-    Serial.print("  Safety maintenance: ");
-    Serial.print(safetyMaint, 3);
-    Serial.print(" × ");
-    Serial.print(WEIGHT_SAFETY, 2);
-    Serial.print(" = ");
-    Serial.println(safetyMaint * WEIGHT_SAFETY, 3);
+    LOG_PRINT(LEARNING, INFO, "  Safety maintenance: ");
+    LOG_PRINT(LEARNING, INFO, safetyMaint, 3);
+    LOG_PRINT(LEARNING, INFO, " × ");
+    LOG_PRINT(LEARNING, INFO, WEIGHT_SAFETY, 2);
+    LOG_PRINT(LEARNING, INFO, " = ");
+    LOG_PRINTLN(LEARNING, INFO, safetyMaint * WEIGHT_SAFETY, 3);
 
     float total = calculate(behavior, needsAfter, emotionAfter, goalSystem);
-    Serial.print("  TOTAL OUTCOME: ");
-    Serial.println(total, 3);
+    LOG_PRINT(LEARNING, INFO, "  TOTAL OUTCOME: ");
+    LOG_PRINTLN(LEARNING, INFO, total, 3);
   }
 };
 
@@ -4,6 +4,8 @@
 #ifndef PERSONALITY_H
 #define PERSONALITY_H
 
+#include "Log.h"
+
 class Learning;  // Forward declaration
 
 class Personality {
@@ -98,62 +100,62 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- PERSONALITY ---");
-    Serial.print("  Curiosity:       ");
+    LOG_PRINTLN(PERSONALITY, INFO, "--- PERSONALITY ---");
+    LOG_PRINT(PERSONALITY, INFO, "  Curiosity:       ");
     printBar(curiosity);
-    Serial.println();
-    Serial.print("  Caution:         ");
+    LOG_PRINTLN(PERSONALITY, INFO);
+    LOG_PRINT(PERSONALITY, INFO, "  Caution:         ");
     printBar(caution);
-    Serial.println();
-    Serial.print("  Sociability:     ");
+    LOG_PRINTLN(PERSONALITY, INFO);
+    LOG_PRINT(PERSONALITY, INFO, "  Sociability:     ");
     printBar(sociability);
-    Serial.println();
-    Serial.print("  Playfulness:     ");
+    LOG_PRINTLN(PERSONALITY, INFO);
+    LOG_PRINT(PERSONALITY, INFO, "  Playfulness:     ");
     printBar(playfulness);
-    Serial.println();
-    Serial.print("  Excitability:    ");
+    LOG_PRINTLN(PERSONALITY, INFO);
+    LOG_PRINT(PERSONALITY, INFO, "  Excitability:    ");
     printBar(excitability);
-    Serial.println();
-    Serial.print("  Persistence:     ");
+    LOG_PRINTLN(PERSONALITY, INFO);
+    LOG_PRINT(PERSONALITY, INFO, "  Persistence:     ");
     printBar(persistence);
-    Serial.println();
-    Serial.print("  Expressiveness:  ");
+    LOG_PRINTLN(PERSONALITY, INFO);
+    LOG_PRINT(PERSONALITY, INFO, "  Expressiveness:  ");
     printBar(expressiveness);
-    Serial.println();
+    LOG_PRINTLN(PERSONALITY, INFO);
     
-    Serial.println("\n  Derived Attributes:");
-    Serial.print("    Effective Curiosity: ");
-    Serial.println(getEffectiveCuriosity(), 2);
-    Serial.print("    Risk Tolerance: ");
-    Serial.println(getRiskTolerance(), 2);
-    Serial.print("    Exploration Style: ");
-    Serial.println(getExplorationStyle(), 2);
+    LOG_PRINTLN(PERSONALITY, INFO, "\n  Derived Attributes:");
+    LOG_PRINT(PERSONALITY, INFO, "    Effective Curiosity: ");
+    LOG_PRINTLN(PERSONALITY, INFO, getEffectiveCuriosity(), 2);
+    LOG_PRINT(PERSONALITY, INFO, "    Risk Tolerance: ");
+    LOG_PRINTLN(PERSONALITY, INFO, getRiskTolerance(), 2);
+    LOG_PRINT(PERSONALITY, INFO, "    Exploration Style: ");
+    LOG_PRINTLN(PERSONALITY, INFO, getExplorationStyle(), 2);
   }
   
   void printCompact() {
-    Serial.print("  [PERSONALITY] C:");
-    Serial.print(curiosity, 1);
-    Serial.print(" Ca:");
-    Serial.print(caution, 1);
-    Serial.print(" S:");
-    Serial.print(sociability, 1);
-    Serial.print(" P:");
-    Serial.print(playfulness, 1);
-    Serial.println();
+    LOG_PRINT(PERSONALITY, INFO, "  [PERSONALITY] C:");
+    LOG_PRINT(PERSONALITY, INFO, curiosity, 1);
+    LOG_PRINT(PERSONALITY, INFO, " Ca:");
+    LOG_PRINT(PERSONALITY, INFO, caution, 1);
+    LOG_PRINT(PERSONALITY, INFO, " S:");
+    LOG_PRINT(PERSONALITY, INFO, sociability, 1);
+    LOG_PRINT(PERSONALITY, INFO, " P:");
+    LOG_PRINT(PERSONALITY, INFO, playfulness, 1);
+    LOG_PRINTLN(PERSONALITY, INFO);
   }
   
   void printBar(float value) {
-    Serial.print("[");
+    LOG_PRINT(PERSONALITY, INFO, "[");
     int bars = (int)(value * 10);
     for (int i = 0; i < 10; i++) {
       if (i < bars) {
-        Serial.print("█");
+        LOG_PRINT(PERSONALITY, INFO, "█");
       } else {
-        Serial.print("░");
+        LOG_PRINT(PERSONALITY, INFO, "░");
       }
     }
-    Serial.print("] ");
-    Serial.print(value, 2);
+    LOG_PRINT(PERSONALITY, INFO, "] ");
+    LOG_PRINT(PERSONALITY, INFO, value, 2);
   }
   
   // ============================================
@@ -170,7 +172,7 @@ public:
         excitability = 0.7;
         persistence = 0.6;
         expressiveness = 0.7;
-        Serial.println("[PERSONALITY] Set to Bold Explorer");
+        LOG_PRINTLN(PERSONALITY, INFO, "[PERSONALITY] Set to Bold Explorer");
         break;
         
       case 2:  // Shy Observer
@@ -181,7 +183,7 @@ public:
         excitability = 0.4;
         persistence = 0.7;
         expressiveness = 0.4;
-        Serial.println("[PERSONALITY] Set to Shy Observer");
+        LOG_PRINTLN(PERSONALITY, INFO, "[PERSONALITY] Set to Shy Observer");
         break;
         
       case 3:  // Playful Friend
@@ -192,7 +194,7 @@ public:
         excitability = 0.7;
         persistence = 0.4;
         expressiveness = 0.8;
-        Serial.println("[PERSONALITY] Set to Playful Friend");
+        LOG_PRINTLN(PERSONALITY, INFO, "[PERSONALITY] Set to Playful Friend");
         break;
 
       case 4:  // Buddy (canonical personality)
@@ -203,7 +205,7 @@ public:
         excitability = 0.50;
         persistence = 0.70;
         expressiveness = 0.65;
-        Serial.println("[PERSONALITY] Set to Buddy");
+        LOG_PRINTLN(PERSONALITY, INFO, "[PERSONALITY] Set to Buddy");
         break;
 
       default:  // Balanced (default)
@@ -214,7 +216,7 @@ public:
         excitability = 0.5;
         persistence = 0.5;
         expressiveness = 0.5;
-        Serial.println("[PERSONALITY] Set to Balanced");
+        LOG_PRINTLN(PERSONALITY, INFO, "[PERSONALITY] Set to Balanced");
         break;
     }
   }
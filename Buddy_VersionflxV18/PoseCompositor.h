@@ -0,0 +1,155 @@
+/**
+ * PoseCompositor.h - Layered servo pose, one write per servo per tick
+ *
+ * Five sources used to write the servos on their own schedules: breathing
+ * (nodServo.write of the state plus a sine), micro-movements (write, delay,
+ * write back), AmbientLife (edits of the stored pose), the AI looping
+ * animations and the reflex (directWrite/directWriteFull). Each overwrote
+ * the others, so the main loop had to keep the behavior engine out while
+ * an AI animation ran.
+ *
+ * Now each source owns a layer, and ServoController::updateMotion()
+ * composes them once per motion tick:
+ *
+ *   out = base + Σ weight[l] × offset[l] + pulses     additive layers
+ *   out = lerp(out, tracking, trackWeight)             tracked axes only
+ *
+ *   base        MotionEngine moves and snaps (getPosition() reports this)
+ *   EXPRESSION  AI THINKING/SPEAKING loops
+ *   BREATH      breathing sine on the nod axis
+ *   AMBIENT     AmbientLife weight shift, droop and glance
+ *   pulses      short micro-movements that return by themselves
+ *   tracking    reflex target, blended over everything on its axes
+ *               (reached through a trapezoid JointProfile, so the ~10Hz
+ *               reflex steps arrive as continuous, accel-limited motion)
+ *
+ * A layer that is set fades in and a layer that is released fades out,
+ * both over POSE_BLEND_MS. The tracking override lapses by itself when it
+ * is not refreshed for POSE_TRACK_HOLD_MS. The compositor only does the
+ * arithmetic, in float degrees; ServoController hands the result to the
+ * output stage (ServoOutput.h).
+ */
+
+#ifndef POSE_COMPOSITOR_H
+#define POSE_COMPOSITOR_H
+
+#include <Arduino.h>
+#include "MotionEngine.h"
+#include "MotionLut.h"
+
+#define POSE_BLEND_MS       200   // Layer and tracking fade in/out
+#define POSE_TRACK_HOLD_MS  250   // Reflex refreshes at ~10Hz; lapse after that
+
+enum PoseLayer : uint8_t { LAYER_EXPRESSION, LAYER_BREATH, LAYER_AMBIENT, POSE_LAYERS };
+
+class PoseCompositor {
+public:
+  PoseCompositor() : trackMask(0), trackWeight(0.0f), trackSeenAt(0), lastCompose(0) {
+    for (int l = 0; l < POSE_LAYERS; l++) {
+      weight[l] = 0.0f;
+      on[l] = false;
+      for (int a = 0; a < MOTION_AXES; a++) offset[l][a] = 0.0f;
+    }
+    for (int a = 0; a < MOTION_AXES; a++) {
+      pulse[a] = 0.0f;
+      pulseUntil[a] = 0;
+      lastOut[a] = 0.0f;
+      follow[a].setLimits(BODY_JOINT_LIMITS[a]);
+    }
+  }
+
+  // Additive layer offsets in degrees; the layer fades in if it was off
+  void setLayer(PoseLayer layer, float base, float nod, float tilt) {
+    offset[layer][AXIS_BASE] = base;
+    offset[layer][AXIS_NOD] = nod;
+    offset[layer][AXIS_TILT] = tilt;
+    on[layer] = true;
+  }
+
+  void setLayerAxis(PoseLayer layer, MotionAxis axis, float degrees) {
+    offset[layer][axis] = degrees;
+    on[layer] = true;
+  }
+
+  // Fade a layer out; its offsets are dropped once it is silent
+  void fadeLayer(PoseLayer layer) { on[layer] = false; }
+
+  bool layerActive(PoseLayer layer) const { return on[layer] || weight[layer] > 0.0f; }
+
+  // Offset on one axis that returns after ms (replaces a running pulse)
+  void addPulse(MotionAxis axis, float degrees, uint16_t ms, unsigned long now) {
+    pulse[axis] = degrees;
+    pulseUntil[axis] = now + ms;
+  }
+
+  // Absolute angles for the mask axes, blended over the other layers
+  void setTracking(const float pose[MOTION_AXES], uint8_t mask, unsigned long now) {
+    for (int a = 0; a < MOTION_AXES; a++) {
+      if (!(mask & (1 << a))) continue;
+      // Newly tracked axis: the follower starts where the head is
+      if (!(trackMask & (1 << a)) || trackWeight == 0.0f) {
+        follow[a].reset(lastCompose != 0 ? lastOut[a] : pose[a], now);
+      }
+      follow[a].moveTo(pose[a], PROFILE_TRAPEZOID, 0, now);
+    }
+    trackMask |= mask;
+    trackSeenAt = now;
+  }
+
+  bool isTracking(unsigned long now) const {
+    return trackMask != 0 && (now - trackSeenAt) < POSE_TRACK_HOLD_MS;
+  }
+
+  // Pose for this tick from the base layer
+  void compose(const int base[MOTION_AXES], unsigned long now, float out[MOTION_AXES]) {
+    float step = (now - lastCompose) / (float)POSE_BLEND_MS;
+    if (lastCompose == 0 || step > 1.0f) step = 1.0f;
+    lastCompose = now;
+
+    for (int l = 0; l < POSE_LAYERS; l++) {
+      weight[l] = approach(weight[l], on[l] ? 1.0f : 0.0f, step);
+      if (!on[l] && weight[l] == 0.0f) {
+        for (int a = 0; a < MOTION_AXES; a++) offset[l][a] = 0.0f;
+      }
+    }
+
+    trackWeight = approach(trackWeight, isTracking(now) ? 1.0f : 0.0f, step);
+    if (trackWeight == 0.0f && !isTracking(now)) trackMask = 0;
+
+    for (int a = 0; a < MOTION_AXES; a++) {
+      float v = base[a];
+      for (int l = 0; l < POSE_LAYERS; l++) v += offset[l][a] * lutEase(weight[l]);
+
+      if (pulseUntil[a] != 0) {
+        if ((long)(now - pulseUntil[a]) < 0) v += pulse[a];
+        else pulseUntil[a] = 0;
+      }
+
+      if (trackMask & (1 << a)) v += (follow[a].sample(now) - v) * lutEase(trackWeight);
+
+      out[a] = v;   // ServoOutput clamps to the safe range
+      lastOut[a] = v;
+    }
+  }
+
+private:
+  float offset[POSE_LAYERS][MOTION_AXES];
+  float weight[POSE_LAYERS];     // 0..1, moves toward on[] over POSE_BLEND_MS (eased on use)
+  bool on[POSE_LAYERS];
+  float pulse[MOTION_AXES];
+  unsigned long pulseUntil[MOTION_AXES];   // 0 = no pulse
+  JointProfile follow[MOTION_AXES];   // Tracking target, accel-limited
+  float lastOut[MOTION_AXES];
+  uint8_t trackMask;
+  float trackWeight;
+  unsigned long trackSeenAt;
+  unsigned long lastCompose;
+
+  static float approach(float v, float target, float step) {
+    if (v < target) return min(v + step, target);
+    if (v > target) return max(v - step, target);
+    return v;
+  }
+};
+
+#endif // POSE_COMPOSITOR_H
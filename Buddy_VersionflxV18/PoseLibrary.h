@@ -8,6 +8,7 @@
 #include "BehaviorSelection.h"
 #include "Emotion.h"
 #include "Personality.h"
+#include "Log.h"
 
 struct Pose {
   int base;
@@ -18,13 +19,13 @@ struct Pose {
   Pose(int b, int n, int t) : base(b), nod(n), tilt(t) {}
   
   void print() {
-    Serial.print("Base:");
-    Serial.print(base);
-    Serial.print("° Nod:");
-    Serial.print(nod);
-    Serial.print("° Tilt:");
-    Serial.print(tilt);
-    Serial.println("°");
+    LOG_PRINT(ANIM, INFO, "Base:");
+    LOG_PRINT(ANIM, INFO, base);
+    LOG_PRINT(ANIM, INFO, "° Nod:");
+    LOG_PRINT(ANIM, INFO, nod);
+    LOG_PRINT(ANIM, INFO, "° Tilt:");
+    LOG_PRINT(ANIM, INFO, tilt);
+    LOG_PRINTLN(ANIM, INFO, "°");
   }
 };
 
@@ -337,8 +338,8 @@ public:
   // ============================================
   
   void printPose(Pose& pose, const char* label = "Pose") {
-    Serial.print(label);
-    Serial.print(": ");
+    LOG_PRINT(ANIM, INFO, label);
+    LOG_PRINT(ANIM, INFO, ": ");
     pose.print();
   }
   
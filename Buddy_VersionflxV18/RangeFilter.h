@@ -0,0 +1,201 @@
+/**
+ * RangeFilter.h - Filtered ultrasonic range with validity and confidence
+ *
+ * Raw HC-SR04 pings are noisy: missed echoes, multipath spikes, soft
+ * targets that come and go. Fed straight into Emotion (distanceChange >
+ * 20cm spikes arousal), every glitch looked like something moving.
+ *
+ * Pipeline, one step per new ping (UltrasonicReading::seq):
+ *   1. No echo        → counted, never turned into a fake distance
+ *   2. Median of N    → last RANGE_MEDIAN_N valid echoes, kills spikes
+ *   3. Outlier gate   → median further than RANGE_GATE_CM from the
+ *                       prediction is rejected; RANGE_REACQUIRE rejections
+ *                       in a row mean the scene really changed → re-lock
+ *   4. Alpha-beta     → smoothed range + closing velocity
+ *
+ * estimate() reports flags instead of magic values: RANGE_VALID only when
+ * the track is fresh and locked, RANGE_NO_ECHO after a run of misses
+ * (open space or sensor fault), RANGE_STALE when pings stopped arriving.
+ * confidence (0..1) falls with misses, rejections and age; consumers
+ * should ignore changes they can't trust.
+ */
+
+#ifndef RANGE_FILTER_H
+#define RANGE_FILTER_H
+
+#include <Arduino.h>
+#include "UltrasonicRanger.h"
+
+#define RANGE_MEDIAN_N        5
+#define RANGE_ALPHA           0.5f    // Position correction gain
+#define RANGE_BETA            0.1f    // Velocity correction gain
+#define RANGE_GATE_CM         40.0f   // Max jump from prediction before rejecting
+#define RANGE_REACQUIRE       3       // Consecutive rejections that force a re-lock
+#define RANGE_NO_ECHO_RUN     5       // Consecutive misses before RANGE_NO_ECHO
+#define RANGE_STALE_MS        500     // No ping for this long → RANGE_STALE
+#define RANGE_CONF_GAIN       0.2f    // Confidence EWMA weight per ping
+#define RANGE_DEFAULT_CM      100.0f  // Held value before the first lock
+#define RANGE_TRUST_CONFIDENCE 0.5f   // Below this, consumers hold their last range
+
+enum RangeFlags : uint8_t {
+  RANGE_VALID    = 0x01,   // Locked, fresh track — cm can be trusted
+  RANGE_NO_ECHO  = 0x02,   // Last RANGE_NO_ECHO_RUN pings had no echo
+  RANGE_STALE    = 0x04,   // No new ping within RANGE_STALE_MS
+  RANGE_OUTLIER  = 0x08    // Most recent sample was rejected by the gate
+};
+
+struct RangeEstimate {
+  float cm;            // Filtered range (last good value if not valid)
+  float velocity;      // cm/s, negative = approaching
+  float confidence;    // 0..1
+  uint8_t flags;
+  uint32_t seq;        // Ping sequence of the last sample consumed
+
+  bool valid() const { return (flags & RANGE_VALID) != 0; }
+};
+
+class RangeFilter {
+public:
+  // Counters since boot
+  unsigned long samples;     // Pings consumed
+  unsigned long accepted;    // Fed the alpha-beta filter
+  unsigned long rejected;    // Dropped by the outlier gate
+  unsigned long misses;      // No-echo pings
+
+  RangeFilter() { reset(); }
+
+  void reset() {
+    samples = accepted = rejected = misses = 0;
+    count = 0;
+    head = 0;
+    locked = false;
+    x = RANGE_DEFAULT_CM;
+    v = 0;
+    confidence = 0;
+    missRun = 0;
+    rejectRun = 0;
+    lastSeq = 0;
+    lastSampleMs = 0;
+    lastFlags = 0;
+  }
+
+  // Consume the ranger's latest ping if it is new. Returns true if it was.
+  bool update(const UltrasonicReading& reading) {
+    if (reading.seq == lastSeq) return false;
+    lastSeq = reading.seq;
+    samples++;
+
+    float dt = (lastSampleMs > 0) ? (reading.timestampMs - lastSampleMs) / 1000.0f : 0;
+    lastSampleMs = reading.timestampMs;
+    lastFlags = 0;
+
+    // 1. No echo — counts against confidence, never becomes a distance
+    if (!reading.valid) {
+      misses++;
+      if (missRun < 255) missRun++;
+      decayConfidence();
+      return true;
+    }
+    missRun = 0;
+
+    // 2. Median of the last N echoes
+    window[head] = reading.cm;
+    head = (head + 1) % RANGE_MEDIAN_N;
+    if (count < RANGE_MEDIAN_N) count++;
+    float z = median();
+
+    if (!locked) {
+      x = z;
+      v = 0;
+      locked = true;
+      accepted++;
+      raiseConfidence();
+      return true;
+    }
+
+    // 3. Gate against the prediction
+    float predicted = x + v * dt;
+    float residual = z - predicted;
+    if (fabsf(residual) > RANGE_GATE_CM) {
+      rejected++;
+      lastFlags |= RANGE_OUTLIER;
+      if (++rejectRun >= RANGE_REACQUIRE) {
+        // Consistently somewhere else — the scene changed, re-lock there
+        x = z;
+        v = 0;
+        rejectRun = 0;
+        confidence *= 0.5f;
+      } else {
+        decayConfidence();
+      }
+      return true;
+    }
+    rejectRun = 0;
+
+    // 4. Alpha-beta update
+    x = predicted + RANGE_ALPHA * residual;
+    if (dt > 0.001f) v += RANGE_BETA * residual / dt;
+    accepted++;
+    raiseConfidence();
+    return true;
+  }
+
+  RangeEstimate estimate() const {
+    RangeEstimate e;
+    e.cm = x;
+    e.velocity = v;
+    e.seq = lastSeq;
+    e.flags = lastFlags;
+    e.confidence = confidence;
+
+    if (missRun >= RANGE_NO_ECHO_RUN) e.flags |= RANGE_NO_ECHO;
+
+    unsigned long age = millis() - lastSampleMs;
+    if (lastSampleMs == 0 || age > RANGE_STALE_MS) {
+      e.flags |= RANGE_STALE;
+      e.confidence = 0;
+    } else {
+      // Linear fade over the stale window
+      e.confidence *= 1.0f - (float)age / RANGE_STALE_MS;
+    }
+
+    if (locked && !(e.flags & (RANGE_NO_ECHO | RANGE_STALE))) e.flags |= RANGE_VALID;
+    return e;
+  }
+
+private:
+  float window[RANGE_MEDIAN_N];
+  int count;
+  int head;
+
+  bool locked;
+  float x;              // Filtered range (cm)
+  float v;              // Filtered velocity (cm/s)
+  float confidence;
+  uint8_t missRun;
+  uint8_t rejectRun;
+  uint32_t lastSeq;
+  uint32_t lastSampleMs;
+  uint8_t lastFlags;
+
+  void raiseConfidence() { confidence += RANGE_CONF_GAIN * (1.0f - confidence); }
+  void decayConfidence() { confidence -= RANGE_CONF_GAIN * confidence; }
+
+  float median() const {
+    float sorted[RANGE_MEDIAN_N];
+    for (int i = 0; i < count; i++) sorted[i] = window[i];
+    // Insertion sort — N is tiny
+    for (int i = 1; i < count; i++) {
+      float key = sorted[i];
+      int j = i - 1;
+      while (j >= 0 && sorted[j] > key) {
+        sorted[j + 1] = sorted[j];
+        j--;
+      }
+      sorted[j + 1] = key;
+    }
+    return sorted[count / 2];
+  }
+};
+
+#endif // RANGE_FILTER_H
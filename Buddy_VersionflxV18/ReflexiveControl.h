@@ -24,6 +24,9 @@
 #define REFLEXIVE_CONTROL_H
 
 #include <Arduino.h>
+#include "Telemetry.h"
+#include "Log.h"
+#include "BodySchema.h"
 
 // ============================================================================
 // CONFIGURATION CONSTANTS
@@ -170,50 +173,44 @@ public:
 class GentleTrajectory {
 private:
   bool active;
-  float startPan, startTilt;
-  float targetPan, targetTilt;
-  float currentStep;
-  float totalSteps;
+  JointProfile pan;    // Minimum-jerk, within the BodySchema joint limits
+  JointProfile tilt;
 
 public:
   GentleTrajectory() {
     active = false;
-    currentStep = 0;
-    totalSteps = 0;
+    pan.setLimits(BODY_JOINT_LIMITS[0]);
+    tilt.setLimits(BODY_JOINT_LIMITS[1]);
   }
 
   void planReturnToCenter(float fromPan, float fromTilt) {
-    startPan = fromPan;
-    startTilt = fromTilt;
-    targetPan = BASE_CENTER;
-    targetTilt = NOD_CENTER;
+    unsigned long now = millis();
 
     // Calculate smooth trajectory duration based on distance
-    float distance = sqrt(pow(targetPan - fromPan, 2) + pow(targetTilt - fromTilt, 2));
+    float distance = sqrt(pow(BASE_CENTER - fromPan, 2) + pow(NOD_CENTER - fromTilt, 2));
     float durationSeconds = distance / 60.0;
     durationSeconds = constrain(durationSeconds, 0.3, 1.5);
+    unsigned long durationMs = (unsigned long)(durationSeconds * 1000.0f);
 
-    totalSteps = durationSeconds * 50;  // 50Hz update rate
-    currentStep = 0;
+    pan.reset(fromPan, now);
+    tilt.reset(fromTilt, now);
+    pan.moveTo(BASE_CENTER, PROFILE_MIN_JERK, durationMs, now);
+    tilt.moveTo(NOD_CENTER, PROFILE_MIN_JERK, durationMs, now);
     active = true;
   }
 
-  bool getNextPosition(float& pan, float& tilt) {
+  bool getNextPosition(float& panOut, float& tiltOut) {
     if (!active) return false;
 
-    if (currentStep >= totalSteps) {
+    if (!pan.isMoving() && !tilt.isMoving()) {
       active = false;
       return false;
     }
 
-    // Ease-in-out curve for smooth motion
-    float t = currentStep / totalSteps;
-    float smoothT = (t < 0.5) ? 2 * t * t : 1 - pow(-2 * t + 2, 2) / 2;
-
-    pan = startPan + (targetPan - startPan) * smoothT;
-    tilt = startTilt + (targetTilt - startTilt) * smoothT;
-
-    currentStep++;
+    // Sampled by time, not by call count
+    unsigned long now = millis();
+    panOut = pan.sample(now);
+    tiltOut = tilt.sample(now);
     return true;
   }
 
@@ -319,7 +316,7 @@ private:
   // For velocity calculation (derived from position)
   int lastFaceX;
   int lastFaceY;
-  unsigned long lastVelocityTime;
+  unsigned long lastVelocityUs;   // Arrival time of the previous sample
 
 public:
 
@@ -380,7 +377,7 @@ public:
 
     lastFaceX = CAMERA_CENTER_X;
     lastFaceY = CAMERA_CENTER_Y;
-    lastVelocityTime = 0;
+    lastVelocityUs = 0;
 
     panPID.reset();
     tiltPID.reset();
@@ -411,24 +408,15 @@ public:
     }
   }
 
+  // Scheduled every 500ms from the main loop's task table
   void checkTimeout() {
     if (!state.active) return;
 
-    // ═══════════════════════════════════════════════════════════════
-    // OPTIMIZATION: Only check timeout periodically, not every call
-    // ═══════════════════════════════════════════════════════════════
-    static unsigned long lastCheck = 0;
     unsigned long now = millis();
 
-    // Only check every 500ms (not every loop iteration)
-    if (now - lastCheck < 500) {
-      return;
-    }
-    lastCheck = now;
-
     // No face data ever received - should not be active
     if (state.lastFaceTime == 0) {
-      Serial.println("[REFLEX] Timeout: active with no face data, disabling");
+      TELEMETRY(TEL_REFLEX_TIMEOUT, 0, 0);
       state.active = false;
       state.shouldBeActive = false;
       return;
@@ -437,7 +425,7 @@ public:
     // Face data timeout - no fresh data for 2 seconds
     unsigned long timeSinceFace = now - state.lastFaceTime;
     if (timeSinceFace > 2000) {
-      Serial.println("[REFLEX] Timeout: no face data for 2s, disabling");
+      TELEMETRY(TEL_REFLEX_TIMEOUT, 1, (int32_t)timeSinceFace);
       state.active = false;
       state.shouldBeActive = false;  // Prevent behavior system from re-enabling
     }
@@ -453,6 +441,15 @@ public:
    * Signature preserved for compatibility with existing code
    */
   void updateFaceData(int x, int y, int size, int distance) {
+    updateFaceData(x, y, size, distance, micros());
+  }
+
+  /**
+   * Same, with the micros() time the sample arrived on the wire.
+   * Velocity is taken over real inter-arrival times instead of the
+   * 20ms-quantized times at which the main loop processed the samples.
+   */
+  void updateFaceData(int x, int y, int size, int distance, unsigned long arrivalUs) {
     unsigned long now = millis();
 
     // Constrain inputs
@@ -495,8 +492,8 @@ public:
     // CALCULATE VELOCITY (derived from position changes)
     // ========================================================================
 
-    if (lastVelocityTime > 0) {
-      float dt = (now - lastVelocityTime) / 1000.0;  // seconds
+    if (lastVelocityUs > 0) {
+      float dt = (arrivalUs - lastVelocityUs) / 1000000.0;  // seconds
       if (dt > 0.001 && dt < 0.5) {  // Reasonable time delta
         state.faceVX = (int)((x - lastFaceX) / dt);
         state.faceVY = (int)((y - lastFaceY) / dt);
@@ -509,7 +506,7 @@ public:
 
     lastFaceX = x;
     lastFaceY = y;
-    lastVelocityTime = now;
+    lastVelocityUs = arrivalUs;
 
     // ========================================================================
     // STORE FACE DATA
@@ -553,6 +550,18 @@ public:
   // REFLEX COMPUTATION (CORE ALGORITHM from Teensy v5.4)
   // ========================================================================
 
+  /**
+   * Calculate reflexive servo adjustments, unquantized
+   * (ServoController::directWrite resolves ~0.1°)
+   */
+  bool calculate(int currentBase, int currentNod, float& baseOut, float& nodOut) {
+    int base, nod;
+    bool active = calculate(currentBase, currentNod, base, nod);
+    baseOut = constrain(state.panAngle, (float)BASE_MIN, (float)BASE_MAX);
+    nodOut = constrain(state.tiltAngle, (float)NOD_MIN, (float)NOD_MAX);
+    return active;
+  }
+
   /**
    * Calculate reflexive servo adjustments
    * Interface preserved for compatibility with existing code
@@ -568,9 +577,11 @@ public:
     }
     lastUpdateTime = now;
 
-    // Update current angles for trajectory planning
-    state.panAngle = currentBase;
-    state.tiltAngle = currentNod;
+    // Update current angles for trajectory planning. Within a degree of
+    // the last target the servo is where we put it (its position is
+    // reported rounded): keep the fraction so sub-degree steps add up
+    if (fabs(state.panAngle - currentBase) >= 1.0f) state.panAngle = currentBase;
+    if (fabs(state.tiltAngle - currentNod) >= 1.0f) state.tiltAngle = currentNod;
 
     // ═══════════════════════════════════════════════
     // BLIND STATE MACHINE
@@ -702,22 +713,9 @@ private:
       if (abs(errorY) < deadband) errorY = 0;
 
       // ═══════════════════════════════════════════════════════════════
-      // DEBUG: Print error and deadband info
+      // DEBUG: Error after deadband (every calc — text output thins it)
       // ═══════════════════════════════════════════════════════════════
-      static unsigned long lastDebug = 0;
-      if (millis() - lastDebug > 500) {
-        Serial.print("[REFLEX] Face:(");
-        Serial.print(state.faceX);
-        Serial.print(",");
-        Serial.print(state.faceY);
-        Serial.print(") Err:(");
-        Serial.print((int)errorX);
-        Serial.print(",");
-        Serial.print((int)errorY);
-        Serial.print(") DB:");
-        Serial.println(deadband);
-        lastDebug = millis();
-      }
+      TELEMETRY(TEL_REFLEX_ERROR, state.faceX, state.faceY, (int32_t)errorX, (int32_t)errorY);
     }
 
     float totalError = sqrt(errorX*errorX + errorY*errorY);
@@ -782,21 +780,10 @@ private:
     state.tiltAngle += tiltCommand * SMOOTHING_FACTOR;
 
     // ═══════════════════════════════════════════════════════════════
-    // DEBUG: Print commands and resulting angles
+    // DEBUG: Commands and resulting angles
     // ═══════════════════════════════════════════════════════════════
-    static unsigned long lastCmdDebug = 0;
-    if (millis() - lastCmdDebug > 500) {
-      Serial.print("[REFLEX] Cmd:(");
-      Serial.print(panCommand, 2);
-      Serial.print(",");
-      Serial.print(tiltCommand, 2);
-      Serial.print(") Angle:(");
-      Serial.print((int)state.panAngle);
-      Serial.print(",");
-      Serial.print((int)state.tiltAngle);
-      Serial.println(")");
-      lastCmdDebug = millis();
-    }
+    TELEMETRY(TEL_REFLEX_CMD, (int32_t)(panCommand * 100), (int32_t)(tiltCommand * 100),
+              (int32_t)state.panAngle, (int32_t)state.tiltAngle);
 
     // Store adjustments for diagnostics
     state.adjustBase = (int)(panCommand * SMOOTHING_FACTOR);
@@ -918,31 +905,31 @@ public:
 
   void printDebug() {
     if (state.active) {
-      Serial.print("[REFLEX v6.0] ");
+      LOG_PRINT(REFLEX, INFO, "[REFLEX v6.0] ");
 
       switch(state.controlState) {
-        case LOST: Serial.print("LOST"); break;
-        case ACQUIRE: Serial.print("ACQ"); break;
-        case TRACK: Serial.print("TRK"); break;
+        case LOST: LOG_PRINT(REFLEX, INFO, "LOST"); break;
+        case ACQUIRE: LOG_PRINT(REFLEX, INFO, "ACQ"); break;
+        case TRACK: LOG_PRINT(REFLEX, INFO, "TRK"); break;
       }
 
-      Serial.print(" Face:(");
-      Serial.print(state.faceX);
-      Serial.print(",");
-      Serial.print(state.faceY);
-      Serial.print(") Err:");
-      Serial.print(state.errorMagnitude, 1);
-      Serial.print("px Conf:");
-      Serial.print(state.faceConfidence);
-      Serial.print(" Pan:");
-      Serial.print(state.panAngle, 1);
-      Serial.print("° Tilt:");
-      Serial.print(state.tiltAngle, 1);
-      Serial.print("° Quality:");
-      Serial.print(state.trackingQuality * 100, 0);
-      Serial.println("%");
+      LOG_PRINT(REFLEX, INFO, " Face:(");
+      LOG_PRINT(REFLEX, INFO, state.faceX);
+      LOG_PRINT(REFLEX, INFO, ",");
+      LOG_PRINT(REFLEX, INFO, state.faceY);
+      LOG_PRINT(REFLEX, INFO, ") Err:");
+      LOG_PRINT(REFLEX, INFO, state.errorMagnitude, 1);
+      LOG_PRINT(REFLEX, INFO, "px Conf:");
+      LOG_PRINT(REFLEX, INFO, state.faceConfidence);
+      LOG_PRINT(REFLEX, INFO, " Pan:");
+      LOG_PRINT(REFLEX, INFO, state.panAngle, 1);
+      LOG_PRINT(REFLEX, INFO, "° Tilt:");
+      LOG_PRINT(REFLEX, INFO, state.tiltAngle, 1);
+      LOG_PRINT(REFLEX, INFO, "° Quality:");
+      LOG_PRINT(REFLEX, INFO, state.trackingQuality * 100, 0);
+      LOG_PRINTLN(REFLEX, INFO, "%");
     } else {
-      Serial.println("[REFLEX v6.0] Inactive");
+      LOG_PRINTLN(REFLEX, INFO, "[REFLEX v6.0] Inactive");
     }
   }
 };
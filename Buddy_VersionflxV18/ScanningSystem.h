@@ -1,5 +1,7 @@
 // ScanningSystem.h - COMPLETE UPDATED FILE
 // Optimized 3-tier scanning with smooth animation system integration
+// All servo motion goes through ServoController (startMove); the old
+// direct-write sweeps are gone.
 
 #ifndef SCANNING_SYSTEM_H
 #define SCANNING_SYSTEM_H
@@ -8,24 +10,109 @@
 #include "SpatialMemory.h"
 #include "ServoController.h"
 #include "MovementStyle.h"
+#include "UltrasonicRanger.h"
+#include "Telemetry.h"
+#include "Log.h"
 
 extern Servo baseServo;
 extern Servo nodServo;
 extern Servo tiltServo;
 
 // Forward declaration of checkUltra
-int checkUltra(int theEchoPin, int theTrigPin);
+UltrasonicReading checkUltra(int theEchoPin, int theTrigPin);
 
 // Note: echoPin and trigPin are defined as macros in LittleBots_Board_Pins.h
 // No need to declare them here
 
+// Sweep points (base angle, nod) — the peripheral U-sweep alternates
+// direction per layer, the foveal spiral is relative to the centre
+#define SCAN_PERIPHERAL_POINTS 15
+#define SCAN_FOVEAL_POINTS     10
+
+// Sweeps run one point per step: start*() moves to the first point and
+// returns, update() (behavior task) notes when the move arrives and
+// reads the first ping fired after that, then starts the next move.
+// A ping already in flight during the move never counts. Nothing waits.
+enum ScanKind : uint8_t { SCAN_NONE, SCAN_PERIPHERAL, SCAN_FOVEAL };
+
 class ScanningSystem {
 private:
   int currentScanDirection;
+
+  // Sweep in progress
+  ScanKind scanKind;
+  uint8_t scanPoint;          // Point being moved to / read
+  bool scanArrived;
+  uint32_t arrivedMs;         // Readings must come from pings fired after this
+  int scanCenterDirection;    // Foveal: direction every reading goes to
+  int scanCenterAngle;
+  SpatialMemory* scanMemory;
+  ServoController* scanServos;
+  MovementStyleParams scanStyle;
+
+  uint8_t scanPointCount() const {
+    return scanKind == SCAN_PERIPHERAL ? SCAN_PERIPHERAL_POINTS : SCAN_FOVEAL_POINTS;
+  }
+
+  void scanPointAt(uint8_t i, int& base, int& nod) const {
+    if (scanKind == SCAN_PERIPHERAL) {
+      static const int angles[5] = {10, 45, 90, 135, 170};
+      static const int heights[3] = {95, 120, 140};
+      int layer = i / 5;
+      int col = (layer % 2 == 0) ? i % 5 : 4 - i % 5;   // Left→Right, Right→Left, Left→Right
+      base = angles[col];
+      nod = heights[layer];
+    } else {
+      // Spiral out at low height, spiral in at high height
+      static const int pattern[SCAN_FOVEAL_POINTS][2] = {
+        {0, 110},   {-15, 110}, {15, 110},  {-30, 110}, {30, 110},
+        {30, 130},  {-30, 130}, {15, 130},  {-15, 130}, {0, 130}
+      };
+      base = constrain(scanCenterAngle + pattern[i][0], 10, 170);
+      nod = pattern[i][1];
+    }
+  }
+
+  void startScanMove() {
+    int base, nod;
+    scanPointAt(scanPoint, base, nod);
+    scanServos->startMove(base, nod, 85, scanStyle);
+    scanArrived = false;
+  }
+
+  void beginScan(ScanKind kind, SpatialMemory& memory, ServoController& servos,
+                 const MovementStyleParams& style) {
+    scanKind = kind;
+    scanPoint = 0;
+    scanMemory = &memory;
+    scanServos = &servos;
+    scanStyle = style;
+    startScanMove();
+  }
+
+  void finishScan() {
+    // Return to neutral / centre
+    if (scanKind == SCAN_PERIPHERAL) {
+      scanServos->startMove(90, 110, 85, scanStyle);
+      LOG_PRINTLN(SCAN, DEBUG, "[PERIPHERAL] Smooth U-sweep complete (15 positions)\n");
+    } else {
+      scanServos->startMove(scanCenterAngle, 120, 85, scanStyle);
+      LOG_PRINTLN(SCAN, DEBUG, "[FOVEAL] Optimized spiral complete (10 positions)\n");
+    }
+    scanKind = SCAN_NONE;
+  }
   
 public:
   ScanningSystem() {
     currentScanDirection = 0;
+    scanKind = SCAN_NONE;
+    scanPoint = 0;
+    scanArrived = false;
+    arrivedMs = 0;
+    scanCenterDirection = 0;
+    scanCenterAngle = 90;
+    scanMemory = nullptr;
+    scanServos = nullptr;
   }
   
   // ============================================
@@ -37,208 +124,73 @@ public:
     int currentNod = nodServo.read();
     int direction = angleToDirection(currentBase, currentNod);
     
-    float distance = checkUltra(echoPin, trigPin);
-    memory.updateReading(direction, distance);
+    UltrasonicReading ping = checkUltra(echoPin, trigPin);
+    if (!ping.valid) return;   // No echo: nothing to learn about this direction
+    memory.updateReading(direction, ping.cm);
   }
   
   // ============================================
   // TIER 2: PERIPHERAL SWEEP (with animation)
   // ============================================
   
-  // Legacy version (without smooth animation)
-  void peripheralSweepOptimized(SpatialMemory& memory) {
-    Serial.println("\n[PERIPHERAL] Basic U-sweep (legacy)");
-    
-    int angles[5] = {10, 45, 90, 135, 170};
-    int heights[3] = {95, 120, 140};
-    
-    for (int layer = 0; layer < 3; layer++) {
-      int startIdx = (layer % 2 == 0) ? 0 : 4;
-      int endIdx = (layer % 2 == 0) ? 5 : -1;
-      int step = (layer % 2 == 0) ? 1 : -1;
-      
-      for (int i = startIdx; i != endIdx; i += step) {
-        baseServo.write(angles[i]);
-        nodServo.write(heights[layer]);
-        tiltServo.write(85);
-        delay(150);
-        
-        float distance = checkUltra(echoPin, trigPin);
-        memory.updateReading(angleToDirection(angles[i], heights[layer]), distance);
-      }
-    }
-    
-    baseServo.write(90);
-    nodServo.write(110);
-    Serial.println("[PERIPHERAL] U-sweep complete\n");
-  }
-  
-  // NEW: Smooth animation version
-  void peripheralSweepOptimized(SpatialMemory& memory, ServoController& servos, 
-                                MovementStyleParams& style) {
-    Serial.println("\n[PERIPHERAL] Optimized U-sweep with smooth animation");
-    
-    int angles[5] = {10, 45, 90, 135, 170};
-    int heights[3] = {95, 120, 140};
-    
-    Serial.println("  Pattern: Left→Right (low), Right→Left (mid), Left→Right (high)");
-    
-    // Bottom sweep: Left to Right at LOW height
-    Serial.println("  Layer 1 (low) →");
-    for (int i = 0; i < 5; i++) {
-      servos.smoothMoveTo(angles[i], heights[0], 85, style);
-      delay(150);
-      
-      float distance = checkUltra(echoPin, trigPin);
-      memory.updateReading(angleToDirection(angles[i], heights[0]), distance);
-      
-      if (i % 2 == 0) {
-        Serial.print("    ");
-        Serial.print(angles[i]);
-        Serial.print("°: ");
-        Serial.print(distance);
-        Serial.println("cm");
-      }
-    }
-    
-    // Middle sweep: Right to Left at MID height
-    Serial.println("  Layer 2 (mid) ←");
-    for (int i = 4; i >= 0; i--) {
-      servos.smoothMoveTo(angles[i], heights[1], 85, style);
-      delay(150);
-      
-      float distance = checkUltra(echoPin, trigPin);
-      memory.updateReading(angleToDirection(angles[i], heights[1]), distance);
-      
-      if (i % 2 == 0) {
-        Serial.print("    ");
-        Serial.print(angles[i]);
-        Serial.print("°: ");
-        Serial.print(distance);
-        Serial.println("cm");
-      }
-    }
-    
-    // Top sweep: Left to Right at HIGH height
-    Serial.println("  Layer 3 (high) →");
-    for (int i = 0; i < 5; i++) {
-      servos.smoothMoveTo(angles[i], heights[2], 85, style);
-      delay(150);
-      
-      float distance = checkUltra(echoPin, trigPin);
-      memory.updateReading(angleToDirection(angles[i], heights[2]), distance);
-      
-      if (i % 2 == 0) {
-        Serial.print("    ");
-        Serial.print(angles[i]);
-        Serial.print("°: ");
-        Serial.print(distance);
-        Serial.println("cm");
-      }
-    }
-    
-    // Return to neutral
-    Serial.println("  Returning to center");
-    servos.smoothMoveTo(90, 110, 85, style);
-    
-    Serial.println("[PERIPHERAL] Smooth U-sweep complete (15 positions)\n");
+  // Three layers of five points: Left→Right (low), Right→Left (mid),
+  // Left→Right (high). False if a sweep is already running.
+  bool startPeripheralSweep(SpatialMemory& memory, ServoController& servos,
+                            const MovementStyleParams& style) {
+    if (scanKind != SCAN_NONE) return false;
+    LOG_PRINTLN(SCAN, DEBUG, "\n[PERIPHERAL] Optimized U-sweep with smooth animation");
+    beginScan(SCAN_PERIPHERAL, memory, servos, style);
+    return true;
   }
   
   // ============================================
   // TIER 3: FOVEAL SCAN
   // ============================================
   
-  // Legacy version
-  void fovealScan(int centerDirection, SpatialMemory& memory) {
-    Serial.print("\n[FOVEAL] Basic spiral scan dir ");
-    Serial.println(centerDirection);
-    
-    int centerAngle = directionToAngle(centerDirection);
-    
-    int pattern[][2] = {
-      {0, 110},   {-15, 110}, {15, 110},  {-30, 110}, {30, 110},
-      {30, 130},  {-30, 130}, {15, 130},  {-15, 130}, {0, 130}
-    };
-    
-    for (int i = 0; i < 10; i++) {
-      int targetBase = constrain(centerAngle + pattern[i][0], 10, 170);
-      int targetNod = pattern[i][1];
-      
-      baseServo.write(targetBase);
-      nodServo.write(targetNod);
-      tiltServo.write(85);
-      delay(300);
-      
-      float distance = checkUltra(echoPin, trigPin);
-      memory.updateReading(centerDirection, distance);
-    }
-    
-    baseServo.write(centerAngle);
-    nodServo.write(120);
-    
-    Serial.println("[FOVEAL] Spiral complete\n");
+  // Optimized pattern around centerDirection: spiral out at low height,
+  // spiral in at high height. False if a sweep is already running.
+  bool startFovealScan(int centerDirection, SpatialMemory& memory,
+                       ServoController& servos, const MovementStyleParams& style) {
+    if (scanKind != SCAN_NONE) return false;
+    LOG_PRINT(SCAN, DEBUG, "\n[FOVEAL] Optimized dual-spiral scan dir ");
+    LOG_PRINTLN(SCAN, DEBUG, centerDirection);
+    scanCenterDirection = centerDirection;
+    scanCenterAngle = directionToAngle(centerDirection);
+    beginScan(SCAN_FOVEAL, memory, servos, style);
+    return true;
   }
   
-  // NEW: Smooth animation version
-  void fovealScan(int centerDirection, SpatialMemory& memory, 
-                  ServoController& servos, MovementStyleParams& style) {
-    Serial.print("\n[FOVEAL] Optimized dual-spiral scan dir ");
-    Serial.println(centerDirection);
-    
-    int centerAngle = directionToAngle(centerDirection);
-    
-    // Optimized pattern: spiral out at low height, spiral in at high height
-    int pattern1[][2] = {
-      {0, 110},   {-15, 110}, {15, 110},  {-30, 110}, {30, 110}
-    };
-    
-    int pattern2[][2] = {
-      {30, 130},  {-30, 130}, {15, 130},  {-15, 130}, {0, 130}
-    };
-    
-    Serial.println("  Layer 1 (low): Center → outward spiral");
-    for (int i = 0; i < 5; i++) {
-      int targetBase = constrain(centerAngle + pattern1[i][0], 10, 170);
-      int targetNod = pattern1[i][1];
-      
-      servos.smoothMoveTo(targetBase, targetNod, 85, style);
-      delay(300);
-      
-      float distance = checkUltra(echoPin, trigPin);
-      memory.updateReading(centerDirection, distance);
-      
-      Serial.print("    ");
-      Serial.print(pattern1[i][0]);
-      Serial.print("° → ");
-      Serial.print(distance);
-      Serial.println("cm");
+  // Behavior task, every tick: a few comparisons until a point is reached
+  void update() {
+    if (scanKind == SCAN_NONE || scanServos->isBusy()) return;
+    
+    if (!scanArrived) {
+      scanArrived = true;
+      arrivedMs = millis();
+      return;
     }
-    
-    Serial.println("  Layer 2 (high): Inward spiral");
-    for (int i = 0; i < 5; i++) {
-      int targetBase = constrain(centerAngle + pattern2[i][0], 10, 170);
-      int targetNod = pattern2[i][1];
-      
-      servos.smoothMoveTo(targetBase, targetNod, 85, style);
-      delay(300);
-      
-      float distance = checkUltra(echoPin, trigPin);
-      memory.updateReading(centerDirection, distance);
-      
-      Serial.print("    ");
-      Serial.print(pattern2[i][0]);
-      Serial.print("° → ");
-      Serial.print(distance);
-      Serial.println("cm");
+    UltrasonicReading ping;
+    if (!ultrasonic.readingFiredSince(arrivedMs, ping)) return;   // Next ping not out yet
+    
+    // No echo: step on without a reading for this point
+    if (ping.valid) {
+      int base, nod;
+      scanPointAt(scanPoint, base, nod);
+      int dir = (scanKind == SCAN_PERIPHERAL) ? angleToDirection(base, nod) : scanCenterDirection;
+      scanMemory->updateReading(dir, ping.cm);
+      TELEMETRY(TEL_SCAN_READING, base, nod, (int32_t)(ping.cm * 10), dir);
     }
     
-    // Return to center
-    servos.smoothMoveTo(centerAngle, 120, 85, style);
-    
-    Serial.println("[FOVEAL] Optimized spiral complete (10 positions)");
-    Serial.println("  Movement efficiency: 37% better than sequential\n");
+    if (++scanPoint < scanPointCount()) startScanMove();
+    else finishScan();
   }
   
+  bool isScanning() const { return scanKind != SCAN_NONE; }
+  
+  // Drop the sweep (reflex took the servos); the move in flight is the
+  // caller's to stop
+  void cancelScan() { scanKind = SCAN_NONE; }
+  
   // ============================================
   // UTILITY
   // ============================================
@@ -265,24 +217,13 @@ public:
     return names[direction % 8];
   }
   
-  void orientToDirection(int direction) {
-    Serial.print("[ORIENT] Moving to dir ");
-    Serial.println(direction);
-    
-    int targetAngle = directionToAngle(direction);
-    
-    baseServo.write(targetAngle);
-    nodServo.write(110);
-    tiltServo.write(85);
-  }
-  
   void orientToDirection(int direction, ServoController& servos, 
-                        MovementStyleParams& style) {
-    Serial.print("[ORIENT] Smoothly moving to dir ");
-    Serial.println(direction);
+                        const MovementStyleParams& style) {
+    LOG_PRINT(SCAN, DEBUG, "[ORIENT] Smoothly moving to dir ");
+    LOG_PRINTLN(SCAN, DEBUG, direction);
     
     int targetAngle = directionToAngle(direction);
-    servos.smoothMoveTo(targetAngle, 110, 85, style);
+    servos.startMove(targetAngle, 110, 85, style);
   }
 };
 
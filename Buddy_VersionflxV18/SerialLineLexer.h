@@ -0,0 +1,199 @@
+/**
+ * SerialLineLexer.h - Non-blocking line lexer for the ESP32 UART link
+ *
+ * Replaces Stream::readBytesUntil() in parseVisionData(). That call waits
+ * up to the stream timeout (1 s default) whenever a line is only partly
+ * received, which stalls the 50Hz loop on every split FACE packet.
+ *
+ * The lexer consumes whatever bytes are already buffered, one at a time,
+ * and keeps a partial line across calls. When a '\n' completes a line it is
+ * classified by prefix and handed back to the caller — no allocation, no
+ * waiting, no String.
+ *
+ *   poll() → LINE_NONE      nothing complete yet (partial line kept)
+ *          → LINE_FACE      "FACE:..."
+ *          → LINE_NO_FACE   "NO_FACE..."
+ *          → LINE_VISION    "!VISION:..."
+ *          → LINE_COMMAND   "!..."       (AIBridge command)
+ *          → LINE_ESP32_READY / LINE_READY
+ *
+ * Lines longer than the buffer are dropped whole (counted as overflows)
+ * rather than split into garbage fragments. Lines with control bytes or an
+ * unknown prefix are dropped and counted as malformed.
+ *
+ * Each line is stamped with micros() when its '\n' is lexed. The sketch
+ * lexes from serialEvent1(), which the Teensy core runs from yield() — i.e.
+ * between loop() passes and inside every delay() — and parks the lines in a
+ * TimedLineRing, so the stamp is the arrival time rather than whenever the
+ * 50Hz loop gets to parseVisionData().
+ */
+
+#ifndef SERIAL_LINE_LEXER_H
+#define SERIAL_LINE_LEXER_H
+
+#include <Arduino.h>
+
+#define SERIAL_LINE_MAX 256   // Fits a full AI_BATCH_MAX_PAYLOAD !BATCH frame
+#define SERIAL_LINE_SLOTS 8   // Lexed lines waiting for parseVisionData()
+
+enum LineKind : uint8_t {
+  LINE_NONE,
+  LINE_FACE,
+  LINE_NO_FACE,
+  LINE_VISION,
+  LINE_COMMAND,
+  LINE_ESP32_READY,
+  LINE_READY
+};
+
+class SerialLineLexer {
+public:
+  // Health counters (shown in the performance profile)
+  unsigned long lines;        // Complete, classified lines
+  unsigned long overflows;    // Lines dropped for exceeding SERIAL_LINE_MAX
+  unsigned long malformed;    // Lines dropped for control bytes / unknown prefix
+
+  SerialLineLexer() : lines(0), overflows(0), malformed(0),
+                      len(0), state(LEX_LINE), badByte(false), lineReady(false),
+                      stampUs(0) {
+    buffer[0] = '\0';
+  }
+
+  // Consume buffered bytes until a line completes or the stream runs dry.
+  // Never blocks; a partial line stays here until its '\n' arrives.
+  LineKind poll(Stream& in) {
+    if (lineReady) reset();   // Previous line has been consumed by the caller
+
+    int avail = in.available();
+    while (avail-- > 0) {
+      int c = in.read();
+      if (c < 0) break;
+
+      if (state == LEX_DISCARD) {
+        if (c == '\n') reset();
+        continue;
+      }
+
+      if (c == '\n') {
+        LineKind kind = finishLine();
+        if (kind != LINE_NONE) {
+          stampUs = micros();
+          lineReady = true;
+          return kind;
+        }
+        reset();
+        continue;
+      }
+      if (c == '\r') continue;
+
+      if (len >= SERIAL_LINE_MAX - 1) {
+        overflows++;
+        state = LEX_DISCARD;
+        continue;
+      }
+      if (c < 0x20 || c == 0x7F) badByte = true;   // Noise on the wire
+      buffer[len++] = (char)c;
+    }
+    return LINE_NONE;
+  }
+
+  // Text of the line returned by the last poll() (valid until the next poll)
+  const char* line() const { return buffer; }
+  int length() const { return len; }
+  uint32_t arrivalUs() const { return stampUs; }
+
+  // Bytes of an unfinished line currently held
+  int pending() const { return (state == LEX_DISCARD || lineReady) ? 0 : len; }
+
+private:
+  enum LexState : uint8_t { LEX_LINE, LEX_DISCARD };
+
+  char buffer[SERIAL_LINE_MAX];
+  int len;
+  LexState state;
+  bool badByte;
+  bool lineReady;   // buffer holds a returned line until the next poll()
+  uint32_t stampUs;
+
+  void reset() {
+    len = 0;
+    state = LEX_LINE;
+    badByte = false;
+    lineReady = false;
+  }
+
+  LineKind finishLine() {
+    if (len == 0) return LINE_NONE;   // Blank line (stray CR/LF) — ignore
+    buffer[len] = '\0';
+
+    LineKind kind = classify();
+    if (badByte || kind == LINE_NONE) {
+      malformed++;
+      return LINE_NONE;
+    }
+    lines++;
+    return kind;
+  }
+
+  LineKind classify() const {
+    switch (buffer[0]) {
+      case 'F': return strncmp(buffer, "FACE:", 5) == 0 ? LINE_FACE : LINE_NONE;
+      case 'N': return strncmp(buffer, "NO_FACE", 7) == 0 ? LINE_NO_FACE : LINE_NONE;
+      case '!': return strncmp(buffer, "!VISION:", 8) == 0 ? LINE_VISION : LINE_COMMAND;
+      case 'E': return strncmp(buffer, "ESP32_READY", 11) == 0 ? LINE_ESP32_READY : LINE_NONE;
+      case 'R': return strncmp(buffer, "READY", 5) == 0 ? LINE_READY : LINE_NONE;
+      default:  return LINE_NONE;
+    }
+  }
+};
+
+// ============================================================================
+// TIMESTAMPED LINE RING
+// Single producer (serialEvent1) / single consumer (parseVisionData). Both
+// run on the main thread — yield() only calls serialEvent1 between
+// statements — so a slot being handled is never overwritten: it is only
+// released once the handler returns, even if the handler calls delay().
+// ============================================================================
+
+struct TimedLine {
+  LineKind kind;
+  uint16_t len;
+  uint32_t arrivalUs;       // micros() when the line's '\n' was lexed
+  char text[SERIAL_LINE_MAX];
+};
+
+class TimedLineRing {
+public:
+  unsigned long highWater;  // Most lines ever queued at once
+
+  TimedLineRing() : highWater(0), head(0), tail(0) {}
+
+  bool full() const { return (uint8_t)(head - tail) >= SERIAL_LINE_SLOTS; }
+  bool empty() const { return head == tail; }
+  uint8_t count() const { return (uint8_t)(head - tail); }
+
+  // Copy the lexer's current line in. Caller checks full() first.
+  void push(const SerialLineLexer& lexer, LineKind kind) {
+    TimedLine& slot = slots[head % SERIAL_LINE_SLOTS];
+    slot.kind = kind;
+    slot.len = (uint16_t)lexer.length();
+    slot.arrivalUs = lexer.arrivalUs();
+    memcpy(slot.text, lexer.line(), slot.len + 1);
+    head++;
+    if (count() > highWater) highWater = count();
+  }
+
+  // Oldest line, or nullptr. Stays valid until release().
+  const TimedLine* peek() const {
+    return empty() ? nullptr : &slots[tail % SERIAL_LINE_SLOTS];
+  }
+
+  void release() { if (!empty()) tail++; }
+
+private:
+  TimedLine slots[SERIAL_LINE_SLOTS];
+  volatile uint8_t head;
+  volatile uint8_t tail;
+};
+
+#endif // SERIAL_LINE_LEXER_H
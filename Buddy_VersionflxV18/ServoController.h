@@ -7,12 +7,20 @@
 
 #include <Servo.h>
 #include "MovementStyle.h"
+#include "MotionEngine.h"
+#include "PoseCompositor.h"
+#include "MotionLut.h"
+#include "ServoOutput.h"
+#include "Log.h"
 
 // Forward declarations
 extern Servo baseServo;
 extern Servo nodServo;
 extern Servo tiltServo;
 
+// Runs while smoothMoveTo() waits for its move (main .ino: urgent tasks)
+typedef void (*MotionWaitHook)();
+
 // Track current positions
 struct ServoState {
   int basePos;
@@ -25,39 +33,43 @@ class ServoController {
 private:
   ServoState state;
   
-  // Easing curves
-  float easeInOut(float t) {
-    // Smooth acceleration and deceleration
-    return t * t * (3.0f - 2.0f * t);
-  }
-  
-  float easeInOutCubic(float t) {
-    // More pronounced ease
-    return t < 0.5f ? 4.0f * t * t * t : 1.0f - pow(-2.0f * t + 2.0f, 3.0f) / 2.0f;
-  }
-  
-  float linear(float t) {
-    return t;
+  // Move in progress (advanced by updateMotion) and the wait around it
+  MotionEngine motion;
+  MotionWaitHook waitHook;
+  bool waiting;
+  bool sequence;               // A step machine owns the servos between moves
+
+  // Layers over the base pose (PoseCompositor.h) and the output stage
+  // they are written through (ServoOutput.h)
+  PoseCompositor layers;
+  ServoOutput output;
+  float breathPhase;           // Turns, 0..1
+  unsigned long lastBreath;
+
+  // Base layer: the axes a move drives
+  void setBase(const int pos[MOTION_AXES], uint8_t mask) {
+    if (mask & (1 << AXIS_BASE)) state.basePos = pos[AXIS_BASE];
+    if (mask & (1 << AXIS_NOD))  state.nodPos = pos[AXIS_NOD];
+    if (mask & (1 << AXIS_TILT)) state.tiltPos = pos[AXIS_TILT];
+    state.lastUpdate = millis();
   }
-  
-  float applyEasing(float t, float smoothness) {
-    if (smoothness > 0.75f) {
-      return easeInOutCubic(t);  // Very smooth, confident
-    } else if (smoothness > 0.5f) {
-      return easeInOut(t);  // Moderately smooth
-    } else {
-      return linear(t);  // Direct, mechanical
+
+  // The only servo write: compose every layer, hand the float pose to
+  // the output stage (clamp, slew, calibration, skip if unchanged)
+  void writeOutput() {
+    unsigned long now = millis();
+    int base[MOTION_AXES] = { state.basePos, state.nodPos, state.tiltPos };
+    float out[MOTION_AXES];
+    layers.compose(base, now, out);
+    for (int a = 0; a < MOTION_AXES; a++) {
+      output.write((MotionAxis)a, out[a], now);
     }
   }
-  
-  int addJitter(int value, float jitterAmount) {
-    if (jitterAmount < 0.01f) return value;
-    int maxJitter = (int)(jitterAmount * 8.0f);
-    return value + random(-maxJitter, maxJitter + 1);
-  }
-  
+
 public:
-  ServoController() {
+  ServoController()
+    : waitHook(nullptr), waiting(false), sequence(false), output(baseServo, nodServo, tiltServo),
+      breathPhase(0.0f), lastBreath(0) {
     state.basePos = 90;
     state.nodPos = 110;
     state.tiltPos = 85;
@@ -70,191 +82,213 @@ public:
     state.tiltPos = tilt;
     state.lastUpdate = millis();
     
-    baseServo.write(base);
-    nodServo.write(nod);
-    tiltServo.write(tilt);
+    output.writeNow(AXIS_BASE, base, state.lastUpdate);
+    output.writeNow(AXIS_NOD, nod, state.lastUpdate);
+    output.writeNow(AXIS_TILT, tilt, state.lastUpdate);
   }
   
   // ============================================
   // SMOOTH MOVEMENT (uses MovementStyle)
+  // startMove() only sets up the trajectory; the motion task advances it
+  // with updateMotion(). smoothMoveTo() keeps the old blocking contract,
+  // but the wait runs the wait hook (vision intake, reflex, queued
+  // commands) instead of sleeping.
+  //
+  // The hook runs CRITICAL/HIGH tasks only (runUrgent), so NORMAL and
+  // LOW tasks stall for the whole move: smoothMoveTo() is for setup()
+  // (startup animation) only. Everything under the main loop uses
+  // startMove() and checks isBusy() on a later tick — a clip, or a step
+  // machine like BehaviorEngine's behavior steps and ScanningSystem's
+  // sweeps, which flag themselves with setSequenceActive().
   // ============================================
-  
-  void smoothMoveTo(int baseTarget, int nodTarget, int tiltTarget, 
-                    MovementStyleParams& style) {
-    
-    int baseStart = state.basePos;
-    int nodStart = state.nodPos;
-    int tiltStart = state.tiltPos;
-
-    // Calculate distances
-    int baseDist = abs(baseTarget - baseStart);
-    int nodDist = abs(nodTarget - nodStart);
-    int tiltDist = abs(tiltTarget - tiltStart);
-    
-    // Find longest distance (determines step count)
-    int maxDist = max(baseDist, max(nodDist, tiltDist));
-    
+
+  void startMove(int baseTarget, int nodTarget, int tiltTarget,
+                 const MovementStyleParams& style, MotionEase ease = MOTION_EASE_STYLE) {
+    MotionTrajectory traj;
+    traj.start[AXIS_BASE] = state.basePos;
+    traj.start[AXIS_NOD] = state.nodPos;
+    traj.start[AXIS_TILT] = state.tiltPos;
+    traj.target[AXIS_BASE] = baseTarget;
+    traj.target[AXIS_NOD] = nodTarget;
+    traj.target[AXIS_TILT] = tiltTarget;
+
+    // Longest distance determines the step count
+    int maxDist = 0;
+    for (int a = 0; a < MOTION_AXES; a++) {
+      maxDist = max(maxDist, abs(traj.target[a] - traj.start[a]));
+    }
+
     if (maxDist < 2) {
       // Already at target
+      motion.cancel();
       state.basePos = baseTarget;
       state.nodPos = nodTarget;
       state.tiltPos = tiltTarget;
       return;
     }
-    
-    // Calculate step count based on speed and distance
+
     // Fast speed = fewer steps, slow speed = more steps
-    int baseSteps = (int)(maxDist * (2.0f - style.speed));
-    baseSteps = constrain(baseSteps, 5, 40);  // Min 5, max 40 steps
-    
-    // Jitter amount from smoothness (inverse)
+    traj.steps = constrain((int)(maxDist * (2.0f - style.speed)), 5, 40);
+    traj.stepMs = constrain(style.delayMs, 5, 50);
+    traj.axisMask = MOTION_ALL_AXES;
+
+    // Jitter amount from smoothness (inverse) — anxious/jerky styles
     float jitterAmount = constrain(1.0f - style.smoothness, 0.0f, 0.5f);
+    traj.jitterChance = (jitterAmount > 0.1f) ? 30 : 0;
+    traj.jitterMax = (uint8_t)(jitterAmount * 8.0f);
+    traj.ease = ease;
+    traj.smoothness = style.smoothness;
+    traj.hesitation = style.hesitation;
 
-    // Interpolate
-    for (int step = 0; step <= baseSteps; step++) {
-      float t = (float)step / (float)baseSteps;
-      
-      // Apply easing curve
-      float eased = applyEasing(t, style.smoothness);
-      
-      // Calculate positions
-      int basePos = baseStart + (int)((baseTarget - baseStart) * eased);
-      int nodPos = nodStart + (int)((nodTarget - nodStart) * eased);
-      int tiltPos = tiltStart + (int)((tiltTarget - tiltStart) * eased);
-      
-      // Add jitter if low smoothness (anxious/jerky)
-      if (jitterAmount > 0.1f && random(100) < 30) {
-        basePos = addJitter(basePos, jitterAmount);
-        nodPos = addJitter(nodPos, jitterAmount);
-        tiltPos = addJitter(tiltPos, jitterAmount);
-      }
-      
-      // Clamp to safe ranges
-      basePos = constrain(basePos, 10, 170);
-      nodPos = constrain(nodPos, 80, 150);
-      tiltPos = constrain(tiltPos, 20, 150);
-      
-      // Write to servos
-      baseServo.write(basePos);
-      nodServo.write(nodPos);
-      tiltServo.write(tiltPos);
-      
-      // Update state
-      state.basePos = basePos;
-      state.nodPos = nodPos;
-      state.tiltPos = tiltPos;
-      
-      // Delay based on speed
-      int delayMs = constrain(style.delayMs, 5, 50);
-      delay(delayMs);
-      
-      // Add hesitation pauses
-      if (style.hesitation > 0.3f && random(100) < (unsigned int)(style.hesitation * 20.0f)) {
-        int pauseMs = (int)(style.hesitation * 150.0f);
-        delay(pauseMs);
-      }
-    }
-    
-    // Ensure we hit exact target
-    baseServo.write(baseTarget);
-    nodServo.write(nodTarget);
-    tiltServo.write(tiltTarget);
-    
-    state.basePos = baseTarget;
-    state.nodPos = nodTarget;
-    state.tiltPos = tiltTarget;
-    state.lastUpdate = millis();
+    motion.start(traj, millis());
   }
-  
+
+  void smoothMoveTo(int baseTarget, int nodTarget, int tiltTarget,
+                    MovementStyleParams& style) {
+    startMove(baseTarget, nodTarget, tiltTarget, style);
+    waitForMotion();
+  }
+
   // ============================================
   // SINGLE SERVO SMOOTH MOVE
+  // Starts the move and returns (isBusy() until it arrives); statePos
+  // is the caller's copy of the target. Only the three head servos run
+  // through ServoOutput — anything else is refused, not written raw.
   // ============================================
-  
-  void smoothMoveServo(Servo& servo, int target, MovementStyleParams& style, 
+
+  bool smoothMoveServo(Servo& servo, int target, const MovementStyleParams& style,
                        int& statePos) {
-    
+    int axis = (&servo == &baseServo) ? AXIS_BASE :
+               (&servo == &nodServo) ? AXIS_NOD :
+               (&servo == &tiltServo) ? AXIS_TILT : -1;
+    if (axis < 0) {
+      LOG_PRINTLN(SERVO, WARN, "[SERVO] smoothMoveServo: not a head servo, ignored");
+      return false;
+    }
+
     int start = statePos;
     int distance = abs(target - start);
-    
+
     if (distance < 2) {
       statePos = target;
-      return;
-    }
-    
-    int steps = (int)(distance * (2.0f - style.speed));
-    steps = constrain(steps, 3, 30);
-    
-    for (int step = 0; step <= steps; step++) {
-      float t = (float)step / (float)steps;
-      float eased = applyEasing(t, style.smoothness);
-      
-      int pos = start + (int)((target - start) * eased);
-      
-      // Jitter
-      if (style.smoothness < 0.5f && random(100) < 20) {
-        pos += random(-3, 4);
-      }
-      
-      pos = constrain(pos, 10, 170);  // Generic safe range
-      servo.write(pos);
-      statePos = pos;
-      
-      delay(constrain(style.delayMs, 5, 50));
+      return true;
     }
-    
-    servo.write(target);
+
+    MotionTrajectory traj;
+    getPosition(traj.start[AXIS_BASE], traj.start[AXIS_NOD], traj.start[AXIS_TILT]);
+    for (int a = 0; a < MOTION_AXES; a++) traj.target[a] = traj.start[a];
+    traj.start[axis] = start;
+    traj.target[axis] = target;
+    traj.axisMask = 1 << axis;
+    traj.steps = constrain((int)(distance * (2.0f - style.speed)), 3, 30);
+    traj.stepMs = constrain(style.delayMs, 5, 50);
+    traj.jitterChance = (style.smoothness < 0.5f) ? 20 : 0;
+    traj.jitterMax = 3;
+    traj.ease = MOTION_EASE_STYLE;
+    traj.smoothness = style.smoothness;
+    traj.hesitation = 0.0f;
+
+    motion.start(traj, millis());
     statePos = target;
+    return true;
   }
-  
+
+  // ============================================
+  // MOTION ENGINE DRIVE
+  // ============================================
+
+  // Called by the wait loop so the rest of the firmware keeps running
+  void setWaitHook(MotionWaitHook hook) { waitHook = hook; }
+
+  // Advance the move to the step that is due, if any, then write the
+  // composed pose (motion task, every tick)
+  void updateMotion() {
+    int pos[MOTION_AXES];
+    if (motion.update(millis(), pos)) setBase(pos, motion.axisMask());
+    writeOutput();
+  }
+
+  bool isBusy() const { return motion.isBusy(); }
+
+  // True while smoothMoveTo() is waiting — the wait hook is running
+  bool inMotionWait() const { return waiting; }
+
+  // Set by a step machine for as long as its sequence runs, so other
+  // movers (AI commands) wait for it as they wait for a clip
+  void setSequenceActive(bool active) { sequence = active; }
+  bool inSequence() const { return sequence; }
+
+  void stopMotion() { motion.cancel(); }
+
+  // Block until the current move ends. A move started from inside the
+  // wait hook only retargets: the outer wait carries it to completion.
+  void waitForMotion() {
+    if (waiting) return;
+    waiting = true;
+    while (motion.isBusy()) {
+      updateMotion();
+      if (waitHook != nullptr) waitHook();
+      if (motion.isBusy()) delay(1);   // yield() → serialEvent1() keeps lexing
+    }
+    waiting = false;
+  }
+
   // ============================================
   // INSTANT MOVEMENT (for emergency/startup)
   // ============================================
   
   void snapTo(int base, int nod, int tilt) {
-    baseServo.write(constrain(base, 10, 170));
-    nodServo.write(constrain(nod, 80, 150));
-    tiltServo.write(constrain(tilt, 20, 150));
-    
+    motion.cancel();
     state.basePos = base;
     state.nodPos = nod;
     state.tiltPos = tilt;
     state.lastUpdate = millis();
+    writeOutput();   // Now, not at the next motion tick
   }
   
+  // ============================================
+  // LAYERS (PoseCompositor.h) — offsets over the base pose,
+  // written with it by updateMotion()
+  // ============================================
+
+  void setLayer(PoseLayer layer, float base, float nod, float tilt) {
+    layers.setLayer(layer, base, nod, tilt);
+  }
+
+  void setLayerAxis(PoseLayer layer, MotionAxis axis, float degrees) {
+    layers.setLayerAxis(layer, axis, degrees);
+  }
+
+  void fadeLayer(PoseLayer layer) { layers.fadeLayer(layer); }
+
+  // Offset on one axis that returns by itself after ms
+  void nudge(MotionAxis axis, float degrees, uint16_t ms) {
+    layers.addPulse(axis, degrees, ms, millis());
+  }
+
   // ============================================
   // MICRO-MOVEMENTS (subtle life)
   // ============================================
   
+  // Breath layer: the phase carries over when the period changes
   void breathingMotion(float amplitude = 3.0f, int periodMs = 4000) {
     unsigned long now = millis();
-    float breathCycle = (now % periodMs) / (float)periodMs;
+    if (lastBreath != 0 && periodMs > 0) {
+      breathPhase += (now - lastBreath) / (float)periodMs;
+      if (breathPhase >= 1.0f) breathPhase -= floorf(breathPhase);
+    }
+    lastBreath = now;
     
     // Sine wave breathing
-    float breathOffset = sin(breathCycle * TWO_PI) * amplitude;
-    
-    int newNod = state.nodPos + (int)breathOffset;
-    newNod = constrain(newNod, 80, 150);
-    
-    nodServo.write(newNod);
-    // Don't update state.nodPos - this is a temporary offset
+    layers.setLayerAxis(LAYER_BREATH, AXIS_NOD, lutSinTurns(breathPhase) * amplitude);
   }
   
   void weightShift(float maxShift = 5.0f) {
-    int shift = random(-(int)maxShift, (int)maxShift + 1);
-    int newBase = constrain(state.basePos + shift, 10, 170);
-    
-    baseServo.write(newBase);
-    delay(200);
-    baseServo.write(state.basePos);  // Return
+    nudge(AXIS_BASE, random(-(int)maxShift, (int)maxShift + 1), 200);
   }
   
   void microTilt(float intensity = 1.0f) {
-    int shift = random(-4, 5) * intensity;
-    int newTilt = constrain(state.tiltPos + shift, 20, 150);
-
-    tiltServo.write(newTilt);
-    delay(100);
-    tiltServo.write(state.tiltPos);  // Return
+    nudge(AXIS_TILT, random(-4, 5) * intensity, 100);
   }
 
   // ============================================
@@ -263,37 +297,46 @@ public:
 
   /**
    * Direct servo write for reflexive control
-   * Bypasses all smoothing, easing, and interpolation
+   * Bypasses move styles and easing: the target goes straight to the
+   * tracking override, bounded only by the joint limits
    * Used by reflexive layer for fast face centering
    *
    * This is the "spinal reflex" pathway - below conscious control
    *
+   * Angles are floats: the output stage resolves ~0.1°, so sub-degree
+   * corrections reach the servos
+   *
    * @param base Target base servo angle (10-170°)
    * @param nod Target nod servo angle (80-150°)
-   * @param logOutput If true, print debug info (default: false)
+   * @param logOutput If true, print debug info (default: false; needs SERVO at TRACE)
    */
-  void directWrite(int base, int nod, bool logOutput = false) {
-    // Safety clamping
-    base = constrain(base, 10, 170);
-    nod = constrain(nod, 80, 150);
+  void directWrite(float base, float nod, bool logOutput = false) {
+    // The reflex pathway overrides any move in progress
+    motion.cancel();
 
-    // Write directly to servos (no interpolation)
-    baseServo.write(base);
-    nodServo.write(nod);
-    // Tilt not used for face tracking, keep current position
+    // Safety clamping
+    base = constrain(base, 10.0f, 170.0f);
+    nod = constrain(nod, 80.0f, 150.0f);
 
-    // Update state tracking
-    state.basePos = base;
-    state.nodPos = nod;
+    // Update state tracking (the base stays put when tracking lapses)
+    state.basePos = (int)lroundf(base);
+    state.nodPos = (int)lroundf(nod);
     state.lastUpdate = millis();
 
+    // Tracking override on base/nod, written now: it blends in over
+    // POSE_BLEND_MS when tracking starts and follows the target within
+    // the joint limits; tilt not used for face tracking, keeps its layers
+    float pose[MOTION_AXES] = { base, nod, (float)state.tiltPos };
+    layers.setTracking(pose, (1 << AXIS_BASE) | (1 << AXIS_NOD), state.lastUpdate);
+    writeOutput();
+
     // Optional debug output
-    if (logOutput) {
-      Serial.print("  [REFLEX WRITE] Base:");
-      Serial.print(base);
-      Serial.print("° Nod:");
-      Serial.print(nod);
-      Serial.println("°");
+    if (LOG_ENABLED(SERVO, TRACE) && logOutput) {
+      LOG_PRINT(SERVO, TRACE, "  [REFLEX WRITE] Base:");
+      LOG_PRINT(SERVO, TRACE, base, 1);
+      LOG_PRINT(SERVO, TRACE, "° Nod:");
+      LOG_PRINT(SERVO, TRACE, nod, 1);
+      LOG_PRINTLN(SERVO, TRACE, "°");
     }
   }
 
@@ -304,34 +347,36 @@ public:
    * @param base Target base servo angle (10-170°)
    * @param nod Target nod servo angle (80-150°)
    * @param tilt Target tilt servo angle (20-150°)
-   * @param logOutput If true, print debug info (default: false)
+   * @param logOutput If true, print debug info (default: false; needs SERVO at TRACE)
    */
-  void directWriteFull(int base, int nod, int tilt, bool logOutput = false) {
-    // Safety clamping
-    base = constrain(base, 10, 170);
-    nod = constrain(nod, 80, 150);
-    tilt = constrain(tilt, 20, 150);
+  void directWriteFull(float base, float nod, float tilt, bool logOutput = false) {
+    motion.cancel();
 
-    // Write directly to servos (no interpolation)
-    baseServo.write(base);
-    nodServo.write(nod);
-    tiltServo.write(tilt);
+    // Safety clamping
+    base = constrain(base, 10.0f, 170.0f);
+    nod = constrain(nod, 80.0f, 150.0f);
+    tilt = constrain(tilt, 20.0f, 150.0f);
 
     // Update state tracking
-    state.basePos = base;
-    state.nodPos = nod;
-    state.tiltPos = tilt;
+    state.basePos = (int)lroundf(base);
+    state.nodPos = (int)lroundf(nod);
+    state.tiltPos = (int)lroundf(tilt);
     state.lastUpdate = millis();
 
+    // Tracking override on all axes, written now (blends in as above)
+    float pose[MOTION_AXES] = { base, nod, tilt };
+    layers.setTracking(pose, MOTION_ALL_AXES, state.lastUpdate);
+    writeOutput();
+
     // Optional debug output
-    if (logOutput) {
-      Serial.print("  [REFLEX WRITE] Base:");
-      Serial.print(base);
-      Serial.print("° Nod:");
-      Serial.print(nod);
-      Serial.print("° Tilt:");
-      Serial.print(tilt);
-      Serial.println("°");
+    if (LOG_ENABLED(SERVO, TRACE) && logOutput) {
+      LOG_PRINT(SERVO, TRACE, "  [REFLEX WRITE] Base:");
+      LOG_PRINT(SERVO, TRACE, base, 1);
+      LOG_PRINT(SERVO, TRACE, "° Nod:");
+      LOG_PRINT(SERVO, TRACE, nod, 1);
+      LOG_PRINT(SERVO, TRACE, "° Tilt:");
+      LOG_PRINT(SERVO, TRACE, tilt, 1);
+      LOG_PRINTLN(SERVO, TRACE, "°");
     }
   }
 
@@ -362,17 +407,27 @@ public:
   // ============================================
   
   void printState() {
-    Serial.println("--- SERVO STATE ---");
-    Serial.print("  Base: ");
-    Serial.print(state.basePos);
-    Serial.print("° Nod: ");
-    Serial.print(state.nodPos);
-    Serial.print("° Tilt: ");
-    Serial.print(state.tiltPos);
-    Serial.println("°");
-    Serial.print("  Last update: ");
-    Serial.print((millis() - state.lastUpdate) / 1000.0f);
-    Serial.println(" seconds ago");
+    LOG_PRINTLN(SERVO, INFO, "--- SERVO STATE ---");
+    LOG_PRINT(SERVO, INFO, "  Base: ");
+    LOG_PRINT(SERVO, INFO, state.basePos);
+    LOG_PRINT(SERVO, INFO, "° Nod: ");
+    LOG_PRINT(SERVO, INFO, state.nodPos);
+    LOG_PRINT(SERVO, INFO, "° Tilt: ");
+    LOG_PRINT(SERVO, INFO, state.tiltPos);
+    LOG_PRINTLN(SERVO, INFO, "°");
+    LOG_PRINT(SERVO, INFO, "  Last update: ");
+    LOG_PRINT(SERVO, INFO, (millis() - state.lastUpdate) / 1000.0f);
+    LOG_PRINTLN(SERVO, INFO, " seconds ago");
+    LOG_PRINT(SERVO, INFO, "  Output: ");
+    LOG_PRINT(SERVO, INFO, output.getAngle(AXIS_BASE), 1);
+    LOG_PRINT(SERVO, INFO, "° / ");
+    LOG_PRINT(SERVO, INFO, output.getAngle(AXIS_NOD), 1);
+    LOG_PRINT(SERVO, INFO, "° / ");
+    LOG_PRINT(SERVO, INFO, output.getAngle(AXIS_TILT), 1);
+    LOG_PRINT(SERVO, INFO, "°  PWM writes ");
+    LOG_PRINT(SERVO, INFO, output.getWrites());
+    LOG_PRINT(SERVO, INFO, ", skipped ");
+    LOG_PRINTLN(SERVO, INFO, output.getSkipped());
   }
 };
 
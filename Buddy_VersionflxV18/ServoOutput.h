@@ -0,0 +1,117 @@
+/**
+ * ServoOutput.h - The one place servo angles become PWM pulses
+ *
+ * Every pose used to leave through Servo::write(int degrees): tracking
+ * corrections were quantized to whole degrees, and the same value was
+ * written again on every tick. ServoController now hands its composed
+ * float pose (PoseCompositor.h) to ServoOutput::write(), which per axis:
+ *
+ *   1. clamps to the calibrated safe range
+ *   2. limits the change to maxDegPerSec since the previous call
+ *   3. maps degrees to microseconds with the servo's own calibration
+ *   4. calls writeMicroseconds() only if the pulse width changed
+ *
+ * One microsecond is ~0.1°, so sub-degree reflex corrections reach the
+ * servos, and a pose that holds still costs no PWM register writes.
+ *
+ * Calibration: SERVO_CALIBRATION below. minUs/maxUs are the pulses at 0°
+ * and 180° (the Servo library defaults are 544/2400); trimUs shifts the
+ * whole range to correct a horn that is not mounted on centre.
+ */
+
+#ifndef SERVO_OUTPUT_H
+#define SERVO_OUTPUT_H
+
+#include <Arduino.h>
+#include <Servo.h>
+#include "MotionEngine.h"
+
+struct ServoCalibration {
+  uint16_t minUs;        // Pulse at 0°
+  uint16_t maxUs;        // Pulse at 180°
+  int16_t trimUs;        // Added to every pulse
+  float minDeg;          // Safe range
+  float maxDeg;
+  float maxDegPerSec;    // Slew limit (0 = none)
+};
+
+// Per servo, in MotionAxis order; safe ranges are the BodySchema joint
+// limits. Slew limits sit just under the servos' own no-load speed
+// (~0.1s/60°) and above the joints' vMax, so they only bite on snaps
+static const ServoCalibration SERVO_CALIBRATION[MOTION_AXES] = {
+  { 544, 2400, 0, BODY_JOINT_LIMITS[AXIS_BASE].minDeg, BODY_JOINT_LIMITS[AXIS_BASE].maxDeg, 500.0f },
+  { 544, 2400, 0, BODY_JOINT_LIMITS[AXIS_NOD].minDeg,  BODY_JOINT_LIMITS[AXIS_NOD].maxDeg,  400.0f },
+  { 544, 2400, 0, BODY_JOINT_LIMITS[AXIS_TILT].minDeg, BODY_JOINT_LIMITS[AXIS_TILT].maxDeg, 400.0f },
+};
+
+class ServoOutput {
+public:
+  ServoOutput(Servo& base, Servo& nod, Servo& tilt) : writes(0), skipped(0) {
+    servo[AXIS_BASE] = &base;
+    servo[AXIS_NOD] = &nod;
+    servo[AXIS_TILT] = &tilt;
+    for (int a = 0; a < MOTION_AXES; a++) {
+      cal[a] = SERVO_CALIBRATION[a];
+      angle[a] = 0.0f;
+      lastUs[a] = 0;
+      lastAt[a] = 0;
+    }
+  }
+
+  void setCalibration(MotionAxis axis, const ServoCalibration& c) {
+    cal[axis] = c;
+    lastUs[axis] = 0;   // Rewrite with the new mapping
+  }
+
+  // Slew-limited write; false if the pulse was unchanged and skipped
+  bool write(MotionAxis axis, float degrees, unsigned long now) {
+    const ServoCalibration& c = cal[axis];
+    float target = constrain(degrees, c.minDeg, c.maxDeg);
+
+    if (lastAt[axis] != 0 && c.maxDegPerSec > 0.0f) {
+      float maxStep = c.maxDegPerSec * (now - lastAt[axis]) / 1000.0f;
+      target = constrain(target, angle[axis] - maxStep, angle[axis] + maxStep);
+    }
+    lastAt[axis] = now;
+    angle[axis] = target;
+    return output(axis);
+  }
+
+  // Write at once, no slew limit (startup, calibration)
+  void writeNow(MotionAxis axis, float degrees, unsigned long now) {
+    angle[axis] = constrain(degrees, cal[axis].minDeg, cal[axis].maxDeg);
+    lastAt[axis] = now;
+    output(axis);
+  }
+
+  // Angle last sent (after clamp and slew)
+  float getAngle(MotionAxis axis) const { return angle[axis]; }
+  uint16_t getPulse(MotionAxis axis) const { return lastUs[axis]; }
+
+  unsigned long getWrites() const { return writes; }
+  unsigned long getSkipped() const { return skipped; }
+
+private:
+  Servo* servo[MOTION_AXES];
+  ServoCalibration cal[MOTION_AXES];
+  float angle[MOTION_AXES];
+  uint16_t lastUs[MOTION_AXES];          // 0 = nothing written yet
+  unsigned long lastAt[MOTION_AXES];
+  unsigned long writes;
+  unsigned long skipped;
+
+  bool output(MotionAxis axis) {
+    const ServoCalibration& c = cal[axis];
+    uint16_t us = (uint16_t)(c.minUs + (c.maxUs - c.minUs) * angle[axis] / 180.0f + c.trimUs + 0.5f);
+    if (us == lastUs[axis]) {
+      skipped++;
+      return false;
+    }
+    servo[axis]->writeMicroseconds(us);
+    lastUs[axis] = us;
+    writes++;
+    return true;
+  }
+};
+
+#endif // SERVO_OUTPUT_H
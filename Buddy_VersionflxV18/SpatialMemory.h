@@ -6,6 +6,7 @@
 #define SPATIAL_MEMORY_H
 
 #include "Personality.h"
+#include "Log.h"
 
 struct SpatialBin {
   float averageDistance;      // Mean distance in this direction
@@ -241,7 +242,7 @@ public:
 
     // ═══════════════════════════════════════════════════════════════
     // PERFORMANCE: Serial spam removed - was printing 20-50 times/sec
-    // Each Serial.print() blocks for 1-2ms, causing cumulative lag
+    // Each LOG_PRINT(SPATIAL, INFO) blocks for 1-2ms, causing cumulative lag
     // Spatial memory still works correctly, just silently
     // ═══════════════════════════════════════════════════════════════
     // REMOVED: [SPATIAL] Face recorded debug spam
@@ -307,80 +308,80 @@ public:
   // ============================================
   
   void print() {
-    Serial.println("--- SPATIAL MEMORY (8 directions) ---");
+    LOG_PRINTLN(SPATIAL, INFO, "--- SPATIAL MEMORY (8 directions) ---");
     const char* dirNames[] = {"Front", "Front-R", "Right", "Back-R", 
                               "Back", "Back-L", "Left", "Front-L"};
     
     for (int i = 0; i < 8; i++) {
       if (bins[i].readingCount == 0) continue;
       
-      Serial.print("  ");
-      Serial.print(dirNames[i]);
-      Serial.print(": ");
-      Serial.print(bins[i].averageDistance, 0);
-      Serial.print("cm (var:");
-      Serial.print(bins[i].variance, 1);
-      Serial.print(" nov:");
-      Serial.print(bins[i].noveltyScore, 2);
-      Serial.print(" chg:");
-      Serial.print(bins[i].recentChange, 0);
-      Serial.print(" n=");
-      Serial.print(bins[i].readingCount);
+      LOG_PRINT(SPATIAL, INFO, "  ");
+      LOG_PRINT(SPATIAL, INFO, dirNames[i]);
+      LOG_PRINT(SPATIAL, INFO, ": ");
+      LOG_PRINT(SPATIAL, INFO, bins[i].averageDistance, 0);
+      LOG_PRINT(SPATIAL, INFO, "cm (var:");
+      LOG_PRINT(SPATIAL, INFO, bins[i].variance, 1);
+      LOG_PRINT(SPATIAL, INFO, " nov:");
+      LOG_PRINT(SPATIAL, INFO, bins[i].noveltyScore, 2);
+      LOG_PRINT(SPATIAL, INFO, " chg:");
+      LOG_PRINT(SPATIAL, INFO, bins[i].recentChange, 0);
+      LOG_PRINT(SPATIAL, INFO, " n=");
+      LOG_PRINT(SPATIAL, INFO, bins[i].readingCount);
       
       // NEW: Indicate if face detected in this direction
       if (hasFaceInDirection(i)) {
-        Serial.print(" FACE");
+        LOG_PRINT(SPATIAL, INFO, " FACE");
       }
       
-      Serial.println(")");
+      LOG_PRINTLN(SPATIAL, INFO, ")");
     }
     
-    Serial.print("  Overall dynamism: ");
-    Serial.println(getAverageDynamism(), 2);
-    Serial.print("  Total novelty: ");
-    Serial.println(getTotalNovelty(), 2);
-    Serial.print("  Human likely present: ");
-    Serial.println(likelyHumanPresent() ? "YES" : "NO");
+    LOG_PRINT(SPATIAL, INFO, "  Overall dynamism: ");
+    LOG_PRINTLN(SPATIAL, INFO, getAverageDynamism(), 2);
+    LOG_PRINT(SPATIAL, INFO, "  Total novelty: ");
+    LOG_PRINTLN(SPATIAL, INFO, getTotalNovelty(), 2);
+    LOG_PRINT(SPATIAL, INFO, "  Human likely present: ");
+    LOG_PRINTLN(SPATIAL, INFO, likelyHumanPresent() ? "YES" : "NO");
     
     // NEW: Face tracking diagnostics
     int faceCount = countVisibleFaces();
     if (faceCount > 0) {
-      Serial.print("  Faces detected: ");
-      Serial.print(faceCount);
-      Serial.print(" in direction(s): ");
+      LOG_PRINT(SPATIAL, INFO, "  Faces detected: ");
+      LOG_PRINT(SPATIAL, INFO, faceCount);
+      LOG_PRINT(SPATIAL, INFO, " in direction(s): ");
       for (int i = 0; i < 8; i++) {
         if (hasFaceInDirection(i)) {
-          Serial.print(i);
-          Serial.print(" ");
+          LOG_PRINT(SPATIAL, INFO, i);
+          LOG_PRINT(SPATIAL, INFO, " ");
         }
       }
-      Serial.println();
+      LOG_PRINTLN(SPATIAL, INFO);
       
       int closestDir = getClosestFaceDirection();
-      Serial.print("  Closest face: ");
-      Serial.print(dirNames[closestDir]);
-      Serial.print(" at ");
-      Serial.print(getFaceDistance(closestDir), 0);
-      Serial.println("cm");
+      LOG_PRINT(SPATIAL, INFO, "  Closest face: ");
+      LOG_PRINT(SPATIAL, INFO, dirNames[closestDir]);
+      LOG_PRINT(SPATIAL, INFO, " at ");
+      LOG_PRINT(SPATIAL, INFO, getFaceDistance(closestDir), 0);
+      LOG_PRINTLN(SPATIAL, INFO, "cm");
     }
   }
   
   void printCompact() {
-    Serial.print("  [MEMORY] Dyn:");
-    Serial.print(getAverageDynamism(), 2);
-    Serial.print(" Nov:");
-    Serial.print(getTotalNovelty(), 2);
-    Serial.print(" Human:");
-    Serial.print(likelyHumanPresent() ? "Y" : "N");
+    LOG_PRINT(SPATIAL, INFO, "  [MEMORY] Dyn:");
+    LOG_PRINT(SPATIAL, INFO, getAverageDynamism(), 2);
+    LOG_PRINT(SPATIAL, INFO, " Nov:");
+    LOG_PRINT(SPATIAL, INFO, getTotalNovelty(), 2);
+    LOG_PRINT(SPATIAL, INFO, " Human:");
+    LOG_PRINT(SPATIAL, INFO, likelyHumanPresent() ? "Y" : "N");
     
     // NEW: Add face count to compact view
     int faceCount = countVisibleFaces();
     if (faceCount > 0) {
-      Serial.print(" Faces:");
-      Serial.print(faceCount);
+      LOG_PRINT(SPATIAL, INFO, " Faces:");
+      LOG_PRINT(SPATIAL, INFO, faceCount);
     }
     
-    Serial.println();
+    LOG_PRINTLN(SPATIAL, INFO);
   }
 };
 
@@ -5,6 +5,7 @@
 // It answers: "How much does Buddy want to speak right now, and why?"
 //
 // Python reads the urge via QUERY and decides whether to let Buddy talk.
+// wantsToSpeak and trigger changes are also pushed as EVT: lines (AIEvents.h).
 
 #ifndef SPEECH_URGE_H
 #define SPEECH_URGE_H
@@ -12,6 +13,7 @@
 #include "Needs.h"
 #include "Emotion.h"
 #include "Personality.h"
+#include "AIEvents.h"
 
 // Why Buddy wants to speak
 enum SpeechTrigger {
@@ -46,6 +48,10 @@ private:
   // Cooldown tracking
   unsigned long lastTriggerTime[13]; // Per-trigger cooldowns
 
+  // Last state raised as an event (edges are reported, not levels)
+  bool reportedWants;
+  SpeechTrigger reportedTrigger;
+
   // Configuration
   static constexpr float URGE_THRESHOLD = 0.7f;       // Must exceed to signal readiness
   static constexpr float URGE_DECAY = 0.985f;          // Per-update decay (~1Hz)
@@ -66,6 +72,8 @@ public:
     facePresentPrev = false;
     recognizedFace = false;
     for (int i = 0; i < 13; i++) lastTriggerTime[i] = 0;
+    reportedWants = false;
+    reportedTrigger = TRIGGER_NONE;
   }
 
   // ============================================
@@ -79,6 +87,7 @@ public:
     // Don't build urge if we just spoke
     if (now - lastUtterance < MIN_UTTERANCE_GAP) {
       urge *= 0.95f;  // Faster decay during cooldown
+      raiseEdges();
       return;
     }
 
@@ -170,6 +179,22 @@ public:
       currentTrigger = TRIGGER_NONE;
       triggerIntensity = 0.0f;
     }
+
+    raiseEdges();
+  }
+
+  // Trigger changes first, so a speech_ready names the trigger already seen
+  void raiseEdges() {
+    if (currentTrigger != reportedTrigger) {
+      AI_EVENT(AI_EVT_SPEECH_TRIGGER, triggerName(reportedTrigger), triggerName(currentTrigger),
+               triggerIntensity);
+      reportedTrigger = currentTrigger;
+    }
+    bool wants = wantsToSpeak();
+    if (wants != reportedWants) {
+      AI_EVENT(wants ? AI_EVT_SPEECH_READY : AI_EVT_SPEECH_CLEARED, triggerName(currentTrigger), "", urge);
+      reportedWants = wants;
+    }
   }
 
   // ============================================
@@ -197,6 +222,7 @@ public:
     urge = 0.0f;
     currentTrigger = TRIGGER_NONE;
     triggerIntensity = 0.0f;
+    raiseEdges();
   }
 
   // ============================================
@@ -208,8 +234,10 @@ public:
   float getTriggerIntensity() const { return triggerIntensity; }
   bool isFacePresent() const { return facePresent; }
 
-  const char* triggerToString() const {
-    switch(currentTrigger) {
+  const char* triggerToString() const { return triggerName(currentTrigger); }
+
+  static const char* triggerName(SpeechTrigger trigger) {
+    switch(trigger) {
       case TRIGGER_NONE: return "none";
       case TRIGGER_LONELY: return "lonely";
       case TRIGGER_BORED: return "bored";
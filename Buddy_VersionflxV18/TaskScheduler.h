@@ -0,0 +1,284 @@
+/**
+ * TaskScheduler.h - Deadline-based cooperative scheduler for the main loop
+ *
+ * A static table of periodic tasks replaces the ad hoc millis() gates in
+ * loop(). Each task has:
+ *   - period / phase   when it is due (phase staggers tasks with the same
+ *                      period so they don't all land on the same pass)
+ *   - priority         TASK_CRITICAL runs before TASK_HIGH before ... LOW;
+ *                      equal priorities run earliest-deadline-first
+ *   - budget           expected worst case in µs; runs longer than this
+ *                      count as overruns
+ *
+ * Low-priority work yields to the reflex path: a task whose recent worst
+ * case would run past the next deadline of a higher-priority task is
+ * deferred until that task has run, and the pass moves on to the next due
+ * task that fits in the gap. A deferred task is never starved — once it is
+ * SCHED_MAX_DEFER_US (or half a period) late it runs regardless, and its
+ * phase restarts from that run. Tasks on the call stack don't count as coming due: a CRITICAL task
+ * waiting in runUrgent() can't hold HIGH back.
+ *
+ * Cooperative only: a task that blocks (pulseIn, delay) still blocks
+ * everything. The WCET / overrun columns in printStats() show which ones.
+ * Code that has to wait on purpose (smoothMoveTo) calls runUrgent() in
+ * its wait loop, so CRITICAL/HIGH tasks keep running. Tasks already on
+ * the call stack are skipped, so none of them runs inside itself. Time
+ * spent in those nested runs is charged to them, not to the waiting task.
+ *
+ * Usage:
+ *   scheduler.addTask("reflex", reflexTask, 20, 0, TASK_HIGH, 500);
+ *   scheduler.start();
+ *   loop() { scheduler.runDue(); delay(scheduler.usUntilNextDue() / 1000); }
+ */
+
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <Arduino.h>
+
+#define SCHED_MAX_TASKS 20
+
+// Longest a task is held back for higher-priority work. The HIGH tasks
+// come due every few ms, so a task that doesn't fit a gap by then won't.
+#define SCHED_MAX_DEFER_US 10000UL
+
+static_assert(SCHED_MAX_TASKS <= 32, "runNext() tracks deferred picks in a uint32_t");
+
+typedef void (*TaskFunction)();
+
+enum TaskPriority : uint8_t {
+  TASK_CRITICAL = 0,   // Serial intake — everything downstream depends on it
+  TASK_HIGH,           // Reflex / servo output
+  TASK_NORMAL,         // Behavior, animation
+  TASK_LOW             // Telemetry, diagnostics, persistence
+};
+
+struct ScheduledTask {
+  const char* name;
+  TaskFunction fn;
+  uint32_t periodUs;
+  uint32_t budgetUs;
+  uint32_t nextDueUs;
+  TaskPriority priority;
+  bool enabled;
+  bool deferred;         // Currently held back for a higher-priority task
+  bool running;          // On the call stack (runUrgent() from inside it)
+
+  // Statistics (wcet / overruns etc. cover the window since resetStats())
+  unsigned long runs;
+  unsigned long overruns;    // Runs longer than budgetUs
+  unsigned long deferrals;   // Times it yielded to a higher-priority task
+  unsigned long missed;      // Whole periods skipped because it ran late
+  uint32_t lastUs;           // Duration of the last run (nested runs excluded)
+  uint32_t wcetUs;           // Worst case seen in this window
+  uint32_t wcetRecentUs;     // Decaying worst case (used for deferral decisions)
+  uint32_t maxLatenessUs;    // Worst start time past the deadline
+  uint64_t totalUs;
+};
+
+class TaskScheduler {
+public:
+  TaskScheduler() : count(0), selfUsTotal(0) {}
+
+  // Register a task. Returns its id, or -1 if the table is full.
+  int addTask(const char* name, TaskFunction fn, uint32_t periodMs,
+              uint32_t phaseMs, TaskPriority priority, uint32_t budgetUs) {
+    if (count >= SCHED_MAX_TASKS || fn == nullptr || periodMs == 0) return -1;
+    ScheduledTask& t = tasks[count];
+    t.name = name;
+    t.fn = fn;
+    t.periodUs = periodMs * 1000UL;
+    t.budgetUs = budgetUs;
+    t.nextDueUs = phaseMs * 1000UL;   // Relative until start()
+    t.priority = priority;
+    t.enabled = true;
+    t.deferred = false;
+    t.running = false;
+    resetTaskStats(t);
+    return count++;
+  }
+
+  // Anchor every task's phase at the current time
+  void start() {
+    uint32_t now = micros();
+    for (int i = 0; i < count; i++) tasks[i].nextDueUs += now;
+  }
+
+  void setEnabled(int id, bool enabled) {
+    if (id < 0 || id >= count) return;
+    if (enabled && !tasks[id].enabled) tasks[id].nextDueUs = micros();
+    tasks[id].enabled = enabled;
+  }
+
+  // Run the most urgent due task at or above lowest priority. A task that
+  // has to yield is skipped and the next candidate tried.
+  // Returns false if nothing is runnable now.
+  bool runNext(TaskPriority lowest = TASK_LOW) {
+    uint32_t now = micros();
+    uint32_t skipped = 0;
+    int pick;
+    for (;;) {
+      pick = -1;
+      for (int i = 0; i < count; i++) {
+        const ScheduledTask& t = tasks[i];
+        if (!t.enabled || t.running || t.priority > lowest || !isDue(t, now)) continue;
+        if (skipped & (1UL << i)) continue;
+        if (pick < 0 || t.priority < tasks[pick].priority ||
+            (t.priority == tasks[pick].priority &&
+             (int32_t)(t.nextDueUs - tasks[pick].nextDueUs) < 0)) {
+          pick = i;
+        }
+      }
+      if (pick < 0) return false;
+      if (!shouldYield(tasks[pick], now, skipped)) break;
+
+      ScheduledTask& held = tasks[pick];
+      if (!held.deferred) held.deferrals++;
+      held.deferred = true;
+      skipped |= 1UL << pick;
+    }
+
+    ScheduledTask& t = tasks[pick];
+    uint32_t lateness = now - t.nextDueUs;
+    if (lateness > t.maxLatenessUs) t.maxLatenessUs = lateness;
+    bool forced = t.deferred && lateness >= maxDeferUs(t);   // Starvation guard
+    t.deferred = false;
+
+    uint32_t nestedBefore = selfUsTotal;
+    t.running = true;
+    t.fn();
+    t.running = false;
+
+    // Tasks run from runUrgent() inside fn() account for their own time
+    uint32_t end = micros();
+    uint32_t elapsed = (end - now) - (selfUsTotal - nestedBefore);
+    selfUsTotal += elapsed;
+    t.runs++;
+    t.lastUs = elapsed;
+    t.totalUs += elapsed;
+    if (elapsed > t.wcetUs) t.wcetUs = elapsed;
+    if (elapsed >= t.wcetRecentUs) t.wcetRecentUs = elapsed;
+    else t.wcetRecentUs -= (t.wcetRecentUs - elapsed) >> WCET_DECAY_SHIFT;
+    if (elapsed > t.budgetUs) t.overruns++;
+
+    if (forced) {
+      // It waited for others, not for itself: restart the phase from this
+      // run instead of charging the deferral as missed periods
+      t.nextDueUs = now + t.periodUs;
+      return true;
+    }
+
+    // Next deadline stays on the phase grid (no drift); periods that have
+    // already gone by are skipped and counted rather than run back-to-back
+    t.nextDueUs += t.periodUs;
+    while (isDue(t, end)) {
+      t.nextDueUs += t.periodUs;
+      t.missed++;
+    }
+    return true;
+  }
+
+  // Run every task that is due, each at most once per call
+  void runDue() {
+    for (int i = 0; i < count; i++) {
+      if (!runNext()) break;
+    }
+  }
+
+  // Same, for CRITICAL and HIGH only — called from inside a task that
+  // waits (servo motion), so vision intake and reflex don't stall
+  void runUrgent() {
+    for (int i = 0; i < count; i++) {
+      if (!runNext(TASK_HIGH)) break;
+    }
+  }
+
+  // Time until the next enabled task is due (0 if one is due now)
+  uint32_t usUntilNextDue() const {
+    uint32_t now = micros();
+    uint32_t best = 0xFFFFFFFFUL;
+    for (int i = 0; i < count; i++) {
+      const ScheduledTask& t = tasks[i];
+      if (!t.enabled) continue;
+      if (isDue(t, now)) return 0;
+      uint32_t wait = t.nextDueUs - now;
+      if (wait < best) best = wait;
+    }
+    return best;
+  }
+
+  int taskCount() const { return count; }
+  const ScheduledTask& task(int id) const { return tasks[id]; }
+
+  // One line per task: period, runs, avg/last/WCET vs budget, overruns...
+  void printStats(Print& out) const {
+    out.println("  Task        Prio  Period   Runs   Avg µs  Last µs  WCET µs  Budget  Over  Defer  Miss  Late µs");
+    for (int i = 0; i < count; i++) {
+      const ScheduledTask& t = tasks[i];
+      char line[128];
+      snprintf(line, sizeof(line),
+               "  %-10s  %4d  %5lums  %5lu  %7lu  %7lu  %7lu  %6lu  %4lu  %5lu  %4lu  %7lu%s",
+               t.name, (int)t.priority, (unsigned long)(t.periodUs / 1000), t.runs,
+               t.runs > 0 ? (unsigned long)(t.totalUs / t.runs) : 0UL,
+               (unsigned long)t.lastUs, (unsigned long)t.wcetUs, (unsigned long)t.budgetUs,
+               t.overruns, t.deferrals, t.missed, (unsigned long)t.maxLatenessUs,
+               t.enabled ? "" : "  (off)");
+      out.println(line);
+    }
+  }
+
+  void resetStats() {
+    for (int i = 0; i < count; i++) resetTaskStats(tasks[i]);
+  }
+
+private:
+  ScheduledTask tasks[SCHED_MAX_TASKS];
+  int count;
+  uint32_t selfUsTotal;   // Sum of every run's own time (wraps; only deltas used)
+
+  // wcetRecentUs follows a new peak at once and sinks a quarter of the
+  // way toward each shorter run, so a one-off stall stops deferring the
+  // task after a couple of dozen runs
+  static const uint8_t WCET_DECAY_SHIFT = 2;
+
+  static bool isDue(const ScheduledTask& t, uint32_t now) {
+    return (int32_t)(now - t.nextDueUs) >= 0;
+  }
+
+  // Hold a task back if, by its recent worst case, it would still be
+  // running when a higher-priority task comes due. Never past maxDeferUs().
+  // A running task (waiting in runUrgent() further up the stack) can't run
+  // again until it returns, and one already held back this pass (skipped)
+  // is waiting itself — neither is a reason to wait.
+  bool shouldYield(const ScheduledTask& t, uint32_t now, uint32_t skipped) const {
+    if (t.priority == TASK_CRITICAL) return false;
+    if (now - t.nextDueUs >= maxDeferUs(t)) return false;   // Starvation guard
+
+    for (int i = 0; i < count; i++) {
+      const ScheduledTask& hp = tasks[i];
+      if (!hp.enabled || hp.running || hp.priority >= t.priority) continue;
+      if (skipped & (1UL << i)) continue;
+      if (isDue(hp, now)) return true;
+      if (hp.nextDueUs - now < t.wcetRecentUs) return true;
+    }
+    return false;
+  }
+
+  static uint32_t maxDeferUs(const ScheduledTask& t) {
+    return t.periodUs / 2 < SCHED_MAX_DEFER_US ? t.periodUs / 2 : SCHED_MAX_DEFER_US;
+  }
+
+  static void resetTaskStats(ScheduledTask& t) {
+    t.runs = 0;
+    t.overruns = 0;
+    t.deferrals = 0;
+    t.missed = 0;
+    t.lastUs = 0;
+    t.wcetUs = 0;
+    t.wcetRecentUs = 0;
+    t.maxLatenessUs = 0;
+    t.totalUs = 0;
+  }
+};
+
+#endif // TASK_SCHEDULER_H
@@ -0,0 +1,268 @@
+/**
+ * Telemetry.h - Binary event records in a lock-free RAM ring
+ *
+ * Control-path code used to format text with a dozen Serial.print calls
+ * per message — milliseconds on the 50Hz thread whenever USB backed up.
+ * Now it calls TELEMETRY(id, args...) which stamps micros(), reserves a
+ * slot with one compare-and-swap and stores the record: well under a
+ * microsecond, safe from interrupts, never blocks. A full ring drops the
+ * record (counted) instead of waiting.
+ *
+ * A TASK_LOW scheduler task drains the ring over USB:
+ *   TELEM_TEXT    one readable line per record (default, serial monitor)
+ *   TELEM_BINARY  framed records for host/telemetry_decode.py
+ *   TELEM_OFF     records are consumed and discarded
+ *
+ * Binary frame (little-endian):
+ *   0xA5 0x7E  count  count × TelemetryWire  checksum
+ *   checksum = 8-bit sum of count and every record byte
+ *
+ * Events are declared once in TELEMETRY_EVENTS below; the host decoder
+ * reads this file for names and argument labels, so adding an event here
+ * is all that's needed. Labels ending in _x10 / _x100 are fixed-point,
+ * _4cc packs the first four ASCII characters of a name (scheduler task
+ * names are unique in their first four for this reason).
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include <Arduino.h>
+
+#define TELEMETRY_RING_SLOTS  256   // Power of two; 256 × 28 bytes ≈ 7 KB
+#define TELEMETRY_DRAIN_MAX   32    // Records per drain call
+#define TELEMETRY_MAGIC0      0xA5
+#define TELEMETRY_MAGIC1      0x7E
+
+// ============================================================================
+// EVENT TABLE — X(id, name, text_ms, arg0, arg1, arg2, arg3)   ("" = unused)
+// text_ms: minimum spacing of TELEM_TEXT lines for high-rate events (binary
+// output always carries every record)
+// ============================================================================
+
+#define TELEMETRY_EVENTS(X) \
+  X(TEL_BOOT,            "boot",              0,   "",          "",              "",             "") \
+  X(TEL_TASK_STATS,      "task",              0,   "name_4cc",  "runs",          "avg_us",       "wcet_us") \
+  X(TEL_TASK_FAULTS,     "task_faults",       0,   "name_4cc",  "overruns",      "deferrals",    "missed") \
+  X(TEL_TASK_LOAD,       "task_load",         0,   "load_x10",  "window_ms",     "",             "") \
+  X(TEL_LINK_STATS,      "esp32_link",        0,   "lines",     "overflows",     "malformed",    "parse_errors") \
+  X(TEL_LINK_QUEUE,      "esp32_queue",       0,   "budget_yields", "queue_peak", "slots",       "") \
+  X(TEL_ULTRA_STATS,     "ultrasonic",        0,   "pings",     "echoes",        "timeouts",     "age_ms") \
+  X(TEL_RANGE,           "range",             0,   "cm_x10",    "vel_x10",       "conf_x100",    "flags") \
+  X(TEL_RANGE_WARN,      "range_warn",        0,   "no_echo",   "outliers",      "window_s",     "") \
+  X(TEL_REFLEX_MODE,     "reflex_mode",       0,   "active",    "face_tracking", "behavior",     "") \
+  X(TEL_REFLEX_TIMEOUT,  "reflex_timeout",    0,   "reason",    "since_face_ms", "",             "") \
+  X(TEL_REFLEX_ERROR,    "reflex_error",      500, "face_x",    "face_y",        "err_x",        "err_y") \
+  X(TEL_REFLEX_CMD,      "reflex_cmd",        500, "pan_x100",  "tilt_x100",     "pan_deg",      "tilt_deg") \
+  X(TEL_REFLEX_LIMIT,    "reflex_limit",      2000, "base_req", "base",          "nod_req",      "nod") \
+  X(TEL_REFLEX_STUCK,    "reflex_stuck",      0,   "base",      "nod",           "",             "") \
+  X(TEL_BEHAVIOR_PATH,   "behavior_path",     0,   "reflex_fast", "",            "",             "") \
+  X(TEL_BEHAVIOR_EXEC,   "behavior_exec",     0,   "behavior",  "reflex_active", "face_tracking", "reflex_action") \
+  X(TEL_TRACK_LOCK,      "track_lock",        0,   "lock_ms",   "known",         "",             "") \
+  X(TEL_EXPLORE_MOVE,    "explore_move",      5000, "base",     "nod",           "tilt",         "") \
+  X(TEL_ATTENTION_SHIFT, "attention_shift",   0,   "from_dir",  "to_dir",        "from_x100",    "to_x100") \
+  X(TEL_ATTENTION_FORCE, "attention_force",   0,   "dir",       "strength_x100", "",             "") \
+  X(TEL_SCAN_READING,    "scan_reading",      0,   "base_deg",  "nod_deg",       "cm_x10",       "direction") \
+  X(TEL_DROPPED,         "telemetry_dropped", 0,   "count",     "",              "",             "")
+
+#define TELEMETRY_ENUM_ENTRY(id, name, text_ms, a0, a1, a2, a3) id,
+enum TelemetryEventId : uint16_t {
+  TELEMETRY_EVENTS(TELEMETRY_ENUM_ENTRY)
+  TEL_EVENT_COUNT
+};
+#undef TELEMETRY_ENUM_ENTRY
+
+enum TelemetryMode : uint8_t { TELEM_TEXT, TELEM_BINARY, TELEM_OFF };
+
+// On-the-wire record (24 bytes, packed by construction)
+struct TelemetryWire {
+  uint32_t timeUs;
+  uint16_t id;
+  uint16_t seq;        // Increments per record; gaps = lost in transit
+  int32_t args[4];
+};
+
+// ============================================================================
+// RING
+// ============================================================================
+
+class Telemetry {
+public:
+  volatile unsigned long dropped;    // Records lost to a full ring
+  unsigned long drained;             // Records written out (or discarded)
+
+  Telemetry() : dropped(0), drained(0), reported(0), head(0), tail(0), outMode(TELEM_TEXT) {
+    for (int i = 0; i < TELEMETRY_RING_SLOTS; i++) slots[i].commit = 0;
+    for (int i = 0; i < TEL_EVENT_COUNT; i++) lastTextMs[i] = 0;
+  }
+
+  // Append a record. Interrupt-safe and lock-free; drops if full.
+  bool log(uint16_t id, int32_t a0 = 0, int32_t a1 = 0, int32_t a2 = 0, int32_t a3 = 0) {
+    uint32_t t = micros();
+    uint32_t h = __atomic_load_n(&head, __ATOMIC_RELAXED);
+    do {
+      if (h - tail >= TELEMETRY_RING_SLOTS) {
+        dropped++;
+        return false;
+      }
+    } while (!__atomic_compare_exchange_n(&head, &h, h + 1, true,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_RELAXED));
+
+    Slot& s = slots[h & (TELEMETRY_RING_SLOTS - 1)];
+    s.rec.timeUs = t;
+    s.rec.id = id;
+    s.rec.seq = (uint16_t)h;
+    s.rec.args[0] = a0;
+    s.rec.args[1] = a1;
+    s.rec.args[2] = a2;
+    s.rec.args[3] = a3;
+    __atomic_store_n(&s.commit, h + 1, __ATOMIC_RELEASE);   // Publish last
+    return true;
+  }
+
+  // Write up to maxRecords committed records to out (main thread only)
+  int drain(Print& out, int maxRecords = TELEMETRY_DRAIN_MAX) {
+    TelemetryWire batch[TELEMETRY_DRAIN_MAX];
+    if (maxRecords > TELEMETRY_DRAIN_MAX) maxRecords = TELEMETRY_DRAIN_MAX;
+
+    int n = 0;
+    while (n < maxRecords) {
+      Slot& s = slots[tail & (TELEMETRY_RING_SLOTS - 1)];
+      if (__atomic_load_n(&s.commit, __ATOMIC_ACQUIRE) != tail + 1) break;   // Not written yet
+      batch[n++] = s.rec;
+      __atomic_store_n(&tail, tail + 1, __ATOMIC_RELEASE);
+    }
+    reportDrops();
+    if (n == 0) return 0;
+    drained += n;
+
+    if (outMode == TELEM_BINARY) {
+      writeFrame(out, batch, n);
+    } else if (outMode == TELEM_TEXT) {
+      for (int i = 0; i < n; i++) {
+        if (textThrottled(batch[i])) continue;
+        printRecord(out, batch[i]);
+      }
+    }
+    return n;
+  }
+
+  bool pending() const { return head != tail; }
+
+  void setMode(TelemetryMode m) { outMode = m; }
+  TelemetryMode mode() const { return outMode; }
+
+  static const char* eventName(uint16_t id) {
+    static const char* const names[] = {
+#define TELEMETRY_NAME_ENTRY(id, name, text_ms, a0, a1, a2, a3) name,
+      TELEMETRY_EVENTS(TELEMETRY_NAME_ENTRY)
+#undef TELEMETRY_NAME_ENTRY
+    };
+    return id < TEL_EVENT_COUNT ? names[id] : "?";
+  }
+
+  static uint16_t textIntervalMs(uint16_t id) {
+    static const uint16_t intervals[] = {
+#define TELEMETRY_TEXT_ENTRY(id, name, text_ms, a0, a1, a2, a3) text_ms,
+      TELEMETRY_EVENTS(TELEMETRY_TEXT_ENTRY)
+#undef TELEMETRY_TEXT_ENTRY
+    };
+    return id < TEL_EVENT_COUNT ? intervals[id] : 0;
+  }
+
+  static const char* argName(uint16_t id, int arg) {
+    static const char* const labels[][4] = {
+#define TELEMETRY_ARGS_ENTRY(id, name, text_ms, a0, a1, a2, a3) { a0, a1, a2, a3 },
+      TELEMETRY_EVENTS(TELEMETRY_ARGS_ENTRY)
+#undef TELEMETRY_ARGS_ENTRY
+    };
+    return (id < TEL_EVENT_COUNT && arg >= 0 && arg < 4) ? labels[id][arg] : "";
+  }
+
+  // Four ASCII characters packed into an int32 (for *_4cc arguments)
+  static int32_t fourCC(const char* s) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4 && s[i] != '\0'; i++) v |= (uint32_t)(uint8_t)s[i] << (8 * i);
+    return (int32_t)v;
+  }
+
+private:
+  struct Slot {
+    TelemetryWire rec;
+    volatile uint32_t commit;   // Ring index + 1 once rec is complete
+  };
+
+  Slot slots[TELEMETRY_RING_SLOTS];
+  unsigned long reported;
+  volatile uint32_t head;   // Next index to reserve (producers)
+  volatile uint32_t tail;   // Next index to drain (consumer)
+  TelemetryMode outMode;
+  uint32_t lastTextMs[TEL_EVENT_COUNT];
+
+  // Losses go in-band so they show up in the log itself. Only marked as
+  // reported once the record fits, so a full ring can't swallow the count.
+  void reportDrops() {
+    unsigned long total = dropped;
+    if (total == reported) return;
+    if (log(TEL_DROPPED, (int32_t)(total - reported))) reported = total;
+  }
+
+  // High-rate events are thinned out in text mode only
+  bool textThrottled(const TelemetryWire& r) {
+    uint16_t interval = textIntervalMs(r.id);
+    if (interval == 0 || r.id >= TEL_EVENT_COUNT) return false;
+    uint32_t ms = r.timeUs / 1000;
+    if (lastTextMs[r.id] != 0 && ms - lastTextMs[r.id] < interval) return true;
+    lastTextMs[r.id] = ms;
+    return false;
+  }
+
+  static void writeFrame(Print& out, const TelemetryWire* recs, int n) {
+    uint8_t header[3] = { TELEMETRY_MAGIC0, TELEMETRY_MAGIC1, (uint8_t)n };
+    uint8_t sum = (uint8_t)n;
+    const uint8_t* bytes = (const uint8_t*)recs;
+    size_t len = (size_t)n * sizeof(TelemetryWire);
+    for (size_t i = 0; i < len; i++) sum += bytes[i];
+
+    out.write(header, sizeof(header));
+    out.write(bytes, len);
+    out.write(&sum, 1);
+  }
+
+  static void printRecord(Print& out, const TelemetryWire& r) {
+    out.print("[T ");
+    out.print(r.timeUs / 1000);
+    out.print(".");
+    uint32_t frac = r.timeUs % 1000;
+    if (frac < 100) out.print("0");
+    if (frac < 10) out.print("0");
+    out.print(frac);
+    out.print("] ");
+    out.print(eventName(r.id));
+
+    for (int i = 0; i < 4; i++) {
+      const char* label = argName(r.id, i);
+      if (label[0] == '\0') continue;
+      out.print(" ");
+      out.print(label);
+      out.print("=");
+      size_t len = strlen(label);
+      if (len > 4 && strcmp(label + len - 4, "_4cc") == 0) {
+        for (int b = 0; b < 4; b++) {
+          char c = (char)((uint32_t)r.args[i] >> (8 * b));
+          if (c != '\0') out.print(c);
+        }
+      } else {
+        out.print(r.args[i]);
+      }
+    }
+    out.println();
+  }
+};
+
+// Firmware-wide instance, defined in the main .ino
+extern Telemetry telemetry;
+
+#define TELEMETRY(...) telemetry.log(__VA_ARGS__)
+
+#endif // TELEMETRY_H
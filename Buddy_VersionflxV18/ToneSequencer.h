@@ -0,0 +1,162 @@
+/**
+ * ToneSequencer.h - Non-blocking buzzer phrases
+ *
+ * Every sound used to be tone() / delay() in a row, so a 700 ms sigh held
+ * up the behavior task — and the vision, reflex and motion tasks queued
+ * behind it — until the last note ended.
+ *
+ * A phrase is now data: a constexpr array of ToneNotes (droidSpeak.h)
+ *
+ *   freq        Hz; 0 = rest
+ *   ms          how long the note sounds
+ *   gapMs       silence after it (0 = slide straight into the next note)
+ *   freqJitter  ± random Hz, rolled when the note starts
+ *   msJitter    ± random ms on the note and on the gap
+ *
+ * update() runs from the "sound" task every 5 ms and starts each note when
+ * its time comes. Note times add up from the phrase start, so a late tick
+ * shortens the next note instead of stretching the phrase.
+ *
+ *   play(phrase, priority)   replace whatever is playing, unless that has
+ *                            a higher priority (then false, nothing plays)
+ *   queue(phrase, priority)  play after the current and queued phrases
+ *                            (TONE_QUEUE_SIZE slots; false when full)
+ *   stop()                   silence and drop the queue
+ */
+
+#ifndef TONE_SEQUENCER_H
+#define TONE_SEQUENCER_H
+
+#include <Arduino.h>
+
+#define TONE_QUEUE_SIZE  4
+
+struct ToneNote {
+  uint16_t freq;
+  uint16_t ms;
+  uint16_t gapMs;
+  uint16_t freqJitter;
+  uint16_t msJitter;
+};
+
+struct TonePhrase {
+  const char* name;
+  const ToneNote* notes;
+  uint8_t count;
+};
+
+enum TonePriority : uint8_t { TONE_LOW, TONE_NORMAL, TONE_HIGH };
+
+#define TN(freq, ms) { freq, ms, 0, 0, 0 }
+#define TN_EX(freq, ms, gap, freqJitter, msJitter) { freq, ms, gap, freqJitter, msJitter }
+
+#define TONE_NOTES(notes) notes, (uint8_t)(sizeof(notes) / sizeof(notes[0]))
+
+class ToneSequencer {
+public:
+  explicit ToneSequencer(uint8_t pin)
+    : pin(pin), playing(false), inGap(false), index(0), priority(TONE_LOW),
+      phaseEnd(0), gapMs(0), head(0), pending(0) {
+    current = { nullptr, nullptr, 0 };
+  }
+
+  bool play(const TonePhrase& phrase, TonePriority prio = TONE_NORMAL) {
+    if (playing && priority > prio) return false;
+    pending = 0;
+    start(phrase, prio, millis());
+    return true;
+  }
+
+  bool queue(const TonePhrase& phrase, TonePriority prio = TONE_NORMAL) {
+    if (!playing) {
+      start(phrase, prio, millis());
+      return true;
+    }
+    if (pending >= TONE_QUEUE_SIZE) return false;
+    uint8_t slot = (head + pending) % TONE_QUEUE_SIZE;
+    waiting[slot] = phrase;
+    waitingPriority[slot] = prio;
+    pending++;
+    return true;
+  }
+
+  void stop() {
+    noTone(pin);
+    playing = false;
+    pending = 0;
+  }
+
+  void update(unsigned long now) {
+    while (playing && (long)(now - phaseEnd) >= 0) {
+      if (!inGap && gapMs > 0) {
+        noTone(pin);
+        inGap = true;
+        phaseEnd += gapMs;
+        continue;
+      }
+
+      if (++index < current.count) {
+        beginNote(phaseEnd);
+      } else if (pending > 0) {
+        TonePhrase next = waiting[head];
+        TonePriority prio = waitingPriority[head];
+        head = (head + 1) % TONE_QUEUE_SIZE;
+        pending--;
+        start(next, prio, phaseEnd);
+      } else {
+        noTone(pin);
+        playing = false;
+      }
+    }
+  }
+
+  bool isPlaying() const { return playing; }
+  const char* playingName() const { return playing ? current.name : nullptr; }
+
+private:
+  uint8_t pin;
+  bool playing;
+  bool inGap;
+  uint8_t index;
+  TonePriority priority;
+  TonePhrase current;
+  unsigned long phaseEnd;        // When the note (or its gap) ends
+  uint16_t gapMs;                // Gap after the sounding note, jitter rolled
+  TonePhrase waiting[TONE_QUEUE_SIZE];
+  TonePriority waitingPriority[TONE_QUEUE_SIZE];
+  uint8_t head;
+  uint8_t pending;
+
+  void start(const TonePhrase& phrase, TonePriority prio, unsigned long at) {
+    current = phrase;
+    priority = prio;
+    index = 0;
+    playing = phrase.count > 0;
+    if (playing) beginNote(at);
+    else noTone(pin);
+  }
+
+  void beginNote(unsigned long at) {
+    const ToneNote& n = current.notes[index];
+    long freq = n.freq;
+    long ms = n.ms;
+    long gap = n.gapMs;
+    if (n.freqJitter > 0 && freq > 0) freq += random(-(long)n.freqJitter, (long)n.freqJitter + 1);
+    if (n.msJitter > 0) {
+      ms += random(-(long)n.msJitter, (long)n.msJitter + 1);
+      if (gap > 0) gap += random(-(long)n.msJitter, (long)n.msJitter + 1);
+    }
+
+    if (freq > 0) tone(pin, max(freq, 31L));   // 31 Hz: lowest tone() handles
+    else noTone(pin);
+
+    phaseEnd = at + max(ms, 1L);
+    gapMs = (uint16_t)max(gap, 0L);
+    inGap = false;
+  }
+};
+
+// Firmware-wide instance on the buzzer, defined in the main .ino
+extern ToneSequencer toneSequencer;
+
+#endif // TONE_SEQUENCER_H
@@ -0,0 +1,190 @@
+/**
+ * UltrasonicRanger.h - Interrupt-driven, non-blocking HC-SR04 ranging
+ *
+ * Replaces pulseIn(echo, HIGH, 30000), which held the loop for up to 30ms
+ * (1.5 control periods at 50Hz) on every read and the full 30ms whenever
+ * nothing echoed back.
+ *
+ *   IntervalTimer (every pingIntervalMs)
+ *     → closes out the previous ping (no falling edge = timeout)
+ *     → fires the 10µs trigger pulse
+ *   Echo pin CHANGE interrupt
+ *     → rising edge: stamp micros()
+ *     → falling edge: pulse width → cm, publish with a new sequence number
+ *
+ * Pings keep running while the loop is busy, so latest() is never older
+ * than about one ping interval. Callers never wait: they read the most
+ * recent result, its sequence number and age. A caller that moved the
+ * head (scan sweeps) needs a ping fired after the move arrived, not
+ * one that was already in flight: readingFiredSince() returns false
+ * until such a ping has been published.
+ */
+
+#ifndef ULTRASONIC_RANGER_H
+#define ULTRASONIC_RANGER_H
+
+#include <Arduino.h>
+
+#define ULTRA_PING_INTERVAL_MS  60      // HC-SR04 needs ~60ms between pings
+#define ULTRA_MAX_ECHO_US       30000   // Same ceiling as the old pulseIn timeout
+#define ULTRA_US_PER_CM         58.2f
+#define ULTRA_MAX_RANGE_CM      400
+
+struct UltrasonicReading {
+  float cm;                 // Range (only meaningful when valid)
+  bool valid;               // false = no echo / out of range
+  uint32_t seq;             // Increments on every published ping (0 = none yet)
+  uint32_t timestampMs;     // millis() when it was published
+  uint32_t firedMs;         // millis() when its trigger pulse went out
+
+  unsigned long ageMs() const { return millis() - timestampMs; }
+};
+
+class UltrasonicRanger {
+public:
+  // Counters (read with interrupts enabled — approximate is fine)
+  volatile unsigned long pings;
+  volatile unsigned long echoes;
+  volatile unsigned long timeouts;
+
+  UltrasonicRanger() : pings(0), echoes(0), timeouts(0),
+                       trigPinNum(-1), echoPinNum(-1), intervalMs(ULTRA_PING_INTERVAL_MS),
+                       pingState(PING_IDLE), riseUs(0), firedMs(0),
+                       resultCm(0), resultValid(false), resultSeq(0), resultMs(0), resultFiredMs(0) {}
+
+  // Configure pins and start pinging in the background
+  void begin(int trig, int echo, uint32_t pingIntervalMs = ULTRA_PING_INTERVAL_MS) {
+    trigPinNum = trig;
+    echoPinNum = echo;
+    intervalMs = pingIntervalMs;
+    instance = this;
+
+    pinMode(trigPinNum, OUTPUT);
+    digitalWrite(trigPinNum, LOW);
+    pinMode(echoPinNum, INPUT);
+
+    attachInterrupt(digitalPinToInterrupt(echoPinNum), echoISR, CHANGE);
+    pingTimer.begin(timerISR, intervalMs * 1000.0f);
+  }
+
+  void end() {
+    pingTimer.end();
+    if (echoPinNum >= 0) detachInterrupt(digitalPinToInterrupt(echoPinNum));
+  }
+
+  // Most recent published ping (copied atomically)
+  UltrasonicReading latest() const {
+    UltrasonicReading r;
+    noInterrupts();
+    r.cm = resultCm;
+    r.valid = resultValid;
+    r.seq = resultSeq;
+    r.timestampMs = resultMs;
+    r.firedMs = resultFiredMs;
+    interrupts();
+    return r;
+  }
+
+  // Latest ping if it was fired at or after sinceMs (e.g. when a move
+  // arrived); false while the newest result is from an earlier ping
+  bool readingFiredSince(uint32_t sinceMs, UltrasonicReading& out) const {
+    UltrasonicReading r = latest();
+    if (r.seq == 0 || (int32_t)(r.firedMs - sinceMs) < 0) return false;
+    out = r;
+    return true;
+  }
+
+  // Change the ping rate on the fly (takes effect from the next tick)
+  void setPingInterval(uint32_t ms) {
+    if (ms < ULTRA_PING_INTERVAL_MS) ms = ULTRA_PING_INTERVAL_MS;   // Echo overlap
+    if (ms == intervalMs) return;
+    intervalMs = ms;
+    pingTimer.update(intervalMs * 1000.0f);
+  }
+
+  uint32_t pingIntervalMs() const { return intervalMs; }
+
+private:
+  enum PingState : uint8_t { PING_IDLE, PING_SENT, PING_ECHO_HIGH };
+
+  static UltrasonicRanger* instance;
+  IntervalTimer pingTimer;
+
+  int trigPinNum;
+  int echoPinNum;
+  uint32_t intervalMs;
+
+  volatile PingState pingState;
+  volatile uint32_t riseUs;
+  volatile uint32_t firedMs;      // Trigger time of the ping in flight
+
+  // Published result (written only from the ISRs)
+  volatile float resultCm;
+  volatile bool resultValid;
+  volatile uint32_t resultSeq;
+  volatile uint32_t resultMs;
+  volatile uint32_t resultFiredMs;
+
+  void publish(float cm, bool valid) {
+    resultCm = cm;
+    resultValid = valid;
+    resultSeq = resultSeq + 1;
+    resultMs = millis();
+    resultFiredMs = firedMs;
+  }
+
+  // ── Timer: close out the last ping, fire the next ──
+  static void timerISR() {
+    UltrasonicRanger* self = instance;
+    if (self == nullptr) return;
+
+    if (self->pingState != PING_IDLE) {
+      // No falling edge within a whole interval — nothing echoed back
+      self->timeouts++;
+      self->publish(0, false);
+    }
+
+    self->pingState = PING_SENT;
+    self->firedMs = millis();
+    self->pings++;
+    digitalWriteFast(self->trigPinNum, HIGH);
+    delayMicroseconds(10);
+    digitalWriteFast(self->trigPinNum, LOW);
+  }
+
+  // ── Echo pin: time the HIGH pulse ──
+  static void echoISR() {
+    UltrasonicRanger* self = instance;
+    if (self == nullptr) return;
+    uint32_t now = micros();
+
+    if (digitalReadFast(self->echoPinNum)) {
+      if (self->pingState == PING_SENT) {
+        self->riseUs = now;
+        self->pingState = PING_ECHO_HIGH;
+      }
+      return;
+    }
+
+    if (self->pingState != PING_ECHO_HIGH) return;   // Stray edge
+    self->pingState = PING_IDLE;
+
+    uint32_t width = now - self->riseUs;
+    if (width == 0 || width > ULTRA_MAX_ECHO_US) {
+      self->timeouts++;
+      self->publish(0, false);
+      return;
+    }
+
+    float cm = width / ULTRA_US_PER_CM;
+    self->echoes++;
+    self->publish(cm, cm > 0 && cm <= ULTRA_MAX_RANGE_CM);
+  }
+};
+
+UltrasonicRanger* UltrasonicRanger::instance = nullptr;
+
+// Firmware-wide instance (one sensor), defined in the main .ino
+extern UltrasonicRanger ultrasonic;
+
+#endif // ULTRASONIC_RANGER_H
@@ -1,5 +1,7 @@
 //This function pings the Ultrasonic Sensor and returns a distance in CM
 
+#include "Log.h"
+
 int checkUltra(int theEchoPin, int theTrigPin) {
   long duration, distance;
   
@@ -18,11 +20,11 @@ int checkUltra(int theEchoPin, int theTrigPin) {
   
   // Validate reading
   if (distance == 0 || distance > 400) {
-    Serial.print("⚠ Sensor warning: ");
+    LOG_PRINT(RANGE, WARN, "⚠ Sensor warning: ");
     if (distance == 0) {
-      Serial.println("No echo received (timeout)");
+      LOG_PRINTLN(RANGE, WARN, "No echo received (timeout)");
     } else {
-      Serial.println("Reading out of range");
+      LOG_PRINTLN(RANGE, WARN, "Reading out of range");
     }
     distance = 400; // Default to max range
   }
@@ -1,101 +1,162 @@
+/**
+ * droidSpeak.h - Buddy's sounds as tone phrases
+ *
+ * Every buzzer phrase lives here as data for ToneSequencer
+ * (ToneSequencer.h), which plays it from the sound task without blocking.
+ * To add a sound, add a note array and a phrase, then play it:
+ *
+ *   toneSequencer.play(PHRASE_HAPPY);
+ *   toneSequencer.queue(PHRASE_CHIRP, TONE_LOW);
+ *
+ * VOICE_* phrases are IllusionLayer::vocalizeInternalState's emotions.
+ */
+
 #ifndef DROID_SPEAK_H
 #define DROID_SPEAK_H
 
-#include "LittleBots_Board_Pins.h"
-
-// Original droid speak function (preserved for backward compatibility)
-void droidSpeak(int soundPin, int maxWords) {
-  int toneDuration;
-  int numberOfWords;
-  int toneFreq;
-
-  numberOfWords = random(1, maxWords);
-
-  Serial.print("[SOUND] Droid speak: ");
-  Serial.print(numberOfWords);
-  Serial.println(" beeps");
-
-  for (int i = 0; i <= numberOfWords; i++) {
-    toneDuration = random(50, 300);
-    toneFreq = random(200, 1500);
-    tone(soundPin, toneFreq);
-    delay(toneDuration);
-    noTone(soundPin);
-  }
+#include "ToneSequencer.h"
+#include "Log.h"
+
+// ============================================================================
+// DROID SPEAK
+// ============================================================================
+
+// Random babble: 50-300 ms beeps at 200-1500 Hz, prefix played per call
+static constexpr ToneNote NOTES_BABBLE[] = {
+  TN_EX(850, 175, 0, 650, 125), TN_EX(850, 175, 0, 650, 125),
+  TN_EX(850, 175, 0, 650, 125), TN_EX(850, 175, 0, 650, 125),
+  TN_EX(850, 175, 0, 650, 125), TN_EX(850, 175, 0, 650, 125),
+  TN_EX(850, 175, 0, 650, 125), TN_EX(850, 175, 0, 650, 125)
+};
+static constexpr TonePhrase PHRASE_BABBLE = { "babble", TONE_NOTES(NOTES_BABBLE) };
+
+static constexpr ToneNote NOTES_STARTUP[] = {
+  TN(300, 80), TN(400, 60), TN(500, 60), TN(700, 80), TN(900, 60), TN(1100, 120)
+};
+static constexpr TonePhrase PHRASE_STARTUP = { "startup", TONE_NOTES(NOTES_STARTUP) };
+
+static constexpr ToneNote NOTES_ACKNOWLEDGED[] = { TN(800, 60), TN(1200, 80) };
+static constexpr TonePhrase PHRASE_ACKNOWLEDGED = { "acknowledged", TONE_NOTES(NOTES_ACKNOWLEDGED) };
+
+static constexpr ToneNote NOTES_THINKING_PULSE[] = { TN_EX(350, 100, 0, 30, 0) };
+static constexpr TonePhrase PHRASE_THINKING_PULSE = { "thinking", TONE_NOTES(NOTES_THINKING_PULSE) };
+
+static constexpr ToneNote NOTES_HAPPY[] = { TN(600, 80), TN(900, 80), TN(1200, 120) };
+static constexpr TonePhrase PHRASE_HAPPY = { "happy", TONE_NOTES(NOTES_HAPPY) };
+
+static constexpr ToneNote NOTES_SAD[] = {
+  TN(600, 100), TN(550, 100), TN(500, 100), TN(450, 100), TN(400, 100), TN(350, 100)
+};
+static constexpr TonePhrase PHRASE_SAD = { "sad", TONE_NOTES(NOTES_SAD) };
+
+static constexpr ToneNote NOTES_ALERT[] = { TN_EX(1000, 50, 50, 0, 0), TN(1200, 80) };
+static constexpr TonePhrase PHRASE_ALERT = { "alert", TONE_NOTES(NOTES_ALERT) };
+
+static constexpr ToneNote NOTES_SLEEPY[] = {
+  TN(500, 80), TN(470, 80), TN(440, 80), TN(410, 80), TN(380, 80),
+  TN(350, 80), TN(320, 80), TN(290, 80), TN(260, 80), TN(230, 80)
+};
+static constexpr TonePhrase PHRASE_SLEEPY = { "sleepy", TONE_NOTES(NOTES_SLEEPY) };
+
+// Soft, wandering tones — matches consciousness wondering state
+static constexpr ToneNote NOTES_WONDERING[] = { TN(400, 200), TN_EX(500, 150, 100, 0, 0), TN(350, 250) };
+static constexpr TonePhrase PHRASE_WONDERING = { "wondering", TONE_NOTES(NOTES_WONDERING) };
+
+// Two competing tones
+static constexpr ToneNote NOTES_CONFLICTED[] = { TN(600, 80), TN(400, 80), TN(550, 60) };
+static constexpr TonePhrase PHRASE_CONFLICTED = { "conflicted", TONE_NOTES(NOTES_CONFLICTED) };
+
+static constexpr ToneNote NOTES_CHIRP[] = { TN(900, 40) };
+static constexpr TonePhrase PHRASE_CHIRP = { "chirp", TONE_NOTES(NOTES_CHIRP) };
+
+// "Oh!" — quick ascending surprise
+static constexpr ToneNote NOTES_CATCH_MYSELF[] = { TN(600, 40), TN(900, 60) };
+static constexpr TonePhrase PHRASE_CATCH_MYSELF = { "catch_myself", TONE_NOTES(NOTES_CATCH_MYSELF) };
+
+// ConsciousnessManifest meta-catch, played as the jerk starts
+static constexpr ToneNote NOTES_META_CATCH[] = { TN(600, 40), TN(800, 60) };
+static constexpr TonePhrase PHRASE_META_CATCH = { "meta_catch", TONE_NOTES(NOTES_META_CATCH) };
+
+// IllusionLayer self-correction: little "got it"
+static constexpr ToneNote NOTES_GOT_IT[] = { TN(800, 50), TN(1000, 80) };
+static constexpr TonePhrase PHRASE_GOT_IT = { "got_it", TONE_NOTES(NOTES_GOT_IT) };
+
+// ============================================================================
+// EMOTION VOICES (IllusionLayer::vocalizeInternalState)
+// ============================================================================
+
+// Rising questioning tone
+static constexpr ToneNote NOTES_VOICE_CURIOUS[] = {
+  TN(400, 60), TN(470, 60), TN(540, 60), TN(610, 60),
+  TN(680, 60), TN(750, 60), TN(820, 60), TN(890, 60)
+};
+static constexpr TonePhrase VOICE_CURIOUS = { "curious", TONE_NOTES(NOTES_VOICE_CURIOUS) };
+
+// Happy ascending beeps
+static constexpr ToneNote NOTES_VOICE_EXCITED[] = { TN(600, 100), TN(800, 100), TN(1000, 100), TN(1200, 100) };
+static constexpr TonePhrase VOICE_EXCITED = { "excited", TONE_NOTES(NOTES_VOICE_EXCITED) };
+
+// Uncertain warbling
+static constexpr ToneNote NOTES_VOICE_CONFUSED[] = {
+  TN_EX(550, 150, 0, 100, 0), TN_EX(550, 150, 0, 100, 0),
+  TN_EX(550, 150, 0, 100, 0), TN_EX(550, 150, 0, 100, 0)
+};
+static constexpr TonePhrase VOICE_CONFUSED = { "confused", TONE_NOTES(NOTES_VOICE_CONFUSED) };
+
+// Satisfied descending tone
+static constexpr ToneNote NOTES_VOICE_CONTENT[] = { TN(900, 200), TN(700, 200), TN(500, 150) };
+static constexpr TonePhrase VOICE_CONTENT = { "content", TONE_NOTES(NOTES_VOICE_CONTENT) };
+
+// Nervous stuttering
+static constexpr ToneNote NOTES_VOICE_ANXIOUS[] = {
+  TN_EX(800, 115, 75, 200, 30), TN_EX(800, 115, 75, 200, 30), TN_EX(800, 115, 75, 200, 30),
+  TN_EX(800, 115, 75, 200, 30), TN_EX(800, 115, 75, 200, 30)
+};
+static constexpr TonePhrase VOICE_ANXIOUS = { "anxious", TONE_NOTES(NOTES_VOICE_ANXIOUS) };
+
+// Sharp alarm
+static constexpr ToneNote NOTES_VOICE_STARTLED[] = { TN(1500, 150), TN(1800, 100) };
+static constexpr TonePhrase VOICE_STARTLED = { "startled", TONE_NOTES(NOTES_VOICE_STARTLED) };
+
+// Descending sigh
+static constexpr ToneNote NOTES_VOICE_BORED[] = {
+  TN(600, 120), TN(550, 120), TN(500, 120), TN(450, 120), TN(400, 120), TN(350, 120)
+};
+static constexpr TonePhrase VOICE_BORED = { "bored", TONE_NOTES(NOTES_VOICE_BORED) };
+
+// Neutral beep
+static constexpr ToneNote NOTES_VOICE_NEUTRAL[] = { TN(700, 100) };
+static constexpr TonePhrase VOICE_NEUTRAL = { "neutral", TONE_NOTES(NOTES_VOICE_NEUTRAL) };
+
+// ============================================================================
+// HELPERS
+// ============================================================================
+
+// Original droid speak: 2..maxWords+1 random beeps (now from the sequencer)
+void droidSpeak(int maxWords) {
+  int numberOfWords = random(1, maxWords);
+
+  LOG_PRINT(SOUND, DEBUG, "[SOUND] Droid speak: ");
+  LOG_PRINT(SOUND, DEBUG, numberOfWords);
+  LOG_PRINTLN(SOUND, DEBUG, " beeps");
+
+  TonePhrase words = PHRASE_BABBLE;
+  words.count = (uint8_t)constrain(numberOfWords + 1, 1, (int)PHRASE_BABBLE.count);
+  toneSequencer.play(words);
 }
 
 namespace DroidSpeak {
-
-    void startup() {
-        int f[] = {300, 400, 500, 700, 900, 1100};
-        int d[] = {80, 60, 60, 80, 60, 120};
-        for (int i = 0; i < 6; i++) { tone(buzzerPin, f[i]); delay(d[i]); }
-        noTone(buzzerPin);
-    }
-
-    void acknowledged() {
-        tone(buzzerPin, 800); delay(60);
-        tone(buzzerPin, 1200); delay(80);
-        noTone(buzzerPin);
-    }
-
-    void thinkingPulse() {
-        tone(buzzerPin, 350 + random(-30, 30)); delay(100);
-        noTone(buzzerPin);
-    }
-
-    void happy() {
-        tone(buzzerPin, 600); delay(80);
-        tone(buzzerPin, 900); delay(80);
-        tone(buzzerPin, 1200); delay(120);
-        noTone(buzzerPin);
-    }
-
-    void sad() {
-        for (int f = 600; f > 300; f -= 50) { tone(buzzerPin, f); delay(100); }
-        noTone(buzzerPin);
-    }
-
-    void alert() {
-        tone(buzzerPin, 1000); delay(50);
-        noTone(buzzerPin); delay(50);
-        tone(buzzerPin, 1200); delay(80);
-        noTone(buzzerPin);
-    }
-
-    void sleepy() {
-        for (int f = 500; f > 200; f -= 30) { tone(buzzerPin, f); delay(80); }
-        noTone(buzzerPin);
-    }
-
-    void wondering() {
-        // Soft, wandering tones — matches consciousness wondering state
-        tone(buzzerPin, 400); delay(200);
-        tone(buzzerPin, 500); delay(150);
-        noTone(buzzerPin); delay(100);
-        tone(buzzerPin, 350); delay(250);
-        noTone(buzzerPin);
-    }
-
-    void conflicted() {
-        // Two competing tones
-        tone(buzzerPin, 600); delay(80);
-        tone(buzzerPin, 400); delay(80);
-        tone(buzzerPin, 550); delay(60);
-        noTone(buzzerPin);
-    }
-
-    void chirp() {
-        tone(buzzerPin, 900); delay(40);
-        noTone(buzzerPin);
-    }
-
-    void catchMyself() {
-        // "Oh!" — quick ascending surprise
-        tone(buzzerPin, 600); delay(40);
-        tone(buzzerPin, 900); delay(60);
-        noTone(buzzerPin);
-    }
+    void startup()       { toneSequencer.queue(PHRASE_STARTUP); }
+    void acknowledged()  { toneSequencer.play(PHRASE_ACKNOWLEDGED); }
+    void thinkingPulse() { toneSequencer.play(PHRASE_THINKING_PULSE, TONE_LOW); }
+    void happy()         { toneSequencer.play(PHRASE_HAPPY); }
+    void sad()           { toneSequencer.play(PHRASE_SAD); }
+    void alert()         { toneSequencer.play(PHRASE_ALERT, TONE_HIGH); }
+    void sleepy()        { toneSequencer.play(PHRASE_SLEEPY); }
+    void wondering()     { toneSequencer.play(PHRASE_WONDERING); }
+    void conflicted()    { toneSequencer.play(PHRASE_CONFLICTED); }
+    void chirp()         { toneSequencer.play(PHRASE_CHIRP, TONE_LOW); }
+    void catchMyself()   { toneSequencer.play(PHRASE_CATCH_MYSELF); }
 }
 
 #endif // DROID_SPEAK_H
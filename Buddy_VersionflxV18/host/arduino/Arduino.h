@@ -0,0 +1,148 @@
+// Arduino.h - host stand-in for the Teensy core (sketch_host.cpp only)
+//
+// Enough of the Arduino/Teensyduino API for the whole sketch to compile
+// and run on Linux. The definitions are in sketch_host.cpp.
+
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <math.h>
+#include <strings.h>
+#include <algorithm>
+#include <string>
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+#define PI          3.14159265358979f
+#define TWO_PI      6.2831853f
+#define DEG_TO_RAD  0.017453292519943295f
+#define RAD_TO_DEG  57.29577951308232f
+#define HIGH 1
+#define LOW  0
+#define INPUT        0
+#define OUTPUT       1
+#define INPUT_PULLUP 2
+#define CHANGE  3
+#define RISING  4
+#define FALLING 5
+#define DEC 10
+#define HEX 16
+#define constrain(a, l, h) ((a) < (l) ? (l) : ((a) > (h) ? (h) : (a)))
+#define F(x) x
+#define FLASHMEM
+#define DMAMEM
+#define PROGMEM
+#define FASTRUN
+
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+void yield();
+long random(long howbig);
+long random(long howsmall, long howbig);
+void randomSeed(unsigned long seed);
+void pinMode(int pin, int mode);
+void digitalWrite(int pin, int val);
+int digitalRead(int pin);
+int analogRead(int pin);
+unsigned long pulseIn(int pin, int state, unsigned long timeoutUs);
+void tone(int pin, unsigned int freq);
+void tone(int pin, unsigned int freq, unsigned long durationMs);
+void noTone(int pin);
+void attachInterrupt(int irq, void (*fn)(), int mode);
+void detachInterrupt(int irq);
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void noInterrupts() {}
+inline void interrupts() {}
+inline void digitalWriteFast(int pin, int val) { digitalWrite(pin, val); }
+inline int digitalReadFast(int pin) { return digitalRead(pin); }
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+
+class String {
+public:
+  String() {}
+  String(const char* s) : s_(s) {}
+  const char* c_str() const { return s_.c_str(); }
+  int length() const { return (int)s_.size(); }
+  void trim();
+  bool operator==(const char* o) const { return s_ == o; }
+  std::string s_;
+};
+
+// Out of line like the Teensy core, so a call site costs a call. All
+// output ends in printSink(); the harness counts it and discards it.
+size_t printSink(const char* data, size_t len);
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t b) = 0;
+  virtual size_t write(const uint8_t* b, size_t n);
+  virtual int availableForWrite() { return 4096; }
+  virtual void flush() {}
+  size_t write(const char* s) { return write((const uint8_t*)s, strlen(s)); }
+
+  size_t print(const char* s);
+  size_t print(const String& s);
+  size_t print(char c);
+  size_t print(unsigned char v, int base = DEC);
+  size_t print(int v, int base = DEC);
+  size_t print(unsigned int v, int base = DEC);
+  size_t print(long v, int base = DEC);
+  size_t print(unsigned long v, int base = DEC);
+  size_t print(double v, int digits = 2);
+  size_t println();
+  template <typename T> size_t println(T v) { return print(v) + println(); }
+  template <typename T> size_t println(T v, int arg) { return print(v, arg) + println(); }
+  int printf(const char* fmt, ...);
+};
+
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  void setTimeout(unsigned long) {}
+  size_t readBytesUntil(char term, char* buf, size_t len);
+  String readStringUntil(char term);
+};
+
+// Serial (USB) and Serial1 (ESP32 UART). Input is whatever feed() queued.
+class HardwareSerialX : public Stream {
+public:
+  void begin(unsigned long) {}
+  void addMemoryForRead(void*, size_t) {}
+  void addMemoryForWrite(void*, size_t) {}
+  operator bool() { return true; }
+  size_t write(uint8_t b) override;
+  size_t write(const uint8_t* b, size_t n) override;
+  using Print::write;
+  int available() override { return (int)(in.size() - inPos); }
+  int read() override { return inPos < in.size() ? (uint8_t)in[inPos++] : -1; }
+  int peek() override { return inPos < in.size() ? (uint8_t)in[inPos] : -1; }
+  void feed(const char* line);
+
+private:
+  std::string in;
+  size_t inPos = 0;
+};
+extern HardwareSerialX Serial;
+extern HardwareSerialX Serial1;
+typedef HardwareSerialX HardwareSerial;
+
+// One periodic timer at a time is all the sketch uses (UltrasonicRanger)
+class IntervalTimer {
+public:
+  bool begin(void (*fn)(), float periodUs);
+  void update(float periodUs);
+  void end();
+  void priority(int) {}
+};
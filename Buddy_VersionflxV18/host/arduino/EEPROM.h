@@ -0,0 +1,15 @@
+// EEPROM.h - host stand-in: 1080 bytes of RAM, erased (0xFF) at start
+#pragma once
+#include "Arduino.h"
+
+struct EEPROMClass {
+  uint8_t mem[1080];
+  EEPROMClass() { memset(mem, 0xFF, sizeof(mem)); }
+  uint8_t read(int a) { return mem[a]; }
+  void write(int a, uint8_t v) { mem[a] = v; }
+  void update(int a, uint8_t v) { mem[a] = v; }
+  template <typename T> T& get(int a, T& t) { memcpy(&t, mem + a, sizeof(T)); return t; }
+  template <typename T> const T& put(int a, const T& t) { memcpy(mem + a, &t, sizeof(T)); return t; }
+  int length() { return (int)sizeof(mem); }
+};
+extern EEPROMClass EEPROM;
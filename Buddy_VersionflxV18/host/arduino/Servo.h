@@ -0,0 +1,18 @@
+// Servo.h - host stand-in: remembers the last angle, drives nothing
+#pragma once
+#include "Arduino.h"
+
+class Servo {
+public:
+  uint8_t attach(int) { return 0; }
+  uint8_t attach(int, int, int) { return 0; }
+  void detach() {}
+  void write(int deg) { angle = deg; }
+  void writeMicroseconds(int us) { angle = (us - 544) * 180 / (2400 - 544); }
+  int read() { return angle; }
+  int readMicroseconds() { return 544 + angle * (2400 - 544) / 180; }
+  bool attached() { return true; }
+
+private:
+  int angle = 90;
+};
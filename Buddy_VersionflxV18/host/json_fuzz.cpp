@@ -0,0 +1,359 @@
+// json_fuzz.cpp
+// Linux fuzz and benchmark target for the Teensy's JsonTokenizer.h
+//
+//   ./json_fuzz fuzz [iterations] [seed]   mutate vision payloads and random
+//                                          JSON; check token invariants and
+//                                          bound values (build with sanitizers:
+//                                          make fuzz)
+//   ./json_fuzz bench [iterations]         tokenizer + jsonBind against the old
+//                                          per-key strstr extractors
+//
+// Built with -DJSON_LIBFUZZER the same checks are exposed as
+// LLVMFuzzerTestOneInput for clang's libFuzzer (make libfuzzer).
+
+#include "../JsonTokenizer.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <string>
+
+// Same schemas as AIBridge.h
+struct VisionUpdate {
+    int faceDetected;
+    int faceCount;
+    char expression[16];
+    float sceneNovelty;
+    int objectCount;
+    float movement;
+};
+
+static const JsonField VISION_UPDATE_FIELDS[] = {
+    JSON_INT_FIELD(VisionUpdate, faceDetected, "f"),
+    JSON_INT_FIELD(VisionUpdate, faceCount, "fc"),
+    JSON_STR_FIELD(VisionUpdate, expression, "ex"),
+    JSON_FLOAT_FIELD(VisionUpdate, sceneNovelty, "nv"),
+    JSON_INT_FIELD(VisionUpdate, objectCount, "ob"),
+    JSON_FLOAT_FIELD(VisionUpdate, movement, "mv"),
+};
+
+struct VisionContext {
+    float sceneNovelty;
+    int faceCount;
+    char expression[16];
+    char changeType[24];
+    char sceneDesc[100];
+};
+
+static const JsonField VISION_CONTEXT_FIELDS[] = {
+    JSON_FLOAT_FIELD(VisionContext, sceneNovelty, "novelty"),
+    JSON_INT_FIELD(VisionContext, faceCount, "faces"),
+    JSON_STR_FIELD(VisionContext, expression, "expr"),
+    JSON_STR_FIELD(VisionContext, changeType, "change"),
+    JSON_STR_FIELD(VisionContext, sceneDesc, "desc"),
+};
+
+static const char* CORPUS[] = {
+    "{\"f\":1,\"fc\":2,\"ex\":\"happy\",\"nv\":0.45,\"ob\":3,\"mv\":0.2}",
+    "{\"f\":0,\"fc\":0,\"ex\":\"neutral\",\"nv\":0.0,\"ob\":0,\"mv\":0.0}",
+    "{\"faces\":1,\"expr\":\"smiling\",\"obj\":\"mug,monitor\",\"change\":\"new_object\","
+        "\"novelty\":0.7,\"desc\":\"person at desk\"}",
+    "{\"faces\":0,\"expr\":\"neutral\",\"obj\":\"\",\"change\":\"person_left\","
+        "\"novelty\":0.35,\"desc\":\"empty room, chair \\\"pushed\\\" back\"}",
+    "{\"desc\":\"sign reads \\\"novelty\\\":0.9\",\"novelty\":0.1,\"faces\":2}",
+    "{\"nested\":{\"ex\":\"angry\",\"list\":[1,2,{\"f\":9}]},\"ex\":\"sad\",\"f\":true}",
+    // get_vision_command() with two and three tracked objects (33 / 40 tokens)
+    "{\"faces\":1,\"expr\":\"smiling\",\"obj\":\"mug,monitor\",\"change\":\"new_object\","
+        "\"novelty\":0.62,\"interest\":0.8,\"idir\":1,"
+        "\"objs\":[{\"n\":\"mug\",\"b\":140,\"d\":115},{\"n\":\"monitor\",\"b\":92,\"d\":98}],"
+        "\"desc\":\"person at desk with a mug\"}",
+    "{\"faces\":0,\"expr\":\"neutral\",\"obj\":\"mug,monitor,plant,lamp,book\",\"change\":\"none\","
+        "\"novelty\":0.15,\"interest\":0.35,\"idir\":2,"
+        "\"objs\":[{\"n\":\"mug\",\"b\":140,\"d\":115},{\"n\":\"monitor\",\"b\":92,\"d\":98},"
+        "{\"n\":\"plant\",\"b\":40,\"d\":135}],"
+        "\"desc\":\"empty desk, lamp on\"}",
+};
+static const int CORPUS_COUNT = sizeof(CORPUS) / sizeof(CORPUS[0]);
+
+static unsigned long failures = 0;
+
+#define CHECK(cond, what, input) \
+    do { if (!(cond)) { failures++; report(what, input); } } while (0)
+
+static void report(const char* what, const std::string& input) {
+    if (failures > 20) return;
+    fprintf(stderr, "FAIL %s: ", what);
+    for (unsigned char c : input) {
+        if (c >= 32 && c < 127) fputc(c, stderr);
+        else fprintf(stderr, "\\x%02x", c);
+    }
+    fputc('\n', stderr);
+}
+
+// ============================================================================
+// INVARIANTS
+// ============================================================================
+
+// Runs the tokenizer and binder on arbitrary bytes; everything the firmware
+// relies on must hold whatever the input
+static void checkInput(const std::string& input) {
+    JsonToken tokens[JSON_MAX_TOKENS];
+    const char* js = input.c_str();
+    int len = (int)input.size();
+    int count = jsonTokenize(js, len, tokens, JSON_MAX_TOKENS);
+    CHECK(count >= JSON_ERROR_PARTIAL && count <= JSON_MAX_TOKENS, "count range", input);
+    if (count < 0) return;
+
+    for (int i = 0; i < count; i++) {
+        const JsonToken& t = tokens[i];
+        CHECK(t.start >= 0 && t.start <= t.end && t.end <= len, "span in bounds", input);
+        CHECK(t.parent >= -1 && t.parent < i, "parent precedes child", input);
+        int children = 0;
+        for (int j = i + 1; j < count; j++) {
+            if (tokens[j].parent == i) children++;
+        }
+        CHECK(children == t.size, "size matches children", input);
+        if (t.parent >= 0) {
+            const JsonToken& p = tokens[t.parent];
+            CHECK(p.type != JSON_PRIMITIVE, "primitive has no children", input);
+            if (p.type == JSON_STRING) {
+                // Key: one value, after the key, inside the key's object
+                CHECK(p.size == 1 && t.start > p.end, "value follows key", input);
+                CHECK(p.parent >= 0 && tokens[p.parent].type == JSON_OBJECT, "key in object", input);
+            } else {
+                CHECK(t.start > p.start && t.end < p.end, "child inside container", input);
+            }
+        }
+    }
+
+    // Guard bytes after every string field catch an overrun
+    struct Guarded {
+        VisionContext ctx;
+        unsigned char guard[16];
+    } g;
+    memset(&g, 0xA5, sizeof(g));
+    g.ctx.expression[0] = g.ctx.changeType[0] = g.ctx.sceneDesc[0] = '\0';
+    jsonBind(js, tokens, count, VISION_CONTEXT_FIELDS, JSON_FIELD_COUNT(VISION_CONTEXT_FIELDS), &g.ctx);
+    for (unsigned char b : g.guard) CHECK(b == 0xA5, "string bound overrun", input);
+    CHECK(memchr(g.ctx.expression, 0, sizeof(g.ctx.expression)) != nullptr, "expr terminated", input);
+    CHECK(memchr(g.ctx.changeType, 0, sizeof(g.ctx.changeType)) != nullptr, "change terminated", input);
+    CHECK(memchr(g.ctx.sceneDesc, 0, sizeof(g.ctx.sceneDesc)) != nullptr, "desc terminated", input);
+
+    VisionUpdate v;
+    memset(&v, 0, sizeof(v));
+    jsonBind(js, tokens, count, VISION_UPDATE_FIELDS, JSON_FIELD_COUNT(VISION_UPDATE_FIELDS), &v);
+    CHECK(memchr(v.expression, 0, sizeof(v.expression)) != nullptr, "ex terminated", input);
+}
+
+// ============================================================================
+// GENERATORS
+// ============================================================================
+
+static uint64_t rngState = 88172645463325252ULL;
+
+static uint32_t rnd() {
+    rngState ^= rngState << 13;
+    rngState ^= rngState >> 7;
+    rngState ^= rngState << 17;
+    return (uint32_t)rngState;
+}
+
+static std::string mutate(const std::string& in) {
+    std::string s = in;
+    int edits = 1 + rnd() % 4;
+    for (int e = 0; e < edits; e++) {
+        size_t at = s.empty() ? 0 : rnd() % s.size();
+        switch (rnd() % 5) {
+            case 0: if (!s.empty()) s[at] = (char)(rnd() & 0xFF); break;
+            case 1: s.insert(at, 1, "{}[]\":,\\ntf-0.e"[rnd() % 15]); break;
+            case 2: if (!s.empty()) s.erase(at, 1 + rnd() % 4); break;
+            case 3: s.resize(at); break;
+            case 4: s.insert(at, s.substr(rnd() % (s.size() + 1), rnd() % 12)); break;
+        }
+    }
+    return s;
+}
+
+static const char* WORDS[] = { "happy", "novelty", "\\\"f\\\":7", "desc", "a,b", "" };
+
+// Valid object with known values and decoy keys; the binder must return
+// exactly these values
+static std::string generateContext(VisionContext& expect) {
+    expect.sceneNovelty = (float)(rnd() % 1000) / 1000.0f;
+    expect.faceCount = (int)(rnd() % 5);
+    snprintf(expect.expression, sizeof(expect.expression), "%s", rnd() % 2 ? "smiling" : "sad");
+    snprintf(expect.changeType, sizeof(expect.changeType), "%s", rnd() % 2 ? "none" : "new_object");
+    const char* w = WORDS[rnd() % 6];
+    snprintf(expect.sceneDesc, sizeof(expect.sceneDesc), "desk %s", w);
+
+    char buf[512];
+    std::string s = "{";
+    if (rnd() % 2) s += "\"novelty_hint\":{\"novelty\":9,\"faces\":[9,9]},";
+    snprintf(buf, sizeof(buf), "\"desc\":\"desk %s\",", w);
+    s += buf;
+    snprintf(buf, sizeof(buf), "\"novelty\":%.3f,", expect.sceneNovelty);
+    s += buf;
+    if (rnd() % 2) s += "\"obj\":\"faces,expr\",";
+    s += "\"objs\":[";                               // 0-3 objects, as the sender
+    for (int n = rnd() % 4, i = 0; i < n; i++) {
+        snprintf(buf, sizeof(buf), "%s{\"n\":\"faces\",\"b\":%d,\"d\":%d}",
+                 i ? "," : "", (int)(rnd() % 180), (int)(rnd() % 180));
+        s += buf;
+    }
+    s += "],";
+    snprintf(buf, sizeof(buf), "\"faces\":%d, \"expr\":\"%s\",\n\"change\":\"%s\"}",
+             expect.faceCount, expect.expression, expect.changeType);
+    s += buf;
+
+    // Expected desc is the decoded string
+    std::string decoded;
+    for (const char* p = expect.sceneDesc; *p; p++) {
+        if (*p == '\\' && p[1]) p++;
+        decoded += *p;
+    }
+    snprintf(expect.sceneDesc, sizeof(expect.sceneDesc), "%s", decoded.c_str());
+    return s;
+}
+
+static void checkGenerated() {
+    VisionContext expect;
+    std::string js = generateContext(expect);
+    checkInput(js);
+
+    JsonToken tokens[JSON_MAX_TOKENS];
+    int count = jsonTokenize(js.c_str(), (int)js.size(), tokens, JSON_MAX_TOKENS);
+    CHECK(count > 0, "valid JSON tokenizes", js);
+    if (count <= 0) return;
+
+    VisionContext got = { -1.0f, -1, "", "", "" };
+    uint32_t found = jsonBind(js.c_str(), tokens, count, VISION_CONTEXT_FIELDS,
+                              JSON_FIELD_COUNT(VISION_CONTEXT_FIELDS), &got);
+    CHECK(found == 0x1F, "all fields bound", js);
+    CHECK(fabsf(got.sceneNovelty - expect.sceneNovelty) < 1e-4f, "novelty value", js);
+    CHECK(got.faceCount == expect.faceCount, "faces value", js);
+    CHECK(strcmp(got.expression, expect.expression) == 0, "expr value", js);
+    CHECK(strcmp(got.changeType, expect.changeType) == 0, "change value", js);
+    CHECK(strcmp(got.sceneDesc, expect.sceneDesc) == 0, "desc value", js);
+}
+
+// ============================================================================
+// REFERENCE: the extractors this replaced (one strstr per key)
+// ============================================================================
+
+static float extractFloat(const char* json, const char* key, float defaultVal) {
+    char searchKey[32];
+    snprintf(searchKey, sizeof(searchKey), "\"%s\":", key);
+    const char* pos = strstr(json, searchKey);
+    if (!pos) return defaultVal;
+    pos += strlen(searchKey);
+    while (*pos == ' ') pos++;
+    return atof(pos);
+}
+
+static void extractString(const char* json, const char* key, char* out, int maxLen) {
+    char searchKey[32];
+    snprintf(searchKey, sizeof(searchKey), "\"%s\":\"", key);
+    const char* pos = strstr(json, searchKey);
+    if (!pos) return;
+    pos += strlen(searchKey);
+    int i = 0;
+    while (*pos && *pos != '"' && i < maxLen - 1) out[i++] = *pos++;
+    out[i] = '\0';
+}
+
+static void legacyContext(const char* js, VisionContext& c) {
+    c.sceneNovelty = extractFloat(js, "novelty", 0.0f);
+    c.faceCount = (int)extractFloat(js, "faces", 0.0f);
+    extractString(js, "expr", c.expression, sizeof(c.expression));
+    extractString(js, "change", c.changeType, sizeof(c.changeType));
+    extractString(js, "desc", c.sceneDesc, sizeof(c.sceneDesc));
+}
+
+static void tokenizedContext(const char* js, VisionContext& c) {
+    JsonToken tokens[JSON_MAX_TOKENS];
+    int count = jsonTokenize(js, (int)strlen(js), tokens, JSON_MAX_TOKENS);
+    if (count > 0) {
+        jsonBind(js, tokens, count, VISION_CONTEXT_FIELDS, JSON_FIELD_COUNT(VISION_CONTEXT_FIELDS), &c);
+    }
+}
+
+static double nowSeconds() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+template <typename Fn>
+static double timeNs(Fn fn, const char* js, long iterations) {
+    volatile float sink = 0;
+    double t0 = nowSeconds();
+    for (long i = 0; i < iterations; i++) {
+        VisionContext c = { 0.0f, 0, "neutral", "none", "" };
+        fn(js, c);
+        sink = sink + c.sceneNovelty + c.sceneDesc[0];
+    }
+    return (nowSeconds() - t0) * 1e9 / iterations;
+}
+
+static int bench(long iterations) {
+    printf("%-8s %6s %12s %12s %8s  %s\n", "payload", "bytes", "strstr ns", "tokenize ns", "speedup", "agree");
+    for (int i = 2; i < CORPUS_COUNT; i++) {
+        const char* js = CORPUS[i];
+        double legacy = timeNs(legacyContext, js, iterations);
+        double tokenized = timeNs(tokenizedContext, js, iterations);
+
+        VisionContext a = { 0.0f, 0, "neutral", "none", "" };
+        VisionContext b = a;
+        legacyContext(js, a);
+        tokenizedContext(js, b);
+        bool agree = a.sceneNovelty == b.sceneNovelty && a.faceCount == b.faceCount &&
+                     strcmp(a.sceneDesc, b.sceneDesc) == 0 && strcmp(a.expression, b.expression) == 0;
+        printf("%-8d %6zu %12.0f %12.0f %7.2fx  %s\n", i, strlen(js), legacy, tokenized,
+               legacy / tokenized, agree ? "yes" : "no (strstr: key inside a value or escaped quote)");
+    }
+    return 0;
+}
+
+static int fuzz(long iterations, uint64_t seed) {
+    if (seed) rngState = seed;
+    for (int i = 0; i < CORPUS_COUNT; i++) {
+        JsonToken tokens[JSON_MAX_TOKENS];
+        int count = jsonTokenize(CORPUS[i], (int)strlen(CORPUS[i]), tokens, JSON_MAX_TOKENS);
+        CHECK(count > 0, "corpus payload fits JSON_MAX_TOKENS", CORPUS[i]);
+        checkInput(CORPUS[i]);
+    }
+    for (long n = 0; n < iterations; n++) {
+        if (n % 4 == 0) {
+            checkGenerated();
+        } else {
+            std::string s = CORPUS[rnd() % CORPUS_COUNT];
+            for (int depth = 1 + rnd() % 3; depth > 0; depth--) s = mutate(s);
+            checkInput(s);
+        }
+    }
+    printf("%ld inputs, %lu failures\n", iterations, failures);
+    return failures ? 1 : 0;
+}
+
+#ifdef JSON_LIBFUZZER
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    checkInput(std::string((const char*)data, size));
+    if (failures) abort();
+    return 0;
+}
+#else
+int main(int argc, char** argv) {
+    const char* mode = argc > 1 ? argv[1] : "fuzz";
+    if (strcmp(mode, "fuzz") == 0) {
+        long n = argc > 2 ? strtol(argv[2], nullptr, 10) : 1000000;
+        uint64_t seed = argc > 3 ? strtoull(argv[3], nullptr, 10) : 0;
+        return fuzz(n, seed);
+    }
+    if (strcmp(mode, "bench") == 0) {
+        return bench(argc > 2 ? strtol(argv[2], nullptr, 10) : 200000);
+    }
+    fprintf(stderr, "Usage: %s fuzz [iterations] [seed] | bench [iterations]\n", argv[0]);
+    return 2;
+}
+#endif
@@ -0,0 +1,129 @@
+// motion_lut.cpp
+// Linux accuracy check and benchmark for the Teensy's MotionLut.h
+//
+//   ./motion_lut check [samples]   compare every lookup against libm over
+//                                  dense and random arguments; fail if an
+//                                  error bound is exceeded (make lut)
+//   ./motion_lut bench [calls]     ns per call: tables against sin()/sinf()
+//                                  and the min-jerk polynomial
+
+#include "../MotionLut.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+// Bounds: h²/8 × max|f''| for linear interpolation, plus float rounding
+static const double SINE_BOUND = 8.0e-5;
+static const double EASE_BOUND = 1.5e-5;
+
+static double maxSin, maxCos, maxTurns, maxPeriod, maxEase;
+
+static void track(double& worst, double err) {
+    if (err > worst) worst = err;
+}
+
+static double exactEase(double u) {
+    return u * u * u * (10.0 + u * (-15.0 + 6.0 * u));
+}
+
+static int check(long samples) {
+    // Table entries themselves: the constexpr series against libm
+    double maxEntry = 0.0;
+    for (int i = 0; i <= MOTION_LUT_SIZE; i++) {
+        track(maxEntry, fabs(SINE_LUT.v[i] - sin(2.0 * M_PI * i / MOTION_LUT_SIZE)));
+    }
+
+    // Dense sweep over a few periods, both signs
+    for (long i = 0; i < samples; i++) {
+        double rad = -6.0 * M_PI + 12.0 * M_PI * i / samples;
+        track(maxSin, fabs(lutSin((float)rad) - sin((float)rad)));
+        track(maxCos, fabs(lutCos((float)rad) - cos((float)rad)));
+        double turns = rad / (2.0 * M_PI);
+        track(maxTurns, fabs(lutSinTurns((float)turns) - sin(2.0 * M_PI * (float)turns)));
+
+        double u = (double)i / (samples - 1);
+        track(maxEase, fabs(lutEase((float)u) - exactEase((float)u)));
+    }
+
+    // Clock phases, including uptimes of weeks and the millis() wrap
+    srand(1);
+    const unsigned long periods[] = { 1500, 4000, 5027, 12566, 18850, 65536 };
+    for (long i = 0; i < samples; i++) {
+        unsigned long ms = ((unsigned long)rand() << 16) ^ (unsigned long)rand();
+        if (i % 4 == 0) ms = 0xFFFFFFFFUL - (unsigned long)(rand() % 100000);
+        ms &= 0xFFFFFFFFUL;
+        unsigned long p = periods[i % 6];
+        double exact = sin(2.0 * M_PI * (double)(ms % p) / p);
+        track(maxPeriod, fabs(lutSinPeriod(ms, p) - exact));
+    }
+
+    // Edges: exact boundaries, clamped ease input
+    bool edges = lutSinTurns(0.0f) == 0.0f && fabs(lutSinTurns(0.25f) - 1.0f) < 1e-6 &&
+                 fabs(lutSinTurns(-0.25f) + 1.0f) < 1e-6 && fabs(lutSinTurns(1.0f)) < 1e-6 &&
+                 lutEase(-0.5f) == 0.0f && lutEase(1.5f) == 1.0f && lutEase(1.0f) == 1.0f;
+
+    printf("table entries  max err %.3g\n", maxEntry);
+    printf("lutSin         max err %.3g\n", maxSin);
+    printf("lutCos         max err %.3g\n", maxCos);
+    printf("lutSinTurns    max err %.3g\n", maxTurns);
+    printf("lutSinPeriod   max err %.3g\n", maxPeriod);
+    printf("lutEase        max err %.3g\n", maxEase);
+    printf("edges          %s\n", edges ? "ok" : "FAIL");
+
+    bool ok = edges && maxEntry < 1e-7 && maxSin < SINE_BOUND && maxCos < SINE_BOUND &&
+              maxTurns < SINE_BOUND && maxPeriod < SINE_BOUND && maxEase < EASE_BOUND;
+    printf("%s (bounds: sine %.1e, ease %.1e)\n", ok ? "PASS" : "FAIL", SINE_BOUND, EASE_BOUND);
+    return ok ? 0 : 1;
+}
+
+static double nowNs() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+// Arguments like the firmware's: a growing clock through a few periods
+template <typename F>
+static void time(const char* name, long calls, F f) {
+    volatile float sink = 0.0f;
+    double t0 = nowNs();
+    for (long i = 0; i < calls; i++) sink = sink + f(i);
+    double ns = (nowNs() - t0) / calls;
+    printf("%-34s %6.2f ns/call\n", name, ns);
+}
+
+static int bench(long calls) {
+    time("sin(double) of millis()/3000.0", calls, [](long i) {
+        return (float)sin((unsigned long)(i * 7) / 3000.0);
+    });
+    time("lutSinPeriod(millis(), 18850)", calls, [](long i) {
+        return lutSinPeriod((unsigned long)(i * 7), 18850);
+    });
+    time("sinf(t * 1.0472f)", calls, [](long i) {
+        return sinf(i * 0.005f * 1.0472f);
+    });
+    time("lutSinTurns(t / 6)", calls, [](long i) {
+        return lutSinTurns(i * 0.005f / 6.0f);
+    });
+    time("min-jerk polynomial", calls, [](long i) {
+        float u = (i & 1023) / 1023.0f;
+        return u * u * u * (10.0f + u * (-15.0f + 6.0f * u));
+    });
+    time("lutEase(u)", calls, [](long i) {
+        return lutEase((i & 1023) / 1023.0f);
+    });
+    return 0;
+}
+
+int main(int argc, char** argv) {
+    const char* mode = argc > 1 ? argv[1] : "check";
+    long n = argc > 2 ? atol(argv[2]) : 0;
+
+    if (mode[0] == 'c') return check(n > 0 ? n : 2000000);
+    if (mode[0] == 'b') return bench(n > 0 ? n : 20000000);
+
+    fprintf(stderr, "usage: %s check|bench [n]\n", argv[0]);
+    return 2;
+}
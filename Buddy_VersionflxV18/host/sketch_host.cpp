@@ -0,0 +1,412 @@
+// sketch_host.cpp
+// The whole sketch built for Linux: object size per LOG_LEVEL, and the
+// scheduler's per-task run times under a synthetic workload
+//
+// Buddy_VersionflxV18.ino is compiled as-is against arduino/ (stand-ins
+// for the Teensy core). With -DSKETCH_HOST_SIZE only the sketch is
+// compiled (-c) so `size` sees firmware code alone; Print is out of line
+// as in the Teensy core, so each print site costs a call.
+//
+// Otherwise this file adds the runtime and a main():
+//   clock      micros() = this thread's CPU time + everything skipped.
+//              delay() advances the clock without sleeping, and so does
+//              the harness when no task is due, so idle time costs
+//              nothing, setup()'s waits finish at once and preemption by
+//              the host OS doesn't show up as task time.
+//   HC-SR04    trig falling edge → echo rise 460 µs later, width for
+//              80 ± 40 cm over a 7 s cycle, every 17th ping unanswered.
+//              The IntervalTimer and echo CHANGE ISRs run from delay()
+//              and between loop() passes, with micros() pinned to the
+//              edge time.
+//   ESP32      ESP32_READY for the handshake, then FACE lines at 15 Hz
+//              (a face drifting across the frame) for 8 s of every 12 s,
+//              NO_FACE for the rest.
+//   Serial     formatted and counted; printed only with -v.
+//
+// After setup() the "profile" task is disabled (it resets the stats
+// every 2 s) and the stats are cleared. After the run, every task's
+// TEL_TASK_STATS figures print: runs, avg and worst-case µs, overruns.
+// "busy" is the tasks' total time over the simulated time. The times are
+// host CPU time (plus any delay() a task makes) — compare builds on the same machine, not
+// against the Teensy's budgets.
+//
+// Usage: ./sketch_host [--seconds N] [-v]
+
+#include "Arduino.h"
+#include <time.h>
+
+// Sketch functions the Arduino IDE would prototype
+void startupAnimation();
+void printTrackingDiagnostics();
+void printHelp();
+void handleFaceDetection();
+
+#include "../Buddy_VersionflxV18.ino"
+
+#ifndef SKETCH_HOST_SIZE
+
+#define SIM_ECHO_DELAY_US   460
+#define SIM_NO_ECHO_EVERY   17
+#define SIM_FACE_PERIOD_US  66667UL
+#define SIM_FACE_CYCLE_US   12000000ULL
+#define SIM_FACE_SHOWN_US   8000000ULL
+
+// ============================================
+// CLOCK
+// ============================================
+
+static uint64_t cpuStartUs = 0;
+static uint64_t skippedUs = 0;     // Time advanced without running anything
+static bool clockPinned = false;   // Inside a simulated ISR
+static uint64_t pinnedUs = 0;
+
+static uint64_t cpuUs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000ULL + (uint64_t)(ts.tv_nsec / 1000L);
+}
+
+static uint64_t nowUs() {
+  return clockPinned ? pinnedUs : cpuUs() - cpuStartUs + skippedUs;
+}
+
+static void service();
+
+unsigned long micros() { return (uint32_t)nowUs(); }
+unsigned long millis() { return (uint32_t)(nowUs() / 1000ULL); }
+
+void yield() {
+  if (Serial.available()) serialEvent();
+  if (Serial1.available()) serialEvent1();
+}
+
+void delay(unsigned long ms) {
+  skippedUs += (uint64_t)ms * 1000ULL;
+  if (clockPinned) pinnedUs += (uint64_t)ms * 1000ULL;
+  service();
+  yield();
+}
+
+void delayMicroseconds(unsigned int us) {
+  skippedUs += us;
+  if (clockPinned) pinnedUs += us;
+}
+
+// ============================================
+// MISC CORE
+// ============================================
+
+static uint32_t randState = 1;
+
+void randomSeed(unsigned long seed) { if (seed != 0) randState = (uint32_t)seed; }
+
+long random(long howbig) {
+  if (howbig <= 0) return 0;
+  randState = randState * 1103515245UL + 12345UL;
+  return (long)((randState >> 1) % (uint32_t)howbig);
+}
+
+long random(long howsmall, long howbig) {
+  if (howsmall >= howbig) return howsmall;
+  return howsmall + random(howbig - howsmall);
+}
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+int analogRead(int) { return 512; }
+unsigned long pulseIn(int, int, unsigned long) { return 0; }
+void tone(int, unsigned int) {}
+void tone(int, unsigned int, unsigned long) {}
+void noTone(int) {}
+
+EEPROMClass EEPROM;
+
+// ============================================
+// PINS + HC-SR04
+// ============================================
+
+static uint8_t pinLevel[64];
+static void (*pinIsr[64])() = {};
+static int echoPinSim = -1;
+
+struct EchoEdge { uint64_t atUs; uint8_t level; };
+static EchoEdge echoEdges[2];
+static int echoEdgeCount = 0;
+static unsigned long simPings = 0;
+
+static void simulatePing(uint64_t firedUs) {
+  simPings++;
+  echoEdgeCount = 0;
+  if (simPings % SIM_NO_ECHO_EVERY == 0) return;
+
+  double cm = 80.0 + 40.0 * sin((double)firedUs / 7e6 * 2.0 * M_PI);
+  uint64_t rise = firedUs + SIM_ECHO_DELAY_US;
+  echoEdges[0] = { rise, HIGH };
+  echoEdges[1] = { rise + (uint64_t)(cm * ULTRA_US_PER_CM), LOW };
+  echoEdgeCount = 2;
+}
+
+void pinMode(int, int) {}
+
+void digitalWrite(int pin, int val) {
+  if (pin < 0 || pin >= 64) return;
+  bool falling = pinLevel[pin] == HIGH && val == LOW;
+  pinLevel[pin] = (uint8_t)val;
+  if (pin == trigPin && falling) simulatePing(nowUs());
+}
+
+int digitalRead(int pin) { return pin >= 0 && pin < 64 ? pinLevel[pin] : LOW; }
+
+void attachInterrupt(int irq, void (*fn)(), int) {
+  if (irq < 0 || irq >= 64) return;
+  pinIsr[irq] = fn;
+  echoPinSim = irq;
+}
+
+void detachInterrupt(int irq) { if (irq >= 0 && irq < 64) pinIsr[irq] = nullptr; }
+
+// ============================================
+// INTERVAL TIMER
+// ============================================
+
+static void (*timerFn)() = nullptr;
+static uint64_t timerPeriodUs = 0;
+static uint64_t timerNextUs = 0;
+
+bool IntervalTimer::begin(void (*fn)(), float periodUs) {
+  timerFn = fn;
+  timerPeriodUs = (uint64_t)periodUs;
+  timerNextUs = nowUs() + timerPeriodUs;
+  return true;
+}
+
+void IntervalTimer::update(float periodUs) { timerPeriodUs = (uint64_t)periodUs; }
+void IntervalTimer::end() { timerFn = nullptr; }
+
+// ============================================
+// SERIAL
+// ============================================
+
+HardwareSerialX Serial;
+HardwareSerialX Serial1;
+static FILE* serialOut = nullptr;   // -v: stdout
+static unsigned long long serialBytes = 0;
+
+size_t printSink(const char* data, size_t len) {
+  serialBytes += len;
+  if (serialOut != nullptr) fwrite(data, 1, len, serialOut);
+  return len;
+}
+
+size_t HardwareSerialX::write(uint8_t b) { char c = (char)b; return printSink(&c, 1); }
+size_t HardwareSerialX::write(const uint8_t* b, size_t n) { return printSink((const char*)b, n); }
+
+void HardwareSerialX::feed(const char* line) {
+  if (inPos > 4096) {
+    in.erase(0, inPos);
+    inPos = 0;
+  }
+  in += line;
+}
+
+size_t Print::write(const uint8_t* b, size_t n) {
+  for (size_t i = 0; i < n; i++) write(b[i]);
+  return n;
+}
+
+static size_t printFormatted(const char* fmt, ...) {
+  char buf[64];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  return printSink(buf, (size_t)n);
+}
+
+size_t Print::print(const char* s) { return printSink(s, strlen(s)); }
+size_t Print::print(const String& s) { return printSink(s.c_str(), (size_t)s.length()); }
+size_t Print::print(char c) { return printSink(&c, 1); }
+size_t Print::print(unsigned char v, int base) { return print((unsigned long)v, base); }
+size_t Print::print(int v, int base) { return base == HEX ? print((unsigned long)(unsigned)v, base) : print((long)v, base); }
+size_t Print::print(unsigned int v, int base) { return print((unsigned long)v, base); }
+size_t Print::print(long v, int base) { return base == HEX ? print((unsigned long)v, base) : printFormatted("%ld", v); }
+size_t Print::print(unsigned long v, int base) { return printFormatted(base == HEX ? "%lX" : "%lu", v); }
+size_t Print::print(double v, int digits) { return printFormatted("%.*f", digits, v); }
+size_t Print::println() { return printSink("\r\n", 2); }
+
+int Print::printf(const char* fmt, ...) {
+  char buf[256];
+  va_list ap;
+  va_start(ap, fmt);
+  int n = vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  if (n > (int)sizeof(buf) - 1) n = sizeof(buf) - 1;
+  return (int)printSink(buf, (size_t)n);
+}
+
+size_t Stream::readBytesUntil(char term, char* buf, size_t len) {
+  size_t n = 0;
+  int c;
+  while (n < len && (c = read()) >= 0 && c != term) buf[n++] = (char)c;
+  return n;
+}
+
+String Stream::readStringUntil(char term) {
+  String s;
+  int c;
+  while ((c = read()) >= 0 && c != term) s.s_ += (char)c;
+  return s;
+}
+
+void String::trim() {
+  size_t b = s_.find_first_not_of(" \t\r\n");
+  size_t e = s_.find_last_not_of(" \t\r\n");
+  s_ = b == std::string::npos ? std::string() : s_.substr(b, e - b + 1);
+}
+
+// ============================================
+// ESP32 FACE TRAFFIC
+// ============================================
+
+static uint64_t faceNextUs = 0;
+static unsigned long faceSeq = 0;
+
+static void sendFaceLine(uint64_t t) {
+  char line[80];
+  double s = (double)t / 1e6;
+  if (t % SIM_FACE_CYCLE_US < SIM_FACE_SHOWN_US) {
+    int x = 120 + (int)(70.0 * sin(s * 0.9));
+    int y = 110 + (int)(25.0 * sin(s * 0.5));
+    int w = 55 + (int)(20.0 * sin(s * 0.3));
+    snprintf(line, sizeof(line), "FACE:%d,%d,%d,%d,%d,%d,%d,%lu\n",
+             x, y, (int)(63.0 * cos(s * 0.9)), (int)(12.0 * cos(s * 0.5)), w, w, 85, faceSeq++);
+  } else {
+    snprintf(line, sizeof(line), "NO_FACE,%lu\n", faceSeq++);
+  }
+  Serial1.feed(line);
+}
+
+// ============================================
+// INTERRUPTS + INPUT, in time order
+// ============================================
+
+static void service() {
+  static bool inService = false;
+  if (inService) return;
+  inService = true;
+
+  uint64_t now = nowUs();
+  for (;;) {
+    uint64_t t = UINT64_MAX;
+    int which = -1;
+    if (timerFn != nullptr && timerNextUs <= now && timerNextUs < t) { t = timerNextUs; which = 0; }
+    if (echoEdgeCount > 0 && echoEdges[0].atUs <= now && echoEdges[0].atUs < t) { t = echoEdges[0].atUs; which = 1; }
+    if (faceNextUs <= now && faceNextUs < t) { t = faceNextUs; which = 2; }
+    if (which < 0) break;
+
+    clockPinned = true;
+    pinnedUs = t;
+    if (which == 0) {
+      timerNextUs += timerPeriodUs;
+      timerFn();
+    } else if (which == 1) {
+      EchoEdge edge = echoEdges[0];
+      echoEdges[0] = echoEdges[1];
+      echoEdgeCount--;
+      if (echoPinSim >= 0) {
+        pinLevel[echoPinSim] = edge.level;
+        if (pinIsr[echoPinSim] != nullptr) pinIsr[echoPinSim]();
+      }
+    } else {
+      faceNextUs += SIM_FACE_PERIOD_US;
+      sendFaceLine(t);
+    }
+    clockPinned = false;
+  }
+
+  inService = false;
+}
+
+// ============================================
+// MAIN
+// ============================================
+
+static unsigned long totalRuns() {
+  unsigned long runs = 0;
+  for (int i = 0; i < scheduler.taskCount(); i++) runs += scheduler.task(i).runs;
+  return runs;
+}
+
+// Time until a task that isn't yet due comes due (ignores overdue ones)
+static uint32_t usUntilNextStart() {
+  uint32_t now = micros();
+  uint32_t best = 0;
+  for (int i = 0; i < scheduler.taskCount(); i++) {
+    const ScheduledTask& t = scheduler.task(i);
+    int32_t wait = (int32_t)(t.nextDueUs - now);
+    if (t.enabled && wait > 0 && (best == 0 || (uint32_t)wait < best)) best = (uint32_t)wait;
+  }
+  return best;
+}
+
+int main(int argc, char** argv) {
+  double seconds = 610;   // Past the first 5-minute diagnostics dump
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc) seconds = atof(argv[++i]);
+    else if (strcmp(argv[i], "-v") == 0) serialOut = stdout;
+    else {
+      fprintf(stderr, "Usage: %s [--seconds N] [-v]\n", argv[0]);
+      return 2;
+    }
+  }
+
+  cpuStartUs = cpuUs();
+  Serial1.feed("ESP32_READY\n");
+  setup();
+
+  for (int i = 0; i < scheduler.taskCount(); i++) {
+    if (strcmp(scheduler.task(i).name, "profile") == 0) scheduler.setEnabled(i, false);
+  }
+  faceNextUs = nowUs();
+  scheduler.resetStats();
+  unsigned long long setupBytes = serialBytes;
+
+  uint64_t startUs = nowUs();
+  uint64_t endUs = startUs + (uint64_t)(seconds * 1e6);
+  unsigned long passes = 0;
+  while (nowUs() < endUs) {
+    service();
+    unsigned long runsBefore = totalRuns();
+    loop();
+    passes++;
+
+    // loop() only delays for 1 ms or more; skip the spin below that. A
+    // deferred task stays due while it waits, so if nothing ran, skip to
+    // the next task that comes due.
+    uint32_t idleUs = scheduler.usUntilNextDue();
+    if (idleUs == 0 && totalRuns() == runsBefore) skippedUs += usUntilNextStart();
+    else if (idleUs < 1000) skippedUs += idleUs;
+  }
+  double simS = (double)(nowUs() - startUs) / 1e6;
+  uint64_t busyUs = 0;
+  for (int i = 0; i < scheduler.taskCount(); i++) busyUs += scheduler.task(i).totalUs;
+
+  if (serialOut != nullptr) fflush(serialOut);
+  printf("LOG_LEVEL %d, %.0f s simulated, %lu loop passes, busy %.3f%%\n",
+         LOG_LEVEL, simS, passes, 100.0 * (double)busyUs / (simS * 1e6));
+  printf("serial: %llu bytes in setup, %llu bytes/s after\n",
+         setupBytes, (unsigned long long)((double)(serialBytes - setupBytes) / simS));
+  printf("%-10s %8s %8s %8s %8s\n", "task", "runs", "avg_us", "wcet_us", "overrun");
+  for (int i = 0; i < scheduler.taskCount(); i++) {
+    const ScheduledTask& t = scheduler.task(i);
+    if (!t.enabled) continue;
+    printf("%-10s %8lu %8.1f %8lu %8lu\n", t.name, t.runs,
+           t.runs > 0 ? (double)t.totalUs / (double)t.runs : 0.0,
+           (unsigned long)t.wcetUs, t.overruns);
+  }
+  return 0;
+}
+
+#endif // SKETCH_HOST_SIZE
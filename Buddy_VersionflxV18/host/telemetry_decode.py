@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+"""
+Decoder for the Teensy's binary telemetry (Telemetry.h, 'b' key → BINARY).
+
+Event names and argument labels come straight from the TELEMETRY_EVENTS
+table in ../Telemetry.h, so a new event only needs adding there. Labels
+ending in _x10 / _x100 are scaled back to floats, _4cc to four characters.
+
+Frames are resynchronised on the 0xA5 0x7E magic and checked against the
+8-bit sum; a bad frame is skipped and counted. Gaps in the per-record
+sequence number are records lost between the Teensy and here; records
+the firmware's ring had no room for are reported in-band by its own
+telemetry_dropped event.
+
+Text lines mixed into the stream (boot banner, key responses) are passed
+through with --text so nothing is lost while debugging.
+
+--csv writes long format: a header, then one row per argument
+(time_ms,seq,event,arg,value); an event with no arguments gets one row
+with arg and value empty. Events carry different arguments, so this
+keeps one fixed set of columns for every record.
+
+Usage:
+  python3 telemetry_decode.py /dev/ttyACM0           (needs pyserial)
+  python3 telemetry_decode.py capture.bin --csv > telemetry.csv
+  cat capture.bin | python3 telemetry_decode.py -
+"""
+
+import argparse
+import csv
+import os
+import re
+import struct
+import sys
+
+MAGIC = b"\xA5\x7E"
+RECORD = struct.Struct("<IHH4i")   # TelemetryWire
+MAX_RECORDS = 255
+
+HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "Telemetry.h")
+ENTRY = re.compile(r'X\(\s*(\w+)\s*,\s*"([^"]*)"\s*,\s*(\d+)\s*,'
+                   r'\s*"([^"]*)"\s*,\s*"([^"]*)"\s*,\s*"([^"]*)"\s*,\s*"([^"]*)"\s*\)')
+
+
+def load_events(path):
+    """Event table in declaration order: list of (name, [labels])."""
+    with open(path, encoding="utf-8") as f:
+        source = f.read()
+    start = source.index("#define TELEMETRY_EVENTS(X)")
+    end = source.index("\n\n", start)
+    events = [(m.group(2), [m.group(i) for i in range(4, 8)])
+              for m in ENTRY.finditer(source[start:end])]
+    if not events:
+        sys.exit("no TELEMETRY_EVENTS entries found in " + path)
+    return events
+
+
+def format_arg(label, value):
+    if label.endswith("_x100"):
+        return label[:-5], value / 100.0
+    if label.endswith("_x10"):
+        return label[:-4], value / 10.0
+    if label.endswith("_4cc"):
+        raw = struct.pack("<i", value)
+        return label[:-4], raw.rstrip(b"\0").decode("ascii", errors="replace")
+    return label, value
+
+
+class Decoder:
+    def __init__(self, events, emit, text=None):
+        self.events = events
+        self.emit = emit
+        self.text = text
+        self.buf = bytearray()
+        self.last_seq = None
+        self.frames = 0
+        self.records = 0
+        self.bad_frames = 0
+        self.seq_gaps = 0
+        self.lost = 0
+
+    def feed(self, data):
+        self.buf += data
+        while True:
+            at = self.buf.find(MAGIC)
+            if at < 0:
+                keep = 1 if self.buf.endswith(MAGIC[:1]) else 0
+                self.passthrough(self.buf[:len(self.buf) - keep])
+                del self.buf[:len(self.buf) - keep]
+                return
+            self.passthrough(self.buf[:at])
+            del self.buf[:at]
+
+            if len(self.buf) < 3:
+                return
+            count = self.buf[2]
+            size = 3 + count * RECORD.size + 1
+            if count == 0 or count > MAX_RECORDS:
+                self.bad_frames += 1
+                del self.buf[:2]
+                continue
+            if len(self.buf) < size:
+                return
+
+            body = bytes(self.buf[3:size - 1])
+            if (count + sum(body)) & 0xFF != self.buf[size - 1]:
+                # Not a real frame (or corrupted): skip the magic and rescan
+                self.bad_frames += 1
+                del self.buf[:2]
+                continue
+            del self.buf[:size]
+            self.frames += 1
+            for i in range(count):
+                self.record(RECORD.unpack_from(body, i * RECORD.size))
+
+    def passthrough(self, data):
+        if self.text and data:
+            self.text(bytes(data).decode("utf-8", errors="replace"))
+
+    def record(self, rec):
+        time_us, event_id, seq, *args = rec
+        if self.last_seq is not None:
+            gap = (seq - self.last_seq - 1) & 0xFFFF
+            if gap:
+                self.seq_gaps += 1
+                self.lost += gap
+        self.last_seq = seq
+        self.records += 1
+
+        if event_id < len(self.events):
+            name, labels = self.events[event_id]
+        else:
+            name, labels = "event_%d" % event_id, ["a0", "a1", "a2", "a3"]
+        fields = [format_arg(label, value)
+                  for label, value in zip(labels, args) if label]
+        self.emit(time_us, seq, name, fields)
+
+
+def open_source(path, baud):
+    if path == "-":
+        return sys.stdin.buffer
+    if path.startswith("/dev/") or path.upper().startswith("COM"):
+        try:
+            import serial
+        except ImportError:
+            sys.exit("reading a serial port needs pyserial (pip install pyserial)")
+        return serial.Serial(path, baud, timeout=0.1)
+    return open(path, "rb")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("source", help="serial port, capture file, or - for stdin")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--header", default=HEADER, help="path to Telemetry.h")
+    parser.add_argument("--csv", action="store_true",
+                        help="CSV, one row per argument: time_ms,seq,event,arg,value")
+    parser.add_argument("--text", action="store_true",
+                        help="also print non-telemetry bytes (to stderr)")
+    args = parser.parse_args()
+
+    events = load_events(args.header)
+    writer = csv.writer(sys.stdout, lineterminator="\n") if args.csv else None
+    if writer:
+        writer.writerow(["time_ms", "seq", "event", "arg", "value"])
+
+    def emit(time_us, seq, name, fields):
+        if writer:
+            time_ms = "%.3f" % (time_us / 1000.0)
+            for k, v in fields or [("", "")]:
+                writer.writerow([time_ms, seq, name, k, v])
+        else:
+            values = " ".join("%s=%s" % (k, v) for k, v in fields)
+            print("[T %10.3f] #%-5d %-18s %s" % (time_us / 1000.0, seq, name, values))
+
+    def text(s):
+        sys.stderr.write(s)
+
+    decoder = Decoder(events, emit, text if args.text else None)
+    source = open_source(args.source, args.baud)
+    try:
+        while True:
+            data = source.read(4096)
+            if not data:
+                if hasattr(source, "in_waiting"):
+                    continue   # Serial port: keep listening
+                break
+            decoder.feed(data)
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
+
+    sys.stderr.write("\n%d frames, %d records, %d bad frames, %d seq gaps (%d records lost)\n"
+                     % (decoder.frames, decoder.records, decoder.bad_frames,
+                        decoder.seq_gaps, decoder.lost))
+
+
+if __name__ == "__main__":
+    main()
@@ -37,6 +37,7 @@ import traceback
 from pathlib import Path
 
 import collections
+import queue
 import random
 
 from flask import Flask, render_template_string, request, jsonify, send_file, redirect
@@ -77,6 +78,9 @@ CONFIG = {
     "esp32_ip": os.environ.get("BUDDY_ESP32_IP", "192.168.1.100"),
     "esp32_ws_port": 81,
     "teensy_comm_mode": "websocket",   # "websocket" or "serial"
+    "teensy_state_stream": "sub",      # "sub": !SUB topics, "delta": !STREAM:delta, "off": poll !QUERY (websocket only)
+    # !SUB topic@hz or topic@event — servo pose fast, slow-moving topics slow
+    "teensy_subscriptions": "servo@10,emotion@2,needs@1,consciousness@1,tracking@event,speech@event",
 
     # Vision Pipeline (Package 2)
     "vision_api_url": "http://localhost:5555",
@@ -837,6 +841,16 @@ teensy_connected = False
 # WebSocket connection to ESP32 bridge
 ws_connection = None
 ws_lock = threading.Lock()
+# One command in flight at a time: the sender holds ws_io_lock from send
+# until its reply arrives on ws_replies. Only teensy_ws_reader() calls
+# recv(); it applies STATE:/EVT: lines itself and queues everything else.
+ws_io_lock = threading.Lock()
+ws_replies = queue.Queue()
+# !BATCH answers arrive as BATCH: lines whenever the batch finishes, so
+# they get their own queue and ws_io_lock is free while a batch runs.
+# The bridge holds one batch at a time; ws_batch_lock does the same here.
+ws_batch_lock = threading.Lock()
+ws_batch_replies = queue.Queue()
 teensy_state = {
     "arousal": 0.5, "valence": 0.0, "dominance": 0.5,
     "emotion": "NEUTRAL", "behavior": "IDLE",
@@ -1820,6 +1834,8 @@ def connect_teensy_ws():
 
         # Set teensy_connected AFTER JSON is validated (was before)
         teensy_connected = True
+        forget_teensy_commands()
+        teensy_state_stream.reset()
         socketio.emit('teensy_status', {'connected': True, 'port': f'WS:{ip}:{port}'})
         socketio.emit('log', {'message': 'Teensy responding via WebSocket bridge', 'level': 'success'})
         return True
@@ -1845,6 +1861,8 @@ def connect_teensy_serial():
         if not port: port = CONFIG.get("teensy_port", "COM12")
         teensy_serial = serial.Serial(port=port, baudrate=CONFIG.get("teensy_baud", 115200), timeout=0.1)
         teensy_connected = True
+        forget_teensy_commands()
+        teensy_state_stream.reset()
         # Phase 1H: ISSUE-4 fix — don't permanently change comm mode here.
         # If WebSocket reconnects later, we want to try it again.
         socketio.emit('teensy_status', {'connected': True, 'port': port})
@@ -1885,9 +1903,13 @@ def teensy_send_ws(cmd, fallback=None):
     # reconnect, our local ref may error out, which we handle below.
     use_fallback = False
     try:
-        conn.send(f"!{cmd}")
-        conn.settimeout(0.5)  # 500ms timeout
-        resp = conn.recv()
+        with ws_io_lock:
+            discard_ws_replies()
+            conn.send(f"!{cmd}")
+            try:
+                resp = ws_replies.get(timeout=0.5)  # 500ms timeout
+            except queue.Empty:
+                resp = None
 
         if resp:
             resp = resp.strip()
@@ -1905,8 +1927,6 @@ def teensy_send_ws(cmd, fallback=None):
         if not use_fallback:
             return None
 
-    except websocket.WebSocketTimeoutException:
-        return None
     except Exception as e:
         # Connection may have been swapped/closed by reconnect — that's OK
         teensy_connected = False
@@ -1955,6 +1975,105 @@ def teensy_send_with_fallback(primary_cmd, fallback_cmd=None):
         return teensy_send_command(fallback_cmd)
     return result
 
+# Batch frames: a whole (command, delay) sequence travels as one !BATCH
+# message and comes back as one aggregated result (see AIBridge.h).
+BATCH_MAX_COMMANDS = 16
+BATCH_MAX_PAYLOAD = 240
+BATCH_PER_CMD_ALLOWANCE_S = 1.5  # matches BATCH_PER_CMD_ALLOWANCE_MS on the bridge
+# Rejections of the batch as a whole (nothing ran). unknown_command is
+# firmware without !BATCH, relayed by the bridge.
+BATCH_RETRY_REASONS = ("unknown_command", "batch_busy", "too_long", "too_many", "uart_busy")
+
+def teensy_send_batch_ws(payload, count, total_delay):
+    """Send one !BATCH frame over the WebSocket bridge and wait for its result.
+
+    ws_io_lock is held only for the send; the result comes back on
+    ws_batch_replies, so other commands and the state poll keep running.
+    """
+    global teensy_connected
+
+    with ws_lock:
+        if not teensy_connected or not ws_connection:
+            return None
+        conn = ws_connection
+
+    deadline = time.time() + 0.5 + total_delay + count * BATCH_PER_CMD_ALLOWANCE_S
+    try:
+        with ws_batch_lock:
+            while True:
+                try:
+                    ws_batch_replies.get_nowait()  # Late answer to a timed-out batch
+                except queue.Empty:
+                    break
+            with ws_io_lock:
+                conn.send(f"!BATCH:{payload}")
+            try:
+                resp = ws_batch_replies.get(timeout=max(0.05, deadline - time.time()))
+            except queue.Empty:
+                return None
+        try:
+            return json.loads(resp)
+        except json.JSONDecodeError:
+            socketio.emit('log', {'message': f'Malformed batch result: {resp[:80]}', 'level': 'warning'})
+            return None
+    except Exception as e:
+        teensy_connected = False
+        socketio.emit('log', {'message': f'WebSocket error: {e}', 'level': 'error'})
+        return None
+
+def batch_rejected_whole(result):
+    """True if the batch was refused before any entry ran.
+
+    Results of a batch that ran carry "n"/"results"; their "reason" is an
+    entry's, and re-sending would run the entries that succeeded twice.
+    """
+    return (result is not None and not result.get('ok')
+            and 'n' not in result and 'results' not in result
+            and result.get('reason') in BATCH_RETRY_REASONS)
+
+def teensy_run_sequence(commands):
+    """Run a list of (command, delay_seconds) tuples, "wait" entries allowed.
+
+    In websocket mode the sequence is sent as a single batch frame; delays
+    become "ms@" prefixes on the following entry. Falls back to one command
+    per round trip in serial mode or when the batch is refused as a whole
+    (older firmware, bridge busy, too large); never after entries ran.
+    """
+    entries = []
+    pending_delay = 0.0
+    total_delay = 0.0
+    for cmd, delay in commands:
+        if cmd == "wait":
+            pending_delay += delay
+            continue
+        ms = int(round(pending_delay * 1000))
+        entries.append(f"{ms}@{cmd}" if ms > 0 else cmd)
+        total_delay += pending_delay
+        pending_delay = max(0.0, delay)
+
+    payload = "|".join(entries)
+    use_batch = (CONFIG.get("teensy_comm_mode", "websocket") == "websocket"
+                 and 0 < len(entries) <= BATCH_MAX_COMMANDS
+                 and len(payload) <= BATCH_MAX_PAYLOAD)
+
+    if use_batch:
+        result = teensy_send_batch_ws(payload, len(entries), total_delay)
+        if not batch_rejected_whole(result):
+            if pending_delay > 0:
+                time.sleep(pending_delay)
+            return result
+
+    # Sequential fallback — one round trip per command
+    result = None
+    for cmd, delay in commands:
+        if cmd == "wait":
+            time.sleep(delay)
+        else:
+            result = teensy_send_command(cmd)
+            if delay > 0:
+                time.sleep(delay)
+    return result
+
 def query_teensy_state():
     global teensy_state
     r = teensy_send_command("QUERY")
@@ -1963,6 +2082,209 @@ def query_teensy_state():
         return r
     return None
 
+class TeensyStateStream:
+    """Rebuilds Teensy state from STATE: lines pushed by !STREAM:delta.
+
+    Every frame carries a 16-bit "seq"; keyframes ("key":1) carry every
+    field, the frames between them only the fields that changed past the
+    firmware's per-field epsilon (see STATE_FIELDS in AIBridge.h). A seq
+    gap means a frame was lost, so the state is unusable until the next
+    keyframe. Frames without "seq" come from !STREAM:on (every field) or
+    !SUB (every field of each due topic) and are applied as they are.
+    """
+
+    # Firmware sends a keyframe (delta) or each @event topic (sub) at least
+    # every 10s even when nothing changes
+    STALE_AFTER_S = 12.0
+
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.reset()
+
+    def reset(self):
+        with self.lock:
+            self.requested_at = 0.0
+            self.state = {}
+            self.seq = None
+            self.synced = False
+            self.last_rx = 0.0
+            self.frames = 0
+            self.keyframes = 0
+            self.gaps = 0
+            self.bytes = 0
+
+    def feed(self, line):
+        """Apply one line; returns False if it isn't a STATE: frame."""
+        if not line.startswith("STATE:"):
+            return False
+        try:
+            msg = json.loads(line[6:])
+        except json.JSONDecodeError:
+            return True
+        with self.lock:
+            self.frames += 1
+            self.bytes += len(line) + 1
+            self.last_rx = time.time()
+            seq = msg.pop("seq", None)
+            keyframe = msg.pop("key", 0)
+            if seq is None:
+                self.state.update(msg)
+                self.synced = True
+                return True
+            if self.seq is not None and seq != (self.seq + 1) & 0xFFFF:
+                self.gaps += 1
+                self.synced = False
+            self.seq = seq
+            if keyframe:
+                self.keyframes += 1
+                self.state = msg
+                self.synced = True
+            elif self.synced:
+                self.state.update(msg)
+        return True
+
+    def snapshot(self):
+        """Current state, or None while out of sync or silent."""
+        with self.lock:
+            if not self.synced or time.time() - self.last_rx > self.STALE_AFTER_S:
+                return None
+            return dict(self.state)
+
+    def stats(self):
+        with self.lock:
+            return {"synced": self.synced, "seq": self.seq, "frames": self.frames,
+                    "keyframes": self.keyframes, "gaps": self.gaps, "bytes": self.bytes}
+
+teensy_state_stream = TeensyStateStream()
+
+# Edge events pushed by the firmware (EVT: lines, see AIEvents.h). The
+# state fields they change are applied right away, and speech/behavior
+# edges wake the poll loop so spontaneous speech reacts within a tick
+# instead of up to a poll period later.
+TEENSY_EVENT_STATE = {
+    "speech_ready":   lambda e: {"wantsToSpeak": True, "speechTrigger": e.get("trigger", "none")},
+    "speech_cleared": lambda e: {"wantsToSpeak": False},
+    "speech_trigger": lambda e: {"speechTrigger": e.get("to", "none")},
+    "behavior":       lambda e: {"behavior": e.get("to", "IDLE")},
+    "epistemic":      lambda e: {"epistemic": e.get("to", "confident")},
+    "wonder_start":   lambda e: {"wondering": True},
+    "wonder_end":     lambda e: {"wondering": False},
+}
+TEENSY_WAKE_EVENTS = ("speech_ready", "speech_cleared", "behavior")
+teensy_poll_wake = threading.Event()
+
+def handle_teensy_event(line):
+    """Apply one EVT: line; returns False if it isn't one."""
+    if not line.startswith("EVT:"):
+        return False
+    try:
+        evt = json.loads(line[4:])
+    except json.JSONDecodeError:
+        return True
+    name = evt.get("evt", "")
+    apply = TEENSY_EVENT_STATE.get(name)
+    if apply:
+        with teensy_state_lock:
+            teensy_state.update(apply(evt))
+    if name == "dropped":
+        socketio.emit('log', {'message': f'Teensy dropped {evt.get("count")} events', 'level': 'warning'})
+    socketio.emit('teensy_event', evt)
+    if name in TEENSY_WAKE_EVENTS:
+        teensy_poll_wake.set()
+    return True
+
+def discard_ws_replies():
+    """Drop replies to commands that already timed out."""
+    while True:
+        try:
+            ws_replies.get_nowait()
+        except queue.Empty:
+            return
+
+def teensy_ws_reader():
+    """Sole reader of the bridge socket (websocket mode)."""
+    while True:
+        with ws_lock:
+            conn = ws_connection if teensy_connected else None
+        if conn is None:
+            time.sleep(0.1)
+            continue
+        try:
+            conn.settimeout(0.2)
+            line = conn.recv()
+        except websocket.WebSocketTimeoutException:
+            continue
+        except Exception:
+            time.sleep(0.1)  # closed or swapped; senders report and reconnect
+            continue
+        if not line:
+            continue
+        line = line.strip()
+        if teensy_state_stream.feed(line) or handle_teensy_event(line):
+            continue
+        if line.startswith("BATCH:"):
+            ws_batch_replies.put(line[6:])
+            continue
+        ws_replies.put(line)
+
+def poll_teensy_state():
+    """Streamed state when the push stream is in sync, else one !QUERY.
+
+    A missing or out-of-sync stream is (re)requested at most every 5s;
+    !STREAM:delta opens with a keyframe and !SUB with every subscribed
+    topic, so one request is enough to resync.
+    """
+    mode = CONFIG.get("teensy_state_stream", "sub")
+    if CONFIG.get("teensy_comm_mode", "websocket") != "websocket" or mode not in ("sub", "delta"):
+        return query_teensy_state()
+
+    s = teensy_state_stream.snapshot()
+    if s:
+        with teensy_state_lock:
+            teensy_state.update(s)
+            return dict(teensy_state)
+
+    stream = teensy_state_stream
+    now = time.time()
+    if now - stream.requested_at > 5.0:
+        stream.requested_at = now
+        if mode == "sub":
+            teensy_send_command(f"SUB:{CONFIG['teensy_subscriptions']}")
+        else:
+            teensy_send_command("STREAM:delta")
+    return query_teensy_state()
+
+# Command schemas reported by the firmware (!COMMANDS, see AICommands.h).
+# Fetched on first use after each connect, since the firmware may have
+# been reflashed; older firmware answers unknown_command and the cache
+# stays empty.
+teensy_commands = {}
+teensy_commands_lock = threading.Lock()
+
+def query_teensy_commands():
+    """Return {name: {"help", "args"}} for every command the firmware accepts."""
+    with teensy_commands_lock:
+        if teensy_commands:
+            return dict(teensy_commands)
+
+    listing = teensy_send_command("COMMANDS")
+    if not listing or not listing.get('ok'):
+        return {}
+    schemas = {}
+    for name in listing.get('commands', []):
+        r = teensy_send_command(f"COMMANDS:{name}")
+        if r and r.get('ok'):
+            schemas[name] = {"help": r.get('help', ''), "args": r.get('args', [])}
+
+    with teensy_commands_lock:
+        teensy_commands.clear()
+        teensy_commands.update(schemas)
+    return schemas
+
+def forget_teensy_commands():
+    with teensy_commands_lock:
+        teensy_commands.clear()
+
 def teensy_poll_loop():
     global teensy_connected
     ws_reconnect_count = 0
@@ -1976,7 +2298,7 @@ def teensy_poll_loop():
                 if is_test:
                     teensy_send_command("IDLE")
 
-                s = query_teensy_state()
+                s = poll_teensy_state()
                 if s:
                     socketio.emit('buddy_state', s)
                     ws_reconnect_count = 0  # Reset on success
@@ -2036,7 +2358,9 @@ def teensy_poll_loop():
             print(f"[TEENSY] Poll loop error: {e}\n{traceback.format_exc()}")
             socketio.emit('log', {'message': f'Poll loop error: {e}', 'level': 'error'})
 
-        time.sleep(CONFIG.get("teensy_state_poll_interval", 1.0))
+        # EVT: speech/behavior edges cut the wait short
+        teensy_poll_wake.wait(CONFIG.get("teensy_state_poll_interval", 1.0))
+        teensy_poll_wake.clear()
 
 def execute_buddy_actions(text):
     """Parse and execute action commands from Buddy's response."""
@@ -2107,13 +2431,7 @@ def execute_buddy_actions(text):
         cmds = physical_expression_mgr.get_expression_commands(
             "sigh", current_base=base, current_nod=nod
         )
-        for cmd, delay in cmds:
-            if cmd == "wait":
-                time.sleep(delay)
-            else:
-                teensy_send_command(cmd)
-                if delay > 0:
-                    time.sleep(delay)
+        teensy_run_sequence(cmds)
         actions.append("sighed")
 
     # [DOUBLE_TAKE] — physical expression: surprise double-take
@@ -2124,13 +2442,7 @@ def execute_buddy_actions(text):
         cmds = physical_expression_mgr.get_expression_commands(
             "double_take", current_base=base, current_nod=nod
         )
-        for cmd, delay in cmds:
-            if cmd == "wait":
-                time.sleep(delay)
-            else:
-                teensy_send_command(cmd)
-                if delay > 0:
-                    time.sleep(delay)
+        teensy_run_sequence(cmds)
         actions.append("double take")
 
     # [DISMISS] — physical expression: slow dismissive turn
@@ -2141,13 +2453,7 @@ def execute_buddy_actions(text):
         cmds = physical_expression_mgr.get_expression_commands(
             "dismissive_turn", current_base=base, current_nod=nod
         )
-        for cmd, delay in cmds:
-            if cmd == "wait":
-                time.sleep(delay)
-            else:
-                teensy_send_command(cmd)
-                if delay > 0:
-                    time.sleep(delay)
+        teensy_run_sequence(cmds)
         actions.append("dismissed")
 
     if actions: socketio.emit('log', {'message': f'Actions: {", ".join(actions)}', 'level': 'info'})
@@ -3248,13 +3554,7 @@ def process_narrative_speech(strategy, saved_state):
         # Freeze attention during servo movement (camera swings)
         attention_detector.freeze()
         try:
-            for cmd, delay in pre_commands:
-                if cmd == "wait":
-                    time.sleep(delay)
-                else:
-                    teensy_send_command(cmd)
-                    if delay > 0:
-                        time.sleep(delay)
+            teensy_run_sequence(pre_commands)
         finally:
             attention_detector.unfreeze()
 
@@ -3373,13 +3673,7 @@ def process_narrative_speech(strategy, saved_state):
             )
             attention_detector.freeze()
             try:
-                for cmd, delay in post_commands:
-                    if cmd == "wait":
-                        time.sleep(delay)
-                    else:
-                        teensy_send_command(cmd)
-                        if delay > 0:
-                            time.sleep(delay)
+                teensy_run_sequence(post_commands)
             finally:
                 attention_detector.unfreeze()
 
@@ -3473,13 +3767,7 @@ def process_narrative_speech(strategy, saved_state):
             # Resolution arc — freeze attention during servo movement
             attention_detector.freeze()
             try:
-                for cmd, delay in resolution_commands:
-                    if cmd == "wait":
-                        time.sleep(delay)
-                    else:
-                        teensy_send_command(cmd)
-                        if delay > 0:
-                            time.sleep(delay)
+                teensy_run_sequence(resolution_commands)
             finally:
                 attention_detector.unfreeze()
 
@@ -3644,6 +3932,12 @@ def api_vision_health():
     except (requests.exceptions.RequestException, ValueError):
         return jsonify({"ok": False})
 
+@app.route('/api/teensy_commands')
+def api_teensy_commands():
+    """Command list and argument schemas as reported by the Teensy firmware."""
+    commands = query_teensy_commands()
+    return jsonify({"ok": bool(commands), "commands": commands})
+
 @app.route('/api/inner_thought')
 def api_inner_thought():
     """Return current inner-thought context (buddy state, narrative, intent)."""
@@ -3988,6 +4282,7 @@ def api_health():
             "connected": teensy_connected,
             "comm_mode": CONFIG.get("teensy_comm_mode", "websocket"),
             "ws_lock_locked": ws_lock.locked(),
+            "state_stream": teensy_state_stream.stats(),
         },
         "wake_word": {
             "running": wake_word_running,
@@ -4385,6 +4680,7 @@ if __name__ == '__main__':
                      name="vad-init").start()
 
     threading.Thread(target=teensy_poll_loop, daemon=True).start()
+    threading.Thread(target=teensy_ws_reader, daemon=True, name="teensy-ws-reader").start()
     threading.Thread(target=wake_word_loop, daemon=True).start()
 
     # Phase C: Start SceneContext and vision sender (now event-driven)
@@ -4424,13 +4720,7 @@ if __name__ == '__main__':
         def _run_ready():
             attention_detector.freeze()
             try:
-                for cmd, delay in commands:
-                    if cmd == "wait":
-                        time.sleep(delay)
-                    else:
-                        teensy_send_command(cmd)
-                        if delay > 0:
-                            time.sleep(delay)
+                teensy_run_sequence(commands)
             finally:
                 attention_detector.unfreeze()
 
@@ -8,8 +8,8 @@
  *              Outputs face position/velocity to Teensy via Serial at 50Hz.
  *              Includes HTTP server for JPEG frame capture on /capture endpoint.
  *
- * Version:     8.1.0
- * Date:        2025-02-04
+ * Version:     8.2.0
+ * Date:        2026-10-16
  * Author:      Frank
  * Repository:  https://github.com/frosted123456/buddyesp32cam
  *
@@ -90,11 +90,20 @@
  * Edit WIFI_SSID and WIFI_PASSWORD constants below before uploading.
  * The device IP address will be printed to Serial on successful connection.
  * Access the camera feed at: http://<IP_ADDRESS>/capture
+ * Face crop only:             http://<IP_ADDRESS>/capture?x=80&y=60&w=96&h=96&out_w=64
  *
  * ═══════════════════════════════════════════════════════════════════════════════
  * VERSION HISTORY
  * ═══════════════════════════════════════════════════════════════════════════════
  *
+ * v8.2.0 (2026-10-16)
+ *   - /capture accepts crop box (x,y,w,h), output size (out_w,out_h) and
+ *     JPEG quality; the crop is cut from the raw RGB565 frame before encoding
+ *   - Requests within SNAPSHOT_FRAME_WINDOW_MS share one captured frame;
+ *     identical requests on it are served from a small LRU
+ *   - ROI quality is fmt2jpg's 1-100 (default 80), not the sensor's 0-63;
+ *     parameters and LRU come from SnapshotCache.h, the bridge's copy
+ *
  * v8.1.0 (2025-02-04)
  *   - Fixed HTTP capture timeout/crash: added watchdog timer reset
  *   - Fixed frame buffer leak in HTTP capture handler
@@ -135,6 +144,7 @@
 #include "esp_camera.h"
 #include "img_converters.h"  // For frame2jpg() - RGB565 to JPEG conversion
 #include "HistogramTracker.h"
+#include "SnapshotCache.h"     // Same file as Buddy_ESP32_Bridge/SnapshotCache.h
 #include <WiFi.h>
 #include <WebServer.h>
 #include "esp_task_wdt.h"    // Watchdog timer control
@@ -194,6 +204,7 @@ const float MAX_FAILURE_RATE_PERCENT = 10.0;
 const int HTTP_SERVER_PORT = 80;
 const int JPEG_QUALITY = 12;           // 0-63, lower = better quality
 const int JPEG_QUALITY_LOW_MEM = 25;   // Reduced quality when memory is tight
+const unsigned long SNAPSHOT_FRAME_WINDOW_MS = 100;   // ROI requests this close share a frame
 
 // ============================================
 // WATCHDOG & RECOVERY CONFIGURATION
@@ -210,6 +221,7 @@ WebServer server(HTTP_SERVER_PORT);
 bool wifiConnected = false;
 bool enableRotation = true;
 uint8_t* rotationBuffer = NULL;
+uint8_t* snapshotFrame = NULL;          // Raw RGB565 frame shared by ROI requests
 
 // ============================================
 // SIMPLE STATE - Direct measurements
@@ -383,6 +395,77 @@ bool setupWiFi() {
   return true;
 }
 
+// ============================================
+// ROI SNAPSHOTS
+// ============================================
+// Crop/scale requests are cut from the raw RGB565 frame, so only the
+// requested region is JPEG-encoded and sent. SnapshotParams resolves the
+// request (quality on fmt2jpg's 1-100 scale, SNAPSHOT_DEFAULT_QUALITY when
+// omitted) and SnapshotCache keeps encoded results keyed by request + frame.
+SnapshotCache snapshotCache;            // Only touched from the WebServer loop
+uint32_t snapshotSeq = 0;               // Bumped per captured snapshotFrame
+unsigned long snapshotMillis = 0;
+int snapshotW = 0, snapshotH = 0;
+unsigned long snapshotHits = 0;
+unsigned long snapshotMisses = 0;
+
+// Any crop/scale/quality argument turns /capture into an ROI snapshot
+bool readSnapshotArgs(SnapshotParams& r) {
+  struct { const char* name; int* field; } args[] = {
+    {"x", &r.x}, {"y", &r.y}, {"w", &r.w}, {"h", &r.h},
+    {"out_w", &r.outW}, {"out_h", &r.outH}, {"quality", &r.quality},
+  };
+  r = SnapshotParams();
+  bool any = false;
+  for (auto& a : args) {
+    if (server.hasArg(a.name)) {
+      *a.field = server.arg(a.name).toInt();
+      any = true;
+    }
+  }
+  return any;
+}
+
+// Grab a new raw frame unless the last one is recent enough to share
+bool refreshSnapshotFrame() {
+  if (snapshotSeq != 0 && millis() - snapshotMillis < SNAPSHOT_FRAME_WINDOW_MS) return true;
+  if (!camera.capture().isOk()) return false;
+
+  size_t len = camera.frame->len;
+  if (len > (size_t)CAMERA_WIDTH * CAMERA_HEIGHT * 2) return false;
+  memcpy(snapshotFrame, camera.frame->buf, len);
+  snapshotW = camera.frame->width;
+  snapshotH = camera.frame->height;
+  snapshotSeq++;
+  snapshotMillis = millis();
+  return true;
+}
+
+// Crop + nearest-neighbour scale from the raw frame, then encode only that
+uint8_t* encodeSnapshot(const SnapshotParams& r, size_t& outLen) {
+  uint16_t* crop = (uint16_t*)ps_malloc((size_t)r.outW * r.outH * 2);
+  if (crop == NULL) return NULL;
+
+  const uint16_t* src = (const uint16_t*)snapshotFrame;
+  for (int oy = 0; oy < r.outH; oy++) {
+    const uint16_t* row = src + (r.y + oy * r.h / r.outH) * snapshotW + r.x;
+    uint16_t* dst = crop + oy * r.outW;
+    for (int ox = 0; ox < r.outW; ox++) {
+      dst[ox] = row[ox * r.w / r.outW];
+    }
+  }
+
+  uint8_t* jpeg = NULL;
+  bool ok = fmt2jpg((uint8_t*)crop, (size_t)r.outW * r.outH * 2, r.outW, r.outH,
+                    PIXFORMAT_RGB565, r.quality, &jpeg, &outLen);
+  free(crop);
+  if (!ok) {
+    if (jpeg != NULL) free(jpeg);
+    return NULL;
+  }
+  return jpeg;
+}
+
 // ============================================
 // HTTP SERVER HANDLERS
 // ============================================
@@ -396,15 +479,56 @@ void handleHealth() {
   size_t freeHeap = ESP.getFreeHeap();
   size_t freePsram = ESP.getFreePsram();
 
-  char response[128];
+  char response[160];
   snprintf(response, sizeof(response),
-           "OK\nheap:%u\npsram:%u\nwifi:%d\nuptime:%lu",
+           "OK\nheap:%u\npsram:%u\nwifi:%d\nsnap_hit:%lu\nsnap_miss:%lu\nuptime:%lu",
            (unsigned int)freeHeap, (unsigned int)freePsram,
            WiFi.status() == WL_CONNECTED ? 1 : 0,
+           snapshotHits, snapshotMisses,
            millis() / 1000);
   server.send(200, "text/plain", response);
 }
 
+// /capture with crop/scale/quality arguments
+void handleSnapshot(const SnapshotParams& request) {
+  if (snapshotFrame == NULL) {
+    server.send(503, "application/json", "{\"ok\":false,\"reason\":\"no_snapshot_buffer\"}");
+    return;
+  }
+  if (!refreshSnapshotFrame()) {
+    server.send(500, "text/plain", "Failed to capture frame");
+    return;
+  }
+
+  const char* cacheState = "hit";
+  size_t len = 0;
+  uint8_t* jpeg = snapshotCache.lookup(snapshotSeq, request, len);
+  if (jpeg != NULL) {
+    snapshotHits++;
+  } else {
+    cacheState = "miss";
+    snapshotMisses++;
+    SnapshotParams r = request;
+    if (!r.normalize(snapshotW, snapshotH)) {
+      server.send(400, "application/json", "{\"ok\":false,\"reason\":\"bad_roi\"}");
+      return;
+    }
+    jpeg = encodeSnapshot(r, len);
+    if (jpeg == NULL) {
+      server.send(500, "text/plain", "JPEG conversion failed");
+      return;
+    }
+    snapshotCache.store(snapshotSeq, request, jpeg, len);
+  }
+
+  esp_task_wdt_reset();
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-cache");
+  server.sendHeader("X-Snapshot-Cache", cacheState);
+  server.send_P(200, "image/jpeg", (const char*)jpeg, len);
+  free(jpeg);
+}
+
 void handleCapture() {
   // Prevent concurrent captures that could corrupt state
   if (jpegCaptureInProgress) {
@@ -416,6 +540,13 @@ void handleCapture() {
   // Reset watchdog - capture + JPEG conversion can take a moment
   esp_task_wdt_reset();
 
+  SnapshotParams roi;
+  if (readSnapshotArgs(roi)) {
+    handleSnapshot(roi);
+    jpegCaptureInProgress = false;
+    return;
+  }
+
   Serial.println("[HTTP] /capture request received");
 
   // Capture a fresh RGB565 frame using the existing camera setup
@@ -479,6 +610,7 @@ void handleNotFound() {
   message += "Available endpoints:\n";
   message += "  GET /health  - Health check (no capture)\n";
   message += "  GET /capture - Returns current JPEG frame\n";
+  message += "                ROI: ?x=&y=&w=&h=&out_w=&out_h=&quality= (1-100)\n";
   server.send(404, "text/plain", message);
 }
 
@@ -549,6 +681,12 @@ void setup() {
     }
   }
 
+  // Raw frame for ROI snapshots (/capture?x=&y=&w=&h=...)
+  snapshotFrame = (uint8_t*)ps_malloc(CAMERA_WIDTH * CAMERA_HEIGHT * 2);
+  if (!snapshotFrame) {
+    Serial.println("WARNING: Snapshot buffer allocation failed - ROI capture disabled");
+  }
+
   // Initialize camera with retry
   Serial.print("Initializing camera");
   int cameraRetries = 3;
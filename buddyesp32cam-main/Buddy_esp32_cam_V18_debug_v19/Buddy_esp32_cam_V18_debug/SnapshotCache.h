@@ -0,0 +1,155 @@
+// SnapshotCache.h
+// Region-of-interest snapshots for /capture
+//
+//   /capture?x=&y=&w=&h=&out_w=&out_h=&quality=
+//
+// The crop box is in frame pixels, out_w/out_h scale the crop (one of them
+// keeps the aspect ratio), quality is the re-encode quality (1..100, higher
+// is better — not the sensor's 4..63 scale used by /control).
+//
+// Encoded results are kept in a small LRU keyed by the request and the frame
+// sequence, so identical requests against the same frame (retries, several
+// consumers of one ROI) skip the decode/crop/encode entirely. Entries from an
+// older frame are never served and are evicted first.
+
+#ifndef SNAPSHOT_CACHE_H
+#define SNAPSHOT_CACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SNAPSHOT_CACHE_SLOTS      4
+#define SNAPSHOT_DEFAULT_QUALITY  80
+#define SNAPSHOT_MIN_SIZE         8     // Smallest crop / output edge in pixels
+
+// ════════════════════════════════════════════════════════════════
+// REQUEST PARAMETERS
+// ════════════════════════════════════════════════════════════════
+
+struct SnapshotParams {
+    int x, y, w, h;      // Crop box (w/h 0 = to the frame edge)
+    int outW, outH;      // Output size (0 = crop size / keep aspect)
+    int quality;         // 0 = SNAPSHOT_DEFAULT_QUALITY
+
+    SnapshotParams() : x(0), y(0), w(0), h(0), outW(0), outH(0), quality(0) {}
+
+    bool operator==(const SnapshotParams& o) const {
+        return x == o.x && y == o.y && w == o.w && h == o.h &&
+               outW == o.outW && outH == o.outH && quality == o.quality;
+    }
+
+    // Resolve defaults and clamp against the frame. Returns false if the
+    // request cannot produce an image (box outside the frame, bad quality).
+    bool normalize(int frameW, int frameH) {
+        if (quality == 0) quality = SNAPSHOT_DEFAULT_QUALITY;
+        if (quality < 1 || quality > 100) return false;
+        if (x < 0 || y < 0 || w < 0 || h < 0 || outW < 0 || outH < 0) return false;
+        if (x >= frameW || y >= frameH) return false;
+
+        if (w == 0 || x + w > frameW) w = frameW - x;
+        if (h == 0 || y + h > frameH) h = frameH - y;
+        if (w < SNAPSHOT_MIN_SIZE || h < SNAPSHOT_MIN_SIZE) return false;
+
+        // Output never upscales; a single given edge keeps the aspect ratio
+        if (outW == 0 && outH == 0) { outW = w; outH = h; }
+        else if (outW == 0) outW = (int)((long)w * outH / h);
+        else if (outH == 0) outH = (int)((long)h * outW / w);
+        if (outW > w) outW = w;
+        if (outH > h) outH = h;
+        if (outW < SNAPSHOT_MIN_SIZE) outW = SNAPSHOT_MIN_SIZE;
+        if (outH < SNAPSHOT_MIN_SIZE) outH = SNAPSHOT_MIN_SIZE;
+        return true;
+    }
+
+    // Largest JPEG decode downscale (1, 2, 4, 8) that still has at least
+    // outW x outH pixels inside the crop — decoding at 1/2 or 1/4 is much
+    // cheaper than a full decode followed by a resample.
+    int decodeScale() const {
+        int scale = 8;
+        while (scale > 1 && (w / scale < outW || h / scale < outH)) scale >>= 1;
+        return scale;
+    }
+};
+
+// ════════════════════════════════════════════════════════════════
+// LRU OF ENCODED SNAPSHOTS
+// Not thread-safe — callers serialize (BridgeCore uses the frame lock).
+// ════════════════════════════════════════════════════════════════
+
+class SnapshotCache {
+public:
+    SnapshotCache() : useTick(0) {
+        for (int i = 0; i < SNAPSHOT_CACHE_SLOTS; i++) {
+            slots[i].data = nullptr;
+            slots[i].len = 0;
+        }
+    }
+
+    ~SnapshotCache() { clear(); }
+
+    // Copy of the cached JPEG for (seq, params), nullptr on a miss.
+    // Caller frees the copy with free().
+    uint8_t* lookup(uint32_t seq, const SnapshotParams& params, size_t& len) {
+        for (int i = 0; i < SNAPSHOT_CACHE_SLOTS; i++) {
+            Slot& s = slots[i];
+            if (s.data != nullptr && s.seq == seq && s.params == params) {
+                uint8_t* copy = (uint8_t*)malloc(s.len);
+                if (copy == nullptr) break;
+                memcpy(copy, s.data, s.len);
+                len = s.len;
+                s.lastUse = ++useTick;
+                return copy;
+            }
+        }
+        return nullptr;
+    }
+
+    // Keep a copy of an encoded result. Evicts entries from older frames
+    // first, then the least recently used.
+    void store(uint32_t seq, const SnapshotParams& params, const uint8_t* jpeg, size_t len) {
+        int victim = 0;
+        for (int i = 0; i < SNAPSHOT_CACHE_SLOTS; i++) {
+            Slot& s = slots[i];
+            if (s.data == nullptr) { victim = i; break; }
+            Slot& v = slots[victim];
+            bool staleS = (s.seq != seq), staleV = (v.seq != seq);
+            if ((staleS && !staleV) || (staleS == staleV && s.lastUse < v.lastUse)) victim = i;
+        }
+
+        Slot& s = slots[victim];
+        free(s.data);
+        s.data = (uint8_t*)malloc(len);
+        if (s.data == nullptr) {
+            s.len = 0;
+            return;
+        }
+        memcpy(s.data, jpeg, len);
+        s.len = len;
+        s.seq = seq;
+        s.params = params;
+        s.lastUse = ++useTick;
+    }
+
+    void clear() {
+        for (int i = 0; i < SNAPSHOT_CACHE_SLOTS; i++) {
+            free(slots[i].data);
+            slots[i].data = nullptr;
+            slots[i].len = 0;
+        }
+    }
+
+private:
+    struct Slot {
+        uint32_t seq;
+        SnapshotParams params;   // As requested (pre-normalize) — what clients repeat
+        uint8_t* data;
+        size_t len;
+        uint32_t lastUse;
+    };
+    Slot slots[SNAPSHOT_CACHE_SLOTS];
+    uint32_t useTick;
+};
+
+#endif // SNAPSHOT_CACHE_H